@@ -2,6 +2,7 @@
 
 #include <vector>  //  std::vector
 #include <functional>  //  std::reference_wrapper
+#include <cstddef>  //  std::byte
 
 #include "conditions.h"
 #include "select_constraints.h"
@@ -110,6 +111,22 @@ namespace sqlite_orm {
             }
         };
 
+        /**
+         *  Every value of `in` vector is a node even if the vector itself is a BLOB (e.g. std::vector<uint8_t>).
+         */
+        template<class L, class E>
+        struct ast_iterator<conditions::in_t<L, std::vector<E>>, void> {
+            using node_type = conditions::in_t<L, std::vector<E>>;
+
+            template<class C>
+            void operator()(const node_type &in, const C &l) const {
+                iterate_ast(in.l, l);
+                for(auto &i: in.arg) {
+                    iterate_ast(i, l);
+                }
+            }
+        };
+
         template<class T>
         struct ast_iterator<std::vector<T>, void> {
             using node_type = std::vector<T>;
@@ -132,6 +149,28 @@ namespace sqlite_orm {
             }
         };
 
+        template<>
+        struct ast_iterator<std::vector<unsigned char>, void> {
+            using node_type = std::vector<unsigned char>;
+
+            template<class L>
+            void operator()(const node_type &vec, const L &l) const {
+                l(vec);
+            }
+        };
+
+#ifdef SQLITE_ORM_BYTE_SUPPORTED
+        template<>
+        struct ast_iterator<std::vector<std::byte>, void> {
+            using node_type = std::vector<std::byte>;
+
+            template<class L>
+            void operator()(const node_type &vec, const L &l) const {
+                l(vec);
+            }
+        };
+#endif  //  SQLITE_ORM_BYTE_SUPPORTED
+
         template<class T>
         struct ast_iterator<T, typename std::enable_if<is_base_of_template<T, compound_operator>::value>::type> {
             using node_type = T;
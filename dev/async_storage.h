@@ -0,0 +1,310 @@
+#pragma once
+
+#include <functional>  //  std::function
+#include <future>  //  std::future, std::packaged_task
+#include <memory>  //  std::shared_ptr, std::make_shared, std::unique_ptr
+#include <mutex>  //  std::mutex, std::unique_lock, std::lock_guard
+#include <condition_variable>  //  std::condition_variable
+#include <thread>  //  std::thread
+#include <queue>  //  std::queue
+#include <vector>  //  std::vector
+#include <utility>  //  std::move, std::forward, std::declval
+#include <exception>  //  std::exception_ptr, std::current_exception, std::rethrow_exception
+
+#ifdef SQLITE_ORM_COROUTINES_SUPPORTED
+#include <coroutine>  //  std::coroutine_handle
+#include <optional>  //  std::optional
+#endif  // SQLITE_ORM_COROUTINES_SUPPORTED
+
+#include "prepared_statement.h"
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  Fixed size thread pool. Jobs are executed in order of posting. Destructor executes all posted
+         *  jobs and joins threads.
+         */
+        struct executor {
+            using job_t = std::function<void()>;
+
+            executor(size_t threadsCount) {
+                if(!threadsCount) {
+                    threadsCount = 1;
+                }
+                this->threads.reserve(threadsCount);
+                for(size_t i = 0; i < threadsCount; ++i) {
+                    this->threads.emplace_back([this] {
+                        this->run();
+                    });
+                }
+            }
+
+            executor(const executor &) = delete;
+
+            ~executor() {
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex);
+                    this->stopped = true;
+                }
+                this->condition.notify_all();
+                for(auto &thread: this->threads) {
+                    thread.join();
+                }
+            }
+
+            void post(job_t job) {
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex);
+                    this->jobs.push(std::move(job));
+                }
+                this->condition.notify_one();
+            }
+
+            size_t threads_count() const {
+                return this->threads.size();
+            }
+
+          protected:
+            std::vector<std::thread> threads;
+            std::queue<job_t> jobs;
+            std::mutex mutex;
+            std::condition_variable condition;
+            bool stopped = false;
+
+            void run() {
+                for(;;) {
+                    job_t job;
+                    {
+                        std::unique_lock<std::mutex> lock(this->mutex);
+                        this->condition.wait(lock, [this] {
+                            return this->stopped || !this->jobs.empty();
+                        });
+                        if(this->jobs.empty()) {
+                            return;
+                        }
+                        job = std::move(this->jobs.front());
+                        this->jobs.pop();
+                    }
+                    job();
+                }
+            }
+        };
+
+#ifdef SQLITE_ORM_COROUTINES_SUPPORTED
+        /**
+         *  Awaitable returned by `async_storage::schedule`. Posts a job to the executor when a coroutine
+         *  is suspended and resumes the coroutine on the executor thread once the job is done.
+         */
+        template<class S, class F>
+        struct async_awaitable {
+            using storage_type = S;
+            using result_type = decltype(std::declval<F &>()(std::declval<storage_type &>()));
+
+            async_awaitable(executor &executor_, storage_type &storage_, F job_) :
+                executorRef(executor_), storage(storage_), job(std::move(job_)) {}
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) {
+                this->executorRef.post([this, handle] {
+                    try {
+                        if constexpr(std::is_void<result_type>::value) {
+                            this->job(this->storage);
+                        } else {
+                            this->result.emplace(this->job(this->storage));
+                        }
+                    } catch(...) {
+                        this->exception = std::current_exception();
+                    }
+                    handle.resume();
+                });
+            }
+
+            result_type await_resume() {
+                if(this->exception) {
+                    std::rethrow_exception(this->exception);
+                }
+                if constexpr(!std::is_void<result_type>::value) {
+                    return std::move(*this->result);
+                }
+            }
+
+          protected:
+            using value_type = typename std::conditional<std::is_void<result_type>::value, bool, result_type>::type;
+
+            executor &executorRef;
+            storage_type &storage;
+            F job;
+            std::optional<value_type> result;
+            std::exception_ptr exception;
+        };
+#endif  // SQLITE_ORM_COROUTINES_SUPPORTED
+
+        /**
+         *  Asynchronous facade of a storage. Every call is executed by a dedicated executor thread and
+         *  returns `std::future`. Executor has a single thread by default. More threads make sense only
+         *  if the storage has reader connections (see `pool_options`) so reads are executed in parallel.
+         *  If `SQLITE_ORM_COROUTINES_SUPPORTED` is defined `*_co` functions and `schedule` return awaitables
+         *  which resume a coroutine on the executor thread. Storage must outlive the facade.
+         */
+        template<class S>
+        struct async_storage {
+            using storage_type = S;
+
+            async_storage(storage_type &storage_, size_t threadsCount = 1) :
+                storage(storage_), executorPtr(std::make_unique<executor>(threadsCount)) {}
+
+            /**
+             *  Executes `f(storage)` on the executor.
+             */
+            template<class F>
+            std::future<decltype(std::declval<F &>()(std::declval<storage_type &>()))> submit(F f) {
+                using result_type = decltype(std::declval<F &>()(std::declval<storage_type &>()));
+                auto &storage = this->storage;
+                auto task = std::make_shared<std::packaged_task<result_type()>>([&storage, f]() mutable {
+                    return f(storage);
+                });
+                auto res = task->get_future();
+                this->executorPtr->post([task] {
+                    (*task)();
+                });
+                return res;
+            }
+
+            template<class T, class... Args>
+            std::future<std::vector<T>> get_all_async(Args &&... args) {
+                return this->submit(this->expression_job(sqlite_orm::get_all<T>(std::forward<Args>(args)...)));
+            }
+
+            template<class T, class... Ids>
+            std::future<T> get_async(Ids... ids) {
+                return this->submit(this->expression_job(sqlite_orm::get<T>(std::forward<Ids>(ids)...)));
+            }
+
+            template<class T, class... Ids>
+            std::future<std::unique_ptr<T>> get_pointer_async(Ids... ids) {
+                return this->submit(this->expression_job(sqlite_orm::get_pointer<T>(std::forward<Ids>(ids)...)));
+            }
+
+            template<class O>
+            std::future<int64> insert_async(O o) {
+                return this->submit(this->expression_job(sqlite_orm::insert(std::move(o))));
+            }
+
+            template<class O>
+            std::future<void> replace_async(O o) {
+                return this->submit(this->expression_job(sqlite_orm::replace(std::move(o))));
+            }
+
+            template<class O>
+            std::future<void> update_async(O o) {
+                return this->submit(this->expression_job(sqlite_orm::update(std::move(o))));
+            }
+
+            template<class T, class... Ids>
+            std::future<void> remove_async(Ids... ids) {
+                return this->submit(this->expression_job(sqlite_orm::remove<T>(std::forward<Ids>(ids)...)));
+            }
+
+            /**
+             *  Executes a prepared statement on the executor. Statement is moved into the job cause
+             *  it must not be used by two threads at once.
+             */
+            template<class T>
+            auto execute_async(prepared_statement_t<T> statement) {
+                return this->submit(this->statement_job(std::move(statement)));
+            }
+
+#ifdef SQLITE_ORM_COROUTINES_SUPPORTED
+            /**
+             *  @return awaitable which executes `f(storage)` on the executor.
+             */
+            template<class F>
+            async_awaitable<storage_type, F> schedule(F f) {
+                return {*this->executorPtr, this->storage, std::move(f)};
+            }
+
+            template<class T, class... Args>
+            auto get_all_co(Args &&... args) {
+                return this->schedule(this->expression_job(sqlite_orm::get_all<T>(std::forward<Args>(args)...)));
+            }
+
+            template<class T, class... Ids>
+            auto get_co(Ids... ids) {
+                return this->schedule(this->expression_job(sqlite_orm::get<T>(std::forward<Ids>(ids)...)));
+            }
+
+            template<class T, class... Ids>
+            auto get_pointer_co(Ids... ids) {
+                return this->schedule(this->expression_job(sqlite_orm::get_pointer<T>(std::forward<Ids>(ids)...)));
+            }
+
+            template<class O>
+            auto insert_co(O o) {
+                return this->schedule(this->expression_job(sqlite_orm::insert(std::move(o))));
+            }
+
+            template<class O>
+            auto replace_co(O o) {
+                return this->schedule(this->expression_job(sqlite_orm::replace(std::move(o))));
+            }
+
+            template<class O>
+            auto update_co(O o) {
+                return this->schedule(this->expression_job(sqlite_orm::update(std::move(o))));
+            }
+
+            template<class T, class... Ids>
+            auto remove_co(Ids... ids) {
+                return this->schedule(this->expression_job(sqlite_orm::remove<T>(std::forward<Ids>(ids)...)));
+            }
+
+            template<class T>
+            auto execute_co(prepared_statement_t<T> statement) {
+                return this->schedule(this->statement_job(std::move(statement)));
+            }
+#endif  // SQLITE_ORM_COROUTINES_SUPPORTED
+
+            size_t threads_count() const {
+                return this->executorPtr->threads_count();
+            }
+
+          protected:
+            storage_type &storage;
+            std::unique_ptr<executor> executorPtr;
+
+            /**
+             *  @return job which prepares and executes `expression`.
+             */
+            template<class E>
+            static auto expression_job(E expression) {
+                return [expression](storage_type &storage) {
+                    auto statement = storage.prepare(expression);
+                    return storage.execute(statement);
+                };
+            }
+
+            template<class T>
+            static auto statement_job(prepared_statement_t<T> statement) {
+                auto statementPointer = std::make_shared<prepared_statement_t<T>>(std::move(statement));
+                return [statementPointer](storage_type &storage) {
+                    return storage.execute(*statementPointer);
+                };
+            }
+        };
+    }
+
+    /**
+     *  Creates an asynchronous facade of `storage` with `threadsCount` executor threads.
+     *  Usage: `auto asyncStorage = make_async_storage(storage);
+     *          auto users = asyncStorage.get_all_async<User>().get();`
+     */
+    template<class S>
+    internal::async_storage<S> make_async_storage(S &storage, size_t threadsCount = 1) {
+        return {storage, threadsCount};
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>  //  std::size_t
+
+namespace sqlite_orm {
+
+    /**
+     *  Non owning view of a BLOB value. A view extracted from a statement points into sqlite's column
+     *  buffer so it is valid only until the statement is stepped, reset or finalized.
+     */
+    struct blob_view {
+        using value_type = char;
+        using size_type = std::size_t;
+        using const_iterator = const char *;
+
+        blob_view() = default;
+
+        blob_view(const char *data_, size_type size_) : pointer(data_), length(size_) {}
+
+        const char *data() const {
+            return this->pointer;
+        }
+
+        size_type size() const {
+            return this->length;
+        }
+
+        bool empty() const {
+            return !this->length;
+        }
+
+        const_iterator begin() const {
+            return this->pointer;
+        }
+
+        const_iterator end() const {
+            return this->pointer + this->length;
+        }
+
+        char operator[](size_type index) const {
+            return this->pointer[index];
+        }
+
+      protected:
+        const char *pointer = nullptr;
+        size_type length = 0;
+    };
+}
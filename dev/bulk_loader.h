@@ -0,0 +1,241 @@
+#pragma once
+
+#include <sqlite3.h>
+#include <vector>  //  std::vector
+#include <memory>  //  std::unique_ptr, std::make_unique
+#include <chrono>  //  std::chrono::steady_clock, std::chrono::milliseconds
+#include <utility>  //  std::move
+
+#include "journal_mode.h"
+#include "connection_holder.h"
+#include "prepared_statement.h"
+
+namespace sqlite_orm {
+
+    /**
+     *  Options of a loader created by `storage.bulk_loader<T>(options)`.
+     */
+    struct bulk_loader_options {
+
+        /**
+         *  Max amount of rows inserted by a single INSERT statement. It is decreased if needed
+         *  to fit into SQLITE_LIMIT_VARIABLE_NUMBER.
+         */
+        size_t batch_size = 100;
+
+        /**
+         *  Transaction is committed once this amount of rows is inserted in it. 0 means no limit.
+         */
+        size_t commit_rows = 100000;
+
+        /**
+         *  Transaction is committed once it is opened for this time. It is checked every time a batch
+         *  is inserted. 0 means no limit.
+         */
+        std::chrono::milliseconds commit_interval{0};
+
+        /**
+         *  `PRAGMA synchronous` value used while the loader exists. -1 means the current value is kept.
+         */
+        int synchronous = -1;
+
+        /**
+         *  `PRAGMA journal_mode` value used while the loader exists. Null means the current value is kept.
+         */
+        std::unique_ptr<sqlite_orm::journal_mode> journal_mode;
+    };
+
+    namespace internal {
+
+        /**
+         *  Inserts objects pushed one by one with constant memory usage. Objects are buffered into
+         *  a batch which is inserted with a single `insert_range` statement once it is full. The statement
+         *  for a full batch is prepared once and reused. Rows are inserted inside a transaction which is
+         *  committed according to `bulk_loader_options`. Call `finish` to insert and commit the rest rows.
+         *  Otherwise uncommitted rows are rolled back in destructor just like `transaction_guard_t` does.
+         *  Loader cannot be created inside a transaction cause it commits its own transactions: storage throws
+         *  `orm_error_code::cannot_start_a_transaction_within_a_transaction` then. Loader must be used by
+         *  a single thread.
+         */
+        template<class S, class T>
+        struct bulk_loader_t {
+            using storage_type = S;
+            using object_type = T;
+            using buffer_type = std::vector<object_type>;
+            using statement_type = prepared_statement_t<insert_range_t<typename buffer_type::iterator>>;
+
+            bulk_loader_t(storage_type &storage_,
+                          connection_ref con_,
+                          bulk_loader_options options_,
+                          size_t batchSize_) :
+                storage(storage_), con(std::move(con_)), options(std::move(options_)), batchSize(batchSize_) {
+                auto db = this->con.get();
+                if(this->options.synchronous != -1) {
+                    this->previousSynchronous = this->storage.pragma.synchronous();
+                    this->storage.pragma.set_pragma("synchronous", this->options.synchronous, db);
+                }
+                if(this->options.journal_mode) {
+                    auto previousJournalMode = this->storage.pragma.journal_mode();
+                    this->previousJournalMode = std::make_unique<sqlite_orm::journal_mode>(previousJournalMode);
+                    this->storage.pragma.set_pragma("journal_mode", *this->options.journal_mode, db);
+                }
+                this->buffer.reserve(this->batchSize);
+                this->begin();
+            }
+
+            bulk_loader_t(bulk_loader_t &&other) :
+                storage(other.storage), con(other.con), options(std::move(other.options)),
+                batchSize(other.batchSize), buffer(std::move(other.buffer)), statement(std::move(other.statement)),
+                previousSynchronous(other.previousSynchronous),
+                previousJournalMode(std::move(other.previousJournalMode)), transactionStart(other.transactionStart),
+                rowsInTransaction(other.rowsInTransaction), rowsCount(other.rowsCount),
+                committedRowsCount(other.committedRowsCount), finished(other.finished) {
+                other.finished = true;
+            }
+
+            /**
+             *  Rolls back uncommitted rows and restores pragmas. Errors are ignored: the transaction may be
+             *  rolled back by sqlite already (e.g. SQLITE_FULL or `RAISE(ROLLBACK)` in a trigger).
+             */
+            ~bulk_loader_t() {
+                if(!this->finished) {
+                    this->statement.reset();
+                    try {
+                        this->storage.abort_transaction();
+                    } catch(...) {
+                    }
+                    try {
+                        this->restore_pragmas();
+                    } catch(...) {
+                    }
+                }
+            }
+
+            void push(const object_type &o) {
+                this->buffer.push_back(o);
+                this->on_pushed();
+            }
+
+            void push(object_type &&o) {
+                this->buffer.push_back(std::move(o));
+                this->on_pushed();
+            }
+
+            /**
+             *  Inserts buffered rows without waiting for the batch to be full.
+             */
+            void flush() {
+                this->insert_buffer();
+                auto commitByRows = this->options.commit_rows && this->rowsInTransaction >= this->options.commit_rows;
+                auto elapsed = std::chrono::steady_clock::now() - this->transactionStart;
+                auto commitByTime = this->options.commit_interval.count() && elapsed >= this->options.commit_interval;
+                if(commitByRows || commitByTime) {
+                    this->commit();
+                }
+            }
+
+            /**
+             *  Inserts buffered rows, commits the current transaction and opens a new one.
+             */
+            void commit() {
+                this->insert_buffer();
+                this->storage.commit();
+                this->committedRowsCount += this->rowsInTransaction;
+                this->begin();
+            }
+
+            /**
+             *  Inserts buffered rows, commits them and restores pragmas. Loader cannot be used after this call.
+             */
+            void finish() {
+                this->insert_buffer();
+                this->statement.reset();
+                this->storage.commit();
+                this->committedRowsCount += this->rowsInTransaction;
+                this->rowsInTransaction = 0;
+                this->finished = true;
+                this->restore_pragmas();
+            }
+
+            /**
+             *  @return amount of pushed rows.
+             */
+            size_t rows_count() const {
+                return this->rowsCount;
+            }
+
+            /**
+             *  @return amount of committed rows.
+             */
+            size_t committed_rows_count() const {
+                return this->committedRowsCount;
+            }
+
+            /**
+             *  @return amount of rows inserted by a single statement.
+             */
+            size_t batch_size() const {
+                return this->batchSize;
+            }
+
+          protected:
+            storage_type &storage;
+            connection_ref con;
+            bulk_loader_options options;
+            size_t batchSize = 0;
+            buffer_type buffer;
+            std::unique_ptr<statement_type> statement;
+            int previousSynchronous = -1;
+            std::unique_ptr<sqlite_orm::journal_mode> previousJournalMode;
+            std::chrono::steady_clock::time_point transactionStart;
+            size_t rowsInTransaction = 0;
+            size_t rowsCount = 0;
+            size_t committedRowsCount = 0;
+            bool finished = false;
+
+            void insert_buffer() {
+                if(this->buffer.empty()) {
+                    return;
+                }
+                if(this->buffer.size() == this->batchSize) {
+                    if(!this->statement) {
+                        this->statement = std::make_unique<statement_type>(
+                            this->storage.prepare(insert_range(this->buffer.begin(), this->buffer.end())));
+                    } else {
+                        this->statement->t.range = {this->buffer.begin(), this->buffer.end()};
+                    }
+                    this->storage.execute(*this->statement);
+                } else {
+                    auto partialStatement =
+                        this->storage.prepare(insert_range(this->buffer.begin(), this->buffer.end()));
+                    this->storage.execute(partialStatement);
+                }
+                this->rowsInTransaction += this->buffer.size();
+                this->buffer.clear();
+            }
+
+            void on_pushed() {
+                ++this->rowsCount;
+                if(this->buffer.size() >= this->batchSize) {
+                    this->flush();
+                }
+            }
+
+            void begin() {
+                this->storage.begin_transaction();
+                this->transactionStart = std::chrono::steady_clock::now();
+                this->rowsInTransaction = 0;
+            }
+
+            void restore_pragmas() {
+                auto db = this->con.get();
+                if(this->previousSynchronous != -1) {
+                    this->storage.pragma.set_pragma("synchronous", this->previousSynchronous, db);
+                }
+                if(this->previousJournalMode) {
+                    this->storage.pragma.set_pragma("journal_mode", *this->previousJournalMode, db);
+                }
+            }
+        };
+    }
+}
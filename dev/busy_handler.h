@@ -0,0 +1,203 @@
+#pragma once
+
+#include <sqlite3.h>
+#include <functional>  //  std::function
+#include <memory>  //  std::shared_ptr
+#include <mutex>  //  std::mutex, std::lock_guard
+#include <chrono>  //  std::chrono::steady_clock, std::chrono::microseconds, std::chrono::milliseconds
+#include <thread>  //  std::this_thread::sleep_for, std::this_thread::yield
+#include <random>  //  std::minstd_rand, std::random_device, std::uniform_int_distribution
+#include <algorithm>  //  std::min
+#include <utility>  //  std::move
+
+#include "sqlite_type.h"
+
+namespace sqlite_orm {
+
+    /**
+     *  Decides what to do when a database lock is busy. `wait(attempt, waited)` is called by sqlite
+     *  instead of returning SQLITE_BUSY. `attempt` starts from 0 for every busy event and `waited` is the time
+     *  spent in `wait` during this event so far. `wait` must wait itself and return true to try to take
+     *  the lock again or false to give up so the query fails with SQLITE_BUSY. Set it with
+     *  `storage.busy_handler(policy)`. Use `exponential_backoff_policy` or `spin_then_sleep_policy`
+     *  or a custom callback: `storage.busy_handler({[](int attempt, std::chrono::microseconds waited) {...}})`.
+     */
+    struct busy_handler_policy {
+        std::function<bool(int, std::chrono::microseconds)> wait;
+    };
+
+    /**
+     *  Contention statistics of a single connection collected by its busy handler.
+     */
+    struct busy_handler_stats {
+
+        /**
+         *  Amount of times a lock was busy. Every busy event may contain several attempts.
+         */
+        int64 busy_count = 0;
+
+        /**
+         *  Amount of busy handler calls.
+         */
+        int64 attempts_count = 0;
+
+        /**
+         *  Amount of busy events the handler gave up on so a query failed with SQLITE_BUSY.
+         */
+        int64 timeouts_count = 0;
+
+        std::chrono::microseconds total_wait{0};
+
+        /**
+         *  The longest wait of a single busy event.
+         */
+        std::chrono::microseconds max_wait{0};
+    };
+
+    namespace internal {
+
+        /**
+         *  @return random duration from [0, max]. Generator is thread local so concurrent writers get
+         *  different sequences.
+         */
+        inline std::chrono::microseconds random_duration(std::chrono::microseconds max) {
+            thread_local std::minstd_rand generator(std::random_device{}());
+            std::uniform_int_distribution<long long> distribution(0, max.count());
+            return std::chrono::microseconds(distribution(generator));
+        }
+
+        /**
+         *  @return random delay between a half and a whole of `initialDelay * 2^attempt` but not longer
+         *  than `maxDelay`. Random jitter keeps concurrent writers from retrying at the same moments.
+         */
+        inline std::chrono::microseconds
+        backoff_delay(std::chrono::microseconds initialDelay, std::chrono::microseconds maxDelay, int attempt) {
+            auto delay = initialDelay;
+            for(auto i = 0; i < attempt && delay < maxDelay; ++i) {
+                delay *= 2;
+            }
+            delay = std::min(delay, maxDelay);
+            return delay / 2 + random_duration(delay / 2);
+        }
+
+        /**
+         *  Busy handler of a single connection. Holds a policy shared by all connections of a storage
+         *  and statistics of this connection. `install` must be called for every handle the connection opens.
+         */
+        struct busy_handler_state {
+
+            void set_policy(std::shared_ptr<const busy_handler_policy> policy_) {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->policy = std::move(policy_);
+            }
+
+            bool has_policy() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                return this->policy != nullptr;
+            }
+
+            /**
+             *  Installs the handler into `db` or removes any busy handler from `db` if there is no policy.
+             */
+            void install(sqlite3 *db) {
+                if(this->has_policy()) {
+                    sqlite3_busy_handler(db, busy_callback, this);
+                } else {
+                    sqlite3_busy_handler(db, nullptr, nullptr);
+                }
+            }
+
+            busy_handler_stats stats() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                return this->statistics;
+            }
+
+          protected:
+            std::mutex mutex;
+            std::shared_ptr<const busy_handler_policy> policy;
+            busy_handler_stats statistics;
+            std::chrono::microseconds eventWait{0};
+
+            /**
+             *  Called by sqlite on the thread which waits for a lock. The mutex is not held while the policy
+             *  waits so statistics may be read at the same time.
+             */
+            static int busy_callback(void *data, int attempt) {
+                auto &state = *static_cast<busy_handler_state *>(data);
+                std::shared_ptr<const busy_handler_policy> policy;
+                std::chrono::microseconds waited;
+                {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    policy = state.policy;
+                    if(attempt == 0) {
+                        ++state.statistics.busy_count;
+                        state.eventWait = std::chrono::microseconds(0);
+                    }
+                    ++state.statistics.attempts_count;
+                    waited = state.eventWait;
+                }
+                auto retry = false;
+                auto start = std::chrono::steady_clock::now();
+                if(policy && policy->wait) {
+                    try {
+                        retry = policy->wait(attempt, waited);
+                    } catch(...) {
+                        retry = false;
+                    }
+                }
+                auto elapsed =
+                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+                std::lock_guard<std::mutex> lock(state.mutex);
+                state.eventWait += elapsed;
+                state.statistics.total_wait += elapsed;
+                if(state.eventWait > state.statistics.max_wait) {
+                    state.statistics.max_wait = state.eventWait;
+                }
+                if(!retry) {
+                    ++state.statistics.timeouts_count;
+                }
+                return retry ? 1 : 0;
+            }
+        };
+    }
+
+    /**
+     *  Sleeps for a random time between a half and a whole of `initialDelay * 2^attempt` but not longer than
+     *  `maxDelay` and gives up after `timeout`.
+     */
+    inline busy_handler_policy
+    exponential_backoff_policy(std::chrono::milliseconds timeout,
+                               std::chrono::microseconds initialDelay = std::chrono::microseconds(100),
+                               std::chrono::microseconds maxDelay = std::chrono::microseconds(20000)) {
+        return {[timeout, initialDelay, maxDelay](int attempt, std::chrono::microseconds waited) {
+            if(waited >= timeout) {
+                return false;
+            }
+            auto delay = internal::backoff_delay(initialDelay, maxDelay, attempt);
+            std::this_thread::sleep_for(std::min<std::chrono::microseconds>(delay, timeout - waited));
+            return true;
+        }};
+    }
+
+    /**
+     *  Yields the thread for the first `spins` attempts and then sleeps for `sleep` between attempts.
+     *  Gives up after `timeout`. Short lock holds are caught with a low latency without burning a core
+     *  on long ones.
+     */
+    inline busy_handler_policy
+    spin_then_sleep_policy(std::chrono::milliseconds timeout,
+                           int spins = 100,
+                           std::chrono::microseconds sleep = std::chrono::microseconds(1000)) {
+        return {[timeout, spins, sleep](int attempt, std::chrono::microseconds waited) {
+            if(waited >= timeout) {
+                return false;
+            }
+            if(attempt < spins) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::min<std::chrono::microseconds>(sleep, timeout - waited));
+            }
+            return true;
+        }};
+    }
+}
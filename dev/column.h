@@ -3,7 +3,7 @@
 #include <tuple>  //  std::tuple
 #include <string>  //  std::string
 #include <memory>  //  std::unique_ptr
-#include <type_traits>  //  std::true_type, std::false_type, std::is_same, std::enable_if, std::is_member_pointer, std::is_member_function_pointer
+#include <type_traits>  //  std::true_type, std::false_type, std::is_same, std::enable_if, std::is_member_pointer, std::is_member_function_pointer, std::remove_const
 
 #include "type_is_nullable.h"
 #include "tuple_helper.h"
@@ -22,20 +22,36 @@ namespace sqlite_orm {
             const std::string name;
         };
 
+        /**
+         *  Column access tags. A column created with a member pointer reads and writes `member_pointer`
+         *  (`field_access`), a column created with getter and setter calls `getter` and `setter`
+         *  (`getter_setter_access`). The tag is a part of column's type so row loops are specialized for it
+         *  at compile time instead of checking `member_pointer` for every row.
+         */
+        struct field_access {};
+        struct getter_setter_access {};
+
         /**
          *  This class stores single column info. column_t is a pair of [column_name:member_pointer] mapped to a storage
          *  O is a mapped class, e.g. User
-         *  T is a mapped class'es field type, e.g. &User::name
+         *  T is a mapped class'es field type, e.g. &User::name. May be const if the table has a constructor element
+         *  A is an access tag: field_access or getter_setter_access
          *  Op... is a constraints pack, e.g. primary_key_t, autoincrement_t etc
          */
-        template<class O, class T, class G /* = const T& (O::*)() const*/, class S /* = void (O::*)(T)*/, class... Op>
+        template<class O,
+                 class T,
+                 class G /* = const T& (O::*)() const*/,
+                 class S /* = void (O::*)(T)*/,
+                 class A /* = field_access*/,
+                 class... Op>
         struct column_t : column_base {
             using object_type = O;
-            using field_type = T;
+            using field_type = typename std::remove_const<T>::type;
             using constraints_type = std::tuple<Op...>;
-            using member_pointer_t = field_type object_type::*;
+            using member_pointer_t = T object_type::*;
             using getter_type = G;
             using setter_type = S;
+            using access_type = A;
 
             /**
              *  Member pointer used to read/write member
@@ -276,7 +292,7 @@ namespace sqlite_orm {
              class T,
              typename = typename std::enable_if<!std::is_member_function_pointer<T O::*>::value>::type,
              class... Op>
-    internal::column_t<O, T, const T &(O::*)() const, void (O::*)(T), Op...>
+    internal::column_t<O, T, const T &(O::*)() const, void (O::*)(T), internal::field_access, Op...>
     make_column(const std::string &name, T O::*m, Op... constraints) {
         static_assert(constraints::constraints_size<Op...>::value == std::tuple_size<std::tuple<Op...>>::value,
                       "Incorrect constraints pack");
@@ -295,6 +311,7 @@ namespace sqlite_orm {
                        typename internal::setter_traits<S>::field_type,
                        G,
                        S,
+                       internal::getter_setter_access,
                        Op...>
     make_column(const std::string &name, S setter, G getter, Op... constraints) {
         static_assert(std::is_same<typename internal::setter_traits<S>::field_type,
@@ -318,6 +335,7 @@ namespace sqlite_orm {
                        typename internal::setter_traits<S>::field_type,
                        G,
                        S,
+                       internal::getter_setter_access,
                        Op...>
     make_column(const std::string &name, G getter, S setter, Op... constraints) {
         static_assert(std::is_same<typename internal::setter_traits<S>::field_type,
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <type_traits>  //  std::enable_if, std::is_same, std::decay
+#include <type_traits>  //  std::enable_if, std::is_same, std::decay, std::remove_const
 #include <tuple>  //  std::tuple
 #include <functional>  //  std::reference_wrapper
 
@@ -34,7 +34,7 @@ namespace sqlite_orm {
                                F O::*,
                                typename std::enable_if<std::is_member_pointer<F O::*>::value &&
                                                        !std::is_member_function_pointer<F O::*>::value>::type> {
-            using type = F;
+            using type = typename std::remove_const<F>::type;
         };
 
         /**
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <sqlite3.h>
+#include <vector>  //  std::vector
+#include <tuple>  //  std::tuple, std::get, std::tuple_size, std::tuple_element
+#include <memory>  //  std::shared_ptr, std::unique_ptr
+#include <cstdint>  //  std::uint64_t
+#include <utility>  //  std::index_sequence, std::make_index_sequence
+#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
+#include <optional>  // std::optional
+#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+
+#include "row_extractor.h"
+#include "column_result.h"
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  Tells how a column of type `T` is stored in a `columnar_column`. Nullable types (`std::shared_ptr`,
+         *  `std::unique_ptr` and `std::optional`) are stored as plain values plus a null bitmap.
+         */
+        template<class T>
+        struct columnar_traits {
+            using value_type = T;
+            static constexpr bool is_nullable = false;
+        };
+
+        template<class T>
+        struct columnar_traits<std::shared_ptr<T>> {
+            using value_type = T;
+            static constexpr bool is_nullable = true;
+        };
+
+        template<class T>
+        struct columnar_traits<std::unique_ptr<T>> {
+            using value_type = T;
+            static constexpr bool is_nullable = true;
+        };
+
+#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
+        template<class T>
+        struct columnar_traits<std::optional<T>> {
+            using value_type = T;
+            static constexpr bool is_nullable = true;
+        };
+#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+
+        /**
+         *  Values of a single result column stored contiguously. If the column type is nullable `null_bitmap`
+         *  has a bit for every row (bit `i % 64` of word `i / 64`) which is set if the row value is NULL.
+         *  Value of a NULL row is default constructed. For not nullable columns `null_bitmap` is empty.
+         */
+        template<class T>
+        struct columnar_column {
+            using traits = columnar_traits<T>;
+            using value_type = typename traits::value_type;
+
+            std::vector<value_type> values;
+            std::vector<std::uint64_t> null_bitmap;
+
+            size_t size() const {
+                return this->values.size();
+            }
+
+            bool is_null(size_t index) const {
+                if(traits::is_nullable) {
+                    return (this->null_bitmap[index / 64] >> (index % 64)) & 1;
+                } else {
+                    return false;
+                }
+            }
+
+            void reserve(size_t n) {
+                this->values.reserve(n);
+                if(traits::is_nullable) {
+                    this->null_bitmap.reserve((n + 63) / 64);
+                }
+            }
+
+            void clear() {
+                this->values.clear();
+                this->null_bitmap.clear();
+            }
+
+            void push_back(sqlite3_stmt *stmt, int columnIndex) {
+                auto index = this->values.size();
+                if(traits::is_nullable) {
+                    if(index % 64 == 0) {
+                        this->null_bitmap.push_back(0);
+                    }
+                    if(sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
+                        this->null_bitmap.back() |= std::uint64_t(1) << (index % 64);
+                        this->values.emplace_back();
+                        return;
+                    }
+                }
+                this->values.push_back(row_extractor<value_type>().extract(stmt, columnIndex));
+            }
+        };
+
+        /**
+         *  Struct-of-arrays result of `storage.select_columns(columns(...), ...)`. Every selected column
+         *  is stored in its own `columnar_column` so its values are contiguous in memory.
+         *  Usage: `auto res = storage.select_columns(columns(&User::id, &User::age));
+         *          const std::vector<int> &ages = res.values<1>();`
+         */
+        template<class... Ts>
+        struct columnar_result {
+            using columns_type = std::tuple<columnar_column<Ts>...>;
+
+            static constexpr const int count = std::tuple_size<columns_type>::value;
+
+            columns_type columns;
+
+            template<size_t I>
+            typename std::tuple_element<I, columns_type>::type &column() {
+                return std::get<I>(this->columns);
+            }
+
+            template<size_t I>
+            const typename std::tuple_element<I, columns_type>::type &column() const {
+                return std::get<I>(this->columns);
+            }
+
+            template<size_t I>
+            const auto &values() const {
+                return std::get<I>(this->columns).values;
+            }
+
+            /**
+             *  @return amount of rows.
+             */
+            size_t size() const {
+                return std::get<0>(this->columns).size();
+            }
+
+            bool empty() const {
+                return !this->size();
+            }
+
+            void reserve(size_t n) {
+                this->for_each_column([n](auto &column) {
+                    column.reserve(n);
+                });
+            }
+
+            void clear() {
+                this->for_each_column([](auto &column) {
+                    column.clear();
+                });
+            }
+
+            /**
+             *  Appends the current row of `stmt`. Column `i` of the statement is appended to column `i`.
+             */
+            void push_back(sqlite3_stmt *stmt) {
+                auto index = 0;
+                this->for_each_column([stmt, &index](auto &column) {
+                    column.push_back(stmt, index++);
+                });
+            }
+
+          protected:
+            template<class L>
+            void for_each_column(const L &l) {
+                this->for_each_column(l, std::make_index_sequence<count>{});
+            }
+
+            template<class L, size_t... Is>
+            void for_each_column(const L &l, std::index_sequence<Is...>) {
+                using expander = int[];
+                (void)expander{0, (l(std::get<Is>(this->columns)), 0)...};
+            }
+        };
+
+        template<class T>
+        struct columnar_result_type;
+
+        template<class... Ts>
+        struct columnar_result_type<std::tuple<Ts...>> {
+            using type = columnar_result<Ts...>;
+        };
+
+        /**
+         *  `columnar_result` type of columns `C` selected from storage `St`.
+         */
+        template<class St, class C>
+        using columnar_result_t = typename columnar_result_type<typename column_result_t<St, C>::type>::type;
+    }
+}
@@ -3,39 +3,164 @@
 #include <sqlite3.h>
 #include <string>  //  std::string
 #include <system_error>  //  std::system_error
+#include <functional>  //  std::function
+#include <mutex>  //  std::recursive_mutex, std::lock_guard, std::unique_lock
+#include <condition_variable>  //  std::condition_variable_any
+#include <thread>  //  std::thread
+#include <chrono>  //  std::chrono::steady_clock, std::chrono::milliseconds
+#include <atomic>  //  std::atomic_int, std::atomic
+#include <memory>  //  std::shared_ptr
+#include <utility>  //  std::move
 
 #include "error_code.h"
+#include "statement_cache.h"
+#include "sqlite_type.h"
+#include "open_options.h"
+#include "busy_handler.h"
 
 namespace sqlite_orm {
 
+    /**
+     *  Defines when a database connection is closed after it is no longer used by any call.
+     *  Set it with `storage.set_connection_lifetime`.
+     */
+    enum class connection_lifetime {
+
+        /**
+         *  Connection is closed right after the last user releases it. Every call made outside of
+         *  a transaction opens the database again. This is the default.
+         */
+        per_call,
+
+        /**
+         *  Connection is kept open while it is used at least once per idle timeout. It is closed by
+         *  a background thread once it is not used for the idle timeout.
+         */
+        idle_timeout,
+
+        /**
+         *  Connection is opened on its first use and kept open until the storage is destroyed.
+         */
+        always_open,
+    };
+
     namespace internal {
 
+        /**
+         *  Owns a single `sqlite3*` handle. The handle is opened by the first `retain` call. It is closed
+         *  when the last `release` call happens according to the `connection_lifetime` policy. `on_after_open`
+         *  is fired right after the handle is opened and before any other thread can obtain it.
+         *  Retain and release are thread-safe.
+         */
         struct connection_holder {
+            using on_after_open_t = std::function<void(sqlite3 *)>;
+
+            connection_holder(std::string filename_, on_after_open_t on_after_open_ = {}, open_options options_ = {}) :
+                filename(move(filename_)), options(std::move(options_)), on_after_open(move(on_after_open_)) {}
+
+            connection_holder(const connection_holder &) = delete;
 
-            connection_holder(std::string filename_) : filename(move(filename_)) {}
+            ~connection_holder() {
+                {
+                    std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                    this->stopped = true;
+                }
+                this->condition.notify_all();
+                if(this->idleThread.joinable()) {
+                    this->idleThread.join();
+                }
+                if(this->db) {
+                    this->cache.clear();
+                    this->control.clear();
+                    sqlite3_close(this->db);
+                }
+            }
 
             void retain() {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
                 ++this->_retain_count;
-                if(1 == this->_retain_count) {
-                    auto rc = sqlite3_open(this->filename.c_str(), &this->db);
+                if(1 == this->_retain_count && !this->db) {
+                    auto openFilename = open_filename(this->filename, this->options);
+                    auto vfs = this->options.vfs.empty() ? nullptr : this->options.vfs.c_str();
+                    auto rc = sqlite3_open_v2(openFilename.c_str(), &this->db, open_flags(this->options), vfs);
                     if(rc != SQLITE_OK) {
-                        throw std::system_error(std::error_code(sqlite3_errcode(this->db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(this->db));
+                        --this->_retain_count;
+                        std::error_code errorCode(sqlite3_errcode(this->db), get_sqlite_error_category());
+                        std::string message = sqlite3_errmsg(this->db);
+                        sqlite3_close(this->db);
+                        this->db = nullptr;
+                        throw std::system_error(errorCode, message);
+                    }
+                    ++this->opensCount;
+                    try {
+                        if(this->on_after_open) {
+                            this->on_after_open(this->db);
+                        }
+                        if(this->busyHandler.has_policy()) {
+                            this->busyHandler.install(this->db);
+                        }
+                    } catch(...) {
+                        //  close the handle so the next retain opens it again and calls `on_after_open`
+                        --this->_retain_count;
+                        this->cache.clear();
+                        this->control.clear();
+                        sqlite3_close(this->db);
+                        this->db = nullptr;
+                        throw;
                     }
                 }
             }
 
             void release() {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
                 --this->_retain_count;
                 if(0 == this->_retain_count) {
-                    auto rc = sqlite3_close(this->db);
-                    if(rc != SQLITE_OK) {
-                        throw std::system_error(std::error_code(sqlite3_errcode(this->db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(this->db));
+                    switch(this->lifetime) {
+                        case connection_lifetime::per_call:
+                            this->close();
+                            break;
+                        case connection_lifetime::idle_timeout:
+                            this->lastReleaseTime = std::chrono::steady_clock::now();
+                            if(this->idleThreadWaitsForRelease) {
+                                this->condition.notify_all();
+                            }
+                            break;
+                        case connection_lifetime::always_open:
+                            break;
                     }
                 }
             }
 
+            /**
+             *  Changes the lifetime policy. If the connection is open and not used at the moment it is closed
+             *  according to the new policy. `idleTimeout` is used by `connection_lifetime::idle_timeout` only.
+             */
+            void set_lifetime(connection_lifetime lifetime_, std::chrono::milliseconds idleTimeout_) {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                this->lifetime = lifetime_;
+                this->idleTimeout = idleTimeout_;
+                if(0 == this->_retain_count) {
+                    this->lastReleaseTime = std::chrono::steady_clock::now();
+                    if(this->lifetime == connection_lifetime::per_call) {
+                        this->close();
+                    }
+                }
+                if(this->lifetime == connection_lifetime::idle_timeout && !this->idleThread.joinable()) {
+                    this->idleThread = std::thread([this] {
+                        this->close_idle();
+                    });
+                }
+                this->condition.notify_all();
+            }
+
+            connection_lifetime get_lifetime() const {
+                return this->lifetime;
+            }
+
+            std::chrono::milliseconds get_idle_timeout() const {
+                return this->idleTimeout;
+            }
+
             sqlite3 *get() const {
                 return this->db;
             }
@@ -44,11 +169,123 @@ namespace sqlite_orm {
                 return this->_retain_count;
             }
 
+            /**
+             *  @return true if the handle is open. It may be open while nobody retains it
+             *  if lifetime policy is not `connection_lifetime::per_call`.
+             */
+            bool is_open() {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                return this->db != nullptr;
+            }
+
+            /**
+             *  Sets a busy handler policy shared by connections of a storage. It is installed right now
+             *  if the handle is open and every time the handle is opened after `on_after_open` so it replaces
+             *  a busy timeout set there. Null policy removes the handler.
+             */
+            void set_busy_handler(std::shared_ptr<const busy_handler_policy> policy) {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                this->busyHandler.set_policy(std::move(policy));
+                if(this->db) {
+                    this->busyHandler.install(this->db);
+                }
+            }
+
+            /**
+             *  @return contention statistics collected by the busy handler of this connection.
+             */
+            busy_handler_stats busy_stats() {
+                return this->busyHandler.stats();
+            }
+
+            /**
+             *  @return amount of times the handle has been opened.
+             */
+            int64 opens_count() const {
+                return this->opensCount;
+            }
+
+            /**
+             *  @return amount of times the handle has been closed.
+             */
+            int64 closes_count() const {
+                return this->closesCount;
+            }
+
             const std::string filename;
 
+            /**
+             *  Arguments of `sqlite3_open_v2`.
+             */
+            const open_options options;
+
+            /**
+             *  Statements cached for this connection. Cleared right before the connection is closed.
+             */
+            statement_cache cache;
+
+            /**
+             *  `BEGIN`, `COMMIT` and `ROLLBACK` statements of this connection. Cleared right before the connection
+             *  is closed.
+             */
+            control_statements control;
+
           protected:
+            on_after_open_t on_after_open;
             sqlite3 *db = nullptr;
-            int _retain_count = 0;
+            std::atomic_int _retain_count{0};
+            std::recursive_mutex mutex;
+            connection_lifetime lifetime = connection_lifetime::per_call;
+            std::chrono::milliseconds idleTimeout{0};
+            std::chrono::steady_clock::time_point lastReleaseTime;
+            std::condition_variable_any condition;
+            std::thread idleThread;
+            bool idleThreadWaitsForRelease = false;
+            bool stopped = false;
+            std::atomic<int64> opensCount{0};
+            std::atomic<int64> closesCount{0};
+            busy_handler_state busyHandler;
+
+            void close() {
+                if(!this->db) {
+                    return;
+                }
+                this->cache.clear();
+                this->control.clear();
+                auto rc = sqlite3_close(this->db);
+                if(rc != SQLITE_OK) {
+                    throw std::system_error(std::error_code(sqlite3_errcode(this->db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(this->db));
+                }
+                this->db = nullptr;
+                ++this->closesCount;
+            }
+
+            /**
+             *  Body of the idle thread. Closes the handle once it is not retained for `idleTimeout`.
+             *  While it waits for a close time `release` doesn't wake it up: a newer release time is
+             *  noticed when the wait expires.
+             */
+            void close_idle() {
+                std::unique_lock<std::recursive_mutex> lock(this->mutex);
+                while(!this->stopped) {
+                    if(this->lifetime == connection_lifetime::idle_timeout && this->db && 0 == this->_retain_count) {
+                        auto closeTime = this->lastReleaseTime + this->idleTimeout;
+                        if(std::chrono::steady_clock::now() >= closeTime) {
+                            try {
+                                this->close();
+                            } catch(...) {
+                            }
+                        } else {
+                            this->condition.wait_until(lock, closeTime);
+                        }
+                    } else {
+                        this->idleThreadWaitsForRelease = true;
+                        this->condition.wait(lock);
+                        this->idleThreadWaitsForRelease = false;
+                    }
+                }
+            }
         };
 
         struct connection_ref {
@@ -72,6 +309,14 @@ namespace sqlite_orm {
                 return this->holder.get();
             }
 
+            statement_cache &cache() const {
+                return this->holder.cache;
+            }
+
+            control_statements &control() const {
+                return this->holder.control;
+            }
+
           protected:
             connection_holder &holder;
         };
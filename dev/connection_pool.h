@@ -0,0 +1,165 @@
+#pragma once
+
+#include <sqlite3.h>
+#include <string>  //  std::string
+#include <vector>  //  std::vector
+#include <memory>  //  std::unique_ptr, std::make_unique, std::shared_ptr
+#include <mutex>  //  std::recursive_mutex, std::lock_guard
+
+#include "connection_holder.h"
+
+namespace sqlite_orm {
+
+    /**
+     *  Options of a pooled storage. Pass it to `make_storage` right after the filename.
+     *  `readers` is an amount of additional read-only connections used by SELECT-like queries
+     *  (`get`, `get_all`, `select`, `iterate`, `count` etc) so they can run in parallel from different threads
+     *  while one connection is used for writes. Makes sense only with `journal_mode::WAL`.
+     *  Ignored for in-memory databases cause every connection to `:memory:` is a separate database.
+     */
+    struct pool_options {
+        int readers = 0;
+    };
+
+    namespace internal {
+
+        /**
+         *  Set of reader connections to the same database file. Reader is opened lazily on its first
+         *  acquire and kept open until the pool is destroyed. `acquire_reader` returns a reader that is not used
+         *  by anybody at the moment if there is one. Otherwise the least busy reader is shared
+         *  (sqlite serializes access to a shared handle itself).
+         */
+        struct connection_pool {
+
+            connection_pool(const std::string &filename,
+                            pool_options options_,
+                            connection_holder::on_after_open_t f,
+                            const open_options &openOptions = {}) :
+                options(options_) {
+                this->readers.reserve(size_t(this->options.readers));
+                for(auto i = 0; i < this->options.readers; ++i) {
+                    this->readers.push_back(std::make_unique<connection_holder>(filename, f, openOptions));
+                }
+                this->opened.resize(this->readers.size(), false);
+            }
+
+            connection_pool(const connection_pool &) = delete;
+
+            ~connection_pool() {
+                for(size_t i = 0; i < this->readers.size(); ++i) {
+                    if(this->opened[i]) {
+                        this->readers[i]->release();
+                    }
+                }
+            }
+
+            connection_ref acquire_reader() {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                size_t bestIndex = 0;
+                auto bestUsers = -1;
+                for(size_t i = 0; i < this->readers.size(); ++i) {
+                    auto users = this->users(i);
+                    if(bestUsers == -1 || users < bestUsers ||
+                       (users == bestUsers && this->opened[i] && !this->opened[bestIndex])) {
+                        bestIndex = i;
+                        bestUsers = users;
+                    }
+                }
+                auto &reader = *this->readers[bestIndex];
+                if(!this->opened[bestIndex]) {
+                    reader.retain();
+                    this->opened[bestIndex] = true;
+                }
+                return {reader};
+            }
+
+            /**
+             *  @return amount of readers opened at the moment.
+             */
+            int opened_readers_count() {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                auto res = 0;
+                for(auto value: this->opened) {
+                    if(value) {
+                        ++res;
+                    }
+                }
+                return res;
+            }
+
+            /**
+             *  Calls `f(db)` for every opened reader.
+             */
+            template<class F>
+            void for_each_opened_reader(const F &f) {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                for(size_t i = 0; i < this->readers.size(); ++i) {
+                    if(this->opened[i]) {
+                        f(this->readers[i]->get());
+                    }
+                }
+            }
+
+            int64 opens_count() const {
+                int64 res = 0;
+                for(auto &reader: this->readers) {
+                    res += reader->opens_count();
+                }
+                return res;
+            }
+
+            int64 closes_count() const {
+                int64 res = 0;
+                for(auto &reader: this->readers) {
+                    res += reader->closes_count();
+                }
+                return res;
+            }
+
+            void set_busy_handler(const std::shared_ptr<const busy_handler_policy> &policy) {
+                for(auto &reader: this->readers) {
+                    reader->set_busy_handler(policy);
+                }
+            }
+
+            /**
+             *  @return sum of busy handler statistics of all readers. `max_wait` is the max of all readers.
+             */
+            busy_handler_stats busy_stats() {
+                busy_handler_stats res;
+                for(auto &reader: this->readers) {
+                    auto stats = reader->busy_stats();
+                    res.busy_count += stats.busy_count;
+                    res.attempts_count += stats.attempts_count;
+                    res.timeouts_count += stats.timeouts_count;
+                    res.total_wait += stats.total_wait;
+                    if(stats.max_wait > res.max_wait) {
+                        res.max_wait = stats.max_wait;
+                    }
+                }
+                return res;
+            }
+
+            void clear_caches() {
+                for(auto &reader: this->readers) {
+                    reader->cache.clear();
+                }
+            }
+
+            const pool_options options;
+
+          protected:
+            std::vector<std::unique_ptr<connection_holder>> readers;
+            std::vector<bool> opened;
+            std::recursive_mutex mutex;
+
+            int users(size_t index) const {
+                auto res = this->readers[index]->retain_count();
+                if(this->opened[index]) {
+                    --res;
+                }
+                return res;
+            }
+        };
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <tuple>  //  std::tuple
+#include <type_traits>  //  std::false_type, std::true_type
+#include <utility>  //  std::move
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  Table element which tells storage how to create objects of the mapped class. By default an object is
+         *  default constructed and every column value is assigned to it. With this element the object is created
+         *  from all column values passed in columns order: `O(values...)` if F is void or `factory(values...)`
+         *  otherwise. So the mapped class doesn't need a default constructor and may have const members.
+         *  Must be placed after columns like table constraints. `stream` cursors reuse their objects so they still
+         *  require a default constructible class with assignable fields.
+         */
+        template<class F>
+        struct constructor_t {
+            using field_type = void;  //  for column iteration
+            using constraints_type = std::tuple<>;
+
+            F factory;
+        };
+
+        template<>
+        struct constructor_t<void> {
+            using field_type = void;  //  for column iteration
+            using constraints_type = std::tuple<>;
+        };
+
+        template<class T>
+        struct is_constructor : std::false_type {};
+
+        template<class F>
+        struct is_constructor<constructor_t<F>> : std::true_type {};
+    }
+
+    /**
+     *  Makes storage create objects with a constructor which accepts values of all columns in columns order:
+     *  `make_table("points", make_column("x", &Point::x), make_column("y", &Point::y), constructor())`
+     *  creates points with `Point(x, y)`.
+     */
+    inline internal::constructor_t<void> constructor() {
+        return {};
+    }
+
+    /**
+     *  Makes storage create objects with `f(values...)` where values are values of all columns in columns order.
+     *  `f` must return the mapped object by value. Useful for aggregates and named constructors.
+     */
+    template<class F>
+    internal::constructor_t<F> factory(F f) {
+        return {std::move(f)};
+    }
+}
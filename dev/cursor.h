@@ -0,0 +1,132 @@
+#pragma once
+
+#include <sqlite3.h>
+#include <type_traits>  //  std::decay
+#include <system_error>  //  std::system_error
+#include <vector>  //  std::vector
+#include <utility>  //  std::move
+
+#include "row_extractor.h"
+#include "field_value_holder.h"
+#include "error_code.h"
+#include "prepared_statement.h"
+#include "ast_iterator.h"
+#include "statement_binder.h"
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  Forward only cursor created by `storage.stream<T>(conditions...)`. Unlike `iterate` it doesn't
+         *  allocate an object per row: every row is extracted into a single object owned by the cursor
+         *  or into elements of a caller provided vector. Strings and blobs are assigned in place so scanning
+         *  a table doesn't allocate once buffers have grown enough. Cursor owns its prepared statement so
+         *  it must be used by a single thread and must not outlive the storage.
+         */
+        template<class S, class T, class... Args>
+        struct cursor_t {
+            using storage_type = S;
+            using object_type = T;
+            using statement_type = prepared_statement_t<get_all_t<T, Args...>>;
+
+            cursor_t(storage_type &storage_, statement_type statement_) :
+                storage(storage_), statement(std::move(statement_)) {
+                auto db = this->statement.con.get();
+                auto stmt = this->statement.stmt;
+                auto index = 1;
+                sqlite3_reset(stmt);
+                iterate_ast(this->statement.t, [stmt, &index, db](auto &node) {
+                    using node_type = typename std::decay<decltype(node)>::type;
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                    if(SQLITE_OK != binder(node)) {
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
+                    }
+                });
+            }
+
+            cursor_t(cursor_t &&) = default;
+
+            /**
+             *  Steps to the next row and extracts it into `current()`.
+             *  @return false if there are no more rows.
+             */
+            bool next() {
+                if(!this->step()) {
+                    return false;
+                }
+                this->extract(this->object);
+                return true;
+            }
+
+            /**
+             *  Extracts up to `n` next rows into `rows`. Existing elements of `rows` are overwritten so
+             *  their buffers are reused, new elements are appended only if `rows` is shorter than the amount
+             *  of extracted rows. `rows` is resized to the amount of extracted rows.
+             *  @return amount of extracted rows. 0 means there are no more rows.
+             */
+            size_t next(std::vector<object_type> &rows, size_t n) {
+                size_t count = 0;
+                while(count < n && this->step()) {
+                    if(count == rows.size()) {
+                        rows.emplace_back();
+                    }
+                    this->extract(rows[count]);
+                    ++count;
+                }
+                rows.resize(count);
+                return count;
+            }
+
+            /**
+             *  @return object extracted by the last successful `next()` call.
+             */
+            object_type &current() {
+                return this->object;
+            }
+
+            /**
+             *  @return true if all rows have been stepped.
+             */
+            bool done() const {
+                return this->isDone;
+            }
+
+          protected:
+            storage_type &storage;
+            statement_type statement;
+            object_type object;
+            bool isDone = false;
+
+            bool step() {
+                if(this->isDone) {
+                    return false;
+                }
+                auto stmt = this->statement.stmt;
+                auto stepRes = sqlite3_step(stmt);
+                switch(stepRes) {
+                    case SQLITE_ROW:
+                        return true;
+                    case SQLITE_DONE:
+                        this->isDone = true;
+                        return false;
+                    default: {
+                        auto db = this->statement.con.get();
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
+                    }
+                }
+            }
+
+            void extract(object_type &o) {
+                auto &impl = this->storage.template get_impl<object_type>();
+                auto stmt = this->statement.stmt;
+                auto index = 0;
+                impl.table.for_each_column([&index, &o, stmt](auto &c) {
+                    extract_column_value(c, o, stmt, index++);
+                });
+            }
+        };
+    }
+}
@@ -21,6 +21,8 @@ namespace sqlite_orm {
         incorrect_journal_mode_string,
         invalid_collate_argument_enum,
         failed_to_init_a_backup,
+        write_queue_is_not_started,
+        incorrect_locking_mode_string,
     };
 
 }
@@ -57,6 +59,10 @@ namespace sqlite_orm {
                     return "Invalid collate_argument enum";
                 case orm_error_code::failed_to_init_a_backup:
                     return "Failed to init a backup";
+                case orm_error_code::write_queue_is_not_started:
+                    return "Write queue is not started";
+                case orm_error_code::incorrect_locking_mode_string:
+                    return "Incorrect locking mode string";
                 default:
                     return "unknown error";
             }
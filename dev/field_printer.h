@@ -1,6 +1,6 @@
 #pragma once
 
-#include <string>  //  std::string
+#include <string>  //  std::string, std::wstring, std::u16string
 #include <sstream>  //  std::stringstream
 #include <vector>  //  std::vector
 #include <cstddef>  //  std::nullptr_t
@@ -9,6 +9,8 @@
 #include <optional>  // std::optional
 #endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
 
+#include "utf_converter.h"
+
 namespace sqlite_orm {
 
     /**
@@ -67,6 +69,20 @@ namespace sqlite_orm {
         }
     };
 
+    template<>
+    struct field_printer<std::wstring> {
+        std::string operator()(const std::wstring &t) const {
+            return internal::utf_converter::to_utf8(t.data(), t.size());
+        }
+    };
+
+    template<>
+    struct field_printer<std::u16string> {
+        std::string operator()(const std::u16string &t) const {
+            return internal::utf_converter::to_utf8(t.data(), t.size());
+        }
+    };
+
     template<>
     struct field_printer<std::vector<char>> {
         std::string operator()(const std::vector<char> &t) const {
@@ -79,6 +95,18 @@ namespace sqlite_orm {
         }
     };
 
+    template<>
+    struct field_printer<std::vector<unsigned char>> {
+        std::string operator()(const std::vector<unsigned char> &t) const {
+            std::stringstream ss;
+            ss << std::hex;
+            for(auto c: t) {
+                ss << int(c);
+            }
+            return ss.str();
+        }
+    };
+
     template<>
     struct field_printer<std::nullptr_t> {
         std::string operator()(const std::nullptr_t &) const {
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <sqlite3.h>
 #include <type_traits>  //  std::enable_if
 
 #include "column.h"
+#include "row_extractor.h"
 
 namespace sqlite_orm {
     namespace internal {
@@ -15,6 +17,13 @@ namespace sqlite_orm {
             using type = typename getter_traits<T>::field_type;
 
             const type &value;
+
+            /**
+             *  `value` refers to the object's field so it may be bound without copying.
+             */
+            static sqlite3_destructor_type destructor() {
+                return SQLITE_STATIC;
+            }
         };
 
         template<class T>
@@ -22,6 +31,50 @@ namespace sqlite_orm {
             using type = typename getter_traits<T>::field_type;
 
             type value;
+
+            /**
+             *  `value` is destroyed before the statement is executed so sqlite must copy it.
+             */
+            static sqlite3_destructor_type destructor() {
+                return SQLITE_TRANSIENT;
+            }
         };
+
+        /**
+         *  Calls `f(value, destructor)` with the value of column `c` of object `o`. `destructor` tells sqlite
+         *  whether `value` outlives the statement execution (`SQLITE_STATIC`) or must be copied
+         *  (`SQLITE_TRANSIENT`). Overloaded on the access tag so no runtime check is performed per row.
+         */
+        template<class O, class T, class G, class S, class... Op, class Object, class F>
+        void call_with_column_value(const column_t<O, T, G, S, field_access, Op...> &c, const Object &o, const F &f) {
+            f(o.*c.member_pointer, SQLITE_STATIC);
+        }
+
+        template<class O, class T, class G, class S, class... Op, class Object, class F>
+        void call_with_column_value(const column_t<O, T, G, S, getter_setter_access, Op...> &c,
+                                    const Object &o,
+                                    const F &f) {
+            field_value_holder<G> valueHolder{(o.*c.getter)()};
+            f(valueHolder.value, valueHolder.destructor());
+        }
+
+        /**
+         *  Extracts column `index` of the current row of `stmt` into the field mapped by column `c` of object `o`.
+         */
+        template<class O, class T, class G, class S, class... Op, class Object>
+        void extract_column_value(const column_t<O, T, G, S, field_access, Op...> &c,
+                                  Object &o,
+                                  sqlite3_stmt *stmt,
+                                  int index) {
+            extract_into(o.*c.member_pointer, stmt, index);
+        }
+
+        template<class O, class T, class G, class S, class... Op, class Object>
+        void extract_column_value(const column_t<O, T, G, S, getter_setter_access, Op...> &c,
+                                  Object &o,
+                                  sqlite3_stmt *stmt,
+                                  int index) {
+            (o.*c.setter)(row_extractor<T>().extract(stmt, index));
+        }
     }
 }
@@ -1,6 +1,8 @@
 #pragma once
 
-#include <type_traits>  //  std::is_same, std::decay, std::remove_reference
+#include <type_traits>  //  std::is_same, std::decay, std::remove_reference, std::integral_constant
+#include <tuple>  //  std::tuple_size, std::forward_as_tuple, std::get
+#include <utility>  //  std::index_sequence, std::index_sequence_for, std::forward
 
 #include "prepared_statement.h"
 #include "ast_iterator.h"
@@ -164,4 +166,65 @@ namespace sqlite_orm {
         });
         return internal::get_ref(*result);
     }
+
+    namespace internal {
+
+        /**
+         *  Amount of arguments of a statement accessible with `get<N>`.
+         */
+        template<class T>
+        struct statement_arguments_count
+            : std::tuple_size<typename bindable_filter<typename node_tuple<T>::type>::type> {};
+
+        template<class T, class... Ids>
+        struct statement_arguments_count<get_t<T, Ids...>> : std::integral_constant<size_t, sizeof...(Ids)> {};
+
+        template<class T, class... Ids>
+        struct statement_arguments_count<get_pointer_t<T, Ids...>> : std::integral_constant<size_t, sizeof...(Ids)> {};
+
+#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
+        template<class T, class... Ids>
+        struct statement_arguments_count<get_optional_t<T, Ids...>>
+            : std::integral_constant<size_t, sizeof...(Ids)> {};
+#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+
+        template<class T, class... Ids>
+        struct statement_arguments_count<remove_t<T, Ids...>> : std::integral_constant<size_t, sizeof...(Ids)> {};
+
+        template<class T>
+        struct statement_arguments_count<update_t<T>> : std::integral_constant<size_t, 1> {};
+
+        template<class T>
+        struct statement_arguments_count<insert_t<T>> : std::integral_constant<size_t, 1> {};
+
+        template<class T, class... Cols>
+        struct statement_arguments_count<insert_explicit<T, Cols...>> : std::integral_constant<size_t, 1> {};
+
+        template<class T>
+        struct statement_arguments_count<replace_t<T>> : std::integral_constant<size_t, 1> {};
+
+        template<class T, class Tuple, size_t... Is>
+        void rebind_values(prepared_statement_t<T> &statement, Tuple &&values, std::index_sequence<Is...>) {
+            using expander = int[];
+            (void)expander{0, (sqlite_orm::get<Is>(statement) = std::get<Is>(std::move(values)), 0)...};
+        }
+    }
+
+    /**
+     *  Assigns new values to all arguments of a prepared statement in the order `get<N>` uses. Values are
+     *  bound when the statement is executed next time so the statement is not prepared again.
+     *  Usage: `auto statement = storage.prepare(get_all<User>(where(c(&User::age) > 18 and c(&User::name) != "")));
+     *          for(auto age: ages) {
+     *              rebind(statement, age, "");
+     *              auto users = storage.execute(statement);
+     *          }`
+     */
+    template<class T, class... Args>
+    void rebind(internal::prepared_statement_t<T> &statement, Args &&... args) {
+        static_assert(internal::statement_arguments_count<T>::value == sizeof...(Args),
+                      "rebind must get a value for every argument of the statement");
+        internal::rebind_values(statement,
+                                std::forward_as_tuple(std::forward<Args>(args)...),
+                                std::index_sequence_for<Args...>{});
+    }
 }
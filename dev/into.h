@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>  //  std::size_t
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  Caller provided result container. `get_all`, `get_all_pointer` and `select` clear it and append rows
+         *  to it instead of returning a new container. `clear` keeps capacity of `std::vector` so a polling loop
+         *  which passes the same container every time stops reallocating once the container is big enough.
+         */
+        template<class C>
+        struct into_t {
+            C &container;
+        };
+
+        /**
+         *  Calls `container.reserve(size)` if the container has `reserve`. Does nothing otherwise.
+         */
+        template<class C>
+        auto reserve_container(C &container, size_t size, int) -> decltype(container.reserve(size), void()) {
+            container.reserve(size);
+        }
+
+        template<class C>
+        void reserve_container(C &, size_t, long) {}
+
+        template<class C>
+        void reserve_container(C &container, size_t size) {
+            reserve_container(container, size, 0);
+        }
+    }
+
+    /**
+     *  Makes `get_all`, `get_all_pointer` and `select` put rows into `container` which must outlive the call.
+     *  Reserve the container to pass an expected result size.
+     *  Usage: `std::vector<User> users;
+     *          while(polling) {
+     *              storage.get_all<User>(into(users), where(...));
+     *          }`
+     */
+    template<class C>
+    internal::into_t<C> into(C &container) {
+        return {container};
+    }
+}
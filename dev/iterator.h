@@ -10,6 +10,7 @@
 #include <ios>  //  std::make_error_code
 
 #include "row_extractor.h"
+#include "object_builder.h"
 #include "statement_finalizer.h"
 #include "error_code.h"
 
@@ -39,19 +40,11 @@ namespace sqlite_orm {
             std::shared_ptr<value_type> current;
 
             void extract_value(std::unique_ptr<value_type> &temp) {
-                temp = std::make_unique<value_type>();
                 auto &storage = this->view.storage;
                 auto &impl = storage.template get_impl<value_type>();
-                auto index = 0;
-                impl.table.for_each_column([&index, &temp, this](auto &c) {
-                    using field_type = typename std::decay<decltype(c)>::type::field_type;
-                    auto value = row_extractor<field_type>().extract(*this->stmt, index++);
-                    if(c.member_pointer) {
-                        auto member_pointer = c.member_pointer;
-                        (*temp).*member_pointer = std::move(value);
-                    } else {
-                        ((*temp).*(c.setter))(std::move(value));
-                    }
+                emplace_object(impl.table, *this->stmt, [&temp](auto &&... args) -> value_type & {
+                    temp = std::make_unique<value_type>(std::forward<decltype(args)>(args)...);
+                    return *temp;
                 });
             }
 
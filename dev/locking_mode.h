@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>  //  std::string
+#include <memory>  //  std::unique_ptr, std::make_unique
+#include <algorithm>  //  std::transform
+#include <iterator>  //  std::back_inserter
+#include <cctype>  //  ::toupper
+
+namespace sqlite_orm {
+
+    /**
+     *  Caps case like in https://www.sqlite.org/pragma.html#pragma_locking_mode
+     */
+    enum class locking_mode : signed char {
+        NORMAL = 0,
+        EXCLUSIVE = 1,
+    };
+
+    namespace internal {
+
+        inline const std::string &to_string(locking_mode l) {
+            static std::string res[] = {
+                "NORMAL",
+                "EXCLUSIVE",
+            };
+            return res[static_cast<int>(l)];
+        }
+
+        inline std::unique_ptr<locking_mode> locking_mode_from_string(const std::string &str) {
+            std::string upper_str;
+            std::transform(str.begin(), str.end(), std::back_inserter(upper_str), ::toupper);
+            for(auto l: {locking_mode::NORMAL, locking_mode::EXCLUSIVE}) {
+                if(to_string(l) == upper_str) {
+                    return std::make_unique<locking_mode>(l);
+                }
+            }
+            return {};
+        }
+    }
+}
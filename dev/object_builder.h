@@ -0,0 +1,134 @@
+#pragma once
+
+#include <sqlite3.h>
+#include <tuple>  //  std::tuple, std::tuple_element, std::get
+#include <type_traits>  //  std::conditional
+#include <utility>  //  std::forward, std::index_sequence, std::make_index_sequence
+
+#include "constructor.h"
+#include "column.h"
+#include "tuple_helper.h"
+#include "table.h"
+#include "row_extractor.h"
+#include "field_value_holder.h"
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  `type` is the constructor element (`constructor_t`) of table elements Cs... or void if there is no one.
+         */
+        template<class... Cs>
+        struct table_constructor {
+            using type = void;
+        };
+
+        template<class C, class... Cs>
+        struct table_constructor<C, Cs...> {
+            using type =
+                typename std::conditional<is_constructor<C>::value, C, typename table_constructor<Cs...>::type>::type;
+        };
+
+        template<class Tuple, class F, size_t... Is>
+        decltype(auto) call_with_row_impl(sqlite3_stmt *stmt, const F &f, std::index_sequence<Is...>) {
+            return f(row_extractor<typename std::tuple_element<Is, Tuple>::type::field_type>().extract(
+                stmt,
+                static_cast<int>(Is))...);
+        }
+
+        /**
+         *  Calls `f(values...)` with values of all columns of the current row of `stmt`. Columns go first in
+         *  table elements so column `i` is the element `i`.
+         */
+        template<class T, class... Cs, class F>
+        decltype(auto) call_with_row(const table_t<T, Cs...> &, sqlite3_stmt *stmt, const F &f) {
+            using columns_count = count_tuple<std::tuple<Cs...>, is_column>;
+            return call_with_row_impl<std::tuple<Cs...>>(stmt, f, std::make_index_sequence<columns_count::value>{});
+        }
+
+        /**
+         *  Creates objects of a mapped class T from the current row of a statement. C is the table constructor
+         *  element or void. `construct(args...)` passed to `emplace` must create an object from `args` in
+         *  a container and return a reference to it.
+         */
+        template<class T, class C>
+        struct object_builder;
+
+        template<class T>
+        struct object_builder<T, void> {
+
+            template<class Table, class L>
+            static void emplace(const Table &table, sqlite3_stmt *stmt, const L &construct) {
+                fill(table, stmt, construct());
+            }
+
+            template<class Table>
+            static T make(const Table &table, sqlite3_stmt *stmt) {
+                T res;
+                fill(table, stmt, res);
+                return res;
+            }
+
+          private:
+            template<class Table>
+            static void fill(const Table &table, sqlite3_stmt *stmt, T &object) {
+                auto index = 0;
+                table.for_each_column([&index, &object, stmt](auto &c) {
+                    extract_column_value(c, object, stmt, index++);
+                });
+            }
+        };
+
+        template<class T>
+        struct object_builder<T, constructor_t<void>> {
+
+            template<class Table, class L>
+            static void emplace(const Table &table, sqlite3_stmt *stmt, const L &construct) {
+                call_with_row(table, stmt, construct);
+            }
+
+            template<class Table>
+            static T make(const Table &table, sqlite3_stmt *stmt) {
+                return call_with_row(table, stmt, [](auto &&... values) {
+                    return T(std::forward<decltype(values)>(values)...);
+                });
+            }
+        };
+
+        template<class T, class F>
+        struct object_builder<T, constructor_t<F>> {
+
+            template<class Table, class L>
+            static void emplace(const Table &table, sqlite3_stmt *stmt, const L &construct) {
+                auto &factory = std::get<constructor_t<F>>(table.columns).factory;
+                call_with_row(table, stmt, [&construct, &factory](auto &&... values) -> T & {
+                    return construct(factory(std::forward<decltype(values)>(values)...));
+                });
+            }
+
+            template<class Table>
+            static T make(const Table &table, sqlite3_stmt *stmt) {
+                return call_with_row(table, stmt, std::get<constructor_t<F>>(table.columns).factory);
+            }
+        };
+
+        /**
+         *  Creates an object mapped by `table` from the current row of `stmt` with `construct(args...)`. `args`
+         *  are column values if the table has a constructor element and nothing otherwise: the object is default
+         *  constructed by `construct()` and filled with column values after that.
+         */
+        template<class T, class... Cs, class L>
+        void emplace_object(const table_t<T, Cs...> &table, sqlite3_stmt *stmt, const L &construct) {
+            object_builder<T, typename table_constructor<Cs...>::type>::emplace(table, stmt, construct);
+        }
+
+        /**
+         *  Returns an object mapped by `table` created from the current row of `stmt`.
+         */
+        template<class T, class... Cs>
+        T make_object(const table_t<T, Cs...> &table, sqlite3_stmt *stmt) {
+            return object_builder<T, typename table_constructor<Cs...>::type>::make(table, stmt);
+        }
+    }
+}
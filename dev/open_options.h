@@ -0,0 +1,83 @@
+#pragma once
+
+#include <sqlite3.h>
+#include <string>  //  std::string
+#include <vector>  //  std::vector
+#include <utility>  //  std::pair
+#include <sstream>  //  std::stringstream
+#include <iomanip>  //  std::hex, std::uppercase, std::setw, std::setfill
+
+namespace sqlite_orm {
+
+    /**
+     *  Arguments of `sqlite3_open_v2` used for every connection of a storage. Pass it to `make_storage`
+     *  right after the filename. Default value opens a database just like `sqlite3_open` does.
+     *  Example for a read-only replica:
+     *  `open_options options;
+     *   options.flags = SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX;
+     *   options.uri_parameters = {{"immutable", "1"}};
+     *   auto storage = make_storage("replica.sqlite", options, make_table(...));`
+     */
+    struct open_options {
+
+        /**
+         *  `SQLITE_OPEN_*` flags. `SQLITE_OPEN_URI` is added automatically if `uri_parameters` is not empty.
+         */
+        int flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
+
+        /**
+         *  Name of a registered VFS. Empty string means the default VFS.
+         */
+        std::string vfs;
+
+        /**
+         *  URI query parameters like `mode=ro`, `immutable=1`, `cache=shared` or `nolock=1`. If not empty
+         *  the filename is converted into a `file:` URI with these parameters.
+         */
+        std::vector<std::pair<std::string, std::string>> uri_parameters;
+    };
+
+    namespace internal {
+
+        inline void append_uri_escaped(std::stringstream &ss, const std::string &value, bool isParameter) {
+            for(auto c: value) {
+                if(c == '%' || c == '?' || c == '#' || (isParameter && (c == '&' || c == '='))) {
+                    ss << '%' << std::hex << std::uppercase << std::setw(2) << std::setfill('0')
+                       << int(static_cast<unsigned char>(c)) << std::dec;
+                } else {
+                    ss << c;
+                }
+            }
+        }
+
+        /**
+         *  @return filename passed to `sqlite3_open_v2`: `filename` as is if there are no URI parameters
+         *  or a `file:` URI with escaped path and parameters otherwise.
+         */
+        inline std::string open_filename(const std::string &filename, const open_options &options) {
+            if(options.uri_parameters.empty()) {
+                return filename;
+            }
+            std::stringstream ss;
+            ss << "file:";
+            append_uri_escaped(ss, filename, false);
+            auto first = true;
+            for(auto &parameter: options.uri_parameters) {
+                ss << (first ? '?' : '&');
+                first = false;
+                append_uri_escaped(ss, parameter.first, true);
+                ss << '=';
+                append_uri_escaped(ss, parameter.second, true);
+            }
+            return ss.str();
+        }
+
+        inline int open_flags(const open_options &options) {
+            if(options.uri_parameters.empty()) {
+                return options.flags;
+            } else {
+                return options.flags | SQLITE_OPEN_URI;
+            }
+        }
+    }
+}
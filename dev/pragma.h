@@ -4,10 +4,17 @@
 #include <sqlite3.h>
 #include <functional>  //  std::function
 #include <memory>  // std::shared_ptr
+#include <map>  //  std::map
+#include <mutex>  //  std::mutex, std::lock_guard
+#include <sstream>  //  std::stringstream
+#include <system_error>  //  std::system_error
 
 #include "error_code.h"
 #include "row_extractor.h"
 #include "journal_mode.h"
+#include "locking_mode.h"
+#include "temp_store.h"
+#include "sqlite_type.h"
 #include "connection_holder.h"
 
 namespace sqlite_orm {
@@ -57,14 +64,124 @@ namespace sqlite_orm {
             this->set_pragma("auto_vacuum", value);
         }
 
+        /**
+         *  Performance pragmas below are per connection. Values set with setters are remembered and
+         *  applied to every connection opened later (including pooled readers) so they survive reconnects.
+         *  Pooled readers which are open already keep their old values until they are closed.
+         */
+        int cache_size() {
+            return this->get_pragma<int>("cache_size");
+        }
+
+        void cache_size(int value) {
+            this->set_persistent_pragma("cache_size", value);
+        }
+
+        int64 mmap_size() {
+            return this->get_pragma<int64>("mmap_size");
+        }
+
+        void mmap_size(int64 value) {
+            this->set_persistent_pragma("mmap_size", value);
+        }
+
+        int page_size() {
+            return this->get_pragma<int>("page_size");
+        }
+
+        void page_size(int value) {
+            this->set_persistent_pragma("page_size", value);
+        }
+
+        sqlite_orm::temp_store temp_store() {
+            return static_cast<sqlite_orm::temp_store>(this->get_pragma<int>("temp_store"));
+        }
+
+        void temp_store(sqlite_orm::temp_store value) {
+            this->set_persistent_pragma("temp_store", internal::to_string(value));
+        }
+
+        sqlite_orm::locking_mode locking_mode() {
+            auto value = this->get_pragma<std::string>("locking_mode");
+            if(auto res = internal::locking_mode_from_string(value)) {
+                return *res;
+            } else {
+                throw std::system_error(std::make_error_code(orm_error_code::incorrect_locking_mode_string));
+            }
+        }
+
+        void locking_mode(sqlite_orm::locking_mode value) {
+            this->set_persistent_pragma("locking_mode", internal::to_string(value));
+        }
+
+        int wal_autocheckpoint() {
+            return this->get_pragma<int>("wal_autocheckpoint");
+        }
+
+        void wal_autocheckpoint(int value) {
+            this->set_persistent_pragma("wal_autocheckpoint", value);
+        }
+
+        int busy_timeout() {
+            return this->get_pragma<int>("busy_timeout");
+        }
+
+        void busy_timeout(int value) {
+            this->set_persistent_pragma("busy_timeout", value);
+        }
+
       protected:
         friend struct storage_base;
 
       public:
         int _synchronous = -1;
         signed char _journal_mode = -1;  //  if != -1 stores static_cast<sqlite_orm::journal_mode>(journal_mode)
+
+        /**
+         *  Values of pragmas set by performance setters. Key is a pragma name, value is a serialized value.
+         *  Guarded by `_persistent_pragmas_mutex` cause connections are opened from any thread (pooled
+         *  readers, reopening after an idle close).
+         */
+        std::map<std::string, std::string> _persistent_pragmas;
+        mutable std::mutex _persistent_pragmas_mutex;
         get_connection_t get_connection;
 
+        template<class T>
+        void set_persistent_pragma(const std::string &name, const T &value) {
+            std::stringstream ss;
+            ss << value;
+            this->erase_persistent_pragma(name);
+            this->set_pragma(name, value);
+            this->set_persistent_pragma_value(name, ss.str());
+        }
+
+        /**
+         *  @return a copy of remembered pragmas.
+         */
+        std::map<std::string, std::string> persistent_pragmas() const {
+            std::lock_guard<std::mutex> lock(this->_persistent_pragmas_mutex);
+            return this->_persistent_pragmas;
+        }
+
+        void set_persistent_pragma_value(const std::string &name, std::string value) {
+            std::lock_guard<std::mutex> lock(this->_persistent_pragmas_mutex);
+            this->_persistent_pragmas[name] = std::move(value);
+        }
+
+        void erase_persistent_pragma(const std::string &name) {
+            std::lock_guard<std::mutex> lock(this->_persistent_pragmas_mutex);
+            this->_persistent_pragmas.erase(name);
+        }
+
+        /**
+         *  Applies remembered pragmas to a just opened handle.
+         */
+        void apply_persistent_pragmas(sqlite3 *db) {
+            for(auto &p: this->persistent_pragmas()) {
+                this->set_pragma_impl("PRAGMA " + p.first + " = " + p.second, db);
+            }
+        }
+
         template<class T>
         T get_pragma(const std::string &name) {
             auto connection = this->get_connection();
@@ -97,32 +214,31 @@ namespace sqlite_orm {
          */
         template<class T>
         void set_pragma(const std::string &name, const T &value, sqlite3 *db = nullptr) {
-            auto con = this->get_connection();
-            if(!db) {
-                db = con.get();
-            }
             std::stringstream ss;
             ss << "PRAGMA " << name << " = " << value;
-            auto query = ss.str();
-            auto rc = sqlite3_exec(db, query.c_str(), nullptr, nullptr, nullptr);
-            if(rc != SQLITE_OK) {
-                throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                        sqlite3_errmsg(db));
-            }
+            this->set_pragma_impl(ss.str(), db);
         }
 
         void set_pragma(const std::string &name, const sqlite_orm::journal_mode &value, sqlite3 *db = nullptr) {
-            auto con = this->get_connection();
-            if(!db) {
-                db = con.get();
-            }
             std::stringstream ss;
             ss << "PRAGMA " << name << " = " << internal::to_string(value);
-            auto query = ss.str();
-            auto rc = sqlite3_exec(db, query.c_str(), nullptr, nullptr, nullptr);
-            if(rc != SQLITE_OK) {
-                throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                        sqlite3_errmsg(db));
+            this->set_pragma_impl(ss.str(), db);
+        }
+
+        /**
+         *  Executes a pragma query with `db` if it is passed. Otherwise obtains a connection from the storage
+         *  so applying pragmas to a just opened handle doesn't open another one.
+         */
+        void set_pragma_impl(const std::string &query, sqlite3 *db) {
+            if(db) {
+                auto rc = sqlite3_exec(db, query.c_str(), nullptr, nullptr, nullptr);
+                if(rc != SQLITE_OK) {
+                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(db));
+                }
+            } else {
+                auto con = this->get_connection();
+                this->set_pragma_impl(query, con.get());
             }
         }
     };
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <sqlite3.h>
+
+namespace sqlite_orm {
+
+    /**
+     *  Flags of `sqlite3_prepare_v3`. Pass them to `storage.prepare(expression, flags)`.
+     *  See https://www.sqlite.org/c3ref/c_prepare_normalize.html
+     */
+    enum class prepare_flags : unsigned int {
+        none = 0,
+
+        /**
+         *  The statement is going to be kept and reused for a long time. sqlite allocates it outside of
+         *  the lookaside memory so the lookaside slots stay available for short living statements. Statements
+         *  kept by the statement cache are always prepared with this flag.
+         */
+        persistent = 0x01,
+    };
+
+    namespace internal {
+
+        /**
+         *  Prepares `query` with `sqlite3_prepare_v3` if it is available and with `sqlite3_prepare_v2`
+         *  (which ignores `flags`) otherwise.
+         *  @return result code of the prepare call.
+         */
+        inline int prepare_statement(sqlite3 *db, const char *query, prepare_flags flags, sqlite3_stmt **stmt) {
+#if SQLITE_VERSION_NUMBER >= 3020000
+            return sqlite3_prepare_v3(db, query, -1, static_cast<unsigned int>(flags), stmt, nullptr);
+#else
+            (void)flags;
+            return sqlite3_prepare_v2(db, query, -1, stmt, nullptr);
+#endif
+        }
+    }
+}
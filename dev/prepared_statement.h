@@ -7,6 +7,7 @@
 #include <utility>  //  std::pair
 
 #include "connection_holder.h"
+#include "statement_cache.h"
 #include "select_constraints.h"
 
 namespace sqlite_orm {
@@ -17,9 +18,29 @@ namespace sqlite_orm {
             sqlite3_stmt *stmt = nullptr;
             connection_ref con;
 
+            /**
+             *  Not null if the statement belongs to a statement cache. Such a statement is put back
+             *  into the cache instead of being finalized.
+             */
+            statement_cache *cache = nullptr;
+            statement_cache_key cacheKey;
+            int cacheGeneration = 0;
+
+            prepared_statement_base(sqlite3_stmt *stmt_, connection_ref con_) : stmt(stmt_), con(std::move(con_)) {}
+
+            prepared_statement_base(prepared_statement_base &&other) :
+                stmt(other.stmt), con(other.con), cache(other.cache), cacheKey(std::move(other.cacheKey)),
+                cacheGeneration(other.cacheGeneration) {
+                other.stmt = nullptr;
+            }
+
             ~prepared_statement_base() {
                 if(this->stmt) {
-                    sqlite3_finalize(this->stmt);
+                    if(this->cache) {
+                        this->cache->put(std::move(this->cacheKey), this->stmt, this->cacheGeneration);
+                    } else {
+                        sqlite3_finalize(this->stmt);
+                    }
                     this->stmt = nullptr;
                 }
             }
@@ -74,6 +95,8 @@ namespace sqlite_orm {
 
             prepared_statement_t(T t_, sqlite3_stmt *stmt, connection_ref con_) :
                 prepared_statement_base{stmt, std::move(con_)}, t(std::move(t_)) {}
+
+            prepared_statement_t(prepared_statement_t &&) = default;
         };
 
         template<class T, class... Args>
@@ -204,6 +227,36 @@ namespace sqlite_orm {
 
             std::pair<iterator_type, iterator_type> range;
         };
+
+        /**
+         *  Trait for expressions which SQL text depends only on the expression type (and the storage).
+         *  Cached statements of such expressions are found by the type without serializing the expression.
+         */
+        template<class T>
+        struct has_static_sql : std::false_type {};
+
+        template<class T, class... Ids>
+        struct has_static_sql<get_t<T, Ids...>> : std::true_type {};
+
+        template<class T, class... Ids>
+        struct has_static_sql<get_pointer_t<T, Ids...>> : std::true_type {};
+
+#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
+        template<class T, class... Ids>
+        struct has_static_sql<get_optional_t<T, Ids...>> : std::true_type {};
+#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+
+        template<class T>
+        struct has_static_sql<update_t<T>> : std::true_type {};
+
+        template<class T, class... Ids>
+        struct has_static_sql<remove_t<T, Ids...>> : std::true_type {};
+
+        template<class T>
+        struct has_static_sql<insert_t<T>> : std::true_type {};
+
+        template<class T>
+        struct has_static_sql<replace_t<T>> : std::true_type {};
     }
 
     /**
@@ -3,19 +3,21 @@
 #include <sqlite3.h>
 #include <type_traits>  //  std::enable_if_t, std::is_arithmetic, std::is_same, std::enable_if
 #include <cstdlib>  //  atof, atoi, atoll
-#include <string>  //  std::string, std::wstring
-#ifndef SQLITE_ORM_OMITS_CODECVT
-#include <codecvt>  //  std::wstring_convert, std::codecvt_utf8_utf16
-#endif  //  SQLITE_ORM_OMITS_CODECVT
+#include <string>  //  std::string, std::wstring, std::u16string
 #include <vector>  //  std::vector
 #include <cstring>  //  strlen
 #include <algorithm>  //  std::copy
 #include <iterator>  //  std::back_inserter
 #include <tuple>  //  std::tuple, std::tuple_size, std::tuple_element
+#ifdef SQLITE_ORM_STRING_VIEW_SUPPORTED
+#include <string_view>  //  std::string_view
+#endif  //  SQLITE_ORM_STRING_VIEW_SUPPORTED
 
 #include "arithmetic_tag.h"
 #include "journal_mode.h"
 #include "error_code.h"
+#include "blob_view.h"
+#include "utf_converter.h"
 
 namespace sqlite_orm {
 
@@ -90,38 +92,95 @@ namespace sqlite_orm {
         std::string extract(sqlite3_stmt *stmt, int columnIndex) {
             auto cStr = (const char *)sqlite3_column_text(stmt, columnIndex);
             if(cStr) {
-                return cStr;
+                return {cStr, static_cast<size_t>(sqlite3_column_bytes(stmt, columnIndex))};
             } else {
                 return {};
             }
         }
     };
-#ifndef SQLITE_ORM_OMITS_CODECVT
+
+#ifdef SQLITE_ORM_STRING_VIEW_SUPPORTED
     /**
-     *  Specialization for std::wstring.
+     *  Specialization for std::string_view. Extracted view points into sqlite's column buffer
+     *  so it is valid only until the statement is stepped, reset or finalized. Use it with
+     *  `storage.visit` or `row_view` only, never as a mapped member type.
      */
     template<class V>
-    struct row_extractor<V, std::enable_if_t<std::is_same<V, std::wstring>::value>> {
-        std::wstring extract(const char *row_value) {
+    struct row_extractor<V, std::enable_if_t<std::is_same<V, std::string_view>::value>> {
+        std::string_view extract(const char *row_value) {
             if(row_value) {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                return converter.from_bytes(row_value);
+                return row_value;
             } else {
                 return {};
             }
         }
 
-        std::wstring extract(sqlite3_stmt *stmt, int columnIndex) {
+        std::string_view extract(sqlite3_stmt *stmt, int columnIndex) {
             auto cStr = (const char *)sqlite3_column_text(stmt, columnIndex);
             if(cStr) {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                return converter.from_bytes(cStr);
+                return {cStr, static_cast<size_t>(sqlite3_column_bytes(stmt, columnIndex))};
+            } else {
+                return {};
+            }
+        }
+    };
+#endif  //  SQLITE_ORM_STRING_VIEW_SUPPORTED
+
+    /**
+     *  Specialization for blob_view. Extracted view points into sqlite's column buffer
+     *  so it is valid only until the statement is stepped, reset or finalized.
+     */
+    template<class V>
+    struct row_extractor<V, std::enable_if_t<std::is_same<V, blob_view>::value>> {
+        blob_view extract(sqlite3_stmt *stmt, int columnIndex) {
+            auto bytes = static_cast<const char *>(sqlite3_column_blob(stmt, columnIndex));
+            auto len = sqlite3_column_bytes(stmt, columnIndex);
+            return {bytes, static_cast<size_t>(len)};
+        }
+    };
+    /**
+     *  Specialization for std::wstring and std::u16string. UTF-16 strings are read with `sqlite3_column_text16`
+     *  as is. UTF-32 strings (`wchar_t` is 4 bytes long everywhere except Windows) are transcoded from UTF-8.
+     */
+    template<class V>
+    struct row_extractor<
+        V,
+        std::enable_if_t<std::is_same<V, std::wstring>::value || std::is_same<V, std::u16string>::value>> {
+        using char_type = typename V::value_type;
+
+        V extract(const char *row_value) {
+            if(row_value) {
+                return internal::utf_converter::from_utf8<char_type>(row_value, ::strlen(row_value));
+            } else {
+                return {};
+            }
+        }
+
+        V extract(sqlite3_stmt *stmt, int columnIndex) {
+            return this->extract(stmt, columnIndex, internal::utf_converter::is_utf16<char_type>{});
+        }
+
+      protected:
+        V extract(sqlite3_stmt *stmt, int columnIndex, std::true_type) {
+            auto data = static_cast<const char_type *>(sqlite3_column_text16(stmt, columnIndex));
+            if(data) {
+                auto bytes = static_cast<size_t>(sqlite3_column_bytes16(stmt, columnIndex));
+                return {data, bytes / sizeof(char_type)};
+            } else {
+                return {};
+            }
+        }
+
+        V extract(sqlite3_stmt *stmt, int columnIndex, std::false_type) {
+            auto data = (const char *)sqlite3_column_text(stmt, columnIndex);
+            if(data) {
+                auto bytes = static_cast<size_t>(sqlite3_column_bytes(stmt, columnIndex));
+                return internal::utf_converter::from_utf8<char_type>(data, bytes);
             } else {
                 return {};
             }
         }
     };
-#endif  //  SQLITE_ORM_OMITS_CODECVT
     /**
      *  Specialization for std::vector<char>.
      */
@@ -233,6 +292,27 @@ namespace sqlite_orm {
         }
     };
 
+    /**
+     *  Specialization for std::vector<unsigned char> (std::vector<uint8_t>).
+     */
+    template<>
+    struct row_extractor<std::vector<unsigned char>> {
+        std::vector<unsigned char> extract(const char *row_value) {
+            if(row_value) {
+                auto bytes = reinterpret_cast<const unsigned char *>(row_value);
+                return {bytes, bytes + ::strlen(row_value)};
+            } else {
+                return {};
+            }
+        }
+
+        std::vector<unsigned char> extract(sqlite3_stmt *stmt, int columnIndex) {
+            auto bytes = static_cast<const unsigned char *>(sqlite3_column_blob(stmt, columnIndex));
+            auto len = static_cast<size_t>(sqlite3_column_bytes(stmt, columnIndex));
+            return {bytes, bytes + len};
+        }
+    };
+
     template<class... Args>
     struct row_extractor<std::tuple<Args...>> {
 
@@ -296,4 +376,37 @@ namespace sqlite_orm {
             return this->extract(cStr);
         }
     };
+
+    namespace internal {
+
+        /**
+         *  Extracts column value into an existing object. Strings and blobs are assigned in place so
+         *  buffers capacity of a reused object is reused too. Other types are move-assigned.
+         */
+        template<class V>
+        void extract_into(V &value, sqlite3_stmt *stmt, int columnIndex) {
+            value = row_extractor<V>().extract(stmt, columnIndex);
+        }
+
+        inline void extract_into(std::string &value, sqlite3_stmt *stmt, int columnIndex) {
+            auto cStr = (const char *)sqlite3_column_text(stmt, columnIndex);
+            if(cStr) {
+                value.assign(cStr, static_cast<size_t>(sqlite3_column_bytes(stmt, columnIndex)));
+            } else {
+                value.clear();
+            }
+        }
+
+        inline void extract_into(std::vector<char> &value, sqlite3_stmt *stmt, int columnIndex) {
+            auto bytes = static_cast<const char *>(sqlite3_column_blob(stmt, columnIndex));
+            auto len = sqlite3_column_bytes(stmt, columnIndex);
+            value.assign(bytes, bytes + len);
+        }
+
+        inline void extract_into(std::vector<unsigned char> &value, sqlite3_stmt *stmt, int columnIndex) {
+            auto bytes = static_cast<const unsigned char *>(sqlite3_column_blob(stmt, columnIndex));
+            auto len = sqlite3_column_bytes(stmt, columnIndex);
+            value.assign(bytes, bytes + len);
+        }
+    }
 }
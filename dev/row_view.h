@@ -0,0 +1,37 @@
+#pragma once
+
+#include <sqlite3.h>
+
+#include "row_extractor.h"
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  Current row of a statement passed to `storage.visit` callback. Values are extracted lazily
+         *  with `get<V>(columnIndex)`. `V` may be a view type (`std::string_view` or `blob_view`) which
+         *  points into sqlite's column buffer without copying. Views are valid only inside the callback.
+         */
+        struct row_view {
+
+            row_view(sqlite3_stmt *stmt_) : stmt(stmt_) {}
+
+            template<class V>
+            V get(int columnIndex) const {
+                return row_extractor<V>().extract(this->stmt, columnIndex);
+            }
+
+            bool is_null(int columnIndex) const {
+                return sqlite3_column_type(this->stmt, columnIndex) == SQLITE_NULL;
+            }
+
+            int columns_count() const {
+                return sqlite3_column_count(this->stmt);
+            }
+
+          protected:
+            sqlite3_stmt *stmt = nullptr;
+        };
+    }
+}
@@ -18,4 +18,13 @@ __pragma(push_macro("min"))
 #if __cplusplus >= 201703L  // use of C++17 or higher
 // Enables use of std::optional in SQLITE_ORM.
 #define SQLITE_ORM_OPTIONAL_SUPPORTED
+// Enables use of std::string_view in SQLITE_ORM.
+#define SQLITE_ORM_STRING_VIEW_SUPPORTED
+// Enables use of std::byte in SQLITE_ORM.
+#define SQLITE_ORM_BYTE_SUPPORTED
+#endif
+
+#if __cplusplus >= 202002L && defined(__cpp_impl_coroutine)  // use of C++20 with coroutines
+// Enables co_await-able functions of async_storage.
+#define SQLITE_ORM_COROUTINES_SUPPORTED
 #endif
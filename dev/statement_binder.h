@@ -2,24 +2,90 @@
 
 #include <sqlite3.h>
 #include <type_traits>  //  std::enable_if_t, std::is_arithmetic, std::is_same, std::true_type, std::false_type
-#include <string>  //  std::string, std::wstring
-#ifndef SQLITE_ORM_OMITS_CODECVT
-#include <codecvt>  //  std::wstring_convert, std::codecvt_utf8_utf16
-#endif  //  SQLITE_ORM_OMITS_CODECVT
+#include <string>  //  std::string, std::wstring, std::u16string
 #include <vector>  //  std::vector
-#include <cstddef>  //  std::nullptr_t
+#include <cstddef>  //  std::nullptr_t, std::byte
 #include <utility>  //  std::declval
+#ifdef SQLITE_ORM_STRING_VIEW_SUPPORTED
+#include <string_view>  //  std::string_view
+#endif  //  SQLITE_ORM_STRING_VIEW_SUPPORTED
 
 #include "is_std_ptr.h"
+#include "blob_view.h"
+#include "utf_converter.h"
 
 namespace sqlite_orm {
 
     /**
      *  Helper class used for binding fields to sqlite3 statements.
+     *  Binders of TEXT and BLOB values also have `bind(stmt, index, value, destructor)` overload which passes
+     *  `destructor` to sqlite. `SQLITE_STATIC` makes sqlite use the value without copying it so it is passed
+     *  only if the value outlives the statement execution. `bind(stmt, index, value)` always copies cause
+     *  it is also called for temporaries (e.g. from custom binders).
      */
     template<class V, typename Enable = void>
     struct statement_binder : std::false_type {};
 
+    namespace internal {
+
+        template<class T>
+        struct is_byte : std::is_same<T, unsigned char> {};
+
+#ifdef SQLITE_ORM_BYTE_SUPPORTED
+        template<>
+        struct is_byte<std::byte> : std::true_type {};
+#endif  //  SQLITE_ORM_BYTE_SUPPORTED
+
+        /**
+         *  Contiguous range of bytes with `data()` and `size()` functions which is bound as BLOB.
+         *  E.g. `std::vector<uint8_t>`, `std::array<std::byte, N>`, `std::span<const std::byte>` or `blob_view`.
+         */
+        template<class T, class SFINAE = void>
+        struct is_blob_range : std::false_type {};
+
+        template<class T>
+        struct is_blob_range<T,
+                             decltype(void(std::declval<const T &>().data()), void(std::declval<const T &>().size()))>
+            : is_byte<std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<const T &>().data())>>> {};
+
+        template<>
+        struct is_blob_range<blob_view, void> : std::true_type {};
+
+        template<class T, class SFINAE = void>
+        struct binds_with_destructor : std::false_type {};
+
+        template<class T>
+        struct binds_with_destructor<
+            T,
+            decltype(void(statement_binder<T>().bind(std::declval<sqlite3_stmt *>(),
+                                                     0,
+                                                     std::declval<const T &>(),
+                                                     std::declval<sqlite3_destructor_type>())))> : std::true_type {};
+
+        template<class T>
+        int bind_value(sqlite3_stmt *stmt,
+                       int index,
+                       const T &value,
+                       sqlite3_destructor_type destructor,
+                       std::true_type) {
+            return statement_binder<T>().bind(stmt, index, value, destructor);
+        }
+
+        template<class T>
+        int bind_value(sqlite3_stmt *stmt, int index, const T &value, sqlite3_destructor_type, std::false_type) {
+            return statement_binder<T>().bind(stmt, index, value);
+        }
+
+        /**
+         *  Binds `value` passing `destructor` to sqlite if binder of `T` accepts it. Binders which don't
+         *  (arithmetic and custom ones) are called without it.
+         */
+        template<class T>
+        int bind_value(sqlite3_stmt *stmt, int index, const T &value, sqlite3_destructor_type destructor) {
+            return bind_value(stmt, index, value, destructor, binds_with_destructor<T>{});
+        }
+    }
+
     /**
      *  Specialization for arithmetic types.
      */
@@ -53,7 +119,11 @@ namespace sqlite_orm {
         V,
         std::enable_if_t<std::is_same<V, std::string>::value || std::is_same<V, const char *>::value>> {
         int bind(sqlite3_stmt *stmt, int index, const V &value) {
-            return sqlite3_bind_text(stmt, index, string_data(value), -1, SQLITE_TRANSIENT);
+            return this->bind(stmt, index, value, SQLITE_TRANSIENT);
+        }
+
+        int bind(sqlite3_stmt *stmt, int index, const V &value, sqlite3_destructor_type destructor) {
+            return sqlite3_bind_text(stmt, index, string_data(value), string_size(value), destructor);
         }
 
       private:
@@ -64,23 +134,103 @@ namespace sqlite_orm {
         const char *string_data(const char *s) const {
             return s;
         }
+
+        int string_size(const std::string &s) const {
+            return static_cast<int>(s.size());
+        }
+
+        int string_size(const char *) const {
+            return -1;
+        }
+    };
+
+#ifdef SQLITE_ORM_STRING_VIEW_SUPPORTED
+    /**
+     *  Specialization for std::string_view.
+     */
+    template<>
+    struct statement_binder<std::string_view, void> {
+        int bind(sqlite3_stmt *stmt, int index, const std::string_view &value) {
+            return this->bind(stmt, index, value, SQLITE_TRANSIENT);
+        }
+
+        int bind(sqlite3_stmt *stmt, int index, const std::string_view &value, sqlite3_destructor_type destructor) {
+            if(value.data()) {
+                return sqlite3_bind_text(stmt, index, value.data(), static_cast<int>(value.size()), destructor);
+            } else {
+                return sqlite3_bind_text(stmt, index, "", 0, SQLITE_STATIC);
+            }
+        }
     };
+#endif  //  SQLITE_ORM_STRING_VIEW_SUPPORTED
 
-#ifndef SQLITE_ORM_OMITS_CODECVT
     /**
-     *  Specialization for std::wstring and C-wstring.
+     *  Specialization for std::wstring, C-wstring, std::u16string and C-u16string. UTF-16 strings are passed
+     *  to `sqlite3_bind_text16` as is. UTF-32 strings (`wchar_t` is 4 bytes long everywhere except Windows)
+     *  are transcoded to UTF-8 first.
      */
     template<class V>
-    struct statement_binder<
-        V,
-        std::enable_if_t<std::is_same<V, std::wstring>::value || std::is_same<V, const wchar_t *>::value>> {
+    struct statement_binder<V,
+                            std::enable_if_t<std::is_same<V, std::wstring>::value ||
+                                             std::is_same<V, const wchar_t *>::value ||
+                                             std::is_same<V, std::u16string>::value ||
+                                             std::is_same<V, const char16_t *>::value>> {
         int bind(sqlite3_stmt *stmt, int index, const V &value) {
-            std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-            std::string utf8Str = converter.to_bytes(value);
-            return statement_binder<decltype(utf8Str)>().bind(stmt, index, utf8Str);
+            return this->bind(stmt, index, value, SQLITE_TRANSIENT);
+        }
+
+        int bind(sqlite3_stmt *stmt, int index, const V &value, sqlite3_destructor_type destructor) {
+            return this->bind_text(stmt, index, string_data(value), string_size(value), destructor);
+        }
+
+      private:
+        template<class Char>
+        int
+        bind_text(sqlite3_stmt *stmt, int index, const Char *data, size_t size, sqlite3_destructor_type destructor) {
+            return this->bind_text(stmt, index, data, size, destructor, internal::utf_converter::is_utf16<Char>{});
+        }
+
+        template<class Char>
+        int bind_text(sqlite3_stmt *stmt,
+                      int index,
+                      const Char *data,
+                      size_t size,
+                      sqlite3_destructor_type destructor,
+                      std::true_type) {
+            return sqlite3_bind_text16(stmt, index, data, static_cast<int>(size * sizeof(Char)), destructor);
+        }
+
+        template<class Char>
+        int bind_text(sqlite3_stmt *stmt,
+                      int index,
+                      const Char *data,
+                      size_t size,
+                      sqlite3_destructor_type,
+                      std::false_type) {
+            auto utf8 = internal::utf_converter::to_utf8(data, size);
+            return sqlite3_bind_text(stmt, index, utf8.data(), static_cast<int>(utf8.size()), SQLITE_TRANSIENT);
+        }
+
+        template<class Char>
+        static const Char *string_data(const std::basic_string<Char> &s) {
+            return s.c_str();
+        }
+
+        template<class Char>
+        static const Char *string_data(const Char *s) {
+            return s;
+        }
+
+        template<class Char>
+        static size_t string_size(const std::basic_string<Char> &s) {
+            return s.size();
+        }
+
+        template<class Char>
+        static size_t string_size(const Char *s) {
+            return std::char_traits<Char>::length(s);
         }
     };
-#endif  //  SQLITE_ORM_OMITS_CODECVT
 
     /**
      *  Specialization for std::nullptr_t.
@@ -106,8 +256,12 @@ namespace sqlite_orm {
         using value_type = typename is_std_ptr<V>::element_type;
 
         int bind(sqlite3_stmt *stmt, int index, const V &value) {
+            return this->bind(stmt, index, value, SQLITE_TRANSIENT);
+        }
+
+        int bind(sqlite3_stmt *stmt, int index, const V &value, sqlite3_destructor_type destructor) {
             if(value) {
-                return statement_binder<value_type>().bind(stmt, index, *value);
+                return internal::bind_value(stmt, index, *value, destructor);
             } else {
                 return statement_binder<std::nullptr_t>().bind(stmt, index, nullptr);
             }
@@ -120,14 +274,32 @@ namespace sqlite_orm {
     template<>
     struct statement_binder<std::vector<char>, void> {
         int bind(sqlite3_stmt *stmt, int index, const std::vector<char> &value) {
+            return this->bind(stmt, index, value, SQLITE_TRANSIENT);
+        }
+
+        int bind(sqlite3_stmt *stmt, int index, const std::vector<char> &value, sqlite3_destructor_type destructor) {
             if(value.size()) {
-                return sqlite3_bind_blob(stmt,
-                                         index,
-                                         (const void *)&value.front(),
-                                         int(value.size()),
-                                         SQLITE_TRANSIENT);
+                return sqlite3_bind_blob(stmt, index, (const void *)&value.front(), int(value.size()), destructor);
             } else {
-                return sqlite3_bind_blob(stmt, index, "", 0, SQLITE_TRANSIENT);
+                return sqlite3_bind_blob(stmt, index, "", 0, SQLITE_STATIC);
+            }
+        }
+    };
+
+    /**
+     *  Specialization for ranges of bytes (see `internal::is_blob_range`).
+     */
+    template<class V>
+    struct statement_binder<V, std::enable_if_t<internal::is_blob_range<V>::value>> {
+        int bind(sqlite3_stmt *stmt, int index, const V &value) {
+            return this->bind(stmt, index, value, SQLITE_TRANSIENT);
+        }
+
+        int bind(sqlite3_stmt *stmt, int index, const V &value, sqlite3_destructor_type destructor) {
+            if(value.size()) {
+                return sqlite3_bind_blob(stmt, index, (const void *)value.data(), int(value.size()), destructor);
+            } else {
+                return sqlite3_bind_blob(stmt, index, "", 0, SQLITE_STATIC);
             }
         }
     };
@@ -138,8 +310,12 @@ namespace sqlite_orm {
         using value_type = T;
 
         int bind(sqlite3_stmt *stmt, int index, const std::optional<T> &value) {
+            return this->bind(stmt, index, value, SQLITE_TRANSIENT);
+        }
+
+        int bind(sqlite3_stmt *stmt, int index, const std::optional<T> &value, sqlite3_destructor_type destructor) {
             if(value) {
-                return statement_binder<value_type>().bind(stmt, index, *value);
+                return internal::bind_value(stmt, index, *value, destructor);
             } else {
                 return statement_binder<std::nullopt_t>().bind(stmt, index, std::nullopt);
             }
@@ -152,11 +328,19 @@ namespace sqlite_orm {
         template<class T>
         using is_bindable = std::integral_constant<bool, !std::is_base_of<std::false_type, statement_binder<T>>::value>;
 
+        /**
+         *  Binds nodes of an expression. `destructor` is `SQLITE_STATIC` if the expression is not moved or
+         *  destroyed until the statement is executed.
+         */
         struct conditional_binder_base {
             sqlite3_stmt *stmt = nullptr;
             int &index;
+            sqlite3_destructor_type destructor = SQLITE_TRANSIENT;
 
-            conditional_binder_base(decltype(stmt) stmt_, decltype(index) index_) : stmt(stmt_), index(index_) {}
+            conditional_binder_base(decltype(stmt) stmt_,
+                                    decltype(index) index_,
+                                    decltype(destructor) destructor_ = SQLITE_TRANSIENT) :
+                stmt(stmt_), index(index_), destructor(destructor_) {}
         };
 
         template<class T, class C>
@@ -168,7 +352,7 @@ namespace sqlite_orm {
             using conditional_binder_base::conditional_binder_base;
 
             int operator()(const T &t) const {
-                return statement_binder<T>().bind(this->stmt, this->index++, t);
+                return bind_value(this->stmt, this->index++, t, this->destructor);
             }
         };
 
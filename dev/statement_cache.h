@@ -0,0 +1,173 @@
+#pragma once
+
+#include <sqlite3.h>
+#include <string>  //  std::string
+#include <map>  //  std::multimap
+#include <mutex>  //  std::mutex, std::lock_guard
+#include <typeinfo>  //  std::type_info
+#include <typeindex>  //  std::type_index
+#include <utility>  //  std::move
+
+#include "prepare_flags.h"
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  Key of a cached statement. `type` is a type of an expression the statement was prepared from.
+         *  `sql` is empty for expressions which SQL depends only on their type (see `has_static_sql`)
+         *  and contains a query text otherwise.
+         */
+        struct statement_cache_key {
+            const std::type_info *type = nullptr;
+            std::string sql;
+
+            bool operator<(const statement_cache_key &other) const {
+                std::type_index lhs(*this->type);
+                std::type_index rhs(*other.type);
+                if(lhs != rhs) {
+                    return lhs < rhs;
+                } else {
+                    return this->sql < other.sql;
+                }
+            }
+        };
+
+        /**
+         *  Statements of a single connection which are not used at the moment. A statement is taken out of
+         *  the cache while it is used so one statement is never used by two threads at once. Every `clear`
+         *  call increments generation so statements prepared before it are finalized once they are put back.
+         */
+        struct statement_cache {
+
+            statement_cache() = default;
+
+            statement_cache(const statement_cache &) = delete;
+
+            ~statement_cache() {
+                this->clear();
+            }
+
+            /**
+             *  @return statement with a given key removed from cache or nullptr if there is no such statement.
+             */
+            sqlite3_stmt *take(const statement_cache_key &key) {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                auto it = this->statements.find(key);
+                if(it != this->statements.end()) {
+                    auto res = it->second;
+                    this->statements.erase(it);
+                    return res;
+                } else {
+                    return nullptr;
+                }
+            }
+
+            /**
+             *  Resets a statement and puts it back into cache. Finalizes it if the cache was cleared
+             *  after the statement was prepared. Bindings are cleared cause values bound with `SQLITE_STATIC`
+             *  may be destroyed while the statement is in the cache.
+             */
+            void put(statement_cache_key key, sqlite3_stmt *stmt, int generation_) {
+                sqlite3_reset(stmt);
+                sqlite3_clear_bindings(stmt);
+                std::lock_guard<std::mutex> lock(this->mutex);
+                if(generation_ == this->_generation) {
+                    this->statements.insert({std::move(key), stmt});
+                } else {
+                    sqlite3_finalize(stmt);
+                }
+            }
+
+            /**
+             *  Finalizes all statements. Must be called before closing the connection.
+             */
+            void clear() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                ++this->_generation;
+                for(auto &p: this->statements) {
+                    sqlite3_finalize(p.second);
+                }
+                this->statements.clear();
+            }
+
+            int generation() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                return this->_generation;
+            }
+
+            size_t size() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                return this->statements.size();
+            }
+
+          protected:
+            std::multimap<statement_cache_key, sqlite3_stmt *> statements;
+            std::mutex mutex;
+            int _generation = 0;
+        };
+
+        /**
+         *  Transaction control statements of a single connection (`BEGIN`, `COMMIT`, `ROLLBACK` and savepoint
+         *  statements of the write queue). Every statement is prepared on its first use and kept until `clear`
+         *  is called so a transaction doesn't prepare and finalize them every time.
+         */
+        struct control_statements {
+            enum kind {
+                begin_deferred,
+                begin_immediate,
+                begin_exclusive,
+                commit,
+                rollback,
+                write_savepoint,
+                write_release,
+                write_rollback_to,
+                kinds_count,
+            };
+
+            control_statements() = default;
+
+            control_statements(const control_statements &) = delete;
+
+            ~control_statements() {
+                this->clear();
+            }
+
+            /**
+             *  Executes statement `k` with `db` preparing it from `query` if it is not prepared yet.
+             *  Statements are prepared with `prepare_flags::persistent` cause they live as long as the connection.
+             *  @return result code of `sqlite3_prepare_v3` if it failed or of `sqlite3_step` otherwise.
+             */
+            int perform(sqlite3 *db, kind k, const char *query) {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                auto &stmt = this->statements[k];
+                if(!stmt) {
+                    auto rc = prepare_statement(db, query, prepare_flags::persistent, &stmt);
+                    if(rc != SQLITE_OK) {
+                        stmt = nullptr;
+                        return rc;
+                    }
+                }
+                auto rc = sqlite3_step(stmt);
+                sqlite3_reset(stmt);
+                return rc;
+            }
+
+            /**
+             *  Finalizes all statements. Must be called before closing the connection.
+             */
+            void clear() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                for(auto &stmt: this->statements) {
+                    sqlite3_finalize(stmt);
+                    stmt = nullptr;
+                }
+            }
+
+          protected:
+            sqlite3_stmt *statements[kinds_count] = {};
+            std::mutex mutex;
+        };
+    }
+}
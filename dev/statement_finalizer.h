@@ -16,4 +16,20 @@ namespace sqlite_orm {
             sqlite3_finalize(this->stmt);
         }
     };
+
+    /**
+     *  Guard class which resets `sqlite3_stmt` and clears its bindings in dtor. `execute` binds values of
+     *  a prepared statement expression with `SQLITE_STATIC` so the bindings must not outlive the execution:
+     *  the expression may be changed with `get<N>` or `rebind` or destroyed after `execute` returns.
+     */
+    struct statement_reset_guard {
+        sqlite3_stmt *stmt = nullptr;
+
+        statement_reset_guard(decltype(stmt) stmt_) : stmt(stmt_) {}
+
+        inline ~statement_reset_guard() {
+            sqlite3_reset(this->stmt);
+            sqlite3_clear_bindings(this->stmt);
+        }
+    };
 }
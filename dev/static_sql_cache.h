@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>  //  std::string
+#include <mutex>  //  std::once_flag, std::call_once
+#include <array>  //  std::array
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  SQL texts of primary key CRUD statements of a single mapped type (see `has_static_sql`).
+         *  Every text is serialized once on first use and reused afterwards. A copy is empty so
+         *  every storage serializes its own texts.
+         */
+        struct static_sql_cache {
+            enum statement_kind {
+                get_statement,
+                update_statement,
+                remove_statement,
+                insert_statement,
+                replace_statement,
+                statement_kinds_count,
+            };
+
+            static_sql_cache() = default;
+
+            static_sql_cache(const static_sql_cache &) {}
+
+            static_sql_cache &operator=(const static_sql_cache &) {
+                return *this;
+            }
+
+            /**
+             *  @return SQL text of `kind` statement. `serialize` is called only once to create it.
+             *  If `serialize` throws it will be called again next time.
+             */
+            template<class F>
+            const std::string &get(statement_kind kind, const F &serialize) {
+                auto &entry = this->entries[kind];
+                std::call_once(entry.flag, [&entry, &serialize] {
+                    entry.sql = serialize();
+                });
+                return entry.sql;
+            }
+
+          protected:
+            struct entry {
+                std::once_flag flag;
+                std::string sql;
+            };
+
+            std::array<entry, statement_kinds_count> entries;
+        };
+    }
+}
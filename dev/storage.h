@@ -5,15 +5,16 @@
 #include <sqlite3.h>
 #include <type_traits>  //  std::remove_reference, std::is_base_of, std::decay, std::false_type, std::true_type
 #include <cstddef>  //  std::ptrdiff_t
-#include <iterator>  //  std::input_iterator_tag, std::iterator_traits, std::distance
+#include <iterator>  //  std::input_iterator_tag, std::iterator_traits, std::distance, std::next
 #include <functional>  //  std::function
+#include <future>  //  std::future
 #include <sstream>  //  std::stringstream
 #include <map>  //  std::map
 #include <vector>  //  std::vector
 #include <tuple>  //  std::tuple_size, std::tuple, std::make_tuple
 #include <utility>  //  std::forward, std::pair
 #include <set>  //  std::set
-#include <algorithm>  //  std::find
+#include <algorithm>  //  std::find, std::max, std::min
 
 #ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
 #include <optional>  // std::optional
@@ -42,11 +43,17 @@
 #include "storage_impl.h"
 #include "journal_mode.h"
 #include "field_value_holder.h"
+#include "object_builder.h"
+#include "into.h"
 #include "view.h"
 #include "ast_iterator.h"
 #include "storage_base.h"
 #include "prepared_statement.h"
 #include "expression_object_type.h"
+#include "bulk_loader.h"
+#include "cursor.h"
+#include "columnar_result.h"
+#include "row_view.h"
 
 namespace sqlite_orm {
 
@@ -74,8 +81,38 @@ namespace sqlite_orm {
             storage_t(const std::string &filename, impl_type impl_) :
                 storage_base{filename, foreign_keys_count(impl_)}, impl(std::move(impl_)) {}
 
+            /**
+             *  @param filename database filename.
+             *  @param poolOptions reader connections options.
+             *  @param impl_ storage_impl head
+             */
+            storage_t(const std::string &filename, pool_options poolOptions, impl_type impl_) :
+                storage_base{filename, foreign_keys_count(impl_), poolOptions}, impl(std::move(impl_)) {}
+
+            /**
+             *  @param filename database filename.
+             *  @param openOptions `sqlite3_open_v2` arguments.
+             *  @param poolOptions reader connections options.
+             *  @param impl_ storage_impl head
+             */
+            storage_t(const std::string &filename,
+                      open_options openOptions,
+                      pool_options poolOptions,
+                      impl_type impl_) :
+                storage_base{filename, foreign_keys_count(impl_), poolOptions, std::move(openOptions)},
+                impl(std::move(impl_)) {}
+
             storage_t(const storage_t &other) : storage_base(other), impl(other.impl) {}
 
+            /**
+             *  Write queue executes functions which use this storage so it must be stopped
+             *  before storage members are destroyed. The same is true for WAL checkpointer thread.
+             */
+            ~storage_t() {
+                this->stop_write_queue();
+                this->stop_wal_checkpointer();
+            }
+
           protected:
             impl_type impl;
 
@@ -88,8 +125,14 @@ namespace sqlite_orm {
             template<class V>
             friend struct iterator_t;
 
-            template<class O, class T, class G, class S, class... Op>
-            std::string serialize_column_schema(const internal::column_t<O, T, G, S, Op...> &c) {
+            template<class S, class T, class... Args>
+            friend struct cursor_t;
+
+            template<class S, class T>
+            friend struct bulk_loader_t;
+
+            template<class O, class T, class G, class S, class A, class... Op>
+            std::string serialize_column_schema(const internal::column_t<O, T, G, S, A, Op...> &c) {
                 std::stringstream ss;
                 ss << "'" << c.name << "' ";
                 using column_type = typename std::decay<decltype(c)>::type;
@@ -696,35 +739,49 @@ namespace sqlite_orm {
                 return ss.str();
             }
 
+            /**
+             *  @return `kind` SQL text of a table cached in `impl`. `serialize` is called only once to create it.
+             */
+            template<class I, class F>
+            const std::string &static_sql(I &impl, static_sql_cache::statement_kind kind, const F &serialize) const {
+                return impl.staticSql.get(kind, [this, &serialize] {
+                    auto sql = serialize();
+                    ++this->staticSqlSerializationsCount;
+                    return sql;
+                });
+            }
+
             // Common code for statements with conditions: get_t, get_pointer_t, get_optional_t.
             template<class T>
             std::string string_from_expression_impl_get(bool /*noTableName*/) const {
                 auto &impl = this->get_impl<T>();
-                std::stringstream ss;
-                ss << "SELECT ";
-                auto columnNames = impl.table.column_names();
-                for(size_t i = 0; i < columnNames.size(); ++i) {
-                    ss << "\"" << columnNames[i] << "\"";
-                    if(i < columnNames.size() - 1) {
-                        ss << ",";
+                return this->static_sql(impl, static_sql_cache::get_statement, [&impl] {
+                    std::stringstream ss;
+                    ss << "SELECT ";
+                    auto columnNames = impl.table.column_names();
+                    for(size_t i = 0; i < columnNames.size(); ++i) {
+                        ss << "\"" << columnNames[i] << "\"";
+                        if(i < columnNames.size() - 1) {
+                            ss << ",";
+                        }
+                        ss << " ";
                     }
-                    ss << " ";
-                }
-                ss << "FROM '" << impl.table.name << "' WHERE ";
-                auto primaryKeyColumnNames = impl.table.primary_key_column_names();
-                if(!primaryKeyColumnNames.empty()) {
-                    for(size_t i = 0; i < primaryKeyColumnNames.size(); ++i) {
-                        ss << "\"" << primaryKeyColumnNames[i] << "\""
-                           << " = ? ";
-                        if(i < primaryKeyColumnNames.size() - 1) {
-                            ss << "AND ";
+                    ss << "FROM '" << impl.table.name << "' WHERE ";
+                    auto primaryKeyColumnNames = impl.table.primary_key_column_names();
+                    if(!primaryKeyColumnNames.empty()) {
+                        for(size_t i = 0; i < primaryKeyColumnNames.size(); ++i) {
+                            ss << "\"" << primaryKeyColumnNames[i] << "\""
+                               << " = ? ";
+                            if(i < primaryKeyColumnNames.size() - 1) {
+                                ss << "AND ";
+                            }
+                            ss << ' ';
                         }
-                        ss << ' ';
+                        return ss.str();
+                    } else {
+                        throw std::system_error(std::make_error_code(orm_error_code::table_has_no_primary_key_column));
                     }
-                    return ss.str();
-                } else {
-                    throw std::system_error(std::make_error_code(orm_error_code::table_has_no_primary_key_column));
-                }
+                });
             }
 
             template<class T, class... Ids>
@@ -750,50 +807,54 @@ namespace sqlite_orm {
                 using object_type = typename expression_object_type<expression_type>::type;
                 auto &impl = this->get_impl<object_type>();
 
-                std::stringstream ss;
-                ss << "UPDATE '" << impl.table.name << "' SET ";
-                std::vector<std::string> setColumnNames;
-                impl.table.for_each_column([&setColumnNames](auto &c) {
-                    if(!c.template has<constraints::primary_key_t<>>()) {
-                        setColumnNames.emplace_back(c.name);
-                    }
-                });
-                for(size_t i = 0; i < setColumnNames.size(); ++i) {
-                    ss << "\"" << setColumnNames[i] << "\""
-                       << " = ?";
-                    if(i < setColumnNames.size() - 1) {
-                        ss << ",";
+                return this->static_sql(impl, static_sql_cache::update_statement, [&impl] {
+                    std::stringstream ss;
+                    ss << "UPDATE '" << impl.table.name << "' SET ";
+                    std::vector<std::string> setColumnNames;
+                    impl.table.for_each_column([&setColumnNames](auto &c) {
+                        if(!c.template has<constraints::primary_key_t<>>()) {
+                            setColumnNames.emplace_back(c.name);
+                        }
+                    });
+                    for(size_t i = 0; i < setColumnNames.size(); ++i) {
+                        ss << "\"" << setColumnNames[i] << "\""
+                           << " = ?";
+                        if(i < setColumnNames.size() - 1) {
+                            ss << ",";
+                        }
+                        ss << " ";
                     }
-                    ss << " ";
-                }
-                ss << "WHERE ";
-                auto primaryKeyColumnNames = impl.table.primary_key_column_names();
-                for(size_t i = 0; i < primaryKeyColumnNames.size(); ++i) {
-                    ss << "\"" << primaryKeyColumnNames[i] << "\""
-                       << " = ?";
-                    if(i < primaryKeyColumnNames.size() - 1) {
-                        ss << " AND";
+                    ss << "WHERE ";
+                    auto primaryKeyColumnNames = impl.table.primary_key_column_names();
+                    for(size_t i = 0; i < primaryKeyColumnNames.size(); ++i) {
+                        ss << "\"" << primaryKeyColumnNames[i] << "\""
+                           << " = ?";
+                        if(i < primaryKeyColumnNames.size() - 1) {
+                            ss << " AND";
+                        }
+                        ss << " ";
                     }
-                    ss << " ";
-                }
-                return ss.str();
+                    return ss.str();
+                });
             }
 
             template<class T, class... Ids>
             std::string string_from_expression(const remove_t<T, Ids...> &, bool /*noTableName*/) const {
                 auto &impl = this->get_impl<T>();
-                std::stringstream ss;
-                ss << "DELETE FROM '" << impl.table.name << "' ";
-                ss << "WHERE ";
-                auto primaryKeyColumnNames = impl.table.primary_key_column_names();
-                for(size_t i = 0; i < primaryKeyColumnNames.size(); ++i) {
-                    ss << "\"" << primaryKeyColumnNames[i] << "\""
-                       << " = ? ";
-                    if(i < primaryKeyColumnNames.size() - 1) {
-                        ss << "AND ";
+                return this->static_sql(impl, static_sql_cache::remove_statement, [&impl] {
+                    std::stringstream ss;
+                    ss << "DELETE FROM '" << impl.table.name << "' ";
+                    ss << "WHERE ";
+                    auto primaryKeyColumnNames = impl.table.primary_key_column_names();
+                    for(size_t i = 0; i < primaryKeyColumnNames.size(); ++i) {
+                        ss << "\"" << primaryKeyColumnNames[i] << "\""
+                           << " = ? ";
+                        if(i < primaryKeyColumnNames.size() - 1) {
+                            ss << "AND ";
+                        }
                     }
-                }
-                return ss.str();
+                    return ss.str();
+                });
             }
 
             template<class T, class... Cols>
@@ -845,23 +906,63 @@ namespace sqlite_orm {
                 using object_type = typename expression_object_type<expression_type>::type;
                 this->assert_mapped_type<object_type>();
                 auto &impl = this->get_impl<object_type>();
-                std::stringstream ss;
-                ss << "INSERT INTO '" << impl.table.name << "' ";
-                std::vector<std::string> columnNames;
-                auto compositeKeyColumnNames = impl.table.composite_key_columns_names();
+                return this->static_sql(impl, static_sql_cache::insert_statement, [&impl] {
+                    std::stringstream ss;
+                    ss << "INSERT INTO '" << impl.table.name << "' ";
+                    std::vector<std::string> columnNames;
+                    auto compositeKeyColumnNames = impl.table.composite_key_columns_names();
+
+                    impl.table.for_each_column([&impl, &columnNames, &compositeKeyColumnNames](auto &c) {
+                        if(impl.table._without_rowid || !c.template has<constraints::primary_key_t<>>()) {
+                            auto it = std::find(compositeKeyColumnNames.begin(), compositeKeyColumnNames.end(), c.name);
+                            if(it == compositeKeyColumnNames.end()) {
+                                columnNames.emplace_back(c.name);
+                            }
+                        }
+                    });
 
-                impl.table.for_each_column([&impl, &columnNames, &compositeKeyColumnNames](auto &c) {
-                    if(impl.table._without_rowid || !c.template has<constraints::primary_key_t<>>()) {
-                        auto it = std::find(compositeKeyColumnNames.begin(), compositeKeyColumnNames.end(), c.name);
-                        if(it == compositeKeyColumnNames.end()) {
-                            columnNames.emplace_back(c.name);
+                    auto columnNamesCount = columnNames.size();
+                    if(columnNamesCount) {
+                        ss << "(";
+                        for(size_t i = 0; i < columnNamesCount; ++i) {
+                            ss << "\"" << columnNames[i] << "\"";
+                            if(i < columnNamesCount - 1) {
+                                ss << ",";
+                            } else {
+                                ss << ")";
+                            }
+                            ss << " ";
+                        }
+                    } else {
+                        ss << "DEFAULT ";
+                    }
+                    ss << "VALUES ";
+                    if(columnNamesCount) {
+                        ss << "(";
+                        for(size_t i = 0; i < columnNamesCount; ++i) {
+                            ss << "?";
+                            if(i < columnNamesCount - 1) {
+                                ss << ", ";
+                            } else {
+                                ss << ")";
+                            }
                         }
                     }
+                    return ss.str();
                 });
+            }
 
-                auto columnNamesCount = columnNames.size();
-                if(columnNamesCount) {
-                    ss << "(";
+            template<class T>
+            std::string string_from_expression(const replace_t<T> &rep, bool /*noTableName*/) const {
+                using expression_type = typename std::decay<decltype(rep)>::type;
+                using object_type = typename expression_object_type<expression_type>::type;
+                this->assert_mapped_type<object_type>();
+                auto &impl = this->get_impl<object_type>();
+                return this->static_sql(impl, static_sql_cache::replace_statement, [&impl] {
+                    std::stringstream ss;
+                    ss << "REPLACE INTO '" << impl.table.name << "' (";
+                    auto columnNames = impl.table.column_names();
+                    auto columnNamesCount = columnNames.size();
                     for(size_t i = 0; i < columnNamesCount; ++i) {
                         ss << "\"" << columnNames[i] << "\"";
                         if(i < columnNamesCount - 1) {
@@ -871,12 +972,7 @@ namespace sqlite_orm {
                         }
                         ss << " ";
                     }
-                } else {
-                    ss << "DEFAULT ";
-                }
-                ss << "VALUES ";
-                if(columnNamesCount) {
-                    ss << "(";
+                    ss << "VALUES(";
                     for(size_t i = 0; i < columnNamesCount; ++i) {
                         ss << "?";
                         if(i < columnNamesCount - 1) {
@@ -885,39 +981,8 @@ namespace sqlite_orm {
                             ss << ")";
                         }
                     }
-                }
-                return ss.str();
-            }
-
-            template<class T>
-            std::string string_from_expression(const replace_t<T> &rep, bool /*noTableName*/) const {
-                using expression_type = typename std::decay<decltype(rep)>::type;
-                using object_type = typename expression_object_type<expression_type>::type;
-                this->assert_mapped_type<object_type>();
-                auto &impl = this->get_impl<object_type>();
-                std::stringstream ss;
-                ss << "REPLACE INTO '" << impl.table.name << "' (";
-                auto columnNames = impl.table.column_names();
-                auto columnNamesCount = columnNames.size();
-                for(size_t i = 0; i < columnNamesCount; ++i) {
-                    ss << "\"" << columnNames[i] << "\"";
-                    if(i < columnNamesCount - 1) {
-                        ss << ",";
-                    } else {
-                        ss << ")";
-                    }
-                    ss << " ";
-                }
-                ss << "VALUES(";
-                for(size_t i = 0; i < columnNamesCount; ++i) {
-                    ss << "?";
-                    if(i < columnNamesCount - 1) {
-                        ss << ", ";
-                    } else {
-                        ss << ")";
-                    }
-                }
-                return ss.str();
+                    return ss.str();
+                });
             }
 
             template<class It>
@@ -1341,10 +1406,24 @@ namespace sqlite_orm {
             view_t<T, self, Args...> iterate(Args &&... args) {
                 this->assert_mapped_type<T>();
 
-                auto con = this->get_connection();
+                auto con = this->get_read_connection();
                 return {*this, std::move(con), std::forward<Args>(args)...};
             }
 
+            /**
+             *  Creates a forward only cursor over `T` rows filtered by `args` (conditions like in `get_all`).
+             *  Cursor reuses a single object (`next()`/`current()`) or a caller provided vector
+             *  (`next(rows, n)`) instead of allocating an object per row.
+             *  Usage: `auto cursor = storage.stream<User>(where(c(&User::id) > 10));
+             *          while(cursor.next()) { auto &user = cursor.current(); }`
+             */
+            template<class T, class... Args>
+            cursor_t<self, T, Args...> stream(Args... args) {
+                this->assert_mapped_type<T>();
+                auto statement = this->prepare(sqlite_orm::get_all<T>(std::move(args)...));
+                return {*this, std::move(statement)};
+            }
+
             template<class O, class... Args>
             void remove_all(Args &&... args) {
                 this->assert_mapped_type<O>();
@@ -1687,6 +1766,29 @@ namespace sqlite_orm {
                 }
             }
 
+            /**
+             *  Result of a query without conditions other than `order_by` contains all rows of the table.
+             */
+            template<class Conditions>
+            struct selects_whole_table {
+                static constexpr const bool value =
+                    count_tuple<Conditions, conditions::is_order_by>::value == int(std::tuple_size<Conditions>::value);
+            };
+
+            template<class Conditions, class C>
+            void reserve_result(const std::string &tableName, sqlite3 *db, C &res) {
+                if(this->resultSizeEstimateEnabled && selects_whole_table<Conditions>::value) {
+                    reserve_container(res, this->rows_count_estimate(tableName, db));
+                }
+            }
+
+            template<class Conditions>
+            void remember_result_size(const std::string &tableName, size_t size) {
+                if(this->resultSizeEstimateEnabled && selects_whole_table<Conditions>::value) {
+                    this->remember_rows_count(tableName, size);
+                }
+            }
+
           public:
             /**
              *  Select * with no conditions routine.
@@ -1700,6 +1802,19 @@ namespace sqlite_orm {
                 return this->execute(statement);
             }
 
+            /**
+             *  The same as `get_all` but puts objects into a caller provided container. The container is cleared
+             *  first and keeps its capacity so reusing it across calls avoids reallocations.
+             *  Usage: `storage.get_all<User>(into(users), where(...));`
+             *  @return `target.container`
+             */
+            template<class O, class C, class... Args>
+            C &get_all(into_t<C> target, Args &&... args) {
+                this->assert_mapped_type<O>();
+                auto statement = this->prepare(sqlite_orm::get_all<O>(std::forward<Args>(args)...));
+                return this->execute(statement, target);
+            }
+
             /**
              *  Select * with no conditions routine.
              *  O is an object type to be extracted. Must be specified explicitly.
@@ -1712,6 +1827,18 @@ namespace sqlite_orm {
                 return this->execute(statement);
             }
 
+            /**
+             *  The same as `get_all_pointer` but puts pointers into a caller provided container which is cleared
+             *  first.
+             *  @return `target.container`
+             */
+            template<class O, class C, class... Args>
+            C &get_all_pointer(into_t<C> target, Args &&... args) {
+                this->assert_mapped_type<O>();
+                auto statement = this->prepare(sqlite_orm::get_all_pointer<O>(std::forward<Args>(args)...));
+                return this->execute(statement, target);
+            }
+
             /**
              *  Select * by id routine.
              *  throws std::system_error(orm_error_code::not_found, orm_error_category) if object not found with given
@@ -1941,6 +2068,81 @@ namespace sqlite_orm {
                 return this->execute(statement);
             }
 
+            /**
+             *  The same as `select` but puts rows into a caller provided container. The container is cleared
+             *  first and keeps its capacity.
+             *  Usage: `storage.select(into(ids), &User::id, where(...));`
+             *  @return `target.container`
+             */
+            template<class C, class T, class... Args>
+            C &select(into_t<C> target, T m, Args... args) {
+                static_assert(!is_base_of_template<T, compound_operator>::value ||
+                                  std::tuple_size<std::tuple<Args...>>::value == 0,
+                              "Cannot use args with a compound operator");
+                auto statement = this->prepare(sqlite_orm::select(std::move(m), std::forward<Args>(args)...));
+                return this->execute(statement, target);
+            }
+
+            /**
+             *  Select multiple columns into a struct-of-arrays `columnar_result` instead of
+             *  std::vector<std::tuple<...>>. Every column is extracted into its own contiguous vector.
+             *  Nullable columns have a null bitmap.
+             *  Usage: `auto res = storage.select_columns(columns(&User::id, &User::age), where(...));
+             *          for(auto age: res.values<1>()) {...}`
+             */
+            template<class... Cs, class... Args, class R = columnar_result_t<self, columns_t<Cs...>>>
+            R select_columns(columns_t<Cs...> cols, Args... args) {
+                auto statement = this->prepare(sqlite_orm::select(std::move(cols), std::forward<Args>(args)...));
+                return this->execute_columnar(statement);
+            }
+
+            /**
+             *  Select columns and call `f(row)` for every row without allocating row objects. `row` is
+             *  `row_view` so values are extracted with `row.get<V>(index)`. Use `std::string_view` and
+             *  `blob_view` to read TEXT and BLOB values without copying. Views must not outlive the callback.
+             *  Usage: `storage.visit(columns(&User::id, &User::name), [](auto &row) {
+             *              auto name = row.get<std::string_view>(1);
+             *          }, where(...));`
+             */
+            template<class T, class F, class... Args>
+            void visit(T m, const F &f, Args... args) {
+                auto statement = this->prepare(sqlite_orm::select(std::move(m), std::forward<Args>(args)...));
+                this->visit(statement, f);
+            }
+
+            template<class T, class... Args, class F>
+            void visit(const prepared_statement_t<select_t<T, Args...>> &statement, const F &f) {
+                auto db = statement.con.get();
+                auto stmt = statement.stmt;
+                auto index = 1;
+                sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
+                iterate_ast(statement.t, [stmt, &index, db](auto &node) {
+                    using node_type = typename std::decay<decltype(node)>::type;
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
+                    if(SQLITE_OK != binder(node)) {
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
+                    }
+                });
+                row_view row{stmt};
+                int stepRes;
+                do {
+                    stepRes = sqlite3_step(stmt);
+                    switch(stepRes) {
+                        case SQLITE_ROW: {
+                            f(row);
+                        } break;
+                        case SQLITE_DONE:
+                            break;
+                        default: {
+                            throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                    sqlite3_errmsg(db));
+                        }
+                    }
+                } while(stepRes != SQLITE_DONE);
+            }
+
             /**
              *  Returns a string representation of object of a class mapped to the storage.
              *  Type of string has json-like style.
@@ -1972,8 +2174,12 @@ namespace sqlite_orm {
                     return;
                 }
 
-                auto statement = this->prepare(sqlite_orm::replace_range(from, to));
-                this->execute(statement);
+                auto &impl = this->get_impl<O>();
+                size_t columnsCount = 0;
+                impl.table.for_each_column([&columnsCount](auto &) {
+                    ++columnsCount;
+                });
+                this->execute_range_by_chunks<replace_range_t<It>>(from, to, columnsCount);
             }
 
             template<class O, class... Cols>
@@ -2005,31 +2211,182 @@ namespace sqlite_orm {
                     return;
                 }
 
-                auto statement = this->prepare(sqlite_orm::insert_range(from, to));
-                this->execute(statement);
+                this->execute_range_by_chunks<insert_range_t<It>>(from, to, this->insert_range_columns_count<O>());
             }
 
-          protected:
-            template<class... Tss, class... Cols>
-            sync_schema_result sync_table(storage_impl<internal::index_t<Cols...>, Tss...> *impl, sqlite3 *db, bool) {
-                auto res = sync_schema_result::already_in_sync;
-                std::stringstream ss;
-                ss << "CREATE ";
-                if(impl->table.unique) {
-                    ss << "UNIQUE ";
+            /**
+             *  Creates a loader which inserts objects of type `O` pushed one by one. Pushed objects are inserted
+             *  by batches and committed every `options.commit_rows` rows or `options.commit_interval` time so
+             *  memory usage doesn't depend on amount of rows. Primary key columns are not inserted just like
+             *  in `insert_range`. Call `finish` on the loader to commit the rest rows. Loader commits its own
+             *  transactions so it cannot be created inside a transaction: `std::system_error` with
+             *  `orm_error_code::cannot_start_a_transaction_within_a_transaction` is thrown then.
+             */
+            template<class O>
+            bulk_loader_t<self, O> bulk_loader(bulk_loader_options options = {}) {
+                this->assert_mapped_type<O>();
+                auto con = this->get_connection();
+                if(!sqlite3_get_autocommit(con.get())) {
+                    throw std::system_error(
+                        std::make_error_code(orm_error_code::cannot_start_a_transaction_within_a_transaction));
                 }
-                using columns_type = typename decltype(impl->table)::columns_type;
-                using head_t = typename std::tuple_element<0, columns_type>::type;
-                using indexed_type = typename internal::table_type<head_t>::type;
-                ss << "INDEX IF NOT EXISTS '" << impl->table.name << "' ON '"
-                   << this->impl.template find_table_name<indexed_type>() << "' ( ";
-                std::vector<std::string> columnNames;
-                iterate_tuple(impl->table.columns, [&columnNames, this](auto &v) {
-                    columnNames.push_back(this->impl.column_name(v));
+                auto maxBatchSize = this->range_chunk_size(con.get(), this->insert_range_columns_count<O>());
+                auto batchSize = std::min(std::max(options.batch_size, size_t(1)), maxBatchSize);
+                return {*this, std::move(con), std::move(options), batchSize};
+            }
+
+            /**
+             *  Enqueues insertion of `o` into the write queue (see `start_write_queue`).
+             *  @return future with id of inserted object.
+             */
+            template<class O>
+            std::future<int64> enqueue_insert(O o) {
+                this->assert_mapped_type<O>();
+                auto expression = sqlite_orm::insert(std::move(o));
+                return this->enqueue_write([this, expression] {
+                    auto statement = this->prepare(expression);
+                    return this->execute(statement);
                 });
-                for(size_t i = 0; i < columnNames.size(); ++i) {
-                    ss << "'" << columnNames[i] << "'";
-                    if(i < columnNames.size() - 1) {
+            }
+
+            /**
+             *  Enqueues replacement of `o` into the write queue (see `start_write_queue`).
+             *  @return future with rowid of replaced object.
+             */
+            template<class O>
+            std::future<int64> enqueue_replace(O o) {
+                this->assert_mapped_type<O>();
+                auto expression = sqlite_orm::replace(std::move(o));
+                return this->enqueue_write([this, expression] {
+                    auto statement = this->prepare(expression);
+                    this->execute(statement);
+                    return sqlite3_last_insert_rowid(statement.con.get());
+                });
+            }
+
+            /**
+             *  Enqueues update of `o` into the write queue (see `start_write_queue`).
+             *  @return future with amount of changed rows.
+             */
+            template<class O>
+            std::future<int64> enqueue_update(O o) {
+                this->assert_mapped_type<O>();
+                auto expression = sqlite_orm::update(std::move(o));
+                return this->enqueue_write([this, expression] {
+                    auto statement = this->prepare(expression);
+                    this->execute(statement);
+                    return int64(sqlite3_changes(statement.con.get()));
+                });
+            }
+
+            /**
+             *  Enqueues removal of an object with given primary key into the write queue (see `start_write_queue`).
+             *  @return future with amount of changed rows.
+             */
+            template<class O, class... Ids>
+            std::future<int64> enqueue_remove(Ids... ids) {
+                this->assert_mapped_type<O>();
+                auto expression = sqlite_orm::remove<O>(std::forward<Ids>(ids)...);
+                return this->enqueue_write([this, expression] {
+                    auto statement = this->prepare(expression);
+                    this->execute(statement);
+                    return int64(sqlite3_changes(statement.con.get()));
+                });
+            }
+
+          protected:
+            /**
+             *  @return amount of columns bound for every object by `insert_range`.
+             */
+            template<class O>
+            size_t insert_range_columns_count() const {
+                auto &impl = this->get_impl<O>();
+                size_t res = 0;
+                impl.table.for_each_column([&res](auto &c) {
+                    if(!c.template has<constraints::primary_key_t<>>()) {
+                        ++res;
+                    }
+                });
+                return res;
+            }
+
+            /**
+             *  @return max amount of rows with `columnsCount` columns each which fit into
+             *  `SQLITE_LIMIT_VARIABLE_NUMBER` bound variables.
+             */
+            size_t range_chunk_size(sqlite3 *db, size_t columnsCount) const {
+                auto variablesLimit = static_cast<size_t>(sqlite3_limit(db, SQLITE_LIMIT_VARIABLE_NUMBER, -1));
+                return std::max(variablesLimit / std::max(columnsCount, size_t(1)), size_t(1));
+            }
+
+            /**
+             *  Executes `insert_range_t` or `replace_range_t` expression split into chunks. A chunk has as many rows
+             *  as fit into `SQLITE_LIMIT_VARIABLE_NUMBER` bound variables. All full chunks share one statement
+             *  and the last partial chunk has its own one. Chunks are executed inside a single transaction
+             *  unless there is an opened transaction already. The own transaction is aborted if a chunk or
+             *  `COMMIT` fails and the original error is rethrown.
+             */
+            template<class E>
+            void execute_range_by_chunks(typename E::iterator_type from,
+                                         typename E::iterator_type to,
+                                         size_t columnsCount) {
+                auto con = this->get_connection();
+                auto db = con.get();
+                auto rowsCount = static_cast<size_t>(std::distance(from, to));
+                auto chunkSize = this->range_chunk_size(db, columnsCount);
+                auto ownTransaction = rowsCount > chunkSize && sqlite3_get_autocommit(db);
+                if(ownTransaction) {
+                    this->begin_transaction();
+                }
+                try {
+                    auto fullChunksCount = rowsCount / chunkSize;
+                    if(fullChunksCount) {
+                        auto chunkEnd = std::next(from, chunkSize);
+                        auto statement = this->prepare_impl(E{{from, chunkEnd}}, con);
+                        for(size_t i = 0; i < fullChunksCount; ++i) {
+                            if(i) {
+                                chunkEnd = std::next(from, chunkSize);
+                                statement.t.range = {from, chunkEnd};
+                            }
+                            this->execute(statement);
+                            from = chunkEnd;
+                        }
+                    }
+                    if(from != to) {
+                        auto statement = this->prepare_impl(E{{from, to}}, con);
+                        this->execute(statement);
+                    }
+                    if(ownTransaction) {
+                        this->commit();
+                    }
+                } catch(...) {
+                    if(ownTransaction) {
+                        this->abort_transaction();
+                    }
+                    throw;
+                }
+            }
+
+            template<class... Tss, class... Cols>
+            sync_schema_result sync_table(storage_impl<internal::index_t<Cols...>, Tss...> *impl, sqlite3 *db, bool) {
+                auto res = sync_schema_result::already_in_sync;
+                std::stringstream ss;
+                ss << "CREATE ";
+                if(impl->table.unique) {
+                    ss << "UNIQUE ";
+                }
+                using columns_type = typename decltype(impl->table)::columns_type;
+                using head_t = typename std::tuple_element<0, columns_type>::type;
+                using indexed_type = typename internal::table_type<head_t>::type;
+                ss << "INDEX IF NOT EXISTS '" << impl->table.name << "' ON '"
+                   << this->impl.template find_table_name<indexed_type>() << "' ( ";
+                std::vector<std::string> columnNames;
+                iterate_tuple(impl->table.columns, [&columnNames, this](auto &v) {
+                    columnNames.push_back(this->impl.column_name(v));
+                });
+                for(size_t i = 0; i < columnNames.size(); ++i) {
+                    ss << "'" << columnNames[i] << "'";
+                    if(i < columnNames.size() - 1) {
                         ss << ",";
                     }
                     ss << " ";
@@ -2138,6 +2495,7 @@ namespace sqlite_orm {
                     auto res = this->sync_table(impl, db, preserve);
                     result.insert({impl->table.name, res});
                 });
+                this->clear_statement_cache();
                 return result;
             }
 
@@ -2166,234 +2524,152 @@ namespace sqlite_orm {
                 return this->impl.table_exists(tableName, con.get());
             }
 
-            template<class T, class... Args>
-            prepared_statement_t<select_t<T, Args...>> prepare(select_t<T, Args...> sel) {
-                sel.highest_level = true;
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
+          protected:
+            /**
+             *  Common part of all `prepare` overloads. Takes a statement from the statement cache of `con`
+             *  if the cache is enabled. Otherwise or if there is no such statement in the cache prepares a new one.
+             *  Statements of expressions with static SQL are searched by expression type only so SQL
+             *  is not serialized for them at all in case of cache hit. Statements which go to the cache are
+             *  always prepared with `prepare_flags::persistent`.
+             */
+            template<class E>
+            prepared_statement_t<E>
+            prepare_impl(E expression, connection_ref con, prepare_flags flags = prepare_flags::none) {
                 auto db = con.get();
-                auto query = this->string_from_expression(sel, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(sel), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
+                sqlite3_stmt *stmt = nullptr;
+                statement_cache *cache = nullptr;
+                statement_cache_key cacheKey;
+                auto cacheGeneration = 0;
+                std::string query;
+                if(this->statementCacheEnabled) {
+                    flags = prepare_flags::persistent;
+                    cache = &con.cache();
+                    cacheGeneration = cache->generation();
+                    cacheKey.type = &typeid(E);
+                    if(!has_static_sql<E>::value) {
+                        query = this->string_from_expression(expression, false);
+                        cacheKey.sql = query;
+                    }
+                    stmt = cache->take(cacheKey);
+                    if(stmt) {
+                        ++this->statementCacheHits;
+                    } else {
+                        ++this->statementCacheMisses;
+                    }
+                }
+                if(!stmt) {
+                    if(query.empty()) {
+                        query = this->string_from_expression(expression, false);
+                    }
+                    if(prepare_statement(db, query.c_str(), flags, &stmt) != SQLITE_OK) {
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
+                    }
                 }
+                prepared_statement_t<E> res{std::move(expression), stmt, std::move(con)};
+                res.cache = cache;
+                res.cacheKey = std::move(cacheKey);
+                res.cacheGeneration = cacheGeneration;
+                return res;
             }
 
+          public:
             template<class T, class... Args>
-            prepared_statement_t<get_all_t<T, Args...>> prepare(get_all_t<T, Args...> get) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(get, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(get), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<select_t<T, Args...>>
+            prepare(select_t<T, Args...> sel, prepare_flags flags = prepare_flags::none) {
+                sel.highest_level = true;
+                return this->prepare_impl(std::move(sel), this->get_read_connection(), flags);
             }
 
             template<class T, class... Args>
-            prepared_statement_t<get_all_pointer_t<T, Args...>> prepare(get_all_pointer_t<T, Args...> get) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(get, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(get), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<get_all_t<T, Args...>>
+            prepare(get_all_t<T, Args...> get, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(get), this->get_read_connection(), flags);
+            }
+
+            template<class T, class... Args>
+            prepared_statement_t<get_all_pointer_t<T, Args...>>
+            prepare(get_all_pointer_t<T, Args...> get, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(get), this->get_read_connection(), flags);
             }
 
 #ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
             template<class T, class... Args>
-            prepared_statement_t<get_all_optional_t<T, Args...>> prepare(get_all_optional_t<T, Args...> get) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(get, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(get), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<get_all_optional_t<T, Args...>>
+            prepare(get_all_optional_t<T, Args...> get, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(get), this->get_read_connection(), flags);
             }
 #endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
 
             template<class... Args, class... Wargs>
             prepared_statement_t<update_all_t<set_t<Args...>, Wargs...>>
-            prepare(update_all_t<set_t<Args...>, Wargs...> upd) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(upd, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(upd), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepare(update_all_t<set_t<Args...>, Wargs...> upd, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(upd), this->get_connection(), flags);
             }
 
             template<class T, class... Args>
-            prepared_statement_t<remove_all_t<T, Args...>> prepare(remove_all_t<T, Args...> rem) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(rem, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(rem), stmt, std::move(con)};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<remove_all_t<T, Args...>>
+            prepare(remove_all_t<T, Args...> rem, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(rem), this->get_connection(), flags);
             }
 
             template<class T, class... Ids>
-            prepared_statement_t<get_t<T, Ids...>> prepare(get_t<T, Ids...> g) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(g, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(g), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<get_t<T, Ids...>>
+            prepare(get_t<T, Ids...> g, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(g), this->get_read_connection(), flags);
             }
 
             template<class T, class... Ids>
-            prepared_statement_t<get_pointer_t<T, Ids...>> prepare(get_pointer_t<T, Ids...> g) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(g, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(g), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<get_pointer_t<T, Ids...>>
+            prepare(get_pointer_t<T, Ids...> g, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(g), this->get_read_connection(), flags);
             }
 
 #ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
             template<class T, class... Ids>
-            prepared_statement_t<get_optional_t<T, Ids...>> prepare(get_optional_t<T, Ids...> g) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(g, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(g), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<get_optional_t<T, Ids...>>
+            prepare(get_optional_t<T, Ids...> g, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(g), this->get_read_connection(), flags);
             }
 #endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
 
             template<class T>
-            prepared_statement_t<update_t<T>> prepare(update_t<T> upd) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(upd, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(upd), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<update_t<T>> prepare(update_t<T> upd, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(upd), this->get_connection(), flags);
             }
 
             template<class T, class... Ids>
-            prepared_statement_t<remove_t<T, Ids...>> prepare(remove_t<T, Ids...> rem) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(rem, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(rem), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<remove_t<T, Ids...>>
+            prepare(remove_t<T, Ids...> rem, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(rem), this->get_connection(), flags);
             }
 
             template<class T>
-            prepared_statement_t<insert_t<T>> prepare(insert_t<T> ins) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(ins, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(ins), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<insert_t<T>> prepare(insert_t<T> ins, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(ins), this->get_connection(), flags);
             }
 
             template<class T>
-            prepared_statement_t<replace_t<T>> prepare(replace_t<T> rep) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(rep, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(rep), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<replace_t<T>> prepare(replace_t<T> rep, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(rep), this->get_connection(), flags);
             }
 
             template<class It>
-            prepared_statement_t<insert_range_t<It>> prepare(insert_range_t<It> ins) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(ins, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(ins), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<insert_range_t<It>>
+            prepare(insert_range_t<It> ins, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(ins), this->get_connection(), flags);
             }
 
             template<class It>
-            prepared_statement_t<replace_range_t<It>> prepare(replace_range_t<It> rep) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(rep, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(rep), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<replace_range_t<It>>
+            prepare(replace_range_t<It> rep, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(rep), this->get_connection(), flags);
             }
 
             template<class T, class... Cols>
-            prepared_statement_t<insert_explicit<T, Cols...>> prepare(insert_explicit<T, Cols...> ins) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(ins, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(ins), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<insert_explicit<T, Cols...>>
+            prepare(insert_explicit<T, Cols...> ins, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(ins), this->get_connection(), flags);
             }
 
             template<class T, class... Cols>
@@ -2402,17 +2678,17 @@ namespace sqlite_orm {
                 using expression_type = typename statement_type::expression_type;
                 using object_type = typename expression_object_type<expression_type>::type;
                 auto index = 1;
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto &impl = this->get_impl<object_type>();
                 auto &o = statement.t.obj;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_tuple(statement.t.columns.columns, [&o, &index, &stmt, &impl, db](auto &m) {
                     using column_type = typename std::decay<decltype(m)>::type;
                     using field_type = typename column_result_t<self, column_type>::type;
                     const field_type *value = impl.table.template get_object_field_pointer<field_type>(o, m);
-                    if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, *value)) {
+                    if(SQLITE_OK != bind_value<field_type>(stmt, index++, *value, SQLITE_STATIC)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
@@ -2432,30 +2708,22 @@ namespace sqlite_orm {
                 using object_type = typename expression_type::object_type;
                 auto &impl = this->get_impl<object_type>();
                 auto index = 1;
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 for(auto it = statement.t.range.first; it != statement.t.range.second; ++it) {
                     auto &o = *it;
                     impl.table.for_each_column([&o, &index, &stmt, db](auto &c) {
                         using column_type = typename std::decay<decltype(c)>::type;
                         using field_type = typename column_type::field_type;
-                        if(c.member_pointer) {
-                            if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, o.*c.member_pointer)) {
+                        call_with_column_value(c, o, [stmt, &index, db](auto &value, auto destructor) {
+                            if(SQLITE_OK != bind_value<field_type>(stmt, index++, value, destructor)) {
                                 throw std::system_error(
                                     std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                     sqlite3_errmsg(db));
                             }
-                        } else {
-                            using getter_type = typename column_type::getter_type;
-                            field_value_holder<getter_type> valueHolder{((o).*(c.getter))()};
-                            if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, valueHolder.value)) {
-                                throw std::system_error(
-                                    std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                    sqlite3_errmsg(db));
-                            }
-                        }
+                        });
                     });
                 }
                 if(sqlite3_step(stmt) == SQLITE_DONE) {
@@ -2472,33 +2740,24 @@ namespace sqlite_orm {
                 using expression_type = typename statement_type::expression_type;
                 using object_type = typename expression_type::object_type;
                 auto index = 1;
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto &impl = this->get_impl<object_type>();
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 for(auto it = statement.t.range.first; it != statement.t.range.second; ++it) {
                     auto &o = *it;
                     impl.table.for_each_column([&o, &index, &stmt, db](auto &c) {
                         if(!c.template has<constraints::primary_key_t<>>()) {
                             using column_type = typename std::decay<decltype(c)>::type;
                             using field_type = typename column_type::field_type;
-                            if(c.member_pointer) {
-                                if(SQLITE_OK !=
-                                   statement_binder<field_type>().bind(stmt, index++, o.*c.member_pointer)) {
+                            call_with_column_value(c, o, [stmt, &index, db](auto &value, auto destructor) {
+                                if(SQLITE_OK != bind_value<field_type>(stmt, index++, value, destructor)) {
                                     throw std::system_error(
                                         std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                         sqlite3_errmsg(db));
                                 }
-                            } else {
-                                using getter_type = typename column_type::getter_type;
-                                field_value_holder<getter_type> valueHolder{((o).*(c.getter))()};
-                                if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, valueHolder.value)) {
-                                    throw std::system_error(
-                                        std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                        sqlite3_errmsg(db));
-                                }
-                            }
+                            });
                         }
                     });
                 }
@@ -2515,29 +2774,22 @@ namespace sqlite_orm {
                 using statement_type = typename std::decay<decltype(statement)>::type;
                 using expression_type = typename statement_type::expression_type;
                 using object_type = typename expression_object_type<expression_type>::type;
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 auto &o = get_object(statement.t);
                 auto &impl = this->get_impl<object_type>();
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 impl.table.for_each_column([&o, &index, &stmt, db](auto &c) {
                     using column_type = typename std::decay<decltype(c)>::type;
                     using field_type = typename column_type::field_type;
-                    if(c.member_pointer) {
-                        if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, o.*c.member_pointer)) {
-                            throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                                    sqlite3_errmsg(db));
-                        }
-                    } else {
-                        using getter_type = typename column_type::getter_type;
-                        field_value_holder<getter_type> valueHolder{((o).*(c.getter))()};
-                        if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, valueHolder.value)) {
+                    call_with_column_value(c, o, [stmt, &index, db](auto &value, auto destructor) {
+                        if(SQLITE_OK != bind_value<field_type>(stmt, index++, value, destructor)) {
                             throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                     sqlite3_errmsg(db));
                         }
-                    }
+                    });
                 });
                 if(sqlite3_step(stmt) == SQLITE_DONE) {
                     //..
@@ -2553,36 +2805,27 @@ namespace sqlite_orm {
                 using expression_type = typename statement_type::expression_type;
                 using object_type = typename expression_object_type<expression_type>::type;
                 int64 res = 0;
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 auto &impl = this->get_impl<object_type>();
                 auto &o = get_object(statement.t);
                 auto compositeKeyColumnNames = impl.table.composite_key_columns_names();
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 impl.table.for_each_column([&o, &index, &stmt, &impl, &compositeKeyColumnNames, db](auto &c) {
                     if(impl.table._without_rowid || !c.template has<constraints::primary_key_t<>>()) {
                         auto it = std::find(compositeKeyColumnNames.begin(), compositeKeyColumnNames.end(), c.name);
                         if(it == compositeKeyColumnNames.end()) {
                             using column_type = typename std::decay<decltype(c)>::type;
                             using field_type = typename column_type::field_type;
-                            if(c.member_pointer) {
-                                if(SQLITE_OK !=
-                                   statement_binder<field_type>().bind(stmt, index++, o.*c.member_pointer)) {
+                            call_with_column_value(c, o, [stmt, &index, db](auto &value, auto destructor) {
+                                if(SQLITE_OK != bind_value<field_type>(stmt, index++, value, destructor)) {
                                     throw std::system_error(
                                         std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                         sqlite3_errmsg(db));
                                 }
-                            } else {
-                                using getter_type = typename column_type::getter_type;
-                                field_value_holder<getter_type> valueHolder{((o).*(c.getter))()};
-                                if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, valueHolder.value)) {
-                                    throw std::system_error(
-                                        std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                        sqlite3_errmsg(db));
-                                }
-                            }
+                            });
                         }
                     }
                 });
@@ -2597,14 +2840,14 @@ namespace sqlite_orm {
 
             template<class T, class... Ids>
             void execute(const prepared_statement_t<remove_t<T, Ids...>> &statement) {
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t.ids, [stmt, &index, db](auto &v) {
                     using field_type = typename std::decay<decltype(v)>::type;
-                    if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, v)) {
+                    if(SQLITE_OK != bind_value<field_type>(stmt, index++, v, SQLITE_STATIC)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
@@ -2622,54 +2865,37 @@ namespace sqlite_orm {
                 using statement_type = typename std::decay<decltype(statement)>::type;
                 using expression_type = typename statement_type::expression_type;
                 using object_type = typename expression_object_type<expression_type>::type;
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto &impl = this->get_impl<object_type>();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 auto &o = get_object(statement.t);
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 impl.table.for_each_column([&o, stmt, &index, db](auto &c) {
                     if(!c.template has<constraints::primary_key_t<>>()) {
                         using column_type = typename std::decay<decltype(c)>::type;
                         using field_type = typename column_type::field_type;
-                        if(c.member_pointer) {
-                            auto bind_res = statement_binder<field_type>().bind(stmt, index++, o.*c.member_pointer);
-                            if(SQLITE_OK != bind_res) {
-                                throw std::system_error(
-                                    std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                    sqlite3_errmsg(db));
-                            }
-                        } else {
-                            using getter_type = typename column_type::getter_type;
-                            field_value_holder<getter_type> valueHolder{((o).*(c.getter))()};
-                            if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, valueHolder.value)) {
+                        call_with_column_value(c, o, [stmt, &index, db](auto &value, auto destructor) {
+                            if(SQLITE_OK != bind_value<field_type>(stmt, index++, value, destructor)) {
                                 throw std::system_error(
                                     std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                     sqlite3_errmsg(db));
                             }
-                        }
+                        });
                     }
                 });
                 impl.table.for_each_column([&o, stmt, &index, db](auto &c) {
                     if(c.template has<constraints::primary_key_t<>>()) {
                         using column_type = typename std::decay<decltype(c)>::type;
                         using field_type = typename column_type::field_type;
-                        if(c.member_pointer) {
-                            if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, o.*c.member_pointer)) {
+                        call_with_column_value(c, o, [stmt, &index, db](auto &value, auto destructor) {
+                            if(SQLITE_OK != bind_value<field_type>(stmt, index++, value, destructor)) {
                                 throw std::system_error(
                                     std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                     sqlite3_errmsg(db));
                             }
-                        } else {
-                            using getter_type = typename column_type::getter_type;
-                            field_value_holder<getter_type> valueHolder{((o).*(c.getter))()};
-                            if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, valueHolder.value)) {
-                                throw std::system_error(
-                                    std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                    sqlite3_errmsg(db));
-                            }
-                        }
+                        });
                     }
                 });
                 if(sqlite3_step(stmt) == SQLITE_DONE) {
@@ -2683,14 +2909,14 @@ namespace sqlite_orm {
             template<class T, class... Ids>
             std::unique_ptr<T> execute(const prepared_statement_t<get_pointer_t<T, Ids...>> &statement) {
                 auto &impl = this->get_impl<T>();
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t.ids, [stmt, &index, db](auto &v) {
                     using field_type = typename std::decay<decltype(v)>::type;
-                    if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, v)) {
+                    if(SQLITE_OK != bind_value<field_type>(stmt, index++, v, SQLITE_STATIC)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
@@ -2698,16 +2924,10 @@ namespace sqlite_orm {
                 auto stepRes = sqlite3_step(stmt);
                 switch(stepRes) {
                     case SQLITE_ROW: {
-                        auto res = std::make_unique<T>();
-                        index = 0;
-                        impl.table.for_each_column([&index, &res, stmt](auto &c) {
-                            using field_type = typename std::decay<decltype(c)>::type::field_type;
-                            auto value = row_extractor<field_type>().extract(stmt, index++);
-                            if(c.member_pointer) {
-                                (*res).*c.member_pointer = std::move(value);
-                            } else {
-                                ((*res).*(c.setter))(std::move(value));
-                            }
+                        std::unique_ptr<T> res;
+                        emplace_object(impl.table, stmt, [&res](auto &&... args) -> T & {
+                            res = std::make_unique<T>(std::forward<decltype(args)>(args)...);
+                            return *res;
                         });
                         return res;
                     } break;
@@ -2725,14 +2945,14 @@ namespace sqlite_orm {
             template<class T, class... Ids>
             std::optional<T> execute(const prepared_statement_t<get_optional_t<T, Ids...>> &statement) {
                 auto &impl = this->get_impl<T>();
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t.ids, [stmt, &index, db](auto &v) {
                     using field_type = typename std::decay<decltype(v)>::type;
-                    if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, v)) {
+                    if(SQLITE_OK != bind_value<field_type>(stmt, index++, v, SQLITE_STATIC)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
@@ -2740,16 +2960,9 @@ namespace sqlite_orm {
                 auto stepRes = sqlite3_step(stmt);
                 switch(stepRes) {
                     case SQLITE_ROW: {
-                        auto res = std::make_optional<T>();
-                        index = 0;
-                        impl.table.for_each_column([&index, &res, stmt](auto &c) {
-                            using field_type = typename std::decay<decltype(c)>::type::field_type;
-                            auto value = row_extractor<field_type>().extract(stmt, index++);
-                            if(c.member_pointer) {
-                                (*res).*c.member_pointer = std::move(value);
-                            } else {
-                                ((*res).*(c.setter))(std::move(value));
-                            }
+                        std::optional<T> res;
+                        emplace_object(impl.table, stmt, [&res](auto &&... args) -> T & {
+                            return res.emplace(std::forward<decltype(args)>(args)...);
                         });
                         return res;
                     } break;
@@ -2767,14 +2980,14 @@ namespace sqlite_orm {
             template<class T, class... Ids>
             T execute(const prepared_statement_t<get_t<T, Ids...>> &statement) {
                 auto &impl = this->get_impl<T>();
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t.ids, [stmt, &index, db](auto &v) {
                     using field_type = typename std::decay<decltype(v)>::type;
-                    if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, v)) {
+                    if(SQLITE_OK != bind_value<field_type>(stmt, index++, v, SQLITE_STATIC)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
@@ -2782,19 +2995,7 @@ namespace sqlite_orm {
                 auto stepRes = sqlite3_step(stmt);
                 switch(stepRes) {
                     case SQLITE_ROW: {
-                        T res;
-                        index = 0;
-                        impl.table.for_each_column([&index, &res, stmt](auto &c) {
-                            using column_type = typename std::decay<decltype(c)>::type;
-                            using field_type = typename column_type::field_type;
-                            auto value = row_extractor<field_type>().extract(stmt, index++);
-                            if(c.member_pointer) {
-                                res.*c.member_pointer = std::move(value);
-                            } else {
-                                ((res).*(c.setter))(std::move(value));
-                            }
-                        });
-                        return res;
+                        return make_object(impl.table, stmt);
                     } break;
                     case SQLITE_DONE: {
                         throw std::system_error(std::make_error_code(sqlite_orm::orm_error_code::not_found));
@@ -2808,14 +3009,14 @@ namespace sqlite_orm {
 
             template<class T, class... Args>
             void execute(const prepared_statement_t<remove_all_t<T, Args...>> &statement) {
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t.conditions, [stmt, &index, db](auto &node) {
                     using node_type = typename std::decay<decltype(node)>::type;
-                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                     if(SQLITE_OK != binder(node)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
@@ -2831,15 +3032,15 @@ namespace sqlite_orm {
 
             template<class... Args, class... Wargs>
             void execute(const prepared_statement_t<update_all_t<set_t<Args...>, Wargs...>> &statement) {
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_tuple(statement.t.set.assigns, [&index, stmt, db](auto &setArg) {
                     iterate_ast(setArg, [&index, stmt, db](auto &node) {
                         using node_type = typename std::decay<decltype(node)>::type;
-                        conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                        conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                         if(SQLITE_OK != binder(node)) {
                             throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                     sqlite3_errmsg(db));
@@ -2848,7 +3049,7 @@ namespace sqlite_orm {
                 });
                 iterate_ast(statement.t.conditions, [stmt, &index, db](auto &node) {
                     using node_type = typename std::decay<decltype(node)>::type;
-                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                     if(SQLITE_OK != binder(node)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
@@ -2864,20 +3065,32 @@ namespace sqlite_orm {
 
             template<class T, class... Args, class R = typename column_result_t<self, T>::type>
             std::vector<R> execute(const prepared_statement_t<select_t<T, Args...>> &statement) {
-                auto con = this->get_connection();
-                auto db = con.get();
+                std::vector<R> res;
+                this->execute(statement, into(res));
+                return res;
+            }
+
+            /**
+             *  Clears `target.container` and appends the selected rows to it.
+             */
+            template<class T, class... Args, class C>
+            C &execute(const prepared_statement_t<select_t<T, Args...>> &statement, into_t<C> target) {
+                using R = typename column_result_t<self, T>::type;
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t, [stmt, &index, db](auto &node) {
                     using node_type = typename std::decay<decltype(node)>::type;
-                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                     if(SQLITE_OK != binder(node)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
                 });
-                std::vector<R> res;
+                auto &res = target.container;
+                res.clear();
                 int stepRes;
                 do {
                     stepRes = sqlite3_step(stmt);
@@ -2896,40 +3109,82 @@ namespace sqlite_orm {
                 return res;
             }
 
+            /**
+             *  Executes a prepared multicolumn select and extracts rows into `columnar_result`.
+             */
+            template<class... Cs, class... Args, class R = columnar_result_t<self, columns_t<Cs...>>>
+            R execute_columnar(const prepared_statement_t<select_t<columns_t<Cs...>, Args...>> &statement) {
+                auto db = statement.con.get();
+                auto stmt = statement.stmt;
+                auto index = 1;
+                sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
+                iterate_ast(statement.t, [stmt, &index, db](auto &node) {
+                    using node_type = typename std::decay<decltype(node)>::type;
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
+                    if(SQLITE_OK != binder(node)) {
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
+                    }
+                });
+                R res;
+                int stepRes;
+                do {
+                    stepRes = sqlite3_step(stmt);
+                    switch(stepRes) {
+                        case SQLITE_ROW: {
+                            res.push_back(stmt);
+                        } break;
+                        case SQLITE_DONE:
+                            break;
+                        default: {
+                            throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                    sqlite3_errmsg(db));
+                        }
+                    }
+                } while(stepRes != SQLITE_DONE);
+                return res;
+            }
+
             template<class T, class... Args>
             std::vector<T> execute(const prepared_statement_t<get_all_t<T, Args...>> &statement) {
+                std::vector<T> res;
+                this->execute(statement, into(res));
+                return res;
+            }
+
+            /**
+             *  Clears `target.container` and appends all objects to it.
+             */
+            template<class T, class... Args, class C>
+            C &execute(const prepared_statement_t<get_all_t<T, Args...>> &statement, into_t<C> target) {
                 auto &impl = this->get_impl<T>();
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t, [stmt, &index, db](auto &node) {
                     using node_type = typename std::decay<decltype(node)>::type;
-                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                     if(SQLITE_OK != binder(node)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
                 });
-                std::vector<T> res;
+                auto &res = target.container;
+                res.clear();
+                using conditions_type = typename get_all_t<T, Args...>::conditions_type;
+                this->reserve_result<conditions_type>(impl.table.name, db, res);
                 int stepRes;
                 do {
                     stepRes = sqlite3_step(stmt);
                     switch(stepRes) {
                         case SQLITE_ROW: {
-                            T obj;
-                            auto index = 0;
-                            impl.table.for_each_column([&index, &obj, stmt](auto &c) {
-                                using field_type = typename std::decay<decltype(c)>::type::field_type;
-                                auto value = row_extractor<field_type>().extract(stmt, index++);
-                                if(c.member_pointer) {
-                                    obj.*c.member_pointer = std::move(value);
-                                } else {
-                                    ((obj).*(c.setter))(std::move(value));
-                                }
+                            emplace_object(impl.table, stmt, [&res](auto &&... args) -> T & {
+                                res.emplace_back(std::forward<decltype(args)>(args)...);
+                                return res.back();
                             });
-                            res.push_back(std::move(obj));
                         } break;
                         case SQLITE_DONE:
                             break;
@@ -2939,44 +3194,50 @@ namespace sqlite_orm {
                         }
                     }
                 } while(stepRes != SQLITE_DONE);
+                this->remember_result_size<conditions_type>(impl.table.name, res.size());
                 return res;
             }
 
             template<class T, class... Args>
             std::vector<std::unique_ptr<T>>
             execute(const prepared_statement_t<get_all_pointer_t<T, Args...>> &statement) {
+                std::vector<std::unique_ptr<T>> res;
+                this->execute(statement, into(res));
+                return res;
+            }
+
+            /**
+             *  Clears `target.container` and appends all objects to it.
+             */
+            template<class T, class... Args, class C>
+            C &execute(const prepared_statement_t<get_all_pointer_t<T, Args...>> &statement, into_t<C> target) {
                 auto &impl = this->get_impl<T>();
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t, [stmt, &index, db](auto &node) {
                     using node_type = typename std::decay<decltype(node)>::type;
-                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                     if(SQLITE_OK != binder(node)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
                 });
-                std::vector<std::unique_ptr<T>> res;
+                auto &res = target.container;
+                res.clear();
+                using conditions_type = typename get_all_pointer_t<T, Args...>::conditions_type;
+                this->reserve_result<conditions_type>(impl.table.name, db, res);
                 int stepRes;
                 do {
                     stepRes = sqlite3_step(stmt);
                     switch(stepRes) {
                         case SQLITE_ROW: {
-                            auto obj = std::make_unique<T>();
-                            auto index = 0;
-                            impl.table.for_each_column([&index, &obj, stmt](auto &c) {
-                                using field_type = typename std::decay<decltype(c)>::type::field_type;
-                                auto value = row_extractor<field_type>().extract(stmt, index++);
-                                if(c.member_pointer) {
-                                    (*obj).*c.member_pointer = std::move(value);
-                                } else {
-                                    ((*obj).*(c.setter))(std::move(value));
-                                }
+                            emplace_object(impl.table, stmt, [&res](auto &&... args) -> T & {
+                                res.push_back(std::make_unique<T>(std::forward<decltype(args)>(args)...));
+                                return *res.back();
                             });
-                            res.push_back(std::move(obj));
                         } break;
                         case SQLITE_DONE:
                             break;
@@ -2986,6 +3247,7 @@ namespace sqlite_orm {
                         }
                     }
                 } while(stepRes != SQLITE_DONE);
+                this->remember_result_size<conditions_type>(impl.table.name, res.size());
                 return res;
             }
 
@@ -2993,38 +3255,43 @@ namespace sqlite_orm {
             template<class T, class... Args>
             std::vector<std::optional<T>>
             execute(const prepared_statement_t<get_all_optional_t<T, Args...>> &statement) {
+                std::vector<std::optional<T>> res;
+                this->execute(statement, into(res));
+                return res;
+            }
+
+            /**
+             *  Clears `target.container` and appends all objects to it.
+             */
+            template<class T, class... Args, class C>
+            C &execute(const prepared_statement_t<get_all_optional_t<T, Args...>> &statement, into_t<C> target) {
                 auto &impl = this->get_impl<T>();
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t, [stmt, &index, db](auto &node) {
                     using node_type = typename std::decay<decltype(node)>::type;
-                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                     if(SQLITE_OK != binder(node)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
                 });
-                std::vector<std::optional<T>> res;
+                auto &res = target.container;
+                res.clear();
+                using conditions_type = typename get_all_optional_t<T, Args...>::conditions_type;
+                this->reserve_result<conditions_type>(impl.table.name, db, res);
                 int stepRes;
                 do {
                     stepRes = sqlite3_step(stmt);
                     switch(stepRes) {
                         case SQLITE_ROW: {
-                            auto obj = std::make_optional<T>();
-                            auto index = 0;
-                            impl.table.for_each_column([&index, &obj, stmt](auto &c) {
-                                using field_type = typename std::decay<decltype(c)>::type::field_type;
-                                auto value = row_extractor<field_type>().extract(stmt, index++);
-                                if(c.member_pointer) {
-                                    (*obj).*c.member_pointer = std::move(value);
-                                } else {
-                                    ((*obj).*(c.setter))(std::move(value));
-                                }
+                            emplace_object(impl.table, stmt, [&res](auto &&... args) -> T & {
+                                res.emplace_back(std::in_place, std::forward<decltype(args)>(args)...);
+                                return *res.back();
                             });
-                            res.push_back(std::move(obj));
                         } break;
                         case SQLITE_DONE:
                             break;
@@ -3034,6 +3301,7 @@ namespace sqlite_orm {
                         }
                     }
                 } while(stepRes != SQLITE_DONE);
+                this->remember_result_size<conditions_type>(impl.table.name, res.size());
                 return res;
             }
 #endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
@@ -3051,6 +3319,33 @@ namespace sqlite_orm {
         return {filename, internal::storage_impl<Ts...>(tables...)};
     }
 
+    /**
+     *  Creates a storage with a pool of reader connections. E.g.
+     *  `auto storage = make_storage("db.sqlite", pool_options{4}, make_table(...));`
+     */
+    template<class... Ts>
+    internal::storage_t<Ts...> make_storage(const std::string &filename, pool_options poolOptions, Ts... tables) {
+        return {filename, poolOptions, internal::storage_impl<Ts...>(tables...)};
+    }
+
+    /**
+     *  Creates a storage which opens connections with `sqlite3_open_v2` arguments. E.g.
+     *  `auto storage = make_storage("db.sqlite", open_options{SQLITE_OPEN_READONLY}, make_table(...));`
+     */
+    template<class... Ts>
+    internal::storage_t<Ts...> make_storage(const std::string &filename, open_options openOptions, Ts... tables) {
+        return {filename, std::move(openOptions), pool_options{}, internal::storage_impl<Ts...>(tables...)};
+    }
+
+    /**
+     *  Creates a storage with `sqlite3_open_v2` arguments and a pool of reader connections.
+     */
+    template<class... Ts>
+    internal::storage_t<Ts...>
+    make_storage(const std::string &filename, open_options openOptions, pool_options poolOptions, Ts... tables) {
+        return {filename, std::move(openOptions), poolOptions, internal::storage_impl<Ts...>(tables...)};
+    }
+
     /**
      *  sqlite3_threadsafe() interface.
      */
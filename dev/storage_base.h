@@ -11,21 +11,48 @@
 #include <map>  //  std::map
 #include <type_traits>  //  std::decay, std::is_same
 #include <algorithm>  //  std::iter_swap
+#include <thread>  //  std::this_thread::get_id, std::this_thread::sleep_for, std::thread::id
+#include <atomic>  //  std::atomic
+#include <chrono>  //  std::chrono::milliseconds
+#include <mutex>  //  std::mutex, std::lock_guard
 
 #include "pragma.h"
 #include "limit_accesor.h"
 #include "transaction_guard.h"
+#include "transaction_options.h"
+#include "busy_handler.h"
 #include "statement_finalizer.h"
 #include "type_printer.h"
 #include "tuple_helper.h"
 #include "row_extractor.h"
 #include "connection_holder.h"
+#include "connection_pool.h"
+#include "write_queue.h"
+#include "wal_checkpointer.h"
 #include "backup.h"
 
 namespace sqlite_orm {
 
     namespace internal {
 
+        /**
+         *  Returns `identifier` enclosed in double quotes. Embedded double quotes are doubled so any string
+         *  may be used as an identifier.
+         */
+        inline std::string quote_identifier(const std::string &identifier) {
+            std::string res;
+            res.reserve(identifier.size() + 2);
+            res += '"';
+            for(auto c: identifier) {
+                if(c == '"') {
+                    res += '"';
+                }
+                res += c;
+            }
+            res += '"';
+            return res;
+        }
+
         struct storage_base {
             using collating_function = std::function<int(int, const void *, int, const void *)>;
 
@@ -33,11 +60,96 @@ namespace sqlite_orm {
             pragma_t pragma;
             limit_accesor limit;
 
+            /**
+             *  Begins a transaction and returns its guard. If the calling thread is inside a transaction already
+             *  the guard controls a savepoint instead (see `savepoint_guard`).
+             */
             transaction_guard_t transaction_guard() {
+                if(this->in_transaction()) {
+                    return this->savepoint_guard(nested_savepoint_name());
+                }
                 this->begin_transaction();
-                auto commitFunc = std::bind(static_cast<void (storage_base::*)()>(&storage_base::commit), this);
-                auto rollbackFunc = std::bind(static_cast<void (storage_base::*)()>(&storage_base::rollback), this);
-                return {this->get_connection(), move(commitFunc), move(rollbackFunc)};
+                return this->make_transaction_guard();
+            }
+
+            /**
+             *  Begins a transaction in `options.mode`. `BEGIN` failed with SQLITE_BUSY or SQLITE_LOCKED is retried
+             *  up to `options.max_retries` times. Statements executed via the guard are not retried so use
+             *  `transaction_mode::immediate` or `transaction_mode::exclusive` to take the write lock right away.
+             */
+            transaction_guard_t transaction_guard(transaction_options options) {
+                if(this->in_transaction()) {
+                    return this->savepoint_guard(nested_savepoint_name());
+                }
+                this->retry_busy(options, [this, &options] {
+                    this->begin_transaction(options.mode);
+                });
+                return this->make_transaction_guard();
+            }
+
+            /**
+             *  Executes `SAVEPOINT name` and returns a guard which releases the savepoint on `commit()` and
+             *  rolls back to it and releases it on `rollback()` or in destructor. Works both inside and outside
+             *  of a transaction.
+             */
+            savepoint_guard_t savepoint_guard(const std::string &name) {
+                this->savepoint(name);
+                auto releaseFunc = std::bind(&storage_base::release_savepoint, this, name);
+                auto rollbackFunc = [this, name] {
+                    this->rollback_to_savepoint(name);
+                    this->release_savepoint(name);
+                };
+                return {this->get_connection(), std::move(releaseFunc), std::move(rollbackFunc)};
+            }
+
+            /**
+             *  Executes `SAVEPOINT name`. Outside of a transaction it begins a deferred transaction which is
+             *  committed by `release_savepoint(name)`. Inside a transaction it marks a point the transaction
+             *  may be rolled back to. Releasing a nested savepoint doesn't write anything to disk so it is
+             *  cheap to wrap a batch of writes inside a large transaction. Every `savepoint` call must be paired
+             *  with a `release_savepoint` call.
+             */
+            void savepoint(const std::string &name) {
+                this->connection->retain();
+                auto db = this->connection->get();
+                try {
+                    this->perform_savepoint_statement(db, "SAVEPOINT ", name);
+                } catch(...) {
+                    this->connection->release();
+                    throw;
+                }
+                this->transactionThreadId = std::this_thread::get_id();
+            }
+
+            /**
+             *  Executes `RELEASE SAVEPOINT name`. Releasing the outermost savepoint commits the transaction.
+             */
+            void release_savepoint(const std::string &name) {
+                auto db = this->connection->get();
+                this->perform_savepoint_statement(db, "RELEASE SAVEPOINT ", name);
+                if(sqlite3_get_autocommit(db)) {
+                    this->transactionThreadId = std::thread::id();
+                }
+                this->connection->release();
+                if(this->connection->retain_count() < 0) {
+                    throw std::system_error(std::make_error_code(orm_error_code::no_active_transaction));
+                }
+            }
+
+            /**
+             *  Executes `ROLLBACK TO SAVEPOINT name`. Changes made after the savepoint are discarded but
+             *  the savepoint stays active so it must be released still.
+             */
+            void rollback_to_savepoint(const std::string &name) {
+                auto db = this->connection->get();
+                this->perform_savepoint_statement(db, "ROLLBACK TO SAVEPOINT ", name);
+            }
+
+            /**
+             *  @return true if the calling thread has begun a transaction or a savepoint which is not finished yet.
+             */
+            bool in_transaction() const {
+                return this->transactionThreadId == std::this_thread::get_id();
             }
 
             void drop_index(const std::string &indexName) {
@@ -86,6 +198,203 @@ namespace sqlite_orm {
             void drop_table(const std::string &tableName) {
                 auto con = this->get_connection();
                 this->drop_table_internal(tableName, con.get());
+                this->clear_statement_cache();
+            }
+
+            /**
+             *  Enables or disables the statement cache. When it is enabled statements prepared by the storage
+             *  (e.g. inside `get`, `insert`, `update`, `replace`, `remove` and explicit `prepare` calls) are not
+             *  finalized after use but are reset and kept by their connection to be reused next time.
+             *  Cache is cleared by `sync_schema`, `drop_table` and when a connection is closed.
+             */
+            void enable_statement_cache(bool value = true) {
+                this->statementCacheEnabled = value;
+                if(!value) {
+                    this->clear_statement_cache();
+                }
+            }
+
+            bool statement_cache_enabled() const {
+                return this->statementCacheEnabled;
+            }
+
+            /**
+             *  Finalizes all cached statements that are not used at the moment. Statements used at the moment
+             *  are finalized once they are released.
+             */
+            void clear_statement_cache() {
+                this->connection->cache.clear();
+                if(this->pool) {
+                    this->pool->clear_caches();
+                }
+            }
+
+            /**
+             *  @return amount of statements taken from the statement cache.
+             */
+            int64 statement_cache_hits() const {
+                return this->statementCacheHits;
+            }
+
+            /**
+             *  @return amount of statements prepared cause they were not found in the statement cache.
+             */
+            int64 statement_cache_misses() const {
+                return this->statementCacheMisses;
+            }
+
+            /**
+             *  @return amount of SQL texts of primary key CRUD statements serialized by this storage. Every text
+             *  is serialized once per mapped type and reused afterwards. A copy of a storage serializes its own texts.
+             */
+            int64 static_sql_serializations_count() const {
+                return this->staticSqlSerializationsCount;
+            }
+
+            /**
+             *  Enables or disables reserving result vectors of `get_all`, `get_all_pointer` and `get_all_optional`
+             *  by an estimate of the table rows count. The first estimate of a table is read from `sqlite_stat1`
+             *  (filled by `ANALYZE`), later ones are the size of the previous result. Only queries without
+             *  conditions other than `order_by` are reserved cause filtered results may be much smaller than
+             *  the table. Pass a reserved container with `into` to reserve filtered results.
+             */
+            void enable_result_size_estimate(bool value = true) {
+                this->resultSizeEstimateEnabled = value;
+            }
+
+            bool result_size_estimate_enabled() const {
+                return this->resultSizeEstimateEnabled;
+            }
+
+            /**
+             *  Starts a group commit queue. Writes passed to `enqueue_write` from any thread are executed by
+             *  a single writer thread, and all writes collected while the previous batch was committed are
+             *  executed in one transaction. Enables the statement cache so statements are not prepared
+             *  for every write. Does nothing if the queue is started already.
+             *  While the queue is running other writes must not be done via the main connection
+             *  cause they would be executed inside a transaction of the writer thread.
+             */
+            void start_write_queue(write_queue_options options = {}) {
+                if(!this->writeQueue) {
+                    this->enable_statement_cache();
+                    this->writeQueue = std::make_unique<write_queue>(
+                        options,
+                        this->get_connection(),
+                        [this] {
+                            this->begin_transaction();
+                        },
+                        [this] {
+                            this->commit();
+                        },
+                        [this] {
+                            this->abort_transaction();
+                        });
+                }
+            }
+
+            /**
+             *  Executes all enqueued writes and stops the writer thread. Must not be called while
+             *  other threads enqueue writes.
+             */
+            void stop_write_queue() {
+                this->writeQueue.reset();
+            }
+
+            /**
+             *  Enqueues a write into the group commit queue started with `start_write_queue`. `write` may execute
+             *  several statements: it is executed inside its own savepoint so if it throws none of its changes
+             *  are committed.
+             *  @return future which gets a result of `write` after it is committed or an exception thrown by
+             *  `write` or by the commit.
+             */
+            std::future<int64> enqueue_write(std::function<int64()> write) {
+                if(this->writeQueue) {
+                    return this->writeQueue->push(std::move(write));
+                } else {
+                    throw std::system_error(std::make_error_code(orm_error_code::write_queue_is_not_started));
+                }
+            }
+
+            /**
+             *  @return amount of transactions committed by the write queue.
+             */
+            int64 write_queue_commits_count() const {
+                return this->writeQueue ? this->writeQueue->commits_count() : 0;
+            }
+
+            /**
+             *  @return amount of writes executed by the write queue.
+             */
+            int64 write_queue_writes_count() const {
+                return this->writeQueue ? this->writeQueue->writes_count() : 0;
+            }
+
+            /**
+             *  Starts a background thread which runs WAL checkpoints with its own connection. Switches
+             *  the database to `journal_mode::WAL` if it is not in WAL mode yet. Automatic checkpoints
+             *  are disabled for connections of this storage so commits never run checkpoints inline:
+             *  a checkpoint is triggered once WAL grows by `options.wal_frames` frames or every
+             *  `options.interval`. Does nothing if the checkpointer is started already or the database
+             *  is in-memory.
+             */
+            void start_wal_checkpointer(wal_checkpointer_options options = {}) {
+                if(this->walCheckpointer || this->inMemory) {
+                    return;
+                }
+                if(this->pragma.journal_mode() != journal_mode::WAL) {
+                    this->pragma.journal_mode(journal_mode::WAL);
+                }
+                auto holder = std::make_unique<connection_holder>(
+                    this->connection->filename,
+                    std::bind(&storage_base::on_open_internal, this, std::placeholders::_1),
+                    this->connection->options);
+                auto checkpointer = std::make_unique<wal_checkpointer>(options, connection_ref{*holder});
+                auto con = this->get_connection();
+                checkpointer->install_hook(con.get());
+                this->walCheckpointerConnection = std::move(holder);
+                this->walCheckpointer = std::move(checkpointer);
+            }
+
+            /**
+             *  Stops the checkpointer thread and restores automatic checkpoints.
+             */
+            void stop_wal_checkpointer() {
+                if(!this->walCheckpointer) {
+                    return;
+                }
+                auto checkpointer = std::move(this->walCheckpointer);
+                if(this->connection->is_open()) {
+                    auto con = this->get_connection();
+                    this->restore_autocheckpoint(con.get());
+                }
+                if(this->pool) {
+                    this->pool->for_each_opened_reader([this](sqlite3 *db) {
+                        this->restore_autocheckpoint(db);
+                    });
+                }
+                checkpointer.reset();
+                this->walCheckpointerConnection.reset();
+            }
+
+            /**
+             *  Runs a checkpoint right now with the checkpointer connection and mode. Does nothing
+             *  if the checkpointer is not started.
+             */
+            void wal_checkpoint() {
+                if(this->walCheckpointer) {
+                    this->walCheckpointer->checkpoint();
+                }
+            }
+
+            /**
+             *  @return statistics of the checkpointer. All values are zero if it was not started.
+             */
+            wal_checkpoint_stats wal_checkpointer_stats() {
+                if(this->walCheckpointer) {
+                    return this->walCheckpointer->stats();
+                } else {
+                    return {};
+                }
             }
 
             /**
@@ -109,9 +418,56 @@ namespace sqlite_orm {
                 return sqlite3_last_insert_rowid(con.get());
             }
 
+            /**
+             *  Sets busy timeout of the current connection. The value is remembered and applied
+             *  to every connection opened later just like `pragma.busy_timeout(ms)` does.
+             *  Removes a busy handler set with `busy_handler`.
+             */
             int busy_timeout(int ms) {
+                if(this->busyHandlerPolicy) {
+                    this->set_busy_handler_policy(nullptr);
+                    if(this->pool) {
+                        this->pool->for_each_opened_reader([ms](sqlite3 *db) {
+                            sqlite3_busy_timeout(db, ms);
+                        });
+                    }
+                }
                 auto con = this->get_connection();
-                return sqlite3_busy_timeout(con.get(), ms);
+                auto rc = sqlite3_busy_timeout(con.get(), ms);
+                if(rc == SQLITE_OK) {
+                    this->pragma.set_persistent_pragma_value("busy_timeout", std::to_string(ms));
+                }
+                return rc;
+            }
+
+            /**
+             *  Sets a busy handler of the storage connection and reader connections. It replaces a busy timeout
+             *  and is installed again every time a connection is opened. Every connection collects its own
+             *  contention statistics.
+             *  Usage: `storage.busy_handler(exponential_backoff_policy(std::chrono::milliseconds(5000)));`
+             */
+            void busy_handler(busy_handler_policy policy) {
+                this->pragma.erase_persistent_pragma("busy_timeout");
+                this->set_busy_handler_policy(std::make_shared<const busy_handler_policy>(std::move(policy)));
+            }
+
+            /**
+             *  @return contention statistics of the storage (writer) connection. All values are zero
+             *  if no busy handler was set.
+             */
+            busy_handler_stats busy_stats() {
+                return this->connection->busy_stats();
+            }
+
+            /**
+             *  @return contention statistics summed over reader connections.
+             */
+            busy_handler_stats readers_busy_stats() {
+                if(this->pool) {
+                    return this->pool->busy_stats();
+                } else {
+                    return {};
+                }
             }
 
             /**
@@ -121,19 +477,56 @@ namespace sqlite_orm {
                 return sqlite3_libversion();
             }
 
+            /**
+             *  Runs `f` inside a transaction which is committed if `f` returns true and rolled back otherwise.
+             *  If the calling thread is inside a transaction already `f` is run inside a savepoint so only
+             *  changes made by `f` are rolled back and nothing is committed until the outer transaction is.
+             */
             bool transaction(std::function<bool()> f) {
+                if(this->in_transaction()) {
+                    return this->nested_transaction(f);
+                }
                 this->begin_transaction();
-                auto con = this->get_connection();
-                auto db = con.get();
                 auto shouldCommit = f();
                 if(shouldCommit) {
-                    this->commit(db);
+                    this->commit();
                 } else {
-                    this->rollback(db);
+                    this->rollback();
                 }
                 return shouldCommit;
             }
 
+            /**
+             *  Runs `f` inside a transaction begun in `options.mode`. If `f`, `BEGIN` or `COMMIT` fails with
+             *  SQLITE_BUSY or SQLITE_LOCKED the transaction is rolled back and `f` is called again in a new
+             *  transaction after a backoff delay, up to `options.max_retries` times. So `f` must not have side
+             *  effects outside of the database. Other exceptions are rethrown after the rollback.
+             *  Called inside a transaction it runs `f` inside a savepoint once: a retry must restart
+             *  the outer transaction.
+             *  @return true if the transaction is committed, false if `f` asked to roll it back.
+             */
+            bool transaction(const std::function<bool()> &f, transaction_options options) {
+                if(this->in_transaction()) {
+                    return this->nested_transaction(f);
+                }
+                return this->retry_busy(options, [this, &f, &options] {
+                    this->begin_transaction(options.mode);
+                    auto shouldCommit = false;
+                    try {
+                        shouldCommit = f();
+                        if(shouldCommit) {
+                            this->commit();
+                        } else {
+                            this->rollback();
+                        }
+                    } catch(...) {
+                        this->abort_transaction();
+                        throw;
+                    }
+                    return shouldCommit;
+                });
+            }
+
             std::string current_timestamp() {
                 auto con = this->get_connection();
                 return this->current_timestamp(con.get());
@@ -188,8 +581,57 @@ namespace sqlite_orm {
             void open_forever() {
                 this->isOpenedForever = true;
                 this->connection->retain();
-                if(1 == this->connection->retain_count()) {
-                    this->on_open_internal(this->connection->get());
+            }
+
+            /**
+             *  Sets when the database connection is closed after the last call that used it. By default
+             *  it is closed right away (`connection_lifetime::per_call`) so every call made outside of
+             *  a transaction reopens the database file and loses sqlite's page cache and cached statements.
+             *  `idleTimeout` is used by `connection_lifetime::idle_timeout` only. Has no effect on in-memory
+             *  databases which are always open.
+             */
+            void set_connection_lifetime(connection_lifetime lifetime,
+                                         std::chrono::milliseconds idleTimeout = std::chrono::milliseconds(1000)) {
+                this->connection->set_lifetime(lifetime, idleTimeout);
+            }
+
+            connection_lifetime get_connection_lifetime() const {
+                return this->connection->get_lifetime();
+            }
+
+            /**
+             *  @return amount of times database connections of this storage (including pooled readers)
+             *  have been opened.
+             */
+            int64 connection_opens_count() const {
+                auto res = this->connection->opens_count();
+                if(this->pool) {
+                    res += this->pool->opens_count();
+                }
+                return res;
+            }
+
+            /**
+             *  @return amount of times database connections of this storage (including pooled readers)
+             *  have been closed.
+             */
+            int64 connection_closes_count() const {
+                auto res = this->connection->closes_count();
+                if(this->pool) {
+                    res += this->pool->closes_count();
+                }
+                return res;
+            }
+
+            /**
+             *  @return amount of pooled reader connections opened at the moment. Always 0 for a storage
+             *  created without `pool_options`.
+             */
+            int opened_readers_count() {
+                if(this->pool) {
+                    return this->pool->opened_readers_count();
+                } else {
+                    return 0;
                 }
             }
 
@@ -202,13 +644,14 @@ namespace sqlite_orm {
                 }
 
                 //  create collations if db is open
-                if(this->connection->retain_count() > 0) {
-                    auto db = this->connection->get();
+                if(this->connection->is_open()) {
+                    auto con = this->get_connection();
+                    auto db = con.get();
                     if(sqlite3_create_collation(db,
                                                 name.c_str(),
                                                 SQLITE_UTF8,
                                                 functionPointer,
-                                                f ? collate_callback : nullptr) != SQLITE_OK) {
+                                                functionPointer ? collate_callback : nullptr) != SQLITE_OK) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
@@ -216,17 +659,25 @@ namespace sqlite_orm {
             }
 
             void begin_transaction() {
+                this->begin_transaction(transaction_mode::deferred);
+            }
+
+            void begin_transaction(transaction_mode mode) {
                 this->connection->retain();
-                if(1 == this->connection->retain_count()) {
-                    this->on_open_internal(this->connection->get());
-                }
                 auto db = this->connection->get();
-                this->begin_transaction(db);
+                try {
+                    this->begin_transaction(db, mode);
+                } catch(...) {
+                    this->connection->release();
+                    throw;
+                }
+                this->transactionThreadId = std::this_thread::get_id();
             }
 
             void commit() {
                 auto db = this->connection->get();
                 this->commit(db);
+                this->transactionThreadId = std::thread::id();
                 this->connection->release();
                 if(this->connection->retain_count() < 0) {
                     throw std::system_error(std::make_error_code(orm_error_code::no_active_transaction));
@@ -236,14 +687,15 @@ namespace sqlite_orm {
             void rollback() {
                 auto db = this->connection->get();
                 this->rollback(db);
+                this->transactionThreadId = std::thread::id();
                 this->connection->release();
                 if(this->connection->retain_count() < 0) {
                     throw std::system_error(std::make_error_code(orm_error_code::no_active_transaction));
                 }
             }
 
-            void backup_to(const std::string &filename) {
-                auto backup = this->make_backup_to(filename);
+            void backup_to(const std::string &filename, open_options openOptions = {}) {
+                auto backup = this->make_backup_to(filename, std::move(openOptions));
                 backup.step(-1);
             }
 
@@ -252,8 +704,8 @@ namespace sqlite_orm {
                 backup.step(-1);
             }
 
-            void backup_from(const std::string &filename) {
-                auto backup = this->make_backup_from(filename);
+            void backup_from(const std::string &filename, open_options openOptions = {}) {
+                auto backup = this->make_backup_from(filename, std::move(openOptions));
                 backup.step(-1);
             }
 
@@ -262,8 +714,11 @@ namespace sqlite_orm {
                 backup.step(-1);
             }
 
-            backup_t make_backup_to(const std::string &filename) {
-                auto holder = std::make_unique<connection_holder>(filename);
+            /**
+             *  Creates a backup into the database `filename`. `openOptions` are used to open it.
+             */
+            backup_t make_backup_to(const std::string &filename, open_options openOptions = {}) {
+                auto holder = std::make_unique<connection_holder>(filename, nullptr, std::move(openOptions));
                 return {connection_ref{*holder}, "main", this->get_connection(), "main", move(holder)};
             }
 
@@ -271,8 +726,11 @@ namespace sqlite_orm {
                 return {other.get_connection(), "main", this->get_connection(), "main", {}};
             }
 
-            backup_t make_backup_from(const std::string &filename) {
-                auto holder = std::make_unique<connection_holder>(filename);
+            /**
+             *  Creates a backup from the database `filename`. `openOptions` are used to open it.
+             */
+            backup_t make_backup_from(const std::string &filename, open_options openOptions = {}) {
+                auto holder = std::make_unique<connection_holder>(filename, nullptr, std::move(openOptions));
                 return {this->get_connection(), "main", connection_ref{*holder}, "main", move(holder)};
             }
 
@@ -284,26 +742,52 @@ namespace sqlite_orm {
                 return this->connection->filename;
             }
 
+            const open_options &get_open_options() const {
+                return this->connection->options;
+            }
+
           protected:
-            storage_base(const std::string &filename_, int foreignKeysCount) :
+            storage_base(const std::string &filename_,
+                         int foreignKeysCount,
+                         pool_options poolOptions = {},
+                         open_options openOptions = {}) :
                 pragma(std::bind(&storage_base::get_connection, this)),
                 limit(std::bind(&storage_base::get_connection, this)),
                 inMemory(filename_.empty() || filename_ == ":memory:"),
-                connection(std::make_unique<connection_holder>(filename_)), cachedForeignKeysCount(foreignKeysCount) {
+                connection(std::make_unique<connection_holder>(
+                    filename_,
+                    std::bind(&storage_base::on_open_internal, this, std::placeholders::_1),
+                    std::move(openOptions))),
+                cachedForeignKeysCount(foreignKeysCount) {
+                this->init_pool(poolOptions);
                 if(this->inMemory) {
                     this->connection->retain();
-                    this->on_open_internal(this->connection->get());
                 }
             }
 
             storage_base(const storage_base &other) :
                 on_open(other.on_open), pragma(std::bind(&storage_base::get_connection, this)),
                 limit(std::bind(&storage_base::get_connection, this)), inMemory(other.inMemory),
-                connection(std::make_unique<connection_holder>(other.connection->filename)),
-                cachedForeignKeysCount(other.cachedForeignKeysCount) {
+                connection(std::make_unique<connection_holder>(
+                    other.connection->filename,
+                    std::bind(&storage_base::on_open_internal, this, std::placeholders::_1),
+                    other.connection->options)),
+                cachedForeignKeysCount(other.cachedForeignKeysCount),
+                statementCacheEnabled(other.statementCacheEnabled.load()),
+                resultSizeEstimateEnabled(other.resultSizeEstimateEnabled.load()) {
+                this->pragma._persistent_pragmas = other.pragma.persistent_pragmas();
+                if(other.busyHandlerPolicy) {
+                    this->set_busy_handler_policy(other.busyHandlerPolicy);
+                }
+                if(other.pool) {
+                    this->init_pool(other.pool->options);
+                }
+                auto lifetime = other.connection->get_lifetime();
+                if(lifetime != connection_lifetime::per_call) {
+                    this->connection->set_lifetime(lifetime, other.connection->get_idle_timeout());
+                }
                 if(this->inMemory) {
                     this->connection->retain();
-                    this->on_open_internal(this->connection->get());
                 }
             }
 
@@ -319,15 +803,65 @@ namespace sqlite_orm {
             const bool inMemory;
             bool isOpenedForever = false;
             std::unique_ptr<connection_holder> connection;
+            std::unique_ptr<connection_pool> pool;
+            std::atomic<std::thread::id> transactionThreadId{std::thread::id()};
             std::map<std::string, collating_function> collatingFunctions;
             const int cachedForeignKeysCount;
+            std::atomic<bool> statementCacheEnabled{false};
+            std::atomic<int64> statementCacheHits{0};
+            std::atomic<int64> statementCacheMisses{0};
+            mutable std::atomic<int64> staticSqlSerializationsCount{0};
+            std::atomic<bool> resultSizeEstimateEnabled{false};
+            std::mutex rowsCountEstimatesMutex;
+            std::map<std::string, size_t> rowsCountEstimates;
+            std::unique_ptr<write_queue> writeQueue;
+            std::unique_ptr<connection_holder> walCheckpointerConnection;
+            std::unique_ptr<wal_checkpointer> walCheckpointer;
+            std::shared_ptr<const busy_handler_policy> busyHandlerPolicy;
 
             connection_ref get_connection() {
-                connection_ref res{*this->connection};
-                if(1 == this->connection->retain_count()) {
-                    this->on_open_internal(this->connection->get());
+                return {*this->connection};
+            }
+
+            /**
+             *  Returns a connection for a read-only query. It is a pooled reader connection if the storage has
+             *  readers and the calling thread has no active transaction. Otherwise it is the same connection
+             *  `get_connection` returns.
+             */
+            connection_ref get_read_connection() {
+                if(this->pool && this->transactionThreadId != std::this_thread::get_id()) {
+                    return this->pool->acquire_reader();
+                } else {
+                    return this->get_connection();
+                }
+            }
+
+            void init_pool(pool_options poolOptions) {
+                if(!this->inMemory && poolOptions.readers > 0) {
+                    this->pool = std::make_unique<connection_pool>(
+                        this->connection->filename,
+                        poolOptions,
+                        [this](sqlite3 *db) {
+                            this->on_open_internal(db);
+                            this->on_open_reader_internal(db);
+                        },
+                        this->connection->options);
+                    if(this->busyHandlerPolicy) {
+                        this->pool->set_busy_handler(this->busyHandlerPolicy);
+                    }
+                }
+            }
+
+            /**
+             *  Passes `policy` to the storage connection and readers. The checkpointer connection keeps
+             *  its own busy timeout.
+             */
+            void set_busy_handler_policy(std::shared_ptr<const busy_handler_policy> policy) {
+                this->busyHandlerPolicy = policy;
+                this->connection->set_busy_handler(policy);
+                if(this->pool) {
+                    this->pool->set_busy_handler(policy);
                 }
-                return res;
             }
 
 #if SQLITE_VERSION_NUMBER >= 3006019
@@ -373,8 +907,10 @@ namespace sqlite_orm {
                     this->foreign_keys(db, true);
                 }
 #endif
+                this->pragma.apply_persistent_pragmas(db);
+
                 if(this->pragma._synchronous != -1) {
-                    this->pragma.synchronous(this->pragma._synchronous);
+                    this->pragma.set_pragma("synchronous", this->pragma._synchronous, db);
                 }
 
                 if(this->pragma._journal_mode != -1) {
@@ -393,68 +929,160 @@ namespace sqlite_orm {
                     sqlite3_limit(db, p.first, p.second);
                 }
 
+                if(this->walCheckpointer) {
+                    this->walCheckpointer->install_hook(db);
+                }
+
                 if(this->on_open) {
                     this->on_open(db);
                 }
             }
 
-            void begin_transaction(sqlite3 *db) {
-                std::stringstream ss;
-                ss << "BEGIN TRANSACTION";
-                auto query = ss.str();
-                sqlite3_stmt *stmt;
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    statement_finalizer finalizer{stmt};
-                    if(sqlite3_step(stmt) == SQLITE_DONE) {
-                        //  done..
-                    } else {
-                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(db));
-                    }
-                } else {
+            /**
+             *  Replaces the checkpointer WAL hook with the automatic checkpoint. Uses `wal_autocheckpoint`
+             *  set with `pragma` if there is one or sqlite default otherwise.
+             */
+            void restore_autocheckpoint(sqlite3 *db) {
+                auto pragmas = this->pragma.persistent_pragmas();
+                auto it = pragmas.find("wal_autocheckpoint");
+                auto frames = it != pragmas.end() ? std::stoi(it->second) : 1000;
+                sqlite3_wal_autocheckpoint(db, frames);
+            }
+
+            void on_open_reader_internal(sqlite3 *db) {
+                auto rc = sqlite3_exec(db, "PRAGMA query_only = 1", nullptr, nullptr, nullptr);
+                if(rc != SQLITE_OK) {
                     throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                             sqlite3_errmsg(db));
                 }
             }
 
+            void begin_transaction(sqlite3 *db, transaction_mode mode = transaction_mode::deferred) {
+                auto kind = control_statements::begin_deferred;
+                switch(mode) {
+                    case transaction_mode::deferred:
+                        break;
+                    case transaction_mode::immediate:
+                        kind = control_statements::begin_immediate;
+                        break;
+                    case transaction_mode::exclusive:
+                        kind = control_statements::begin_exclusive;
+                        break;
+                }
+                this->perform_control_statement(db, kind, begin_transaction_query(mode));
+            }
+
             void commit(sqlite3 *db) {
-                std::stringstream ss;
-                ss << "COMMIT";
-                auto query = ss.str();
-                sqlite3_stmt *stmt;
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    statement_finalizer finalizer{stmt};
-                    if(sqlite3_step(stmt) == SQLITE_DONE) {
-                        //  done..
-                    } else {
-                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(db));
-                    }
-                } else {
+                this->perform_control_statement(db, control_statements::commit, "COMMIT");
+            }
+
+            void rollback(sqlite3 *db) {
+                this->perform_control_statement(db, control_statements::rollback, "ROLLBACK");
+            }
+
+            /**
+             *  Executes a cached transaction control statement of the storage connection. `db` must be
+             *  the storage connection handle.
+             */
+            void perform_control_statement(sqlite3 *db, control_statements::kind kind, const char *query) {
+                if(this->connection->control.perform(db, kind, query) != SQLITE_DONE) {
                     throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                             sqlite3_errmsg(db));
                 }
             }
 
-            void rollback(sqlite3 *db) {
-                std::stringstream ss;
-                ss << "ROLLBACK";
-                auto query = ss.str();
-                sqlite3_stmt *stmt;
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    statement_finalizer finalizer{stmt};
-                    if(sqlite3_step(stmt) == SQLITE_DONE) {
-                        //  done..
-                    } else {
-                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(db));
+            /**
+             *  Guard of a transaction begun already. Lambdas capture only `this` so `std::function` stores them
+             *  without a heap allocation.
+             */
+            transaction_guard_t make_transaction_guard() {
+                return {this->get_connection(),
+                        [this] {
+                            this->commit();
+                        },
+                        [this] {
+                            this->rollback();
+                        }};
+            }
+
+            static const char *nested_savepoint_name() {
+                return "sqlite_orm_nested_transaction";
+            }
+
+            /**
+             *  Runs `f` inside a savepoint. Savepoints of nested calls have the same name which is fine
+             *  cause `RELEASE` and `ROLLBACK TO` find the innermost savepoint with the name.
+             */
+            bool nested_transaction(const std::function<bool()> &f) {
+                this->savepoint(nested_savepoint_name());
+                auto shouldCommit = false;
+                try {
+                    shouldCommit = f();
+                    if(!shouldCommit) {
+                        this->rollback_to_savepoint(nested_savepoint_name());
                     }
-                } else {
+                } catch(...) {
+                    auto db = this->connection->get();
+                    if(!sqlite3_get_autocommit(db)) {
+                        try {
+                            this->rollback_to_savepoint(nested_savepoint_name());
+                            this->perform_savepoint_statement(db, "RELEASE SAVEPOINT ", nested_savepoint_name());
+                        } catch(...) {
+                        }
+                    }
+                    if(sqlite3_get_autocommit(db)) {
+                        this->transactionThreadId = std::thread::id();
+                    }
+                    this->connection->release();
+                    throw;
+                }
+                this->release_savepoint(nested_savepoint_name());
+                return shouldCommit;
+            }
+
+            void perform_savepoint_statement(sqlite3 *db, const char *statement, const std::string &name) {
+                auto query = statement + quote_identifier(name);
+                auto rc = sqlite3_exec(db, query.c_str(), nullptr, nullptr, nullptr);
+                if(rc != SQLITE_OK) {
                     throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                             sqlite3_errmsg(db));
                 }
             }
 
+            /**
+             *  Ends a transaction begun by `begin_transaction` after a failure. `COMMIT` failed with SQLITE_BUSY
+             *  leaves the transaction active and some errors roll it back automatically so `ROLLBACK` is
+             *  executed only if the transaction is still active. Errors of `ROLLBACK` are ignored.
+             */
+            void abort_transaction() {
+                auto db = this->connection->get();
+                if(db && !sqlite3_get_autocommit(db)) {
+                    sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr);
+                }
+                if(this->transactionThreadId == std::this_thread::get_id()) {
+                    this->transactionThreadId = std::thread::id();
+                    this->connection->release();
+                }
+            }
+
+            /**
+             *  Calls `f` until it doesn't throw an error for which `is_busy_error` is true or
+             *  `options.max_retries` retries are done. Sleeps for a backoff delay before every retry.
+             */
+            template<class F>
+            auto retry_busy(const transaction_options &options, const F &f) -> decltype(f()) {
+                for(auto attempt = 0;; ++attempt) {
+                    try {
+                        return f();
+                    } catch(const std::system_error &e) {
+                        if(attempt >= options.max_retries || !is_busy_error(e.code())) {
+                            throw;
+                        }
+                    }
+                    std::this_thread::sleep_for(backoff_delay(options.backoff, options.max_backoff, attempt));
+                }
+            }
+
             std::string current_timestamp(sqlite3 *db) {
                 std::string res;
                 std::stringstream ss;
@@ -500,6 +1128,50 @@ namespace sqlite_orm {
                 }
             }
 
+            /**
+             *  Returns the cached rows count estimate of `tableName` or reads it from `sqlite_stat1` once.
+             *  Returns 0 if nothing is known.
+             */
+            size_t rows_count_estimate(const std::string &tableName, sqlite3 *db) {
+                {
+                    std::lock_guard<std::mutex> lock(this->rowsCountEstimatesMutex);
+                    auto it = this->rowsCountEstimates.find(tableName);
+                    if(it != this->rowsCountEstimates.end()) {
+                        return it->second;
+                    }
+                }
+                auto res = this->stat1_rows_count(tableName, db);
+                std::lock_guard<std::mutex> lock(this->rowsCountEstimatesMutex);
+                return this->rowsCountEstimates.insert({tableName, res}).first->second;
+            }
+
+            void remember_rows_count(const std::string &tableName, size_t rowsCount) {
+                std::lock_guard<std::mutex> lock(this->rowsCountEstimatesMutex);
+                this->rowsCountEstimates[tableName] = rowsCount;
+            }
+
+            /**
+             *  Every `sqlite_stat1` row of a table starts with the rows count of the table or of its index.
+             *  Partial indexes have fewer rows so the maximum is taken. Returns 0 if `ANALYZE` was never run.
+             */
+            size_t stat1_rows_count(const std::string &tableName, sqlite3 *db) {
+                auto query = "SELECT MAX(CAST(stat AS INTEGER)) FROM sqlite_stat1 WHERE tbl = ?";
+                sqlite3_stmt *stmt;
+                if(sqlite3_prepare_v2(db, query, -1, &stmt, nullptr) != SQLITE_OK) {
+                    return 0;  //  no sqlite_stat1 table
+                }
+                statement_finalizer finalizer{stmt};
+                size_t res = 0;
+                if(sqlite3_bind_text(stmt, 1, tableName.c_str(), int(tableName.size()), SQLITE_STATIC) == SQLITE_OK &&
+                   sqlite3_step(stmt) == SQLITE_ROW) {
+                    auto rowsCount = sqlite3_column_int64(stmt, 0);
+                    if(rowsCount > 0) {
+                        res = size_t(rowsCount);
+                    }
+                }
+                return res;
+            }
+
             template<class S>
             std::string process_order_by(const conditions::dynamic_order_by_t<S> &orderBy) const {
                 std::vector<std::string> expressions;
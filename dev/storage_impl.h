@@ -21,6 +21,7 @@
 #include "sync_schema_result.h"
 #include "sqlite_type.h"
 #include "field_value_holder.h"
+#include "static_sql_cache.h"
 
 namespace sqlite_orm {
 
@@ -168,6 +169,12 @@ namespace sqlite_orm {
 
             table_type table;
 
+            /**
+             *  SQL texts of primary key CRUD statements of this table. Mutable cause it is filled lazily
+             *  by const serialization functions.
+             */
+            mutable static_sql_cache staticSql;
+
             template<class L>
             void for_each(const L &l) {
                 this->super::for_each(l);
@@ -321,13 +328,9 @@ namespace sqlite_orm {
                     using column_type = typename std::decay<decltype(c)>::type;
                     using field_type = typename column_type::field_type;
                     pair p{c.name, ""};
-                    if(c.member_pointer) {
-                        p.second = field_printer<field_type>()(o.*c.member_pointer);
-                    } else {
-                        using getter_type = typename column_type::getter_type;
-                        field_value_holder<getter_type> valueHolder{((o).*(c.getter))()};
-                        p.second = field_printer<field_type>()(valueHolder.value);
-                    }
+                    call_with_column_value(c, o, [&p](auto &value, auto) {
+                        p.second = field_printer<field_type>()(value);
+                    });
                     pairs.push_back(std::move(p));
                 });
                 for(size_t i = 0; i < pairs.size(); ++i) {
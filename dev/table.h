@@ -1,7 +1,7 @@
 #pragma once
 
 #include <string>  //  std::string
-#include <type_traits>  //  std::remove_reference, std::is_same, std::is_base_of
+#include <type_traits>  //  std::remove_reference, std::is_same, std::is_base_of, std::remove_const, std::decay
 #include <vector>  //  std::vector
 #include <tuple>  //  std::tuple_size, std::tuple_element
 #include <algorithm>  //  std::reverse, std::find_if
@@ -14,6 +14,7 @@
 #include "table_info.h"
 #include "type_printer.h"
 #include "column.h"
+#include "constructor.h"
 
 namespace sqlite_orm {
 
@@ -37,7 +38,8 @@ namespace sqlite_orm {
             using object_type = T;
             using columns_type = std::tuple<Cs...>;
 
-            static constexpr const int columns_count = static_cast<int>(std::tuple_size<columns_type>::value);
+            static constexpr const int columns_count = static_cast<int>(std::tuple_size<columns_type>::value) -
+                                                       count_tuple<columns_type, is_constructor>::value;
 
             columns_type columns;
 
@@ -150,7 +152,8 @@ namespace sqlite_orm {
                                                         !std::is_member_function_pointer<F O::*>::value>::type>
             std::string find_column_name(F O::*m) const {
                 std::string res;
-                this->template for_each_column_with_field_type<F>([&res, m](auto &c) {
+                using field_type = typename std::remove_const<F>::type;
+                this->template for_each_column_with_field_type<field_type>([&res, m](auto &c) {
                     if(c.member_pointer == m) {
                         res = c.name;
                     }
@@ -207,9 +210,15 @@ namespace sqlite_orm {
                 });
             }
 
+            /**
+             *  Iterates columns and table constraints. Constructor element (`constructor_t`) is skipped.
+             */
             template<class L>
             void for_each_column_with_constraints(const L &l) const {
-                iterate_tuple(this->columns, l);
+                iterate_tuple(this->columns, [&l](auto &element) {
+                    using element_type = typename std::decay<decltype(element)>::type;
+                    static_if<!is_constructor<element_type>{}>(l)(element);
+                });
             }
 
             template<class F, class L>
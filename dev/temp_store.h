@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>  //  std::string
+
+namespace sqlite_orm {
+
+    /**
+     *  Values of https://www.sqlite.org/pragma.html#pragma_temp_store. Numeric values are the ones
+     *  sqlite returns for `PRAGMA temp_store`.
+     */
+    enum class temp_store : signed char {
+        DEFAULT = 0,
+        FILE = 1,
+        MEMORY = 2,
+    };
+
+    namespace internal {
+
+        inline const std::string &to_string(temp_store t) {
+            static std::string res[] = {
+                "DEFAULT",
+                "FILE",
+                "MEMORY",
+            };
+            return res[static_cast<int>(t)];
+        }
+    }
+}
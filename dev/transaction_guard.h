@@ -63,5 +63,11 @@ namespace sqlite_orm {
             std::function<void()> rollback_func;
             bool gotta_fire = true;
         };
+
+        /**
+         *  Guard of a savepoint returned by `storage.savepoint_guard(name)`. `commit()` releases the savepoint,
+         *  `rollback()` and destructor roll back to it and release it.
+         */
+        using savepoint_guard_t = transaction_guard_t;
     }
 }
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <sqlite3.h>
+#include <chrono>  //  std::chrono::microseconds
+#include <system_error>  //  std::error_code
+
+#include "error_code.h"
+
+namespace sqlite_orm {
+
+    /**
+     *  Kind of `BEGIN` statement. See https://www.sqlite.org/lang_transaction.html
+     */
+    enum class transaction_mode {
+
+        /**
+         *  Locks are taken by the first read and the first write. A transaction which reads and then writes
+         *  fails with SQLITE_BUSY if another connection writes in between.
+         */
+        deferred,
+
+        /**
+         *  The write lock is taken by `BEGIN` so the transaction can't fail on a lock upgrade later.
+         */
+        immediate,
+
+        /**
+         *  Like `immediate` but also prevents reads of other connections in rollback journal modes.
+         */
+        exclusive,
+    };
+
+    /**
+     *  Options of `storage.transaction(f, options)` and `storage.transaction_guard(options)`.
+     */
+    struct transaction_options {
+        transaction_mode mode = transaction_mode::immediate;
+
+        /**
+         *  Amount of times a transaction is started again after it failed with SQLITE_BUSY or SQLITE_LOCKED.
+         */
+        int max_retries = 10;
+
+        /**
+         *  Delay before the first retry. It is doubled for every next retry up to `max_backoff` and a random
+         *  jitter is applied.
+         */
+        std::chrono::microseconds backoff{1000};
+        std::chrono::microseconds max_backoff{100000};
+    };
+
+    namespace internal {
+
+        inline const char *begin_transaction_query(transaction_mode mode) {
+            switch(mode) {
+                case transaction_mode::deferred:
+                    return "BEGIN TRANSACTION";
+                case transaction_mode::immediate:
+                    return "BEGIN IMMEDIATE TRANSACTION";
+                case transaction_mode::exclusive:
+                    return "BEGIN EXCLUSIVE TRANSACTION";
+            }
+            return "BEGIN TRANSACTION";
+        }
+
+        /**
+         *  @return true if `errorCode` is SQLITE_BUSY or SQLITE_LOCKED (extended codes included) so the failed
+         *  transaction may succeed if it is started again.
+         */
+        inline bool is_busy_error(const std::error_code &errorCode) {
+            if(errorCode.category() != get_sqlite_error_category()) {
+                return false;
+            }
+            auto primaryCode = errorCode.value() & 0xff;
+            return primaryCode == SQLITE_BUSY || primaryCode == SQLITE_LOCKED;
+        }
+    }
+}
@@ -25,18 +25,17 @@ namespace sqlite_orm {
         template<typename T, typename Tuple>
         using tuple_contains_type = typename has_type<T, Tuple>::type;
 
+        /**
+         *  Calls `l` for elements [0, N] of a tuple in direct order. The order is a part of the type (not a runtime
+         *  flag) so every level has a single call of the next one and inlining stays linear in tuple size.
+         */
         template<size_t N, class... Args>
         struct iterator {
 
             template<class L>
-            void operator()(const std::tuple<Args...> &t, const L &l, bool reverse = true) {
-                if(reverse) {
-                    l(std::get<N>(t));
-                    iterator<N - 1, Args...>()(t, l, reverse);
-                } else {
-                    iterator<N - 1, Args...>()(t, l, reverse);
-                    l(std::get<N>(t));
-                }
+            void operator()(const std::tuple<Args...> &t, const L &l) {
+                iterator<N - 1, Args...>()(t, l);
+                l(std::get<N>(t));
             }
         };
 
@@ -44,7 +43,7 @@ namespace sqlite_orm {
         struct iterator<0, Args...> {
 
             template<class L>
-            void operator()(const std::tuple<Args...> &t, const L &l, bool /*reverse*/ = true) {
+            void operator()(const std::tuple<Args...> &t, const L &l) {
                 l(std::get<0>(t));
             }
         };
@@ -53,7 +52,7 @@ namespace sqlite_orm {
         struct iterator<N> {
 
             template<class L>
-            void operator()(const std::tuple<> &, const L &, bool /*reverse*/ = true) {
+            void operator()(const std::tuple<> &, const L &) {
                 //..
             }
         };
@@ -80,7 +79,7 @@ namespace sqlite_orm {
         template<class L, class... Args>
         void iterate_tuple(const std::tuple<Args...> &t, const L &l) {
             using tuple_type = std::tuple<Args...>;
-            tuple_helper::iterator<std::tuple_size<tuple_type>::value - 1, Args...>()(t, l, false);
+            tuple_helper::iterator<std::tuple_size<tuple_type>::value - 1, Args...>()(t, l);
         }
 
         template<typename... input_t>
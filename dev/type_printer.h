@@ -1,6 +1,6 @@
 #pragma once
 
-#include <string>  //  std::string
+#include <string>  //  std::string, std::wstring, std::u16string
 #include <memory>  //  std::shared_ptr, std::unique_ptr
 #include <vector>  //  std::vector
 #ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
@@ -86,6 +86,9 @@ namespace sqlite_orm {
     template<>
     struct type_printer<std::wstring, void> : public text_printer {};
 
+    template<>
+    struct type_printer<std::u16string, void> : public text_printer {};
+
     template<>
     struct type_printer<const char *, void> : public text_printer {};
 
@@ -108,4 +111,7 @@ namespace sqlite_orm {
 
     template<>
     struct type_printer<std::vector<char>, void> : public blob_printer {};
+
+    template<>
+    struct type_printer<std::vector<unsigned char>, void> : public blob_printer {};
 }
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <string>  //  std::string, std::basic_string
+#include <cstddef>  //  std::size_t
+#include <type_traits>  //  std::integral_constant
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  Transcoding between UTF-8 and wide strings used by `std::wstring` and `std::u16string` binders and
+         *  extractors. `char16_t` and 2 bytes long `wchar_t` (Windows) hold UTF-16, 4 bytes long `wchar_t` holds
+         *  UTF-32. Malformed sequences are replaced with U+FFFD.
+         */
+        struct utf_converter {
+            template<class Char>
+            using is_utf16 = std::integral_constant<bool, sizeof(Char) == 2>;
+
+            static constexpr char32_t replacement_character = 0xFFFD;
+
+            template<class Char>
+            static std::string to_utf8(const Char *data, std::size_t size) {
+                std::string res;
+                res.reserve(size);
+                for(auto it = data, end = data + size; it != end;) {
+                    if(static_cast<char32_t>(*it) < 0x80) {
+                        res += static_cast<char>(*it++);
+                    } else {
+                        append_utf8(res, decode(it, end, is_utf16<Char>{}));
+                    }
+                }
+                return res;
+            }
+
+            template<class Char>
+            static std::basic_string<Char> from_utf8(const char *data, std::size_t size) {
+                std::basic_string<Char> res;
+                res.reserve(size);
+                auto it = reinterpret_cast<const unsigned char *>(data);
+                for(auto end = it + size; it != end;) {
+                    if(*it < 0x80) {
+                        res += static_cast<Char>(*it++);
+                    } else {
+                        append(res, decode_utf8(it, end), is_utf16<Char>{});
+                    }
+                }
+                return res;
+            }
+
+          private:
+            static bool is_surrogate(char32_t c) {
+                return c >= 0xD800 && c <= 0xDFFF;
+            }
+
+            static void append_utf8(std::string &res, char32_t c) {
+                if(c < 0x80) {
+                    res += static_cast<char>(c);
+                } else if(c < 0x800) {
+                    res += static_cast<char>(0xC0 | (c >> 6));
+                    res += static_cast<char>(0x80 | (c & 0x3F));
+                } else if(c < 0x10000) {
+                    res += static_cast<char>(0xE0 | (c >> 12));
+                    res += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+                    res += static_cast<char>(0x80 | (c & 0x3F));
+                } else {
+                    res += static_cast<char>(0xF0 | (c >> 18));
+                    res += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+                    res += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+                    res += static_cast<char>(0x80 | (c & 0x3F));
+                }
+            }
+
+            template<class Char>
+            static void append(std::basic_string<Char> &res, char32_t c, std::true_type) {
+                if(c < 0x10000) {
+                    res += static_cast<Char>(c);
+                } else {
+                    c -= 0x10000;
+                    res += static_cast<Char>(0xD800 + (c >> 10));
+                    res += static_cast<Char>(0xDC00 + (c & 0x3FF));
+                }
+            }
+
+            template<class Char>
+            static void append(std::basic_string<Char> &res, char32_t c, std::false_type) {
+                res += static_cast<Char>(c);
+            }
+
+            /**
+             *  Decodes a UTF-16 code point and advances `it`.
+             */
+            template<class Char>
+            static char32_t decode(const Char *&it, const Char *end, std::true_type) {
+                char32_t c = static_cast<char16_t>(*it++);
+                if(!is_surrogate(c)) {
+                    return c;
+                }
+                if(c <= 0xDBFF && it != end) {
+                    char32_t low = static_cast<char16_t>(*it);
+                    if(low >= 0xDC00 && low <= 0xDFFF) {
+                        ++it;
+                        return 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                }
+                return replacement_character;
+            }
+
+            /**
+             *  Decodes a UTF-32 code point and advances `it`.
+             */
+            template<class Char>
+            static char32_t decode(const Char *&it, const Char *, std::false_type) {
+                auto c = static_cast<char32_t>(*it++);
+                if(c > 0x10FFFF || is_surrogate(c)) {
+                    return replacement_character;
+                }
+                return c;
+            }
+
+            /**
+             *  Decodes a multibyte UTF-8 sequence and advances `it`. Overlong sequences, surrogates and
+             *  truncated sequences are malformed.
+             */
+            static char32_t decode_utf8(const unsigned char *&it, const unsigned char *end) {
+                auto lead = *it++;
+                int length = 0;
+                char32_t c = 0;
+                char32_t min = 0;
+                if((lead & 0xE0) == 0xC0) {
+                    length = 1;
+                    c = lead & 0x1F;
+                    min = 0x80;
+                } else if((lead & 0xF0) == 0xE0) {
+                    length = 2;
+                    c = lead & 0x0F;
+                    min = 0x800;
+                } else if((lead & 0xF8) == 0xF0) {
+                    length = 3;
+                    c = lead & 0x07;
+                    min = 0x10000;
+                } else {
+                    return replacement_character;
+                }
+                for(auto i = 0; i < length; ++i) {
+                    if(it == end || (*it & 0xC0) != 0x80) {
+                        return replacement_character;
+                    }
+                    c = (c << 6) | (*it++ & 0x3F);
+                }
+                if(c < min || c > 0x10FFFF || is_surrogate(c)) {
+                    return replacement_character;
+                }
+                return c;
+            }
+        };
+    }
+}
@@ -53,7 +53,7 @@ namespace sqlite_orm {
                     auto index = 1;
                     iterate_ast(this->args.conditions, [&index, stmt, db](auto &node) {
                         using node_type = typename std::decay<decltype(node)>::type;
-                        conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                        conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                         if(SQLITE_OK != binder(node)) {
                             throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                     sqlite3_errmsg(db));
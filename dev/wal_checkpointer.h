@@ -0,0 +1,256 @@
+#pragma once
+
+#include <sqlite3.h>
+#include <atomic>  //  std::atomic, std::atomic_int
+#include <chrono>  //  std::chrono::steady_clock, std::chrono::milliseconds, std::chrono::microseconds
+#include <mutex>  //  std::mutex, std::unique_lock, std::lock_guard
+#include <condition_variable>  //  std::condition_variable
+#include <thread>  //  std::thread
+#include <memory>  //  std::unique_ptr
+#include <utility>  //  std::move
+
+#include "sqlite_type.h"
+#include "connection_holder.h"
+
+namespace sqlite_orm {
+
+    /**
+     *  Modes of `sqlite3_wal_checkpoint_v2`. See https://www.sqlite.org/c3ref/wal_checkpoint_v2.html
+     */
+    enum class checkpoint_mode : signed char {
+        PASSIVE = SQLITE_CHECKPOINT_PASSIVE,
+        FULL = SQLITE_CHECKPOINT_FULL,
+        RESTART = SQLITE_CHECKPOINT_RESTART,
+        TRUNCATE = SQLITE_CHECKPOINT_TRUNCATE,
+    };
+
+    /**
+     *  Options of a checkpointer started by `storage.start_wal_checkpointer(options)`.
+     */
+    struct wal_checkpointer_options {
+
+        checkpoint_mode mode = checkpoint_mode::PASSIVE;
+
+        /**
+         *  Checkpoint is run once the storage connection commits and WAL has at least this amount of frames
+         *  which are not checkpointed yet. 0 disables the trigger.
+         */
+        int wal_frames = 1000;
+
+        /**
+         *  Checkpoint is run if the previous one was run this time ago. It catches writes made by other
+         *  connections and processes. 0 disables the trigger.
+         */
+        std::chrono::milliseconds interval{1000};
+
+        /**
+         *  Under a steady write load a `PASSIVE` checkpoint never catches up with writers so WAL is never
+         *  restarted and keeps growing. If WAL still has at least this amount of frames after a checkpoint
+         *  the next one is run in `checkpoint_mode::RESTART` mode. 0 disables escalation.
+         *  `FULL`, `RESTART` and `TRUNCATE` checkpoints block writers while they run so writers must have
+         *  a busy timeout (`storage.busy_timeout(ms)`) to use them.
+         */
+        int restart_wal_frames = 0;
+
+        /**
+         *  Busy timeout of the checkpointer connection. `FULL`, `RESTART` and `TRUNCATE` checkpoints wait
+         *  for readers and writers up to this time.
+         */
+        std::chrono::milliseconds busy_timeout{1000};
+    };
+
+    /**
+     *  Statistics of a WAL checkpointer.
+     */
+    struct wal_checkpoint_stats {
+
+        /**
+         *  Amount of `sqlite3_wal_checkpoint_v2` calls.
+         */
+        int64 checkpoints_count = 0;
+
+        /**
+         *  Amount of checkpoints which returned SQLITE_BUSY. Such checkpoints may be partial.
+         */
+        int64 busy_count = 0;
+
+        /**
+         *  Amount of checkpoints escalated to `checkpoint_mode::RESTART` (see `restart_wal_frames`).
+         */
+        int64 restarts_count = 0;
+
+        /**
+         *  Amount of checkpoints which failed with an error other than SQLITE_BUSY.
+         */
+        int64 errors_count = 0;
+
+        /**
+         *  Size of WAL in frames and amount of checkpointed frames reported by the last checkpoint.
+         */
+        int last_log_frames = 0;
+        int last_checkpointed_frames = 0;
+
+        /**
+         *  Sum of frames checkpointed by all checkpoints. A frame checkpointed by two checkpoints is counted twice.
+         */
+        int64 total_checkpointed_frames = 0;
+
+        std::chrono::microseconds last_duration{0};
+        std::chrono::microseconds max_duration{0};
+        std::chrono::microseconds total_duration{0};
+    };
+
+    namespace internal {
+
+        /**
+         *  Runs WAL checkpoints on a background thread with its own connection so writers never run
+         *  them inline on commit. `install_hook` must be called for every writer connection of the storage:
+         *  it replaces the automatic checkpoint with a `sqlite3_wal_hook` which only wakes the checkpointer
+         *  up once WAL grows enough.
+         */
+        struct wal_checkpointer {
+
+            wal_checkpointer(wal_checkpointer_options options_, connection_ref con_) :
+                options(options_), con(std::move(con_)) {
+                sqlite3_busy_timeout(this->con.get(), static_cast<int>(this->options.busy_timeout.count()));
+                this->lastCheckpointTime = std::chrono::steady_clock::now();
+                this->thread = std::thread([this] {
+                    this->run();
+                });
+            }
+
+            wal_checkpointer(const wal_checkpointer &) = delete;
+
+            ~wal_checkpointer() {
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex);
+                    this->stopped = true;
+                }
+                this->condition.notify_one();
+                this->thread.join();
+            }
+
+            void install_hook(sqlite3 *db) {
+                sqlite3_wal_hook(db, wal_hook_callback, this);
+            }
+
+            /**
+             *  Runs a checkpoint right now on the calling thread.
+             */
+            void checkpoint() {
+                std::lock_guard<std::mutex> checkpointLock(this->checkpointMutex);
+                auto db = this->con.get();
+                auto mode = this->options.mode;
+                auto escalate = this->options.restart_wal_frames > 0 && mode == checkpoint_mode::PASSIVE &&
+                                this->lastLogFrames >= this->options.restart_wal_frames;
+                if(escalate) {
+                    mode = checkpoint_mode::RESTART;
+                }
+                auto logFrames = 0;
+                auto checkpointedFrames = 0;
+                auto start = std::chrono::steady_clock::now();
+                auto rc =
+                    sqlite3_wal_checkpoint_v2(db, nullptr, static_cast<int>(mode), &logFrames, &checkpointedFrames);
+                auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start);
+                if(rc == SQLITE_OK || rc == SQLITE_BUSY) {
+                    this->checkpointedFrames = checkpointedFrames;
+                    this->lastLogFrames = logFrames;
+                }
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->lastCheckpointTime = std::chrono::steady_clock::now();
+                ++this->statistics.checkpoints_count;
+                if(escalate) {
+                    ++this->statistics.restarts_count;
+                }
+                if(rc == SQLITE_BUSY) {
+                    ++this->statistics.busy_count;
+                } else if(rc != SQLITE_OK) {
+                    ++this->statistics.errors_count;
+                }
+                if(rc == SQLITE_OK || rc == SQLITE_BUSY) {
+                    this->statistics.last_log_frames = logFrames;
+                    this->statistics.last_checkpointed_frames = checkpointedFrames;
+                    if(checkpointedFrames > 0) {
+                        this->statistics.total_checkpointed_frames += checkpointedFrames;
+                    }
+                }
+                this->statistics.last_duration = duration;
+                if(duration > this->statistics.max_duration) {
+                    this->statistics.max_duration = duration;
+                }
+                this->statistics.total_duration += duration;
+            }
+
+            wal_checkpoint_stats stats() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                return this->statistics;
+            }
+
+            const wal_checkpointer_options options;
+
+          protected:
+            connection_ref con;
+            std::mutex mutex;
+            std::mutex checkpointMutex;
+            std::condition_variable condition;
+            bool stopped = false;
+            bool checkpointRequested = false;
+            std::chrono::steady_clock::time_point lastCheckpointTime;
+            std::atomic_int checkpointedFrames{0};
+            int lastLogFrames = 0;
+            wal_checkpoint_stats statistics;
+            std::thread thread;
+
+            /**
+             *  Called by sqlite on the committing thread after every commit with the WAL size in frames.
+             *  Frames checkpointed by the previous checkpoint stay in WAL until a writer restarts it
+             *  so only frames above them are counted.
+             */
+            static int wal_hook_callback(void *data, sqlite3 *, const char *, int frames) {
+                auto &checkpointer = *static_cast<wal_checkpointer *>(data);
+                auto threshold = checkpointer.options.wal_frames;
+                if(threshold > 0) {
+                    auto checkpointed = checkpointer.checkpointedFrames.load();
+                    auto pendingFrames = frames >= checkpointed ? frames - checkpointed : frames;
+                    if(pendingFrames >= threshold) {
+                        {
+                            std::lock_guard<std::mutex> lock(checkpointer.mutex);
+                            checkpointer.checkpointRequested = true;
+                        }
+                        checkpointer.condition.notify_one();
+                    }
+                }
+                return SQLITE_OK;
+            }
+
+            void run() {
+                std::unique_lock<std::mutex> lock(this->mutex);
+                while(!this->stopped) {
+                    auto hasInterval = this->options.interval.count() > 0;
+                    auto nextCheckpointTime = this->lastCheckpointTime + this->options.interval;
+                    auto checkpointIsDue = [this, hasInterval, nextCheckpointTime] {
+                        return this->checkpointRequested ||
+                               (hasInterval && std::chrono::steady_clock::now() >= nextCheckpointTime);
+                    };
+                    if(!checkpointIsDue()) {
+                        if(hasInterval) {
+                            this->condition.wait_until(lock, nextCheckpointTime);
+                        } else {
+                            this->condition.wait(lock);
+                        }
+                    }
+                    if(this->stopped) {
+                        break;
+                    }
+                    if(checkpointIsDue()) {
+                        this->checkpointRequested = false;
+                        lock.unlock();
+                        this->checkpoint();
+                        lock.lock();
+                    }
+                }
+            }
+        };
+    }
+}
@@ -0,0 +1,280 @@
+#pragma once
+
+#include <atomic>  //  std::atomic, std::atomic_bool
+#include <functional>  //  std::function
+#include <future>  //  std::promise, std::future
+#include <memory>  //  std::unique_ptr
+#include <mutex>  //  std::mutex, std::unique_lock, std::lock_guard
+#include <condition_variable>  //  std::condition_variable
+#include <thread>  //  std::thread
+#include <exception>  //  std::exception_ptr, std::current_exception
+#include <vector>  //  std::vector
+#include <utility>  //  std::move
+#include <cstddef>  //  std::ptrdiff_t
+#include <system_error>  //  std::system_error, std::error_code
+#include <sqlite3.h>
+
+#include "sqlite_type.h"
+#include "connection_holder.h"
+#include "statement_cache.h"
+#include "error_code.h"
+
+namespace sqlite_orm {
+
+    /**
+     *  Options of a write queue started by `storage.start_write_queue(options)`.
+     */
+    struct write_queue_options {
+
+        /**
+         *  Max amount of writes executed inside a single transaction.
+         */
+        size_t max_batch_size = 1000;
+    };
+
+    namespace internal {
+
+        /**
+         *  Unbounded multiple producers single consumer queue. `push` is lock-free and may be called
+         *  from any thread. `pop` and `empty` must be called by a single consumer thread.
+         */
+        template<class T>
+        struct mpsc_queue {
+
+            mpsc_queue() : head(new node), tail(head.load()) {}
+
+            mpsc_queue(const mpsc_queue &) = delete;
+
+            ~mpsc_queue() {
+                T value;
+                while(this->pop(value)) {
+                }
+                delete this->tail;
+            }
+
+            void push(T value) {
+                auto newNode = new node(std::move(value));
+                auto previous = this->head.exchange(newNode);
+                previous->next.store(newNode);
+            }
+
+            bool pop(T &value) {
+                auto next = this->tail->next.load();
+                if(next) {
+                    value = std::move(next->value);
+                    delete this->tail;
+                    this->tail = next;
+                    return true;
+                } else {
+                    return false;
+                }
+            }
+
+            bool empty() const {
+                return !this->tail->next.load();
+            }
+
+          protected:
+            struct node {
+                node() = default;
+
+                node(T value_) : value(std::move(value_)) {}
+
+                T value;
+                std::atomic<node *> next{nullptr};
+            };
+
+            std::atomic<node *> head;
+            node *tail;
+        };
+
+        /**
+         *  Group commit queue. Writes are pushed from any thread and executed by a single writer thread.
+         *  Writes pushed while the previous batch is committed are executed in a single transaction
+         *  so many writers share one commit (and one fsync). A future is fulfilled after the transaction
+         *  with a write is committed. Every write is executed inside its own savepoint so if a write throws
+         *  changes made by it are rolled back and only its future gets the exception. If the error has rolled
+         *  back the whole transaction futures of writes executed in that transaction get the exception too.
+         *  If the commit fails all futures of the batch get the exception.
+         */
+        struct write_queue {
+            using write_t = std::function<int64()>;
+            using transaction_function_t = std::function<void()>;
+
+            write_queue(write_queue_options options_,
+                        connection_ref con_,
+                        transaction_function_t begin_,
+                        transaction_function_t commit_,
+                        transaction_function_t rollback_) :
+                options(options_),
+                con(std::move(con_)), begin(std::move(begin_)), commit(std::move(commit_)),
+                rollback(std::move(rollback_)) {
+                if(!this->options.max_batch_size) {
+                    this->options.max_batch_size = 1;
+                }
+                this->thread = std::thread([this] {
+                    this->run();
+                });
+            }
+
+            /**
+             *  Executes all pushed writes and stops the writer thread.
+             */
+            ~write_queue() {
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex);
+                    this->stopped = true;
+                }
+                this->condition.notify_one();
+                this->thread.join();
+            }
+
+            std::future<int64> push(write_t write) {
+                std::unique_ptr<task> newTask(new task{std::move(write), {}});
+                auto res = newTask->promise.get_future();
+                this->tasks.push(std::move(newTask));
+                if(this->writerIsWaiting) {
+                    {
+                        std::lock_guard<std::mutex> lock(this->mutex);
+                    }
+                    this->condition.notify_one();
+                }
+                return res;
+            }
+
+            /**
+             *  @return amount of committed transactions.
+             */
+            int64 commits_count() const {
+                return this->commitsCount;
+            }
+
+            /**
+             *  @return amount of executed writes.
+             */
+            int64 writes_count() const {
+                return this->writesCount;
+            }
+
+          protected:
+            struct task {
+                write_t write;
+                std::promise<int64> promise;
+            };
+
+            struct task_result {
+                std::unique_ptr<task> t;
+                int64 value;
+                std::exception_ptr exception;
+            };
+
+            write_queue_options options;
+            connection_ref con;
+            transaction_function_t begin;
+            transaction_function_t commit;
+            transaction_function_t rollback;
+            mpsc_queue<std::unique_ptr<task>> tasks;
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::atomic_bool writerIsWaiting{false};
+            bool stopped = false;
+            std::atomic<int64> commitsCount{0};
+            std::atomic<int64> writesCount{0};
+            std::thread thread;
+
+            void run() {
+                std::vector<task_result> batch;
+                batch.reserve(this->options.max_batch_size);
+                for(;;) {
+                    this->writerIsWaiting = true;
+                    auto stop = false;
+                    {
+                        std::unique_lock<std::mutex> lock(this->mutex);
+                        this->condition.wait(lock, [this] {
+                            return this->stopped || !this->tasks.empty();
+                        });
+                        stop = this->stopped;
+                    }
+                    this->writerIsWaiting = false;
+                    while(!this->tasks.empty() || !batch.empty()) {
+                        this->execute_batch(batch);
+                    }
+                    if(stop) {
+                        break;
+                    }
+                }
+            }
+
+            /**
+             *  Executes a cached savepoint statement of the queue connection.
+             */
+            void perform(control_statements::kind kind, const char *query) {
+                auto db = this->con.get();
+                if(this->con.control().perform(db, kind, query) != SQLITE_DONE) {
+                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(db));
+                }
+            }
+
+            /**
+             *  Executes writes of `batch` (topped up from the queue) in a single transaction and fulfills their
+             *  promises. Every write is wrapped in a savepoint which is rolled back if the write throws so a write
+             *  of several statements is never committed partially. If a failed write has rolled back the whole
+             *  transaction (e.g. `RAISE(ROLLBACK)` in a trigger, SQLITE_FULL, SQLITE_IOERR or SQLITE_NOMEM) writes
+             *  executed so far fail with its error and writes after it are left in `batch` for the next transaction.
+             */
+            void execute_batch(std::vector<task_result> &batch) {
+                std::unique_ptr<task> nextTask;
+                while(batch.size() < this->options.max_batch_size && this->tasks.pop(nextTask)) {
+                    batch.push_back({std::move(nextTask), 0, nullptr});
+                }
+                std::exception_ptr transactionException;
+                auto transactionIsActive = false;
+                auto resultsCount = batch.size();
+                try {
+                    this->begin();
+                    transactionIsActive = true;
+                    for(size_t i = 0; i < batch.size(); ++i) {
+                        auto &result = batch[i];
+                        this->perform(control_statements::write_savepoint, "SAVEPOINT write_queue_write");
+                        try {
+                            result.value = result.t->write();
+                            this->perform(control_statements::write_release, "RELEASE write_queue_write");
+                        } catch(...) {
+                            result.exception = std::current_exception();
+                            if(sqlite3_get_autocommit(this->con.get())) {
+                                resultsCount = i + 1;
+                                throw;
+                            }
+                            this->perform(control_statements::write_rollback_to, "ROLLBACK TO write_queue_write");
+                            this->perform(control_statements::write_release, "RELEASE write_queue_write");
+                        }
+                    }
+                    this->commit();
+                    transactionIsActive = false;
+                    ++this->commitsCount;
+                } catch(...) {
+                    transactionException = std::current_exception();
+                    if(transactionIsActive) {
+                        try {
+                            this->rollback();
+                        } catch(...) {
+                        }
+                    }
+                }
+                this->writesCount += static_cast<int64>(resultsCount);
+                for(size_t i = 0; i < resultsCount; ++i) {
+                    auto &result = batch[i];
+                    if(transactionException) {
+                        result.t->promise.set_exception(transactionException);
+                    } else if(result.exception) {
+                        result.t->promise.set_exception(result.exception);
+                    } else {
+                        result.t->promise.set_value(result.value);
+                    }
+                }
+                batch.erase(batch.begin(), batch.begin() + static_cast<std::ptrdiff_t>(resultsCount));
+            }
+        };
+    }
+}
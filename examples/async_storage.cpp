@@ -0,0 +1,84 @@
+/**
+ *  Latency of asynchronous reads under concurrent load. Client threads issue `get_async` requests and
+ *  wait for results. Compares a single executor thread with an executor of several threads over
+ *  a storage with reader connections.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <mutex>
+#include <algorithm>
+#include <cstdio>
+
+using std::cout;
+using std::endl;
+
+struct Employee {
+    int id = 0;
+    std::string name;
+    double salary = 0;
+};
+
+template<class A>
+void measureLatency(const char *name, A &asyncStorage, int clientsCount, int requestsPerClient) {
+    std::vector<double> latencies;
+    std::mutex mutex;
+    std::vector<std::thread> clients;
+    for(auto c = 0; c < clientsCount; ++c) {
+        clients.emplace_back([&asyncStorage, &latencies, &mutex, requestsPerClient, c] {
+            std::vector<double> clientLatencies;
+            for(auto i = 0; i < requestsPerClient; ++i) {
+                auto start = std::chrono::steady_clock::now();
+                auto employee = asyncStorage.template get_async<Employee>((c * requestsPerClient + i) % 1000 + 1).get();
+                (void)employee;
+                std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+                clientLatencies.push_back(elapsed.count());
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            latencies.insert(latencies.end(), clientLatencies.begin(), clientLatencies.end());
+        });
+    }
+    for(auto &client: clients) {
+        client.join();
+    }
+    std::sort(latencies.begin(), latencies.end());
+    cout << name << ": p50 " << latencies[latencies.size() / 2] << " us, p99 "
+         << latencies[latencies.size() * 99 / 100] << " us" << endl;
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto filename = "async_storage.sqlite";
+    ::remove(filename);
+    const auto executorThreadsCount = 4;
+    auto storage = make_storage(filename,
+                                pool_options{executorThreadsCount},
+                                make_table("employees",
+                                           make_column("id", &Employee::id, primary_key()),
+                                           make_column("name", &Employee::name),
+                                           make_column("salary", &Employee::salary)));
+    storage.sync_schema();
+    storage.pragma.journal_mode(journal_mode::WAL);
+    storage.open_forever();
+    storage.transaction([&storage] {
+        for(auto i = 1; i <= 1000; ++i) {
+            storage.replace(Employee{i, "employee " + std::to_string(i), double(i)});
+        }
+        return true;
+    });
+
+    const auto clientsCount = 16;
+    const auto requestsPerClient = 500;
+    {
+        auto asyncStorage = make_async_storage(storage);
+        measureLatency("1 executor thread", asyncStorage, clientsCount, requestsPerClient);
+    }
+    {
+        auto asyncStorage = make_async_storage(storage, executorThreadsCount);
+        measureLatency("4 executor threads", asyncStorage, clientsCount, requestsPerClient);
+    }
+
+    return 0;
+}
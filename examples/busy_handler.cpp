@@ -0,0 +1,77 @@
+/**
+ *  Several writers with their own storages contend for the same database file. Every writer uses
+ *  a busy handler and reports how much time it waited for the lock.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+using std::cout;
+using std::endl;
+
+struct Counter {
+    int id = 0;
+    int value = 0;
+};
+
+inline auto initStorage(const std::string &filename) {
+    using namespace sqlite_orm;
+    return make_storage(
+        filename,
+        make_table("counters", make_column("id", &Counter::id, primary_key()), make_column("value", &Counter::value)));
+}
+
+template<class F>
+void run(const char *name, const std::string &filename, const F &setBusyHandler) {
+    using namespace sqlite_orm;
+    const auto writersCount = 4;
+    const auto writesCount = 500;
+    std::vector<busy_handler_stats> stats(writersCount);
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for(auto i = 0; i < writersCount; ++i) {
+        threads.emplace_back([i, &filename, &stats, &setBusyHandler] {
+            auto storage = initStorage(filename);
+            storage.set_connection_lifetime(connection_lifetime::always_open);
+            setBusyHandler(storage);
+            for(auto j = 0; j < writesCount; ++j) {
+                storage.update_all(set(c(&Counter::value) = c(&Counter::value) + 1), where(c(&Counter::id) == i + 1));
+            }
+            stats[i] = storage.busy_stats();
+        });
+    }
+    for(auto &thread: threads) {
+        thread.join();
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    cout << name << ": " << elapsed.count() << " ms" << endl;
+    for(auto i = 0; i < writersCount; ++i) {
+        cout << "  writer " << i << ": busy " << stats[i].busy_count << ", attempts " << stats[i].attempts_count
+             << ", total wait " << stats[i].total_wait.count() << " us, max wait " << stats[i].max_wait.count()
+             << " us" << endl;
+    }
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    std::string filename = "busy_handler.sqlite";
+    ::remove(filename.c_str());
+    {
+        auto storage = initStorage(filename);
+        storage.sync_schema();
+        storage.pragma.journal_mode(journal_mode::WAL);
+        for(auto i = 1; i <= 4; ++i) {
+            storage.replace(Counter{i, 0});
+        }
+    }
+    run("exponential backoff", filename, [](auto &storage) {
+        storage.busy_handler(exponential_backoff_policy(std::chrono::milliseconds(10000)));
+    });
+    run("spin then sleep", filename, [](auto &storage) {
+        storage.busy_handler(spin_then_sleep_policy(std::chrono::milliseconds(10000)));
+    });
+    return 0;
+}
@@ -0,0 +1,86 @@
+/**
+ *  Analytics scan with `select` into a vector of tuples and with `select_columns` into a columnar result.
+ *  Columnar result keeps every column in its own contiguous vector so a numeric kernel runs over it
+ *  directly without transposing rows.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <chrono>
+#include <numeric>
+
+using std::cout;
+using std::endl;
+
+struct Trade {
+    int id = 0;
+    double price = 0;
+    double volume = 0;
+    std::unique_ptr<double> fee;
+};
+
+template<class F>
+double millisecondsOf(const F &f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto storage = make_storage({},
+                                make_table("trades",
+                                           make_column("id", &Trade::id, primary_key()),
+                                           make_column("price", &Trade::price),
+                                           make_column("volume", &Trade::volume),
+                                           make_column("fee", &Trade::fee)));
+    storage.sync_schema();
+
+    const auto rowsCount = 500000;
+    {
+        auto loader = storage.bulk_loader<Trade>();
+        for(auto i = 0; i < rowsCount; ++i) {
+            Trade trade;
+            trade.price = 100 + i % 50;
+            trade.volume = 1 + i % 7;
+            if(i % 4) {
+                trade.fee = std::make_unique<double>(0.1);
+            }
+            loader.push(std::move(trade));
+        }
+        loader.finish();
+    }
+
+    double rowsTurnover = 0;
+    auto rowsTime = millisecondsOf([&storage, &rowsTurnover] {
+        auto rows = storage.select(columns(&Trade::price, &Trade::volume, &Trade::fee));
+        std::vector<double> prices;
+        std::vector<double> volumes;
+        prices.reserve(rows.size());
+        volumes.reserve(rows.size());
+        for(auto &row: rows) {
+            prices.push_back(std::get<0>(row));
+            volumes.push_back(std::get<1>(row));
+        }
+        rowsTurnover = std::inner_product(prices.begin(), prices.end(), volumes.begin(), 0.0);
+    });
+
+    double columnarTurnover = 0;
+    size_t nullFeesCount = 0;
+    auto columnarTime = millisecondsOf([&storage, &columnarTurnover, &nullFeesCount] {
+        auto res = storage.select_columns(columns(&Trade::price, &Trade::volume, &Trade::fee));
+        auto &prices = res.values<0>();
+        auto &volumes = res.values<1>();
+        columnarTurnover = std::inner_product(prices.begin(), prices.end(), volumes.begin(), 0.0);
+        auto &fees = res.column<2>();
+        for(size_t i = 0; i < fees.size(); ++i) {
+            nullFeesCount += fees.is_null(i);
+        }
+    });
+
+    cout << "select + transpose: " << rowsTime << " ms, turnover " << rowsTurnover << endl;
+    cout << "select_columns: " << columnarTime << " ms, turnover " << columnarTurnover << ", rows without fee "
+         << nullFeesCount << endl;
+
+    return 0;
+}
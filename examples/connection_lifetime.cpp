@@ -0,0 +1,56 @@
+/**
+ *  Latency of `get` by primary key in a file database under every `connection_lifetime` policy.
+ *  With `per_call` every call opens the file again, runs open callbacks and starts with an empty page cache.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+
+using std::cout;
+using std::endl;
+
+struct User {
+    int id = 0;
+    std::string name;
+};
+
+template<class S>
+void measure(const char *name, S &storage) {
+    const auto callsCount = 20000;
+    auto opensCount = storage.connection_opens_count();
+    auto start = std::chrono::steady_clock::now();
+    for(auto i = 0; i < callsCount; ++i) {
+        storage.template get<User>(i % 100 + 1);
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    cout << name << ": " << elapsed.count() / callsCount << " us per call, "
+         << storage.connection_opens_count() - opensCount << " opens" << endl;
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto filename = "connection_lifetime.sqlite";
+    ::remove(filename);
+    auto storage = make_storage(
+        filename,
+        make_table("users", make_column("id", &User::id, primary_key()), make_column("name", &User::name)));
+    storage.sync_schema();
+    storage.transaction([&storage] {
+        for(auto i = 1; i <= 100; ++i) {
+            storage.replace(User{i, "user" + std::to_string(i)});
+        }
+        return true;
+    });
+    storage.enable_statement_cache(true);
+
+    measure("per_call", storage);
+    storage.set_connection_lifetime(connection_lifetime::idle_timeout, std::chrono::milliseconds(100));
+    measure("idle_timeout", storage);
+    storage.set_connection_lifetime(connection_lifetime::always_open);
+    measure("always_open", storage);
+
+    cout << "opens: " << storage.connection_opens_count() << ", closes: " << storage.connection_closes_count()
+         << endl;
+    return 0;
+}
@@ -0,0 +1,79 @@
+/**
+ *  Multi-threaded read throughput of a storage with a single connection compared with a storage
+ *  with a pool of reader connections (`pool_options`). Readers make sense only in WAL mode.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cstdio>
+
+using std::cout;
+using std::endl;
+
+struct Employee {
+    int id = 0;
+    std::string name;
+    double salary = 0;
+};
+
+template<class S>
+double readsPerSecond(S &storage, int threadsCount, int readsPerThread) {
+    using namespace sqlite_orm;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for(auto t = 0; t < threadsCount; ++t) {
+        threads.emplace_back([&storage, readsPerThread, t] {
+            for(auto i = 0; i < readsPerThread; ++i) {
+                auto rows = storage.template get_all<Employee>(where(c(&Employee::salary) > (t + i) % 1000));
+                (void)rows;
+            }
+        });
+    }
+    for(auto &thread: threads) {
+        thread.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return threadsCount * readsPerThread / elapsed.count();
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto filename = "connection_pool.sqlite";
+    ::remove(filename);
+
+    auto threadsCount = int(std::max(2u, std::thread::hardware_concurrency()));
+    auto makeStorage = [filename](pool_options options) {
+        return make_storage(filename,
+                            options,
+                            make_table("employees",
+                                       make_column("id", &Employee::id, primary_key()),
+                                       make_column("name", &Employee::name),
+                                       make_column("salary", &Employee::salary)));
+    };
+
+    auto storage = makeStorage({});
+    storage.sync_schema();
+    storage.pragma.journal_mode(journal_mode::WAL);
+    storage.transaction([&storage] {
+        for(auto i = 1; i <= 2000; ++i) {
+            storage.replace(Employee{i, "employee " + std::to_string(i), double(i % 1000)});
+        }
+        return true;
+    });
+    storage.open_forever();
+
+    auto pooledStorage = makeStorage(pool_options{threadsCount});
+    pooledStorage.pragma.journal_mode(journal_mode::WAL);
+
+    const auto readsPerThread = 200;
+    cout << "threads: " << threadsCount << endl;
+    cout << "single connection: " << readsPerSecond(storage, threadsCount, readsPerThread) << " reads/s" << endl;
+    cout << threadsCount
+         << " readers: " << readsPerSecond(pooledStorage, threadsCount, readsPerThread) << " reads/s" << endl;
+    cout << "opened readers: " << pooledStorage.opened_readers_count() << endl;
+
+    return 0;
+}
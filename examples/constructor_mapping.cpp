@@ -0,0 +1,131 @@
+/**
+ *  Tables with `constructor()` or `factory(f)` element create objects from column values instead of default
+ *  constructing them and assigning every field. The class doesn't need a default constructor and may be
+ *  immutable. Compares `get_all` throughput of both mappings. Note that const members can't be moved so
+ *  `std::vector` copies such objects when it grows.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <utility>
+
+using std::cout;
+using std::endl;
+
+struct Contact {
+    int id = 0;
+    std::string firstName;
+    std::string lastName;
+    std::string email;
+    std::string phone;
+};
+
+struct ConstructedContact {
+    ConstructedContact(int id_,
+                       std::string firstName_,
+                       std::string lastName_,
+                       std::string email_,
+                       std::string phone_) :
+        id(id_),
+        firstName(std::move(firstName_)), lastName(std::move(lastName_)), email(std::move(email_)),
+        phone(std::move(phone_)) {}
+
+    int id;
+    std::string firstName;
+    std::string lastName;
+    std::string email;
+    std::string phone;
+};
+
+class ImmutableContact {
+  public:
+    ImmutableContact(int id_,
+                     std::string firstName_,
+                     std::string lastName_,
+                     std::string email_,
+                     std::string phone_) :
+        id(id_),
+        firstName(std::move(firstName_)), lastName(std::move(lastName_)), email(std::move(email_)),
+        phone(std::move(phone_)) {}
+
+    const int id;
+    const std::string firstName;
+    const std::string lastName;
+    const std::string email;
+    const std::string phone;
+};
+
+template<class F>
+void measure(const char *name, int rowsCount, const F &f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    cout << name << ": " << int(rowsCount / elapsed.count()) << " rows/s" << endl;
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto storage = make_storage({},
+                                make_table("contacts",
+                                           make_column("id", &Contact::id, primary_key()),
+                                           make_column("first_name", &Contact::firstName),
+                                           make_column("last_name", &Contact::lastName),
+                                           make_column("email", &Contact::email),
+                                           make_column("phone", &Contact::phone)),
+                                make_table("constructed_contacts",
+                                           make_column("id", &ConstructedContact::id, primary_key()),
+                                           make_column("first_name", &ConstructedContact::firstName),
+                                           make_column("last_name", &ConstructedContact::lastName),
+                                           make_column("email", &ConstructedContact::email),
+                                           make_column("phone", &ConstructedContact::phone),
+                                           constructor()),
+                                make_table("immutable_contacts",
+                                           make_column("id", &ImmutableContact::id, primary_key()),
+                                           make_column("first_name", &ImmutableContact::firstName),
+                                           make_column("last_name", &ImmutableContact::lastName),
+                                           make_column("email", &ImmutableContact::email),
+                                           make_column("phone", &ImmutableContact::phone),
+                                           constructor()));
+    storage.sync_schema();
+
+    const auto rowsCount = 200000;
+    storage.transaction([&] {
+        for(auto i = 0; i < rowsCount; ++i) {
+            auto suffix = std::to_string(i);
+            Contact contact{i + 1,
+                            "First name number " + suffix,
+                            "Last name number " + suffix,
+                            "contact.number." + suffix + "@example.com",
+                            "+1 555 000 " + suffix};
+            storage.replace(contact);
+            storage.replace(ConstructedContact{
+                contact.id, contact.firstName, contact.lastName, contact.email, contact.phone});
+            storage.replace(ImmutableContact{
+                contact.id, contact.firstName, contact.lastName, contact.email, contact.phone});
+        }
+        return true;
+    });
+
+    for(auto i = 0; i < 3; ++i) {
+        measure("default constructor and assignment", rowsCount, [&] {
+            auto contacts = storage.get_all<Contact>();
+            if(contacts.size() != size_t(rowsCount)) {
+                cout << "unexpected result" << endl;
+            }
+        });
+        measure("constructor()", rowsCount, [&] {
+            auto contacts = storage.get_all<ConstructedContact>();
+            if(contacts.size() != size_t(rowsCount)) {
+                cout << "unexpected result" << endl;
+            }
+        });
+        measure("constructor() with const members", rowsCount, [&] {
+            auto contacts = storage.get_all<ImmutableContact>();
+            if(contacts.size() != size_t(rowsCount)) {
+                cout << "unexpected result" << endl;
+            }
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,98 @@
+/**
+ *  Cost of serializing primary key CRUD statements. SQL text of `get`, `update`, `remove`, `insert` and
+ *  `replace` statements depends on a table definition only so storage serializes it once per mapped type.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <cstdio>
+
+using std::cout;
+using std::endl;
+
+struct Employee {
+    int id = 0;
+    std::string name;
+    int age = 0;
+    std::string address;
+    double salary = 0;
+};
+
+template<class F>
+double nanosecondsPerCall(int callsCount, const F &f) {
+    auto start = std::chrono::steady_clock::now();
+    for(auto i = 0; i < callsCount; ++i) {
+        f();
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / callsCount;
+}
+
+/**
+ *  Prints time spent by storage to serialize an expression: once with SQL text cached by the storage and once
+ *  with SQL text serialized at runtime. Serialization time is time of `storage.prepare` call minus time of plain
+ *  `sqlite3_prepare_v2` call with the same SQL. A copy of a storage serializes its own SQL texts so the first
+ *  `prepare` call of a fresh copy serializes an expression at runtime.
+ */
+template<class S, class E>
+void measure(const char *name, S &storage, const E &expression) {
+    const auto callsCount = 100000;
+    const auto copiesCount = 100;
+    const auto copiesRoundsCount = 20;
+    auto statement = storage.prepare(expression);
+    auto db = statement.con.get();
+    std::string sql = sqlite3_sql(statement.stmt);
+    auto cachedTime = nanosecondsPerCall(callsCount, [&storage, &expression] {
+        storage.prepare(expression);
+    });
+    std::chrono::duration<double, std::nano> runtimeElapsed{0};
+    for(auto round = 0; round < copiesRoundsCount; ++round) {
+        std::vector<S> copies;
+        copies.reserve(copiesCount);
+        for(auto i = 0; i < copiesCount; ++i) {
+            copies.push_back(storage);
+            copies.back().open_forever();
+
+            //  sqlite reads the schema on the first statement of a connection
+            copies.back().template count<Employee>();
+        }
+        auto start = std::chrono::steady_clock::now();
+        for(auto &copy: copies) {
+            copy.prepare(expression);
+        }
+        runtimeElapsed += std::chrono::steady_clock::now() - start;
+    }
+    auto runtimeTime = runtimeElapsed.count() / (copiesCount * copiesRoundsCount);
+    auto sqliteTime = nanosecondsPerCall(callsCount, [db, &sql] {
+        sqlite3_stmt *stmt = nullptr;
+        sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr);
+        sqlite3_finalize(stmt);
+    });
+    cout << name << ": serialization " << cachedTime - sqliteTime << " ns cached, " << runtimeTime - sqliteTime
+         << " ns at runtime, sqlite3_prepare_v2 " << sqliteTime << " ns" << endl;
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto filename = "crud_sql.sqlite";
+    ::remove(filename);
+    auto storage = make_storage(filename,
+                                make_table("employees",
+                                           make_column("id", &Employee::id, primary_key()),
+                                           make_column("name", &Employee::name),
+                                           make_column("age", &Employee::age),
+                                           make_column("address", &Employee::address),
+                                           make_column("salary", &Employee::salary)));
+    storage.open_forever();
+    storage.sync_schema();
+
+    Employee employee{1, "Paul", 32, "California", 20000};
+    measure("get", storage, get<Employee>(1));
+    measure("update", storage, update(employee));
+    measure("remove", storage, remove<Employee>(1));
+    measure("insert", storage, insert(employee));
+    measure("replace", storage, replace(employee));
+
+    return 0;
+}
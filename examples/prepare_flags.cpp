@@ -0,0 +1,65 @@
+/**
+ *  Keeps a bunch of prepared statements alive and reports lookaside memory usage of the connection
+ *  with and without `prepare_flags::persistent`. Persistent statements are allocated outside of the
+ *  lookaside so it stays available for short living statements and the miss counters stay low.
+ *  Note that if sqlite is compiled with SQLITE_OMIT_LOOKASIDE all lookaside counters are zero.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <vector>
+#include <cstdio>
+
+using std::cout;
+using std::endl;
+
+struct User {
+    int id = 0;
+    std::string name;
+    int age = 0;
+};
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto filename = "prepare_flags.sqlite";
+    ::remove(filename);
+    auto storage = make_storage(filename,
+                                make_table("users",
+                                           make_column("id", &User::id, primary_key()),
+                                           make_column("name", &User::name),
+                                           make_column("age", &User::age)));
+    sqlite3 *db = nullptr;
+    storage.on_open = [&db](sqlite3 *db_) {
+        db = db_;
+    };
+    storage.sync_schema();
+    storage.open_forever();
+    storage.replace(User{1, "Alex", 30});
+
+    auto status = [&db](int op, bool reset) {
+        int current = 0;
+        int highwater = 0;
+        sqlite3_db_status(db, op, &current, &highwater, reset);
+        return std::make_pair(current, highwater);
+    };
+    auto measure = [&](const char *name, prepare_flags flags) {
+        const auto statementsCount = 200;
+        status(SQLITE_DBSTATUS_LOOKASIDE_USED, true);
+        status(SQLITE_DBSTATUS_LOOKASIDE_MISS_SIZE, true);
+        status(SQLITE_DBSTATUS_LOOKASIDE_MISS_FULL, true);
+        std::vector<decltype(storage.prepare(get_all<User>(where(c(&User::age) > 0))))> statements;
+        statements.reserve(statementsCount);
+        for(auto i = 0; i < statementsCount; ++i) {
+            statements.push_back(storage.prepare(get_all<User>(where(c(&User::age) > i)), flags));
+        }
+        auto used = status(SQLITE_DBSTATUS_LOOKASIDE_USED, false);
+        auto missSize = status(SQLITE_DBSTATUS_LOOKASIDE_MISS_SIZE, false);
+        auto missFull = status(SQLITE_DBSTATUS_LOOKASIDE_MISS_FULL, false);
+        auto stmtUsed = status(SQLITE_DBSTATUS_STMT_USED, false);
+        cout << name << ": lookaside used " << used.first << " slots (highwater " << used.second << "), miss size "
+             << missSize.second << ", miss full " << missFull.second << ", statements memory " << stmtUsed.first
+             << " bytes" << endl;
+    };
+    measure("transient", prepare_flags::none);
+    measure("persistent", prepare_flags::persistent);
+    return 0;
+}
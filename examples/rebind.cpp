@@ -0,0 +1,60 @@
+/**
+ *  Runs the same query with different arguments in a loop. The first loop prepares a statement
+ *  for every call like `storage.get_all` does. The second one prepares a statement once and only
+ *  changes its arguments with `rebind`.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+
+using std::cout;
+using std::endl;
+
+struct User {
+    int id = 0;
+    std::string name;
+    int age = 0;
+};
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto filename = "rebind.sqlite";
+    ::remove(filename);
+    auto storage = make_storage(filename,
+                                make_index("users_age", &User::age),
+                                make_table("users",
+                                           make_column("id", &User::id, primary_key()),
+                                           make_column("name", &User::name),
+                                           make_column("age", &User::age)));
+    storage.sync_schema();
+    storage.open_forever();
+    storage.transaction([&storage] {
+        for(auto i = 0; i < 1000; ++i) {
+            storage.insert(User{0, "User" + std::to_string(i), i % 100});
+        }
+        return true;
+    });
+
+    const auto queriesCount = 20000;
+    size_t rowsCount = 0;
+    auto start = std::chrono::steady_clock::now();
+    for(auto i = 0; i < queriesCount; ++i) {
+        rowsCount += storage.get_all<User>(where(c(&User::age) == i % 100)).size();
+    }
+    std::chrono::duration<double, std::micro> unprepared = std::chrono::steady_clock::now() - start;
+
+    size_t preparedRowsCount = 0;
+    start = std::chrono::steady_clock::now();
+    auto statement = storage.prepare(get_all<User>(where(c(&User::age) == 0)));
+    for(auto i = 0; i < queriesCount; ++i) {
+        rebind(statement, i % 100);
+        preparedRowsCount += storage.execute(statement).size();
+    }
+    std::chrono::duration<double, std::micro> prepared = std::chrono::steady_clock::now() - start;
+
+    cout << "unprepared: " << unprepared.count() / queriesCount << " us/query" << endl;
+    cout << "prepared with rebind: " << prepared.count() / queriesCount << " us/query" << endl;
+    cout << "rows: " << rowsCount << " / " << preparedRowsCount << endl;
+    return 0;
+}
@@ -0,0 +1,91 @@
+/**
+ *  `get_all` grows its result vector from empty so big results are reallocated and moved many times.
+ *  This example compares a polling loop which reads the whole table with plain `get_all`, with result size
+ *  estimate enabled (the vector is reserved by the previous result size or `sqlite_stat1`) and with a caller
+ *  provided container passed with `into` which keeps its capacity across calls.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+
+using std::cout;
+using std::endl;
+
+struct Order {
+    int id = 0;
+    std::string customer;
+    std::string address;
+    std::string comment;
+    double total = 0;
+};
+
+template<class F>
+void measure(const char *name, int pollsCount, const F &f) {
+    auto start = std::chrono::steady_clock::now();
+    for(auto i = 0; i < pollsCount; ++i) {
+        f();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    cout << name << ": " << elapsed.count() * 1000 / pollsCount << " ms per poll" << endl;
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto storage = make_storage({},
+                                make_table("orders",
+                                           make_column("id", &Order::id, primary_key()),
+                                           make_column("customer", &Order::customer),
+                                           make_column("address", &Order::address),
+                                           make_column("comment", &Order::comment),
+                                           make_column("total", &Order::total)));
+    storage.sync_schema();
+
+    const auto rowsCount = 100000;
+    storage.transaction([&] {
+        for(auto i = 0; i < rowsCount; ++i) {
+            auto suffix = std::to_string(i);
+            storage.replace(Order{i + 1,
+                                  "Customer number " + suffix,
+                                  "Street number " + suffix + ", some city",
+                                  "Please deliver order number " + suffix + " before noon",
+                                  i * 0.5});
+        }
+        return true;
+    });
+
+    const auto pollsCount = 20;
+    measure("get_all", pollsCount, [&] {
+        auto orders = storage.get_all<Order>();
+        if(orders.size() != size_t(rowsCount)) {
+            cout << "unexpected result" << endl;
+        }
+    });
+
+    storage.enable_result_size_estimate();
+    measure("get_all with result size estimate", pollsCount, [&] {
+        auto orders = storage.get_all<Order>();
+        if(orders.size() != size_t(rowsCount)) {
+            cout << "unexpected result" << endl;
+        }
+    });
+    storage.enable_result_size_estimate(false);
+
+    std::vector<Order> orders;
+    measure("get_all into the same vector", pollsCount, [&] {
+        storage.get_all<Order>(into(orders));
+        if(orders.size() != size_t(rowsCount)) {
+            cout << "unexpected result" << endl;
+        }
+    });
+
+    std::vector<int> ids;
+    measure("select into the same vector", pollsCount, [&] {
+        storage.select(into(ids), &Order::id, where(c(&Order::total) >= 0));
+        if(ids.size() != size_t(rowsCount)) {
+            cout << "unexpected result" << endl;
+        }
+    });
+    return 0;
+}
@@ -0,0 +1,52 @@
+/**
+ *  Point lookups by primary key with and without the statement cache. With the cache enabled
+ *  `get` reuses a statement prepared once instead of serializing and preparing a query every call.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <chrono>
+
+using std::cout;
+using std::endl;
+
+struct Employee {
+    int id = 0;
+    std::string name;
+    double salary = 0;
+};
+
+template<class S>
+double lookupsPerSecond(S &storage, int lookupsCount) {
+    auto start = std::chrono::steady_clock::now();
+    for(auto i = 0; i < lookupsCount; ++i) {
+        auto employee = storage.template get<Employee>(i % 1000 + 1);
+        (void)employee;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return lookupsCount / elapsed.count();
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto storage = make_storage({},
+                                make_table("employees",
+                                           make_column("id", &Employee::id, primary_key()),
+                                           make_column("name", &Employee::name),
+                                           make_column("salary", &Employee::salary)));
+    storage.open_forever();
+    storage.sync_schema();
+    storage.transaction([&storage] {
+        for(auto i = 1; i <= 1000; ++i) {
+            storage.replace(Employee{i, "employee " + std::to_string(i), double(i)});
+        }
+        return true;
+    });
+
+    const auto lookupsCount = 100000;
+    cout << "without cache: " << lookupsPerSecond(storage, lookupsCount) << " lookups/s" << endl;
+    storage.enable_statement_cache();
+    cout << "with cache: " << lookupsPerSecond(storage, lookupsCount) << " lookups/s" << endl;
+    cout << "hits: " << storage.statement_cache_hits() << ", misses: " << storage.statement_cache_misses() << endl;
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ *  Inserts large JSON payloads. Text and blob fields mapped with member pointers are bound with
+ *  `SQLITE_STATIC` and an explicit length so sqlite neither copies nor measures them. A getter which
+ *  returns a value by copy makes sqlite copy the value (`SQLITE_TRANSIENT`) cause the copy is destroyed
+ *  before the statement is executed. Compare throughput of both mappings.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <chrono>
+#include <string>
+
+using std::cout;
+using std::endl;
+
+struct Event {
+    int id = 0;
+    std::string json;
+};
+
+class CopiedEvent {
+    int id = 0;
+    std::string json;
+
+  public:
+    CopiedEvent() = default;
+
+    CopiedEvent(int id_, std::string json_) : id(id_), json(std::move(json_)) {}
+
+    int getId() const {
+        return this->id;
+    }
+
+    void setId(int value) {
+        this->id = value;
+    }
+
+    std::string getJson() const {
+        return this->json;
+    }
+
+    void setJson(std::string value) {
+        this->json = std::move(value);
+    }
+};
+
+template<class F>
+void measure(const char *name, size_t payloadSize, int rowsCount, const F &f) {
+    auto start = std::chrono::steady_clock::now();
+    for(auto i = 0; i < rowsCount; ++i) {
+        f(i);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    cout << name << ": " << int(double(payloadSize) * rowsCount / elapsed.count() / 1024 / 1024) << " MB/s" << endl;
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto storage = make_storage({},
+                                make_table("events",
+                                           make_column("id", &Event::id, primary_key()),
+                                           make_column("json", &Event::json)),
+                                make_table("copied_events",
+                                           make_column("id", &CopiedEvent::getId, &CopiedEvent::setId, primary_key()),
+                                           make_column("json", &CopiedEvent::getJson, &CopiedEvent::setJson)));
+    storage.sync_schema();
+    storage.enable_statement_cache();
+
+    const size_t payloadSize = 1024 * 1024;
+    const auto rowsCount = 200;
+    std::string json = "{\"data\":\"" + std::string(payloadSize - 12, 'x') + "\"}";
+    Event event{0, json};
+    CopiedEvent copiedEvent{0, json};
+    storage.transaction([&] {
+        measure("member pointer (SQLITE_STATIC)", payloadSize, rowsCount, [&](int i) {
+            event.id = i + 1;
+            storage.replace(event);
+        });
+        measure("getter by value (SQLITE_TRANSIENT)", payloadSize, rowsCount, [&](int i) {
+            copiedEvent.setId(i + 1);
+            storage.replace(copiedEvent);
+        });
+        return false;
+    });
+    return 0;
+}
@@ -0,0 +1,74 @@
+/**
+ *  Full table scan with `iterate` and with `stream`. `iterate` allocates a new object for every row
+ *  while `stream` cursor extracts rows into a single object or into a reused vector.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <chrono>
+
+using std::cout;
+using std::endl;
+
+struct User {
+    int id = 0;
+    std::string firstName;
+    std::string lastName;
+    std::string email;
+};
+
+template<class F>
+double millisecondsOf(const F &f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto storage = make_storage({},
+                                make_table("users",
+                                           make_column("id", &User::id, primary_key()),
+                                           make_column("first_name", &User::firstName),
+                                           make_column("last_name", &User::lastName),
+                                           make_column("email", &User::email)));
+    storage.sync_schema();
+
+    const auto rowsCount = 200000;
+    {
+        auto loader = storage.bulk_loader<User>();
+        for(auto i = 0; i < rowsCount; ++i) {
+            auto number = std::to_string(i);
+            loader.push(User{0, "first name " + number, "last name " + number, "user" + number + "@example.com"});
+        }
+        loader.finish();
+    }
+
+    size_t totalLength = 0;
+    auto iterateTime = millisecondsOf([&storage, &totalLength] {
+        for(auto &user: storage.iterate<User>()) {
+            totalLength += user.email.size();
+        }
+    });
+    auto streamTime = millisecondsOf([&storage, &totalLength] {
+        auto cursor = storage.stream<User>();
+        while(cursor.next()) {
+            totalLength += cursor.current().email.size();
+        }
+    });
+    auto batchTime = millisecondsOf([&storage, &totalLength] {
+        auto cursor = storage.stream<User>();
+        std::vector<User> rows;
+        while(cursor.next(rows, 256)) {
+            for(auto &user: rows) {
+                totalLength += user.email.size();
+            }
+        }
+    });
+    cout << "iterate: " << iterateTime << " ms" << endl;
+    cout << "stream next(): " << streamTime << " ms" << endl;
+    cout << "stream next(rows, 256): " << batchTime << " ms" << endl;
+    cout << "checksum: " << totalLength << endl;
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ *  Throughput of empty transactions. `BEGIN`, `COMMIT` and `ROLLBACK` statements are cached by
+ *  the connection and `transaction_guard` doesn't allocate so an empty transaction costs a couple
+ *  of `sqlite3_step` calls. Also counts heap allocations made per transaction.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+using std::cout;
+using std::endl;
+
+static long long allocationsCount = 0;
+
+void *operator new(size_t size) {
+    ++allocationsCount;
+    if(auto res = std::malloc(size ? size : 1)) {
+        return res;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+struct Item {
+    int id = 0;
+};
+
+template<class F>
+void measure(const char *name, const F &f) {
+    const auto transactionsCount = 200000;
+    auto allocationsBefore = allocationsCount;
+    auto start = std::chrono::steady_clock::now();
+    for(auto i = 0; i < transactionsCount; ++i) {
+        f();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    cout << name << ": " << int(transactionsCount / elapsed.count()) << " transactions/s, "
+         << double(allocationsCount - allocationsBefore) / transactionsCount << " allocations/transaction" << endl;
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto filename = "transaction_throughput.sqlite";
+    ::remove(filename);
+    auto storage = make_storage(filename, make_table("items", make_column("id", &Item::id, primary_key())));
+    storage.sync_schema();
+    storage.open_forever();
+
+    measure("begin_transaction/commit", [&storage] {
+        storage.begin_transaction();
+        storage.commit();
+    });
+    measure("transaction_guard", [&storage] {
+        auto guard = storage.transaction_guard();
+        guard.commit();
+    });
+    measure("transaction", [&storage] {
+        storage.transaction([] {
+            return true;
+        });
+    });
+    measure("immediate transaction_guard", [&storage] {
+        transaction_options options;
+        auto guard = storage.transaction_guard(options);
+        guard.rollback();
+    });
+    return 0;
+}
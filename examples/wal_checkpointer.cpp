@@ -0,0 +1,66 @@
+/**
+ *  Commit latency in WAL mode with automatic checkpoints and with a background checkpointer.
+ *  Automatic checkpoint runs inline on a committing thread so some commits are much slower than others.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+#include <cstdio>
+
+using std::cout;
+using std::endl;
+
+struct Event {
+    int id = 0;
+    std::string payload;
+};
+
+template<class S>
+void measure(const char *name, S &storage) {
+    const auto insertsCount = 20000;
+    std::vector<double> latencies;
+    latencies.reserve(insertsCount);
+    Event event{0, std::string(500, 'x')};
+    for(auto i = 0; i < insertsCount; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        storage.insert(event);
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        latencies.push_back(elapsed.count());
+    }
+    std::sort(latencies.begin(), latencies.end());
+    cout << name << ": p50 " << latencies[latencies.size() / 2] << " us, p99 "
+         << latencies[latencies.size() * 99 / 100] << " us, max " << latencies.back() << " us" << endl;
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto filename = "wal_checkpointer.sqlite";
+    ::remove(filename);
+    auto storage = make_storage(
+        filename,
+        make_table("events", make_column("id", &Event::id, primary_key()), make_column("payload", &Event::payload)));
+    storage.set_connection_lifetime(connection_lifetime::always_open);
+    storage.sync_schema();
+    storage.pragma.journal_mode(journal_mode::WAL);
+    storage.pragma.synchronous(1);
+    //  writers wait for RESTART checkpoints instead of failing with SQLITE_BUSY
+    storage.busy_timeout(5000);
+
+    measure("autocheckpoint", storage);
+
+    wal_checkpointer_options options;
+    options.wal_frames = 1000;
+    //  PASSIVE checkpoints never catch up with a steady writer so WAL would grow forever
+    options.restart_wal_frames = 10000;
+    storage.start_wal_checkpointer(options);
+    measure("background checkpointer", storage);
+    auto stats = storage.wal_checkpointer_stats();
+    cout << "checkpoints: " << stats.checkpoints_count << ", restarts: " << stats.restarts_count
+         << ", busy: " << stats.busy_count
+         << ", checkpointed frames: " << stats.total_checkpointed_frames
+         << ", WAL frames: " << stats.last_log_frames
+         << ", max duration: " << stats.max_duration.count() << " us" << endl;
+    return 0;
+}
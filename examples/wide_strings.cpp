@@ -0,0 +1,79 @@
+/**
+ *  Insert and select throughput of wide string columns. `std::u16string` (and `std::wstring` on Windows)
+ *  goes to sqlite as UTF-16 without any conversion on our side. `std::wstring` on other platforms holds
+ *  UTF-32 so it is transcoded to and from UTF-8.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <chrono>
+#include <string>
+
+using std::cout;
+using std::endl;
+
+struct WideRow {
+    int id = 0;
+    std::wstring text;
+};
+
+struct Utf16Row {
+    int id = 0;
+    std::u16string text;
+};
+
+template<class F>
+void measure(const char *name, int rowsCount, const F &f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    cout << name << ": " << int(rowsCount / elapsed.count()) << " rows/s" << endl;
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto storage = make_storage(
+        {},
+        make_table("wide_rows", make_column("id", &WideRow::id, primary_key()), make_column("text", &WideRow::text)),
+        make_table("utf16_rows",
+                   make_column("id", &Utf16Row::id, primary_key()),
+                   make_column("text", &Utf16Row::text)));
+    storage.sync_schema();
+
+    const auto rowsCount = 100000;
+    std::wstring wideText;
+    std::u16string utf16Text;
+    for(auto i = 0; i < 10; ++i) {
+        wideText += L"Grüße, мир, 世界! ";
+        utf16Text += u"Grüße, мир, 世界! ";
+    }
+
+    measure("std::wstring insert", rowsCount, [&] {
+        storage.transaction([&] {
+            for(auto i = 0; i < rowsCount; ++i) {
+                storage.insert(WideRow{0, wideText});
+            }
+            return true;
+        });
+    });
+    measure("std::wstring select", rowsCount, [&] {
+        auto rows = storage.get_all<WideRow>();
+        if(rows.size() != size_t(rowsCount) || rows.back().text != wideText) {
+            cout << "unexpected result" << endl;
+        }
+    });
+    measure("std::u16string insert", rowsCount, [&] {
+        storage.transaction([&] {
+            for(auto i = 0; i < rowsCount; ++i) {
+                storage.insert(Utf16Row{0, utf16Text});
+            }
+            return true;
+        });
+    });
+    measure("std::u16string select", rowsCount, [&] {
+        auto rows = storage.get_all<Utf16Row>();
+        if(rows.size() != size_t(rowsCount) || rows.back().text != utf16Text) {
+            cout << "unexpected result" << endl;
+        }
+    });
+    return 0;
+}
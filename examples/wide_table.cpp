@@ -0,0 +1,105 @@
+/**
+ *  Row throughput of a table with 20 columns. Every column knows at compile time whether it is mapped with a
+ *  member pointer or with getter and setter so binding and extracting a row is a straight sequence of
+ *  calls without checking `member_pointer` for every column of every row.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+using std::cout;
+using std::endl;
+
+struct Measurement {
+    int id = 0;
+    int c1 = 0;
+    int c2 = 0;
+    int c3 = 0;
+    int c4 = 0;
+    int c5 = 0;
+    int c6 = 0;
+    int c7 = 0;
+    int c8 = 0;
+    int c9 = 0;
+    double c10 = 0;
+    double c11 = 0;
+    double c12 = 0;
+    double c13 = 0;
+    double c14 = 0;
+    double c15 = 0;
+    double c16 = 0;
+    double c17 = 0;
+    double c18 = 0;
+    double c19 = 0;
+};
+
+template<class F>
+void measure(const char *name, int rowsCount, const F &f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    cout << name << ": " << int(rowsCount / elapsed.count()) << " rows/s" << endl;
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto storage = make_storage({},
+                                make_table("measurements",
+                                           make_column("id", &Measurement::id, primary_key()),
+                                           make_column("c1", &Measurement::c1),
+                                           make_column("c2", &Measurement::c2),
+                                           make_column("c3", &Measurement::c3),
+                                           make_column("c4", &Measurement::c4),
+                                           make_column("c5", &Measurement::c5),
+                                           make_column("c6", &Measurement::c6),
+                                           make_column("c7", &Measurement::c7),
+                                           make_column("c8", &Measurement::c8),
+                                           make_column("c9", &Measurement::c9),
+                                           make_column("c10", &Measurement::c10),
+                                           make_column("c11", &Measurement::c11),
+                                           make_column("c12", &Measurement::c12),
+                                           make_column("c13", &Measurement::c13),
+                                           make_column("c14", &Measurement::c14),
+                                           make_column("c15", &Measurement::c15),
+                                           make_column("c16", &Measurement::c16),
+                                           make_column("c17", &Measurement::c17),
+                                           make_column("c18", &Measurement::c18),
+                                           make_column("c19", &Measurement::c19)));
+    storage.sync_schema();
+
+    const auto rowsCount = 200000;
+    std::vector<Measurement> measurements;
+    measurements.reserve(rowsCount);
+    for(auto i = 0; i < rowsCount; ++i) {
+        measurements.push_back(
+            {i + 1, i, i, i, i, i, i, i, i, i, i * 0.5, i * 0.5, i * 0.5, i * 0.5, i * 0.5, i * 0.5, i * 0.5,
+             i * 0.5, i * 0.5, i * 0.5});
+    }
+
+    measure("insert_range", rowsCount, [&] {
+        storage.transaction([&] {
+            const auto chunkSize = 40;
+            for(auto it = measurements.begin(); it != measurements.end(); it += chunkSize) {
+                storage.insert_range(it, it + chunkSize);
+            }
+            return true;
+        });
+    });
+    measure("get_all", rowsCount, [&] {
+        auto rows = storage.get_all<Measurement>();
+        if(rows.size() != size_t(rowsCount) || rows.back().c19 != measurements.back().c19) {
+            cout << "unexpected result" << endl;
+        }
+    });
+    measure("iterate", rowsCount, [&] {
+        auto sum = 0.0;
+        for(auto &measurement: storage.iterate<Measurement>()) {
+            sum += measurement.c19;
+        }
+        if(sum == 0) {
+            cout << "unexpected result" << endl;
+        }
+    });
+    return 0;
+}
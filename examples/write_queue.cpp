@@ -0,0 +1,71 @@
+/**
+ *  Many threads insert rows one by one. Without a write queue every insert is a separate transaction
+ *  with its own commit. With `start_write_queue` inserts made at the same time share one commit.
+ */
+#include <sqlite_orm/sqlite_orm.h>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <future>
+#include <cstdio>
+
+using std::cout;
+using std::endl;
+
+struct Event {
+    int id = 0;
+    std::string name;
+};
+
+template<class F>
+double insertsPerSecond(int threadsCount, int insertsPerThread, const F &insert) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for(auto t = 0; t < threadsCount; ++t) {
+        threads.emplace_back([&insert, insertsPerThread, t] {
+            for(auto i = 0; i < insertsPerThread; ++i) {
+                insert(Event{0, "event " + std::to_string(t) + " " + std::to_string(i)});
+            }
+        });
+    }
+    for(auto &thread: threads) {
+        thread.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return threadsCount * insertsPerThread / elapsed.count();
+}
+
+int main(int, char **) {
+    using namespace sqlite_orm;
+    auto filename = "write_queue.sqlite";
+    ::remove(filename);
+    auto storage = make_storage(
+        filename,
+        make_table("events", make_column("id", &Event::id, primary_key()), make_column("name", &Event::name)));
+    storage.sync_schema();
+    storage.open_forever();
+
+    const auto threadsCount = 16;
+    const auto insertsPerThread = 20;
+    cout << "separate commits: " << insertsPerSecond(threadsCount,
+                                                     insertsPerThread,
+                                                     [&storage](const Event &event) {
+                                                         storage.insert(event);
+                                                     })
+         << " inserts/s" << endl;
+
+    storage.start_write_queue();
+    cout << "write queue: " << insertsPerSecond(threadsCount,
+                                                insertsPerThread,
+                                                [&storage](const Event &event) {
+                                                    storage.enqueue_insert(event).get();
+                                                })
+         << " inserts/s" << endl;
+    cout << "writes: " << storage.write_queue_writes_count() << ", commits: " << storage.write_queue_commits_count()
+         << endl;
+    storage.stop_write_queue();
+    cout << "rows: " << storage.count<Event>() << endl;
+
+    return 0;
+}
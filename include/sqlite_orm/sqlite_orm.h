@@ -18,6 +18,15 @@ __pragma(push_macro("min"))
 #if __cplusplus >= 201703L  // use of C++17 or higher
 // Enables use of std::optional in SQLITE_ORM.
 #define SQLITE_ORM_OPTIONAL_SUPPORTED
+// Enables use of std::string_view in SQLITE_ORM.
+#define SQLITE_ORM_STRING_VIEW_SUPPORTED
+// Enables use of std::byte in SQLITE_ORM.
+#define SQLITE_ORM_BYTE_SUPPORTED
+#endif
+
+#if __cplusplus >= 202002L && defined(__cpp_impl_coroutine)  // use of C++20 with coroutines
+// Enables co_await-able functions of async_storage.
+#define SQLITE_ORM_COROUTINES_SUPPORTED
 #endif
 #pragma once
 
@@ -42,6 +51,8 @@ __pragma(push_macro("min"))
         incorrect_journal_mode_string,
         invalid_collate_argument_enum,
         failed_to_init_a_backup,
+        write_queue_is_not_started,
+        incorrect_locking_mode_string,
     };
 }
 
@@ -77,6 +88,10 @@ namespace sqlite_orm {
                     return "Invalid collate_argument enum";
                 case orm_error_code::failed_to_init_a_backup:
                     return "Failed to init a backup";
+                case orm_error_code::write_queue_is_not_started:
+                    return "Write queue is not started";
+                case orm_error_code::incorrect_locking_mode_string:
+                    return "Incorrect locking mode string";
                 default:
                     return "unknown error";
             }
@@ -271,18 +286,17 @@ namespace sqlite_orm {
         template<typename T, typename Tuple>
         using tuple_contains_type = typename has_type<T, Tuple>::type;
 
+        /**
+         *  Calls `l` for elements [0, N] of a tuple in direct order. The order is a part of the type (not a runtime
+         *  flag) so every level has a single call of the next one and inlining stays linear in tuple size.
+         */
         template<size_t N, class... Args>
         struct iterator {
 
             template<class L>
-            void operator()(const std::tuple<Args...> &t, const L &l, bool reverse = true) {
-                if(reverse) {
-                    l(std::get<N>(t));
-                    iterator<N - 1, Args...>()(t, l, reverse);
-                } else {
-                    iterator<N - 1, Args...>()(t, l, reverse);
-                    l(std::get<N>(t));
-                }
+            void operator()(const std::tuple<Args...> &t, const L &l) {
+                iterator<N - 1, Args...>()(t, l);
+                l(std::get<N>(t));
             }
         };
 
@@ -290,7 +304,7 @@ namespace sqlite_orm {
         struct iterator<0, Args...> {
 
             template<class L>
-            void operator()(const std::tuple<Args...> &t, const L &l, bool /*reverse*/ = true) {
+            void operator()(const std::tuple<Args...> &t, const L &l) {
                 l(std::get<0>(t));
             }
         };
@@ -299,7 +313,7 @@ namespace sqlite_orm {
         struct iterator<N> {
 
             template<class L>
-            void operator()(const std::tuple<> &, const L &, bool /*reverse*/ = true) {
+            void operator()(const std::tuple<> &, const L &) {
                 //..
             }
         };
@@ -326,7 +340,7 @@ namespace sqlite_orm {
         template<class L, class... Args>
         void iterate_tuple(const std::tuple<Args...> &t, const L &l) {
             using tuple_type = std::tuple<Args...>;
-            tuple_helper::iterator<std::tuple_size<tuple_type>::value - 1, Args...>()(t, l, false);
+            tuple_helper::iterator<std::tuple_size<tuple_type>::value - 1, Args...>()(t, l);
         }
 
         template<typename... input_t>
@@ -353,7 +367,7 @@ namespace sqlite_orm {
 }
 #pragma once
 
-#include <string>  //  std::string
+#include <string>  //  std::string, std::wstring, std::u16string
 #include <memory>  //  std::shared_ptr, std::unique_ptr
 #include <vector>  //  std::vector
 #ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
@@ -439,6 +453,9 @@ namespace sqlite_orm {
     template<>
     struct type_printer<std::wstring, void> : public text_printer {};
 
+    template<>
+    struct type_printer<std::u16string, void> : public text_printer {};
+
     template<>
     struct type_printer<const char *, void> : public text_printer {};
 
@@ -461,6 +478,9 @@ namespace sqlite_orm {
 
     template<>
     struct type_printer<std::vector<char>, void> : public blob_printer {};
+
+    template<>
+    struct type_printer<std::vector<unsigned char>, void> : public blob_printer {};
 }
 #pragma once
 
@@ -1190,7 +1210,7 @@ namespace sqlite_orm {
 #include <tuple>  //  std::tuple
 #include <string>  //  std::string
 #include <memory>  //  std::unique_ptr
-#include <type_traits>  //  std::true_type, std::false_type, std::is_same, std::enable_if, std::is_member_pointer, std::is_member_function_pointer
+#include <type_traits>  //  std::true_type, std::false_type, std::is_same, std::enable_if, std::is_member_pointer, std::is_member_function_pointer, std::remove_const
 
 // #include "type_is_nullable.h"
 
@@ -1212,20 +1232,36 @@ namespace sqlite_orm {
             const std::string name;
         };
 
+        /**
+         *  Column access tags. A column created with a member pointer reads and writes `member_pointer`
+         *  (`field_access`), a column created with getter and setter calls `getter` and `setter`
+         *  (`getter_setter_access`). The tag is a part of column's type so row loops are specialized for it
+         *  at compile time instead of checking `member_pointer` for every row.
+         */
+        struct field_access {};
+        struct getter_setter_access {};
+
         /**
          *  This class stores single column info. column_t is a pair of [column_name:member_pointer] mapped to a storage
          *  O is a mapped class, e.g. User
-         *  T is a mapped class'es field type, e.g. &User::name
+         *  T is a mapped class'es field type, e.g. &User::name. May be const if the table has a constructor element
+         *  A is an access tag: field_access or getter_setter_access
          *  Op... is a constraints pack, e.g. primary_key_t, autoincrement_t etc
          */
-        template<class O, class T, class G /* = const T& (O::*)() const*/, class S /* = void (O::*)(T)*/, class... Op>
+        template<class O,
+                 class T,
+                 class G /* = const T& (O::*)() const*/,
+                 class S /* = void (O::*)(T)*/,
+                 class A /* = field_access*/,
+                 class... Op>
         struct column_t : column_base {
             using object_type = O;
-            using field_type = T;
+            using field_type = typename std::remove_const<T>::type;
             using constraints_type = std::tuple<Op...>;
-            using member_pointer_t = field_type object_type::*;
+            using member_pointer_t = T object_type::*;
             using getter_type = G;
             using setter_type = S;
+            using access_type = A;
 
             /**
              *  Member pointer used to read/write member
@@ -1466,7 +1502,7 @@ namespace sqlite_orm {
              class T,
              typename = typename std::enable_if<!std::is_member_function_pointer<T O::*>::value>::type,
              class... Op>
-    internal::column_t<O, T, const T &(O::*)() const, void (O::*)(T), Op...>
+    internal::column_t<O, T, const T &(O::*)() const, void (O::*)(T), internal::field_access, Op...>
     make_column(const std::string &name, T O::*m, Op... constraints) {
         static_assert(constraints::constraints_size<Op...>::value == std::tuple_size<std::tuple<Op...>>::value,
                       "Incorrect constraints pack");
@@ -1485,6 +1521,7 @@ namespace sqlite_orm {
                        typename internal::setter_traits<S>::field_type,
                        G,
                        S,
+                       internal::getter_setter_access,
                        Op...>
     make_column(const std::string &name, S setter, G getter, Op... constraints) {
         static_assert(std::is_same<typename internal::setter_traits<S>::field_type,
@@ -1508,6 +1545,7 @@ namespace sqlite_orm {
                        typename internal::setter_traits<S>::field_type,
                        G,
                        S,
+                       internal::getter_setter_access,
                        Op...>
     make_column(const std::string &name, G getter, S setter, Op... constraints) {
         static_assert(std::is_same<typename internal::setter_traits<S>::field_type,
@@ -1521,7 +1559,7 @@ namespace sqlite_orm {
 }
 #pragma once
 
-#include <string>  //  std::string
+#include <string>  //  std::string, std::wstring, std::u16string
 #include <sstream>  //  std::stringstream
 #include <vector>  //  std::vector
 #include <cstddef>  //  std::nullptr_t
@@ -1530,6 +1568,165 @@ namespace sqlite_orm {
 #include <optional>  // std::optional
 #endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
 
+// #include "utf_converter.h"
+
+#include <string>  //  std::string, std::basic_string
+#include <cstddef>  //  std::size_t
+#include <type_traits>  //  std::integral_constant
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  Transcoding between UTF-8 and wide strings used by `std::wstring` and `std::u16string` binders and
+         *  extractors. `char16_t` and 2 bytes long `wchar_t` (Windows) hold UTF-16, 4 bytes long `wchar_t` holds
+         *  UTF-32. Malformed sequences are replaced with U+FFFD.
+         */
+        struct utf_converter {
+            template<class Char>
+            using is_utf16 = std::integral_constant<bool, sizeof(Char) == 2>;
+
+            static constexpr char32_t replacement_character = 0xFFFD;
+
+            template<class Char>
+            static std::string to_utf8(const Char *data, std::size_t size) {
+                std::string res;
+                res.reserve(size);
+                for(auto it = data, end = data + size; it != end;) {
+                    if(static_cast<char32_t>(*it) < 0x80) {
+                        res += static_cast<char>(*it++);
+                    } else {
+                        append_utf8(res, decode(it, end, is_utf16<Char>{}));
+                    }
+                }
+                return res;
+            }
+
+            template<class Char>
+            static std::basic_string<Char> from_utf8(const char *data, std::size_t size) {
+                std::basic_string<Char> res;
+                res.reserve(size);
+                auto it = reinterpret_cast<const unsigned char *>(data);
+                for(auto end = it + size; it != end;) {
+                    if(*it < 0x80) {
+                        res += static_cast<Char>(*it++);
+                    } else {
+                        append(res, decode_utf8(it, end), is_utf16<Char>{});
+                    }
+                }
+                return res;
+            }
+
+          private:
+            static bool is_surrogate(char32_t c) {
+                return c >= 0xD800 && c <= 0xDFFF;
+            }
+
+            static void append_utf8(std::string &res, char32_t c) {
+                if(c < 0x80) {
+                    res += static_cast<char>(c);
+                } else if(c < 0x800) {
+                    res += static_cast<char>(0xC0 | (c >> 6));
+                    res += static_cast<char>(0x80 | (c & 0x3F));
+                } else if(c < 0x10000) {
+                    res += static_cast<char>(0xE0 | (c >> 12));
+                    res += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+                    res += static_cast<char>(0x80 | (c & 0x3F));
+                } else {
+                    res += static_cast<char>(0xF0 | (c >> 18));
+                    res += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+                    res += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+                    res += static_cast<char>(0x80 | (c & 0x3F));
+                }
+            }
+
+            template<class Char>
+            static void append(std::basic_string<Char> &res, char32_t c, std::true_type) {
+                if(c < 0x10000) {
+                    res += static_cast<Char>(c);
+                } else {
+                    c -= 0x10000;
+                    res += static_cast<Char>(0xD800 + (c >> 10));
+                    res += static_cast<Char>(0xDC00 + (c & 0x3FF));
+                }
+            }
+
+            template<class Char>
+            static void append(std::basic_string<Char> &res, char32_t c, std::false_type) {
+                res += static_cast<Char>(c);
+            }
+
+            /**
+             *  Decodes a UTF-16 code point and advances `it`.
+             */
+            template<class Char>
+            static char32_t decode(const Char *&it, const Char *end, std::true_type) {
+                char32_t c = static_cast<char16_t>(*it++);
+                if(!is_surrogate(c)) {
+                    return c;
+                }
+                if(c <= 0xDBFF && it != end) {
+                    char32_t low = static_cast<char16_t>(*it);
+                    if(low >= 0xDC00 && low <= 0xDFFF) {
+                        ++it;
+                        return 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                }
+                return replacement_character;
+            }
+
+            /**
+             *  Decodes a UTF-32 code point and advances `it`.
+             */
+            template<class Char>
+            static char32_t decode(const Char *&it, const Char *, std::false_type) {
+                auto c = static_cast<char32_t>(*it++);
+                if(c > 0x10FFFF || is_surrogate(c)) {
+                    return replacement_character;
+                }
+                return c;
+            }
+
+            /**
+             *  Decodes a multibyte UTF-8 sequence and advances `it`. Overlong sequences, surrogates and
+             *  truncated sequences are malformed.
+             */
+            static char32_t decode_utf8(const unsigned char *&it, const unsigned char *end) {
+                auto lead = *it++;
+                int length = 0;
+                char32_t c = 0;
+                char32_t min = 0;
+                if((lead & 0xE0) == 0xC0) {
+                    length = 1;
+                    c = lead & 0x1F;
+                    min = 0x80;
+                } else if((lead & 0xF0) == 0xE0) {
+                    length = 2;
+                    c = lead & 0x0F;
+                    min = 0x800;
+                } else if((lead & 0xF8) == 0xF0) {
+                    length = 3;
+                    c = lead & 0x07;
+                    min = 0x10000;
+                } else {
+                    return replacement_character;
+                }
+                for(auto i = 0; i < length; ++i) {
+                    if(it == end || (*it & 0xC0) != 0x80) {
+                        return replacement_character;
+                    }
+                    c = (c << 6) | (*it++ & 0x3F);
+                }
+                if(c < min || c > 0x10FFFF || is_surrogate(c)) {
+                    return replacement_character;
+                }
+                return c;
+            }
+        };
+    }
+}
+
 namespace sqlite_orm {
 
     /**
@@ -1588,6 +1785,20 @@ namespace sqlite_orm {
         }
     };
 
+    template<>
+    struct field_printer<std::wstring> {
+        std::string operator()(const std::wstring &t) const {
+            return internal::utf_converter::to_utf8(t.data(), t.size());
+        }
+    };
+
+    template<>
+    struct field_printer<std::u16string> {
+        std::string operator()(const std::u16string &t) const {
+            return internal::utf_converter::to_utf8(t.data(), t.size());
+        }
+    };
+
     template<>
     struct field_printer<std::vector<char>> {
         std::string operator()(const std::vector<char> &t) const {
@@ -1600,6 +1811,18 @@ namespace sqlite_orm {
         }
     };
 
+    template<>
+    struct field_printer<std::vector<unsigned char>> {
+        std::string operator()(const std::vector<unsigned char> &t) const {
+            std::stringstream ss;
+            ss << std::hex;
+            for(auto c: t) {
+                ss << int(c);
+            }
+            return ss.str();
+        }
+    };
+
     template<>
     struct field_printer<std::nullptr_t> {
         std::string operator()(const std::nullptr_t &) const {
@@ -4467,6 +4690,22 @@ namespace sqlite_orm {
             sqlite3_finalize(this->stmt);
         }
     };
+
+    /**
+     *  Guard class which resets `sqlite3_stmt` and clears its bindings in dtor. `execute` binds values of
+     *  a prepared statement expression with `SQLITE_STATIC` so the bindings must not outlive the execution:
+     *  the expression may be changed with `get<N>` or `rebind` or destroyed after `execute` returns.
+     */
+    struct statement_reset_guard {
+        sqlite3_stmt *stmt = nullptr;
+
+        statement_reset_guard(decltype(stmt) stmt_) : stmt(stmt_) {}
+
+        inline ~statement_reset_guard() {
+            sqlite3_reset(this->stmt);
+            sqlite3_clear_bindings(this->stmt);
+        }
+    };
 }
 #pragma once
 
@@ -4495,13 +4734,13 @@ namespace sqlite_orm {
 
 #include <sqlite3.h>
 #include <type_traits>  //  std::enable_if_t, std::is_arithmetic, std::is_same, std::true_type, std::false_type
-#include <string>  //  std::string, std::wstring
-#ifndef SQLITE_ORM_OMITS_CODECVT
-#include <codecvt>  //  std::wstring_convert, std::codecvt_utf8_utf16
-#endif  //  SQLITE_ORM_OMITS_CODECVT
+#include <string>  //  std::string, std::wstring, std::u16string
 #include <vector>  //  std::vector
-#include <cstddef>  //  std::nullptr_t
+#include <cstddef>  //  std::nullptr_t, std::byte
 #include <utility>  //  std::declval
+#ifdef SQLITE_ORM_STRING_VIEW_SUPPORTED
+#include <string_view>  //  std::string_view
+#endif  //  SQLITE_ORM_STRING_VIEW_SUPPORTED
 
 // #include "is_std_ptr.h"
 
@@ -4532,14 +4771,129 @@ namespace sqlite_orm {
     };
 }
 
+// #include "blob_view.h"
+
+#include <cstddef>  //  std::size_t
+
+namespace sqlite_orm {
+
+    /**
+     *  Non owning view of a BLOB value. A view extracted from a statement points into sqlite's column
+     *  buffer so it is valid only until the statement is stepped, reset or finalized.
+     */
+    struct blob_view {
+        using value_type = char;
+        using size_type = std::size_t;
+        using const_iterator = const char *;
+
+        blob_view() = default;
+
+        blob_view(const char *data_, size_type size_) : pointer(data_), length(size_) {}
+
+        const char *data() const {
+            return this->pointer;
+        }
+
+        size_type size() const {
+            return this->length;
+        }
+
+        bool empty() const {
+            return !this->length;
+        }
+
+        const_iterator begin() const {
+            return this->pointer;
+        }
+
+        const_iterator end() const {
+            return this->pointer + this->length;
+        }
+
+        char operator[](size_type index) const {
+            return this->pointer[index];
+        }
+
+      protected:
+        const char *pointer = nullptr;
+        size_type length = 0;
+    };
+}
+
+// #include "utf_converter.h"
+
 namespace sqlite_orm {
 
     /**
      *  Helper class used for binding fields to sqlite3 statements.
+     *  Binders of TEXT and BLOB values also have `bind(stmt, index, value, destructor)` overload which passes
+     *  `destructor` to sqlite. `SQLITE_STATIC` makes sqlite use the value without copying it so it is passed
+     *  only if the value outlives the statement execution. `bind(stmt, index, value)` always copies cause
+     *  it is also called for temporaries (e.g. from custom binders).
      */
     template<class V, typename Enable = void>
     struct statement_binder : std::false_type {};
 
+    namespace internal {
+
+        template<class T>
+        struct is_byte : std::is_same<T, unsigned char> {};
+
+#ifdef SQLITE_ORM_BYTE_SUPPORTED
+        template<>
+        struct is_byte<std::byte> : std::true_type {};
+#endif  //  SQLITE_ORM_BYTE_SUPPORTED
+
+        /**
+         *  Contiguous range of bytes with `data()` and `size()` functions which is bound as BLOB.
+         *  E.g. `std::vector<uint8_t>`, `std::array<std::byte, N>`, `std::span<const std::byte>` or `blob_view`.
+         */
+        template<class T, class SFINAE = void>
+        struct is_blob_range : std::false_type {};
+
+        template<class T>
+        struct is_blob_range<T,
+                             decltype(void(std::declval<const T &>().data()), void(std::declval<const T &>().size()))>
+            : is_byte<std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<const T &>().data())>>> {};
+
+        template<>
+        struct is_blob_range<blob_view, void> : std::true_type {};
+
+        template<class T, class SFINAE = void>
+        struct binds_with_destructor : std::false_type {};
+
+        template<class T>
+        struct binds_with_destructor<
+            T,
+            decltype(void(statement_binder<T>().bind(std::declval<sqlite3_stmt *>(),
+                                                     0,
+                                                     std::declval<const T &>(),
+                                                     std::declval<sqlite3_destructor_type>())))> : std::true_type {};
+
+        template<class T>
+        int bind_value(sqlite3_stmt *stmt,
+                       int index,
+                       const T &value,
+                       sqlite3_destructor_type destructor,
+                       std::true_type) {
+            return statement_binder<T>().bind(stmt, index, value, destructor);
+        }
+
+        template<class T>
+        int bind_value(sqlite3_stmt *stmt, int index, const T &value, sqlite3_destructor_type, std::false_type) {
+            return statement_binder<T>().bind(stmt, index, value);
+        }
+
+        /**
+         *  Binds `value` passing `destructor` to sqlite if binder of `T` accepts it. Binders which don't
+         *  (arithmetic and custom ones) are called without it.
+         */
+        template<class T>
+        int bind_value(sqlite3_stmt *stmt, int index, const T &value, sqlite3_destructor_type destructor) {
+            return bind_value(stmt, index, value, destructor, binds_with_destructor<T>{});
+        }
+    }
+
     /**
      *  Specialization for arithmetic types.
      */
@@ -4573,7 +4927,11 @@ namespace sqlite_orm {
         V,
         std::enable_if_t<std::is_same<V, std::string>::value || std::is_same<V, const char *>::value>> {
         int bind(sqlite3_stmt *stmt, int index, const V &value) {
-            return sqlite3_bind_text(stmt, index, string_data(value), -1, SQLITE_TRANSIENT);
+            return this->bind(stmt, index, value, SQLITE_TRANSIENT);
+        }
+
+        int bind(sqlite3_stmt *stmt, int index, const V &value, sqlite3_destructor_type destructor) {
+            return sqlite3_bind_text(stmt, index, string_data(value), string_size(value), destructor);
         }
 
       private:
@@ -4584,23 +4942,103 @@ namespace sqlite_orm {
         const char *string_data(const char *s) const {
             return s;
         }
+
+        int string_size(const std::string &s) const {
+            return static_cast<int>(s.size());
+        }
+
+        int string_size(const char *) const {
+            return -1;
+        }
+    };
+
+#ifdef SQLITE_ORM_STRING_VIEW_SUPPORTED
+    /**
+     *  Specialization for std::string_view.
+     */
+    template<>
+    struct statement_binder<std::string_view, void> {
+        int bind(sqlite3_stmt *stmt, int index, const std::string_view &value) {
+            return this->bind(stmt, index, value, SQLITE_TRANSIENT);
+        }
+
+        int bind(sqlite3_stmt *stmt, int index, const std::string_view &value, sqlite3_destructor_type destructor) {
+            if(value.data()) {
+                return sqlite3_bind_text(stmt, index, value.data(), static_cast<int>(value.size()), destructor);
+            } else {
+                return sqlite3_bind_text(stmt, index, "", 0, SQLITE_STATIC);
+            }
+        }
     };
+#endif  //  SQLITE_ORM_STRING_VIEW_SUPPORTED
 
-#ifndef SQLITE_ORM_OMITS_CODECVT
     /**
-     *  Specialization for std::wstring and C-wstring.
+     *  Specialization for std::wstring, C-wstring, std::u16string and C-u16string. UTF-16 strings are passed
+     *  to `sqlite3_bind_text16` as is. UTF-32 strings (`wchar_t` is 4 bytes long everywhere except Windows)
+     *  are transcoded to UTF-8 first.
      */
     template<class V>
-    struct statement_binder<
-        V,
-        std::enable_if_t<std::is_same<V, std::wstring>::value || std::is_same<V, const wchar_t *>::value>> {
+    struct statement_binder<V,
+                            std::enable_if_t<std::is_same<V, std::wstring>::value ||
+                                             std::is_same<V, const wchar_t *>::value ||
+                                             std::is_same<V, std::u16string>::value ||
+                                             std::is_same<V, const char16_t *>::value>> {
         int bind(sqlite3_stmt *stmt, int index, const V &value) {
-            std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-            std::string utf8Str = converter.to_bytes(value);
-            return statement_binder<decltype(utf8Str)>().bind(stmt, index, utf8Str);
+            return this->bind(stmt, index, value, SQLITE_TRANSIENT);
+        }
+
+        int bind(sqlite3_stmt *stmt, int index, const V &value, sqlite3_destructor_type destructor) {
+            return this->bind_text(stmt, index, string_data(value), string_size(value), destructor);
+        }
+
+      private:
+        template<class Char>
+        int
+        bind_text(sqlite3_stmt *stmt, int index, const Char *data, size_t size, sqlite3_destructor_type destructor) {
+            return this->bind_text(stmt, index, data, size, destructor, internal::utf_converter::is_utf16<Char>{});
+        }
+
+        template<class Char>
+        int bind_text(sqlite3_stmt *stmt,
+                      int index,
+                      const Char *data,
+                      size_t size,
+                      sqlite3_destructor_type destructor,
+                      std::true_type) {
+            return sqlite3_bind_text16(stmt, index, data, static_cast<int>(size * sizeof(Char)), destructor);
+        }
+
+        template<class Char>
+        int bind_text(sqlite3_stmt *stmt,
+                      int index,
+                      const Char *data,
+                      size_t size,
+                      sqlite3_destructor_type,
+                      std::false_type) {
+            auto utf8 = internal::utf_converter::to_utf8(data, size);
+            return sqlite3_bind_text(stmt, index, utf8.data(), static_cast<int>(utf8.size()), SQLITE_TRANSIENT);
+        }
+
+        template<class Char>
+        static const Char *string_data(const std::basic_string<Char> &s) {
+            return s.c_str();
+        }
+
+        template<class Char>
+        static const Char *string_data(const Char *s) {
+            return s;
+        }
+
+        template<class Char>
+        static size_t string_size(const std::basic_string<Char> &s) {
+            return s.size();
+        }
+
+        template<class Char>
+        static size_t string_size(const Char *s) {
+            return std::char_traits<Char>::length(s);
         }
     };
-#endif  //  SQLITE_ORM_OMITS_CODECVT
 
     /**
      *  Specialization for std::nullptr_t.
@@ -4626,8 +5064,12 @@ namespace sqlite_orm {
         using value_type = typename is_std_ptr<V>::element_type;
 
         int bind(sqlite3_stmt *stmt, int index, const V &value) {
+            return this->bind(stmt, index, value, SQLITE_TRANSIENT);
+        }
+
+        int bind(sqlite3_stmt *stmt, int index, const V &value, sqlite3_destructor_type destructor) {
             if(value) {
-                return statement_binder<value_type>().bind(stmt, index, *value);
+                return internal::bind_value(stmt, index, *value, destructor);
             } else {
                 return statement_binder<std::nullptr_t>().bind(stmt, index, nullptr);
             }
@@ -4640,14 +5082,32 @@ namespace sqlite_orm {
     template<>
     struct statement_binder<std::vector<char>, void> {
         int bind(sqlite3_stmt *stmt, int index, const std::vector<char> &value) {
+            return this->bind(stmt, index, value, SQLITE_TRANSIENT);
+        }
+
+        int bind(sqlite3_stmt *stmt, int index, const std::vector<char> &value, sqlite3_destructor_type destructor) {
+            if(value.size()) {
+                return sqlite3_bind_blob(stmt, index, (const void *)&value.front(), int(value.size()), destructor);
+            } else {
+                return sqlite3_bind_blob(stmt, index, "", 0, SQLITE_STATIC);
+            }
+        }
+    };
+
+    /**
+     *  Specialization for ranges of bytes (see `internal::is_blob_range`).
+     */
+    template<class V>
+    struct statement_binder<V, std::enable_if_t<internal::is_blob_range<V>::value>> {
+        int bind(sqlite3_stmt *stmt, int index, const V &value) {
+            return this->bind(stmt, index, value, SQLITE_TRANSIENT);
+        }
+
+        int bind(sqlite3_stmt *stmt, int index, const V &value, sqlite3_destructor_type destructor) {
             if(value.size()) {
-                return sqlite3_bind_blob(stmt,
-                                         index,
-                                         (const void *)&value.front(),
-                                         int(value.size()),
-                                         SQLITE_TRANSIENT);
+                return sqlite3_bind_blob(stmt, index, (const void *)value.data(), int(value.size()), destructor);
             } else {
-                return sqlite3_bind_blob(stmt, index, "", 0, SQLITE_TRANSIENT);
+                return sqlite3_bind_blob(stmt, index, "", 0, SQLITE_STATIC);
             }
         }
     };
@@ -4658,8 +5118,12 @@ namespace sqlite_orm {
         using value_type = T;
 
         int bind(sqlite3_stmt *stmt, int index, const std::optional<T> &value) {
+            return this->bind(stmt, index, value, SQLITE_TRANSIENT);
+        }
+
+        int bind(sqlite3_stmt *stmt, int index, const std::optional<T> &value, sqlite3_destructor_type destructor) {
             if(value) {
-                return statement_binder<value_type>().bind(stmt, index, *value);
+                return internal::bind_value(stmt, index, *value, destructor);
             } else {
                 return statement_binder<std::nullopt_t>().bind(stmt, index, std::nullopt);
             }
@@ -4672,11 +5136,19 @@ namespace sqlite_orm {
         template<class T>
         using is_bindable = std::integral_constant<bool, !std::is_base_of<std::false_type, statement_binder<T>>::value>;
 
+        /**
+         *  Binds nodes of an expression. `destructor` is `SQLITE_STATIC` if the expression is not moved or
+         *  destroyed until the statement is executed.
+         */
         struct conditional_binder_base {
             sqlite3_stmt *stmt = nullptr;
             int &index;
+            sqlite3_destructor_type destructor = SQLITE_TRANSIENT;
 
-            conditional_binder_base(decltype(stmt) stmt_, decltype(index) index_) : stmt(stmt_), index(index_) {}
+            conditional_binder_base(decltype(stmt) stmt_,
+                                    decltype(index) index_,
+                                    decltype(destructor) destructor_ = SQLITE_TRANSIENT) :
+                stmt(stmt_), index(index_), destructor(destructor_) {}
         };
 
         template<class T, class C>
@@ -4688,7 +5160,7 @@ namespace sqlite_orm {
             using conditional_binder_base::conditional_binder_base;
 
             int operator()(const T &t) const {
-                return statement_binder<T>().bind(this->stmt, this->index++, t);
+                return bind_value(this->stmt, this->index++, t, this->destructor);
             }
         };
 
@@ -4728,15 +5200,15 @@ namespace sqlite_orm {
 #include <sqlite3.h>
 #include <type_traits>  //  std::enable_if_t, std::is_arithmetic, std::is_same, std::enable_if
 #include <cstdlib>  //  atof, atoi, atoll
-#include <string>  //  std::string, std::wstring
-#ifndef SQLITE_ORM_OMITS_CODECVT
-#include <codecvt>  //  std::wstring_convert, std::codecvt_utf8_utf16
-#endif  //  SQLITE_ORM_OMITS_CODECVT
+#include <string>  //  std::string, std::wstring, std::u16string
 #include <vector>  //  std::vector
 #include <cstring>  //  strlen
 #include <algorithm>  //  std::copy
 #include <iterator>  //  std::back_inserter
 #include <tuple>  //  std::tuple, std::tuple_size, std::tuple_element
+#ifdef SQLITE_ORM_STRING_VIEW_SUPPORTED
+#include <string_view>  //  std::string_view
+#endif  //  SQLITE_ORM_STRING_VIEW_SUPPORTED
 
 // #include "arithmetic_tag.h"
 
@@ -4802,6 +5274,10 @@ namespace sqlite_orm {
 
 // #include "error_code.h"
 
+// #include "blob_view.h"
+
+// #include "utf_converter.h"
+
 namespace sqlite_orm {
 
     /**
@@ -4875,38 +5351,95 @@ namespace sqlite_orm {
         std::string extract(sqlite3_stmt *stmt, int columnIndex) {
             auto cStr = (const char *)sqlite3_column_text(stmt, columnIndex);
             if(cStr) {
-                return cStr;
+                return {cStr, static_cast<size_t>(sqlite3_column_bytes(stmt, columnIndex))};
             } else {
                 return {};
             }
         }
     };
-#ifndef SQLITE_ORM_OMITS_CODECVT
+
+#ifdef SQLITE_ORM_STRING_VIEW_SUPPORTED
     /**
-     *  Specialization for std::wstring.
+     *  Specialization for std::string_view. Extracted view points into sqlite's column buffer
+     *  so it is valid only until the statement is stepped, reset or finalized. Use it with
+     *  `storage.visit` or `row_view` only, never as a mapped member type.
      */
     template<class V>
-    struct row_extractor<V, std::enable_if_t<std::is_same<V, std::wstring>::value>> {
-        std::wstring extract(const char *row_value) {
+    struct row_extractor<V, std::enable_if_t<std::is_same<V, std::string_view>::value>> {
+        std::string_view extract(const char *row_value) {
             if(row_value) {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                return converter.from_bytes(row_value);
+                return row_value;
             } else {
                 return {};
             }
         }
 
-        std::wstring extract(sqlite3_stmt *stmt, int columnIndex) {
+        std::string_view extract(sqlite3_stmt *stmt, int columnIndex) {
             auto cStr = (const char *)sqlite3_column_text(stmt, columnIndex);
             if(cStr) {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                return converter.from_bytes(cStr);
+                return {cStr, static_cast<size_t>(sqlite3_column_bytes(stmt, columnIndex))};
+            } else {
+                return {};
+            }
+        }
+    };
+#endif  //  SQLITE_ORM_STRING_VIEW_SUPPORTED
+
+    /**
+     *  Specialization for blob_view. Extracted view points into sqlite's column buffer
+     *  so it is valid only until the statement is stepped, reset or finalized.
+     */
+    template<class V>
+    struct row_extractor<V, std::enable_if_t<std::is_same<V, blob_view>::value>> {
+        blob_view extract(sqlite3_stmt *stmt, int columnIndex) {
+            auto bytes = static_cast<const char *>(sqlite3_column_blob(stmt, columnIndex));
+            auto len = sqlite3_column_bytes(stmt, columnIndex);
+            return {bytes, static_cast<size_t>(len)};
+        }
+    };
+    /**
+     *  Specialization for std::wstring and std::u16string. UTF-16 strings are read with `sqlite3_column_text16`
+     *  as is. UTF-32 strings (`wchar_t` is 4 bytes long everywhere except Windows) are transcoded from UTF-8.
+     */
+    template<class V>
+    struct row_extractor<
+        V,
+        std::enable_if_t<std::is_same<V, std::wstring>::value || std::is_same<V, std::u16string>::value>> {
+        using char_type = typename V::value_type;
+
+        V extract(const char *row_value) {
+            if(row_value) {
+                return internal::utf_converter::from_utf8<char_type>(row_value, ::strlen(row_value));
+            } else {
+                return {};
+            }
+        }
+
+        V extract(sqlite3_stmt *stmt, int columnIndex) {
+            return this->extract(stmt, columnIndex, internal::utf_converter::is_utf16<char_type>{});
+        }
+
+      protected:
+        V extract(sqlite3_stmt *stmt, int columnIndex, std::true_type) {
+            auto data = static_cast<const char_type *>(sqlite3_column_text16(stmt, columnIndex));
+            if(data) {
+                auto bytes = static_cast<size_t>(sqlite3_column_bytes16(stmt, columnIndex));
+                return {data, bytes / sizeof(char_type)};
+            } else {
+                return {};
+            }
+        }
+
+        V extract(sqlite3_stmt *stmt, int columnIndex, std::false_type) {
+            auto data = (const char *)sqlite3_column_text(stmt, columnIndex);
+            if(data) {
+                auto bytes = static_cast<size_t>(sqlite3_column_bytes(stmt, columnIndex));
+                return internal::utf_converter::from_utf8<char_type>(data, bytes);
             } else {
                 return {};
             }
         }
     };
-#endif  //  SQLITE_ORM_OMITS_CODECVT
     /**
      *  Specialization for std::vector<char>.
      */
@@ -5018,10 +5551,31 @@ namespace sqlite_orm {
         }
     };
 
-    template<class... Args>
-    struct row_extractor<std::tuple<Args...>> {
-
-        std::tuple<Args...> extract(char **argv) {
+    /**
+     *  Specialization for std::vector<unsigned char> (std::vector<uint8_t>).
+     */
+    template<>
+    struct row_extractor<std::vector<unsigned char>> {
+        std::vector<unsigned char> extract(const char *row_value) {
+            if(row_value) {
+                auto bytes = reinterpret_cast<const unsigned char *>(row_value);
+                return {bytes, bytes + ::strlen(row_value)};
+            } else {
+                return {};
+            }
+        }
+
+        std::vector<unsigned char> extract(sqlite3_stmt *stmt, int columnIndex) {
+            auto bytes = static_cast<const unsigned char *>(sqlite3_column_blob(stmt, columnIndex));
+            auto len = static_cast<size_t>(sqlite3_column_bytes(stmt, columnIndex));
+            return {bytes, bytes + len};
+        }
+    };
+
+    template<class... Args>
+    struct row_extractor<std::tuple<Args...>> {
+
+        std::tuple<Args...> extract(char **argv) {
             std::tuple<Args...> res;
             this->extract<std::tuple_size<decltype(res)>::value>(res, argv);
             return res;
@@ -5081,6 +5635,39 @@ namespace sqlite_orm {
             return this->extract(cStr);
         }
     };
+
+    namespace internal {
+
+        /**
+         *  Extracts column value into an existing object. Strings and blobs are assigned in place so
+         *  buffers capacity of a reused object is reused too. Other types are move-assigned.
+         */
+        template<class V>
+        void extract_into(V &value, sqlite3_stmt *stmt, int columnIndex) {
+            value = row_extractor<V>().extract(stmt, columnIndex);
+        }
+
+        inline void extract_into(std::string &value, sqlite3_stmt *stmt, int columnIndex) {
+            auto cStr = (const char *)sqlite3_column_text(stmt, columnIndex);
+            if(cStr) {
+                value.assign(cStr, static_cast<size_t>(sqlite3_column_bytes(stmt, columnIndex)));
+            } else {
+                value.clear();
+            }
+        }
+
+        inline void extract_into(std::vector<char> &value, sqlite3_stmt *stmt, int columnIndex) {
+            auto bytes = static_cast<const char *>(sqlite3_column_blob(stmt, columnIndex));
+            auto len = sqlite3_column_bytes(stmt, columnIndex);
+            value.assign(bytes, bytes + len);
+        }
+
+        inline void extract_into(std::vector<unsigned char> &value, sqlite3_stmt *stmt, int columnIndex) {
+            auto bytes = static_cast<const unsigned char *>(sqlite3_column_blob(stmt, columnIndex));
+            auto len = sqlite3_column_bytes(stmt, columnIndex);
+            value.assign(bytes, bytes + len);
+        }
+    }
 }
 #pragma once
 
@@ -5271,7 +5858,7 @@ namespace sqlite_orm {
 }
 #pragma once
 
-#include <type_traits>  //  std::enable_if, std::is_same, std::decay
+#include <type_traits>  //  std::enable_if, std::is_same, std::decay, std::remove_const
 #include <tuple>  //  std::tuple
 #include <functional>  //  std::reference_wrapper
 
@@ -5450,7 +6037,7 @@ namespace sqlite_orm {
                                F O::*,
                                typename std::enable_if<std::is_member_pointer<F O::*>::value &&
                                                        !std::is_member_function_pointer<F O::*>::value>::type> {
-            using type = F;
+            using type = typename std::remove_const<F>::type;
         };
 
         /**
@@ -5685,7 +6272,7 @@ namespace sqlite_orm {
 #pragma once
 
 #include <string>  //  std::string
-#include <type_traits>  //  std::remove_reference, std::is_same, std::is_base_of
+#include <type_traits>  //  std::remove_reference, std::is_same, std::is_base_of, std::remove_const, std::decay
 #include <vector>  //  std::vector
 #include <tuple>  //  std::tuple_size, std::tuple_element
 #include <algorithm>  //  std::reverse, std::find_if
@@ -5706,6 +6293,64 @@ namespace sqlite_orm {
 
 // #include "column.h"
 
+// #include "constructor.h"
+
+#include <tuple>  //  std::tuple
+#include <type_traits>  //  std::false_type, std::true_type
+#include <utility>  //  std::move
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  Table element which tells storage how to create objects of the mapped class. By default an object is
+         *  default constructed and every column value is assigned to it. With this element the object is created
+         *  from all column values passed in columns order: `O(values...)` if F is void or `factory(values...)`
+         *  otherwise. So the mapped class doesn't need a default constructor and may have const members.
+         *  Must be placed after columns like table constraints. `stream` cursors reuse their objects so they still
+         *  require a default constructible class with assignable fields.
+         */
+        template<class F>
+        struct constructor_t {
+            using field_type = void;  //  for column iteration
+            using constraints_type = std::tuple<>;
+
+            F factory;
+        };
+
+        template<>
+        struct constructor_t<void> {
+            using field_type = void;  //  for column iteration
+            using constraints_type = std::tuple<>;
+        };
+
+        template<class T>
+        struct is_constructor : std::false_type {};
+
+        template<class F>
+        struct is_constructor<constructor_t<F>> : std::true_type {};
+    }
+
+    /**
+     *  Makes storage create objects with a constructor which accepts values of all columns in columns order:
+     *  `make_table("points", make_column("x", &Point::x), make_column("y", &Point::y), constructor())`
+     *  creates points with `Point(x, y)`.
+     */
+    inline internal::constructor_t<void> constructor() {
+        return {};
+    }
+
+    /**
+     *  Makes storage create objects with `f(values...)` where values are values of all columns in columns order.
+     *  `f` must return the mapped object by value. Useful for aggregates and named constructors.
+     */
+    template<class F>
+    internal::constructor_t<F> factory(F f) {
+        return {std::move(f)};
+    }
+}
+
 namespace sqlite_orm {
 
     namespace internal {
@@ -5728,7 +6373,8 @@ namespace sqlite_orm {
             using object_type = T;
             using columns_type = std::tuple<Cs...>;
 
-            static constexpr const int columns_count = static_cast<int>(std::tuple_size<columns_type>::value);
+            static constexpr const int columns_count = static_cast<int>(std::tuple_size<columns_type>::value) -
+                                                       count_tuple<columns_type, is_constructor>::value;
 
             columns_type columns;
 
@@ -5841,7 +6487,8 @@ namespace sqlite_orm {
                                                         !std::is_member_function_pointer<F O::*>::value>::type>
             std::string find_column_name(F O::*m) const {
                 std::string res;
-                this->template for_each_column_with_field_type<F>([&res, m](auto &c) {
+                using field_type = typename std::remove_const<F>::type;
+                this->template for_each_column_with_field_type<field_type>([&res, m](auto &c) {
                     if(c.member_pointer == m) {
                         res = c.name;
                     }
@@ -5898,9 +6545,15 @@ namespace sqlite_orm {
                 });
             }
 
+            /**
+             *  Iterates columns and table constraints. Constructor element (`constructor_t`) is skipped.
+             */
             template<class L>
             void for_each_column_with_constraints(const L &l) const {
-                iterate_tuple(this->columns, l);
+                iterate_tuple(this->columns, [&l](auto &element) {
+                    using element_type = typename std::decay<decltype(element)>::type;
+                    static_if<!is_constructor<element_type>{}>(l)(element);
+                });
             }
 
             template<class F, class L>
@@ -6007,10 +6660,13 @@ namespace sqlite_orm {
 
 // #include "field_value_holder.h"
 
+#include <sqlite3.h>
 #include <type_traits>  //  std::enable_if
 
 // #include "column.h"
 
+// #include "row_extractor.h"
+
 namespace sqlite_orm {
     namespace internal {
 
@@ -6022,6 +6678,13 @@ namespace sqlite_orm {
             using type = typename getter_traits<T>::field_type;
 
             const type &value;
+
+            /**
+             *  `value` refers to the object's field so it may be bound without copying.
+             */
+            static sqlite3_destructor_type destructor() {
+                return SQLITE_STATIC;
+            }
         };
 
         template<class T>
@@ -6029,6 +6692,107 @@ namespace sqlite_orm {
             using type = typename getter_traits<T>::field_type;
 
             type value;
+
+            /**
+             *  `value` is destroyed before the statement is executed so sqlite must copy it.
+             */
+            static sqlite3_destructor_type destructor() {
+                return SQLITE_TRANSIENT;
+            }
+        };
+
+        /**
+         *  Calls `f(value, destructor)` with the value of column `c` of object `o`. `destructor` tells sqlite
+         *  whether `value` outlives the statement execution (`SQLITE_STATIC`) or must be copied
+         *  (`SQLITE_TRANSIENT`). Overloaded on the access tag so no runtime check is performed per row.
+         */
+        template<class O, class T, class G, class S, class... Op, class Object, class F>
+        void call_with_column_value(const column_t<O, T, G, S, field_access, Op...> &c, const Object &o, const F &f) {
+            f(o.*c.member_pointer, SQLITE_STATIC);
+        }
+
+        template<class O, class T, class G, class S, class... Op, class Object, class F>
+        void call_with_column_value(const column_t<O, T, G, S, getter_setter_access, Op...> &c,
+                                    const Object &o,
+                                    const F &f) {
+            field_value_holder<G> valueHolder{(o.*c.getter)()};
+            f(valueHolder.value, valueHolder.destructor());
+        }
+
+        /**
+         *  Extracts column `index` of the current row of `stmt` into the field mapped by column `c` of object `o`.
+         */
+        template<class O, class T, class G, class S, class... Op, class Object>
+        void extract_column_value(const column_t<O, T, G, S, field_access, Op...> &c,
+                                  Object &o,
+                                  sqlite3_stmt *stmt,
+                                  int index) {
+            extract_into(o.*c.member_pointer, stmt, index);
+        }
+
+        template<class O, class T, class G, class S, class... Op, class Object>
+        void extract_column_value(const column_t<O, T, G, S, getter_setter_access, Op...> &c,
+                                  Object &o,
+                                  sqlite3_stmt *stmt,
+                                  int index) {
+            (o.*c.setter)(row_extractor<T>().extract(stmt, index));
+        }
+    }
+}
+
+// #include "static_sql_cache.h"
+
+#include <string>  //  std::string
+#include <mutex>  //  std::once_flag, std::call_once
+#include <array>  //  std::array
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  SQL texts of primary key CRUD statements of a single mapped type (see `has_static_sql`).
+         *  Every text is serialized once on first use and reused afterwards. A copy is empty so
+         *  every storage serializes its own texts.
+         */
+        struct static_sql_cache {
+            enum statement_kind {
+                get_statement,
+                update_statement,
+                remove_statement,
+                insert_statement,
+                replace_statement,
+                statement_kinds_count,
+            };
+
+            static_sql_cache() = default;
+
+            static_sql_cache(const static_sql_cache &) {}
+
+            static_sql_cache &operator=(const static_sql_cache &) {
+                return *this;
+            }
+
+            /**
+             *  @return SQL text of `kind` statement. `serialize` is called only once to create it.
+             *  If `serialize` throws it will be called again next time.
+             */
+            template<class F>
+            const std::string &get(statement_kind kind, const F &serialize) {
+                auto &entry = this->entries[kind];
+                std::call_once(entry.flag, [&entry, &serialize] {
+                    entry.sql = serialize();
+                });
+                return entry.sql;
+            }
+
+          protected:
+            struct entry {
+                std::once_flag flag;
+                std::string sql;
+            };
+
+            std::array<entry, statement_kinds_count> entries;
         };
     }
 }
@@ -6179,6 +6943,12 @@ namespace sqlite_orm {
 
             table_type table;
 
+            /**
+             *  SQL texts of primary key CRUD statements of this table. Mutable cause it is filled lazily
+             *  by const serialization functions.
+             */
+            mutable static_sql_cache staticSql;
+
             template<class L>
             void for_each(const L &l) {
                 this->super::for_each(l);
@@ -6332,13 +7102,9 @@ namespace sqlite_orm {
                     using column_type = typename std::decay<decltype(c)>::type;
                     using field_type = typename column_type::field_type;
                     pair p{c.name, ""};
-                    if(c.member_pointer) {
-                        p.second = field_printer<field_type>()(o.*c.member_pointer);
-                    } else {
-                        using getter_type = typename column_type::getter_type;
-                        field_value_holder<getter_type> valueHolder{((o).*(c.getter))()};
-                        p.second = field_printer<field_type>()(valueHolder.value);
-                    }
+                    call_with_column_value(c, o, [&p](auto &value, auto) {
+                        p.second = field_printer<field_type>()(value);
+                    });
                     pairs.push_back(std::move(p));
                 });
                 for(size_t i = 0; i < pairs.size(); ++i) {
@@ -6531,15 +7297,16 @@ namespace sqlite_orm {
 #include <sqlite3.h>
 #include <type_traits>  //  std::remove_reference, std::is_base_of, std::decay, std::false_type, std::true_type
 #include <cstddef>  //  std::ptrdiff_t
-#include <iterator>  //  std::input_iterator_tag, std::iterator_traits, std::distance
+#include <iterator>  //  std::input_iterator_tag, std::iterator_traits, std::distance, std::next
 #include <functional>  //  std::function
+#include <future>  //  std::future
 #include <sstream>  //  std::stringstream
 #include <map>  //  std::map
 #include <vector>  //  std::vector
 #include <tuple>  //  std::tuple_size, std::tuple, std::make_tuple
 #include <utility>  //  std::forward, std::pair
 #include <set>  //  std::set
-#include <algorithm>  //  std::find
+#include <algorithm>  //  std::find, std::max, std::min
 
 #ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
 #include <optional>  // std::optional
@@ -6591,6 +7358,195 @@ namespace sqlite_orm {
 
 // #include "field_value_holder.h"
 
+// #include "object_builder.h"
+
+#include <sqlite3.h>
+#include <tuple>  //  std::tuple, std::tuple_element, std::get
+#include <type_traits>  //  std::conditional
+#include <utility>  //  std::forward, std::index_sequence, std::make_index_sequence
+
+// #include "constructor.h"
+
+// #include "column.h"
+
+// #include "tuple_helper.h"
+
+// #include "table.h"
+
+// #include "row_extractor.h"
+
+// #include "field_value_holder.h"
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  `type` is the constructor element (`constructor_t`) of table elements Cs... or void if there is no one.
+         */
+        template<class... Cs>
+        struct table_constructor {
+            using type = void;
+        };
+
+        template<class C, class... Cs>
+        struct table_constructor<C, Cs...> {
+            using type =
+                typename std::conditional<is_constructor<C>::value, C, typename table_constructor<Cs...>::type>::type;
+        };
+
+        template<class Tuple, class F, size_t... Is>
+        decltype(auto) call_with_row_impl(sqlite3_stmt *stmt, const F &f, std::index_sequence<Is...>) {
+            return f(row_extractor<typename std::tuple_element<Is, Tuple>::type::field_type>().extract(
+                stmt,
+                static_cast<int>(Is))...);
+        }
+
+        /**
+         *  Calls `f(values...)` with values of all columns of the current row of `stmt`. Columns go first in
+         *  table elements so column `i` is the element `i`.
+         */
+        template<class T, class... Cs, class F>
+        decltype(auto) call_with_row(const table_t<T, Cs...> &, sqlite3_stmt *stmt, const F &f) {
+            using columns_count = count_tuple<std::tuple<Cs...>, is_column>;
+            return call_with_row_impl<std::tuple<Cs...>>(stmt, f, std::make_index_sequence<columns_count::value>{});
+        }
+
+        /**
+         *  Creates objects of a mapped class T from the current row of a statement. C is the table constructor
+         *  element or void. `construct(args...)` passed to `emplace` must create an object from `args` in
+         *  a container and return a reference to it.
+         */
+        template<class T, class C>
+        struct object_builder;
+
+        template<class T>
+        struct object_builder<T, void> {
+
+            template<class Table, class L>
+            static void emplace(const Table &table, sqlite3_stmt *stmt, const L &construct) {
+                fill(table, stmt, construct());
+            }
+
+            template<class Table>
+            static T make(const Table &table, sqlite3_stmt *stmt) {
+                T res;
+                fill(table, stmt, res);
+                return res;
+            }
+
+          private:
+            template<class Table>
+            static void fill(const Table &table, sqlite3_stmt *stmt, T &object) {
+                auto index = 0;
+                table.for_each_column([&index, &object, stmt](auto &c) {
+                    extract_column_value(c, object, stmt, index++);
+                });
+            }
+        };
+
+        template<class T>
+        struct object_builder<T, constructor_t<void>> {
+
+            template<class Table, class L>
+            static void emplace(const Table &table, sqlite3_stmt *stmt, const L &construct) {
+                call_with_row(table, stmt, construct);
+            }
+
+            template<class Table>
+            static T make(const Table &table, sqlite3_stmt *stmt) {
+                return call_with_row(table, stmt, [](auto &&... values) {
+                    return T(std::forward<decltype(values)>(values)...);
+                });
+            }
+        };
+
+        template<class T, class F>
+        struct object_builder<T, constructor_t<F>> {
+
+            template<class Table, class L>
+            static void emplace(const Table &table, sqlite3_stmt *stmt, const L &construct) {
+                auto &factory = std::get<constructor_t<F>>(table.columns).factory;
+                call_with_row(table, stmt, [&construct, &factory](auto &&... values) -> T & {
+                    return construct(factory(std::forward<decltype(values)>(values)...));
+                });
+            }
+
+            template<class Table>
+            static T make(const Table &table, sqlite3_stmt *stmt) {
+                return call_with_row(table, stmt, std::get<constructor_t<F>>(table.columns).factory);
+            }
+        };
+
+        /**
+         *  Creates an object mapped by `table` from the current row of `stmt` with `construct(args...)`. `args`
+         *  are column values if the table has a constructor element and nothing otherwise: the object is default
+         *  constructed by `construct()` and filled with column values after that.
+         */
+        template<class T, class... Cs, class L>
+        void emplace_object(const table_t<T, Cs...> &table, sqlite3_stmt *stmt, const L &construct) {
+            object_builder<T, typename table_constructor<Cs...>::type>::emplace(table, stmt, construct);
+        }
+
+        /**
+         *  Returns an object mapped by `table` created from the current row of `stmt`.
+         */
+        template<class T, class... Cs>
+        T make_object(const table_t<T, Cs...> &table, sqlite3_stmt *stmt) {
+            return object_builder<T, typename table_constructor<Cs...>::type>::make(table, stmt);
+        }
+    }
+}
+
+// #include "into.h"
+
+#include <cstddef>  //  std::size_t
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  Caller provided result container. `get_all`, `get_all_pointer` and `select` clear it and append rows
+         *  to it instead of returning a new container. `clear` keeps capacity of `std::vector` so a polling loop
+         *  which passes the same container every time stops reallocating once the container is big enough.
+         */
+        template<class C>
+        struct into_t {
+            C &container;
+        };
+
+        /**
+         *  Calls `container.reserve(size)` if the container has `reserve`. Does nothing otherwise.
+         */
+        template<class C>
+        auto reserve_container(C &container, size_t size, int) -> decltype(container.reserve(size), void()) {
+            container.reserve(size);
+        }
+
+        template<class C>
+        void reserve_container(C &, size_t, long) {}
+
+        template<class C>
+        void reserve_container(C &container, size_t size) {
+            reserve_container(container, size, 0);
+        }
+    }
+
+    /**
+     *  Makes `get_all`, `get_all_pointer` and `select` put rows into `container` which must outlive the call.
+     *  Reserve the container to pass an expected result size.
+     *  Usage: `std::vector<User> users;
+     *          while(polling) {
+     *              storage.get_all<User>(into(users), where(...));
+     *          }`
+     */
+    template<class C>
+    internal::into_t<C> into(C &container) {
+        return {container};
+    }
+}
+
 // #include "view.h"
 
 #include <memory>  //  std::shared_ptr
@@ -6619,6 +7575,8 @@ namespace sqlite_orm {
 
 // #include "row_extractor.h"
 
+// #include "object_builder.h"
+
 // #include "statement_finalizer.h"
 
 // #include "error_code.h"
@@ -6649,19 +7607,11 @@ namespace sqlite_orm {
             std::shared_ptr<value_type> current;
 
             void extract_value(std::unique_ptr<value_type> &temp) {
-                temp = std::make_unique<value_type>();
                 auto &storage = this->view.storage;
                 auto &impl = storage.template get_impl<value_type>();
-                auto index = 0;
-                impl.table.for_each_column([&index, &temp, this](auto &c) {
-                    using field_type = typename std::decay<decltype(c)>::type::field_type;
-                    auto value = row_extractor<field_type>().extract(*this->stmt, index++);
-                    if(c.member_pointer) {
-                        auto member_pointer = c.member_pointer;
-                        (*temp).*member_pointer = std::move(value);
-                    } else {
-                        ((*temp).*(c.setter))(std::move(value));
-                    }
+                emplace_object(impl.table, *this->stmt, [&temp](auto &&... args) -> value_type & {
+                    temp = std::make_unique<value_type>(std::forward<decltype(args)>(args)...);
+                    return *temp;
                 });
             }
 
@@ -6753,18 +7703,19 @@ namespace sqlite_orm {
 
 #include <vector>  //  std::vector
 #include <functional>  //  std::reference_wrapper
+#include <cstddef>  //  std::byte
 
-// #include "conditions.h"
+    // #include "conditions.h"
 
-// #include "select_constraints.h"
+    // #include "select_constraints.h"
 
-// #include "operators.h"
+    // #include "operators.h"
 
-// #include "tuple_helper.h"
+    // #include "tuple_helper.h"
 
-// #include "core_functions.h"
+    // #include "core_functions.h"
 
-// #include "prepared_statement.h"
+    // #include "prepared_statement.h"
 
 #include <sqlite3.h>
 #include <iterator>  //  std::iterator_traits
@@ -6772,2065 +7723,5160 @@ namespace sqlite_orm {
 #include <type_traits>  //  std::true_type, std::false_type
 #include <utility>  //  std::pair
 
-// #include "connection_holder.h"
+    // #include "connection_holder.h"
 
 #include <sqlite3.h>
 #include <string>  //  std::string
 #include <system_error>  //  std::system_error
-
-// #include "error_code.h"
+#include <functional>  //  std::function
+#include <mutex>  //  std::recursive_mutex, std::lock_guard, std::unique_lock
+#include <condition_variable>  //  std::condition_variable_any
+#include <thread>  //  std::thread
+#include <chrono>  //  std::chrono::steady_clock, std::chrono::milliseconds
+#include <atomic>  //  std::atomic_int, std::atomic
+#include <memory>  //  std::shared_ptr
+#include <utility>  //  std::move
+
+    // #include "error_code.h"
+
+    // #include "statement_cache.h"
+
+#include <sqlite3.h>
+#include <string>  //  std::string
+#include <map>  //  std::multimap
+#include <mutex>  //  std::mutex, std::lock_guard
+#include <typeinfo>  //  std::type_info
+#include <typeindex>  //  std::type_index
+#include <utility>  //  std::move
+
+    // #include "prepare_flags.h"
+
+#include <sqlite3.h>
+
+    namespace sqlite_orm {
+
+    /**
+     *  Flags of `sqlite3_prepare_v3`. Pass them to `storage.prepare(expression, flags)`.
+     *  See https://www.sqlite.org/c3ref/c_prepare_normalize.html
+     */
+    enum class prepare_flags : unsigned int {
+        none = 0,
+
+        /**
+         *  The statement is going to be kept and reused for a long time. sqlite allocates it outside of
+         *  the lookaside memory so the lookaside slots stay available for short living statements. Statements
+         *  kept by the statement cache are always prepared with this flag.
+         */
+        persistent = 0x01,
+    };
+
+    namespace internal {
+
+        /**
+         *  Prepares `query` with `sqlite3_prepare_v3` if it is available and with `sqlite3_prepare_v2`
+         *  (which ignores `flags`) otherwise.
+         *  @return result code of the prepare call.
+         */
+        inline int prepare_statement(sqlite3 *db, const char *query, prepare_flags flags, sqlite3_stmt **stmt) {
+#if SQLITE_VERSION_NUMBER >= 3020000
+            return sqlite3_prepare_v3(db, query, -1, static_cast<unsigned int>(flags), stmt, nullptr);
+#else
+            (void)flags;
+            return sqlite3_prepare_v2(db, query, -1, stmt, nullptr);
+#endif
+        }
+    }
+}
 
 namespace sqlite_orm {
 
     namespace internal {
 
-        struct connection_holder {
+        /**
+         *  Key of a cached statement. `type` is a type of an expression the statement was prepared from.
+         *  `sql` is empty for expressions which SQL depends only on their type (see `has_static_sql`)
+         *  and contains a query text otherwise.
+         */
+        struct statement_cache_key {
+            const std::type_info *type = nullptr;
+            std::string sql;
+
+            bool operator<(const statement_cache_key &other) const {
+                std::type_index lhs(*this->type);
+                std::type_index rhs(*other.type);
+                if(lhs != rhs) {
+                    return lhs < rhs;
+                } else {
+                    return this->sql < other.sql;
+                }
+            }
+        };
+
+        /**
+         *  Statements of a single connection which are not used at the moment. A statement is taken out of
+         *  the cache while it is used so one statement is never used by two threads at once. Every `clear`
+         *  call increments generation so statements prepared before it are finalized once they are put back.
+         */
+        struct statement_cache {
 
-            connection_holder(std::string filename_) : filename(move(filename_)) {}
+            statement_cache() = default;
 
-            void retain() {
-                ++this->_retain_count;
-                if(1 == this->_retain_count) {
-                    auto rc = sqlite3_open(this->filename.c_str(), &this->db);
-                    if(rc != SQLITE_OK) {
-                        throw std::system_error(std::error_code(sqlite3_errcode(this->db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(this->db));
-                    }
+            statement_cache(const statement_cache &) = delete;
+
+            ~statement_cache() {
+                this->clear();
+            }
+
+            /**
+             *  @return statement with a given key removed from cache or nullptr if there is no such statement.
+             */
+            sqlite3_stmt *take(const statement_cache_key &key) {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                auto it = this->statements.find(key);
+                if(it != this->statements.end()) {
+                    auto res = it->second;
+                    this->statements.erase(it);
+                    return res;
+                } else {
+                    return nullptr;
                 }
             }
 
-            void release() {
-                --this->_retain_count;
-                if(0 == this->_retain_count) {
-                    auto rc = sqlite3_close(this->db);
-                    if(rc != SQLITE_OK) {
-                        throw std::system_error(std::error_code(sqlite3_errcode(this->db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(this->db));
-                    }
+            /**
+             *  Resets a statement and puts it back into cache. Finalizes it if the cache was cleared
+             *  after the statement was prepared. Bindings are cleared cause values bound with `SQLITE_STATIC`
+             *  may be destroyed while the statement is in the cache.
+             */
+            void put(statement_cache_key key, sqlite3_stmt *stmt, int generation_) {
+                sqlite3_reset(stmt);
+                sqlite3_clear_bindings(stmt);
+                std::lock_guard<std::mutex> lock(this->mutex);
+                if(generation_ == this->_generation) {
+                    this->statements.insert({std::move(key), stmt});
+                } else {
+                    sqlite3_finalize(stmt);
                 }
             }
 
-            sqlite3 *get() const {
-                return this->db;
+            /**
+             *  Finalizes all statements. Must be called before closing the connection.
+             */
+            void clear() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                ++this->_generation;
+                for(auto &p: this->statements) {
+                    sqlite3_finalize(p.second);
+                }
+                this->statements.clear();
             }
 
-            int retain_count() const {
-                return this->_retain_count;
+            int generation() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                return this->_generation;
             }
 
-            const std::string filename;
+            size_t size() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                return this->statements.size();
+            }
 
           protected:
-            sqlite3 *db = nullptr;
-            int _retain_count = 0;
+            std::multimap<statement_cache_key, sqlite3_stmt *> statements;
+            std::mutex mutex;
+            int _generation = 0;
         };
 
-        struct connection_ref {
-            connection_ref(connection_holder &holder_) : holder(holder_) {
-                this->holder.retain();
-            }
+        /**
+         *  Transaction control statements of a single connection (`BEGIN`, `COMMIT`, `ROLLBACK` and savepoint
+         *  statements of the write queue). Every statement is prepared on its first use and kept until `clear`
+         *  is called so a transaction doesn't prepare and finalize them every time.
+         */
+        struct control_statements {
+            enum kind {
+                begin_deferred,
+                begin_immediate,
+                begin_exclusive,
+                commit,
+                rollback,
+                write_savepoint,
+                write_release,
+                write_rollback_to,
+                kinds_count,
+            };
 
-            connection_ref(const connection_ref &other) : holder(other.holder) {
-                this->holder.retain();
-            }
+            control_statements() = default;
 
-            connection_ref(connection_ref &&other) : holder(other.holder) {
-                this->holder.retain();
+            control_statements(const control_statements &) = delete;
+
+            ~control_statements() {
+                this->clear();
             }
 
-            ~connection_ref() {
-                this->holder.release();
+            /**
+             *  Executes statement `k` with `db` preparing it from `query` if it is not prepared yet.
+             *  Statements are prepared with `prepare_flags::persistent` cause they live as long as the connection.
+             *  @return result code of `sqlite3_prepare_v3` if it failed or of `sqlite3_step` otherwise.
+             */
+            int perform(sqlite3 *db, kind k, const char *query) {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                auto &stmt = this->statements[k];
+                if(!stmt) {
+                    auto rc = prepare_statement(db, query, prepare_flags::persistent, &stmt);
+                    if(rc != SQLITE_OK) {
+                        stmt = nullptr;
+                        return rc;
+                    }
+                }
+                auto rc = sqlite3_step(stmt);
+                sqlite3_reset(stmt);
+                return rc;
             }
 
-            sqlite3 *get() const {
-                return this->holder.get();
+            /**
+             *  Finalizes all statements. Must be called before closing the connection.
+             */
+            void clear() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                for(auto &stmt: this->statements) {
+                    sqlite3_finalize(stmt);
+                    stmt = nullptr;
+                }
             }
 
           protected:
-            connection_holder &holder;
+            sqlite3_stmt *statements[kinds_count] = {};
+            std::mutex mutex;
         };
     }
 }
 
-// #include "select_constraints.h"
+// #include "sqlite_type.h"
+
+// #include "open_options.h"
+
+#include <sqlite3.h>
+#include <string>  //  std::string
+#include <vector>  //  std::vector
+#include <utility>  //  std::pair
+#include <sstream>  //  std::stringstream
+#include <iomanip>  //  std::hex, std::uppercase, std::setw, std::setfill
 
 namespace sqlite_orm {
 
-    namespace internal {
+    /**
+     *  Arguments of `sqlite3_open_v2` used for every connection of a storage. Pass it to `make_storage`
+     *  right after the filename. Default value opens a database just like `sqlite3_open` does.
+     *  Example for a read-only replica:
+     *  `open_options options;
+     *   options.flags = SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX;
+     *   options.uri_parameters = {{"immutable", "1"}};
+     *   auto storage = make_storage("replica.sqlite", options, make_table(...));`
+     */
+    struct open_options {
 
-        struct prepared_statement_base {
-            sqlite3_stmt *stmt = nullptr;
-            connection_ref con;
+        /**
+         *  `SQLITE_OPEN_*` flags. `SQLITE_OPEN_URI` is added automatically if `uri_parameters` is not empty.
+         */
+        int flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
 
-            ~prepared_statement_base() {
-                if(this->stmt) {
-                    sqlite3_finalize(this->stmt);
-                    this->stmt = nullptr;
-                }
-            }
+        /**
+         *  Name of a registered VFS. Empty string means the default VFS.
+         */
+        std::string vfs;
 
-            std::string sql() const {
-                if(this->stmt) {
-                    if(auto res = sqlite3_sql(this->stmt)) {
-                        return res;
-                    } else {
-                        return {};
-                    }
+        /**
+         *  URI query parameters like `mode=ro`, `immutable=1`, `cache=shared` or `nolock=1`. If not empty
+         *  the filename is converted into a `file:` URI with these parameters.
+         */
+        std::vector<std::pair<std::string, std::string>> uri_parameters;
+    };
+
+    namespace internal {
+
+        inline void append_uri_escaped(std::stringstream &ss, const std::string &value, bool isParameter) {
+            for(auto c: value) {
+                if(c == '%' || c == '?' || c == '#' || (isParameter && (c == '&' || c == '='))) {
+                    ss << '%' << std::hex << std::uppercase << std::setw(2) << std::setfill('0')
+                       << int(static_cast<unsigned char>(c)) << std::dec;
                 } else {
-                    return {};
+                    ss << c;
                 }
             }
+        }
 
-#if SQLITE_VERSION_NUMBER >= 3014000
-            std::string expanded_sql() const {
-                if(this->stmt) {
-                    if(auto res = sqlite3_expanded_sql(this->stmt)) {
-                        std::string result = res;
-                        sqlite3_free(res);
-                        return result;
-                    } else {
-                        return {};
-                    }
-                } else {
-                    return {};
-                }
+        /**
+         *  @return filename passed to `sqlite3_open_v2`: `filename` as is if there are no URI parameters
+         *  or a `file:` URI with escaped path and parameters otherwise.
+         */
+        inline std::string open_filename(const std::string &filename, const open_options &options) {
+            if(options.uri_parameters.empty()) {
+                return filename;
             }
-#endif
-#if SQLITE_VERSION_NUMBER >= 3026000 and defined(SQLITE_ENABLE_NORMALIZE)
-            std::string normalized_sql() const {
-                if(this->stmt) {
-                    if(auto res = sqlite3_normalized_sql(this->stmt)) {
-                        return res;
-                    } else {
-                        return {};
-                    }
-                } else {
-                    return {};
-                }
+            std::stringstream ss;
+            ss << "file:";
+            append_uri_escaped(ss, filename, false);
+            auto first = true;
+            for(auto &parameter: options.uri_parameters) {
+                ss << (first ? '?' : '&');
+                first = false;
+                append_uri_escaped(ss, parameter.first, true);
+                ss << '=';
+                append_uri_escaped(ss, parameter.second, true);
             }
-#endif
-        };
-
-        template<class T>
-        struct prepared_statement_t : prepared_statement_base {
-            using expression_type = T;
+            return ss.str();
+        }
 
-            expression_type t;
+        inline int open_flags(const open_options &options) {
+            if(options.uri_parameters.empty()) {
+                return options.flags;
+            } else {
+                return options.flags | SQLITE_OPEN_URI;
+            }
+        }
+    }
+}
 
-            prepared_statement_t(T t_, sqlite3_stmt *stmt, connection_ref con_) :
-                prepared_statement_base{stmt, std::move(con_)}, t(std::move(t_)) {}
-        };
+// #include "busy_handler.h"
 
-        template<class T, class... Args>
-        struct get_all_t {
-            using type = T;
+#include <sqlite3.h>
+#include <functional>  //  std::function
+#include <memory>  //  std::shared_ptr
+#include <mutex>  //  std::mutex, std::lock_guard
+#include <chrono>  //  std::chrono::steady_clock, std::chrono::microseconds, std::chrono::milliseconds
+#include <thread>  //  std::this_thread::sleep_for, std::this_thread::yield
+#include <random>  //  std::minstd_rand, std::random_device, std::uniform_int_distribution
+#include <algorithm>  //  std::min
+#include <utility>  //  std::move
 
-            using conditions_type = std::tuple<Args...>;
+// #include "sqlite_type.h"
 
-            conditions_type conditions;
-        };
+namespace sqlite_orm {
 
-        template<class T, class... Args>
-        struct get_all_pointer_t {
-            using type = T;
+    /**
+     *  Decides what to do when a database lock is busy. `wait(attempt, waited)` is called by sqlite
+     *  instead of returning SQLITE_BUSY. `attempt` starts from 0 for every busy event and `waited` is the time
+     *  spent in `wait` during this event so far. `wait` must wait itself and return true to try to take
+     *  the lock again or false to give up so the query fails with SQLITE_BUSY. Set it with
+     *  `storage.busy_handler(policy)`. Use `exponential_backoff_policy` or `spin_then_sleep_policy`
+     *  or a custom callback: `storage.busy_handler({[](int attempt, std::chrono::microseconds waited) {...}})`.
+     */
+    struct busy_handler_policy {
+        std::function<bool(int, std::chrono::microseconds)> wait;
+    };
 
-            using conditions_type = std::tuple<Args...>;
+    /**
+     *  Contention statistics of a single connection collected by its busy handler.
+     */
+    struct busy_handler_stats {
 
-            conditions_type conditions;
-        };
+        /**
+         *  Amount of times a lock was busy. Every busy event may contain several attempts.
+         */
+        int64 busy_count = 0;
 
-#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
-        template<class T, class... Args>
-        struct get_all_optional_t {
-            using type = T;
+        /**
+         *  Amount of busy handler calls.
+         */
+        int64 attempts_count = 0;
 
-            using conditions_type = std::tuple<Args...>;
+        /**
+         *  Amount of busy events the handler gave up on so a query failed with SQLITE_BUSY.
+         */
+        int64 timeouts_count = 0;
 
-            conditions_type conditions;
-        };
-#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+        std::chrono::microseconds total_wait{0};
 
-        template<class T, class... Wargs>
-        struct update_all_t;
+        /**
+         *  The longest wait of a single busy event.
+         */
+        std::chrono::microseconds max_wait{0};
+    };
 
-        template<class... Args, class... Wargs>
-        struct update_all_t<set_t<Args...>, Wargs...> {
-            using set_type = set_t<Args...>;
-            using conditions_type = std::tuple<Wargs...>;
+    namespace internal {
 
-            set_type set;
-            conditions_type conditions;
-        };
+        /**
+         *  @return random duration from [0, max]. Generator is thread local so concurrent writers get
+         *  different sequences.
+         */
+        inline std::chrono::microseconds random_duration(std::chrono::microseconds max) {
+            thread_local std::minstd_rand generator(std::random_device{}());
+            std::uniform_int_distribution<long long> distribution(0, max.count());
+            return std::chrono::microseconds(distribution(generator));
+        }
 
-        template<class T, class... Args>
-        struct remove_all_t {
-            using type = T;
-            using conditions_type = std::tuple<Args...>;
+        /**
+         *  @return random delay between a half and a whole of `initialDelay * 2^attempt` but not longer
+         *  than `maxDelay`. Random jitter keeps concurrent writers from retrying at the same moments.
+         */
+        inline std::chrono::microseconds
+        backoff_delay(std::chrono::microseconds initialDelay, std::chrono::microseconds maxDelay, int attempt) {
+            auto delay = initialDelay;
+            for(auto i = 0; i < attempt && delay < maxDelay; ++i) {
+                delay *= 2;
+            }
+            delay = std::min(delay, maxDelay);
+            return delay / 2 + random_duration(delay / 2);
+        }
 
-            conditions_type conditions;
-        };
+        /**
+         *  Busy handler of a single connection. Holds a policy shared by all connections of a storage
+         *  and statistics of this connection. `install` must be called for every handle the connection opens.
+         */
+        struct busy_handler_state {
 
-        template<class T, class... Ids>
-        struct get_t {
-            using type = T;
-            using ids_type = std::tuple<Ids...>;
+            void set_policy(std::shared_ptr<const busy_handler_policy> policy_) {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->policy = std::move(policy_);
+            }
 
-            ids_type ids;
-        };
+            bool has_policy() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                return this->policy != nullptr;
+            }
+
+            /**
+             *  Installs the handler into `db` or removes any busy handler from `db` if there is no policy.
+             */
+            void install(sqlite3 *db) {
+                if(this->has_policy()) {
+                    sqlite3_busy_handler(db, busy_callback, this);
+                } else {
+                    sqlite3_busy_handler(db, nullptr, nullptr);
+                }
+            }
+
+            busy_handler_stats stats() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                return this->statistics;
+            }
+
+          protected:
+            std::mutex mutex;
+            std::shared_ptr<const busy_handler_policy> policy;
+            busy_handler_stats statistics;
+            std::chrono::microseconds eventWait{0};
+
+            /**
+             *  Called by sqlite on the thread which waits for a lock. The mutex is not held while the policy
+             *  waits so statistics may be read at the same time.
+             */
+            static int busy_callback(void *data, int attempt) {
+                auto &state = *static_cast<busy_handler_state *>(data);
+                std::shared_ptr<const busy_handler_policy> policy;
+                std::chrono::microseconds waited;
+                {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    policy = state.policy;
+                    if(attempt == 0) {
+                        ++state.statistics.busy_count;
+                        state.eventWait = std::chrono::microseconds(0);
+                    }
+                    ++state.statistics.attempts_count;
+                    waited = state.eventWait;
+                }
+                auto retry = false;
+                auto start = std::chrono::steady_clock::now();
+                if(policy && policy->wait) {
+                    try {
+                        retry = policy->wait(attempt, waited);
+                    } catch(...) {
+                        retry = false;
+                    }
+                }
+                auto elapsed =
+                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+                std::lock_guard<std::mutex> lock(state.mutex);
+                state.eventWait += elapsed;
+                state.statistics.total_wait += elapsed;
+                if(state.eventWait > state.statistics.max_wait) {
+                    state.statistics.max_wait = state.eventWait;
+                }
+                if(!retry) {
+                    ++state.statistics.timeouts_count;
+                }
+                return retry ? 1 : 0;
+            }
+        };
+    }
+
+    /**
+     *  Sleeps for a random time between a half and a whole of `initialDelay * 2^attempt` but not longer than
+     *  `maxDelay` and gives up after `timeout`.
+     */
+    inline busy_handler_policy
+    exponential_backoff_policy(std::chrono::milliseconds timeout,
+                               std::chrono::microseconds initialDelay = std::chrono::microseconds(100),
+                               std::chrono::microseconds maxDelay = std::chrono::microseconds(20000)) {
+        return {[timeout, initialDelay, maxDelay](int attempt, std::chrono::microseconds waited) {
+            if(waited >= timeout) {
+                return false;
+            }
+            auto delay = internal::backoff_delay(initialDelay, maxDelay, attempt);
+            std::this_thread::sleep_for(std::min<std::chrono::microseconds>(delay, timeout - waited));
+            return true;
+        }};
+    }
+
+    /**
+     *  Yields the thread for the first `spins` attempts and then sleeps for `sleep` between attempts.
+     *  Gives up after `timeout`. Short lock holds are caught with a low latency without burning a core
+     *  on long ones.
+     */
+    inline busy_handler_policy
+    spin_then_sleep_policy(std::chrono::milliseconds timeout,
+                           int spins = 100,
+                           std::chrono::microseconds sleep = std::chrono::microseconds(1000)) {
+        return {[timeout, spins, sleep](int attempt, std::chrono::microseconds waited) {
+            if(waited >= timeout) {
+                return false;
+            }
+            if(attempt < spins) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::min<std::chrono::microseconds>(sleep, timeout - waited));
+            }
+            return true;
+        }};
+    }
+}
+
+namespace sqlite_orm {
+
+    /**
+     *  Defines when a database connection is closed after it is no longer used by any call.
+     *  Set it with `storage.set_connection_lifetime`.
+     */
+    enum class connection_lifetime {
+
+        /**
+         *  Connection is closed right after the last user releases it. Every call made outside of
+         *  a transaction opens the database again. This is the default.
+         */
+        per_call,
+
+        /**
+         *  Connection is kept open while it is used at least once per idle timeout. It is closed by
+         *  a background thread once it is not used for the idle timeout.
+         */
+        idle_timeout,
+
+        /**
+         *  Connection is opened on its first use and kept open until the storage is destroyed.
+         */
+        always_open,
+    };
+
+    namespace internal {
+
+        /**
+         *  Owns a single `sqlite3*` handle. The handle is opened by the first `retain` call. It is closed
+         *  when the last `release` call happens according to the `connection_lifetime` policy. `on_after_open`
+         *  is fired right after the handle is opened and before any other thread can obtain it.
+         *  Retain and release are thread-safe.
+         */
+        struct connection_holder {
+            using on_after_open_t = std::function<void(sqlite3 *)>;
+
+            connection_holder(std::string filename_, on_after_open_t on_after_open_ = {}, open_options options_ = {}) :
+                filename(move(filename_)), options(std::move(options_)), on_after_open(move(on_after_open_)) {}
+
+            connection_holder(const connection_holder &) = delete;
+
+            ~connection_holder() {
+                {
+                    std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                    this->stopped = true;
+                }
+                this->condition.notify_all();
+                if(this->idleThread.joinable()) {
+                    this->idleThread.join();
+                }
+                if(this->db) {
+                    this->cache.clear();
+                    this->control.clear();
+                    sqlite3_close(this->db);
+                }
+            }
+
+            void retain() {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                ++this->_retain_count;
+                if(1 == this->_retain_count && !this->db) {
+                    auto openFilename = open_filename(this->filename, this->options);
+                    auto vfs = this->options.vfs.empty() ? nullptr : this->options.vfs.c_str();
+                    auto rc = sqlite3_open_v2(openFilename.c_str(), &this->db, open_flags(this->options), vfs);
+                    if(rc != SQLITE_OK) {
+                        --this->_retain_count;
+                        std::error_code errorCode(sqlite3_errcode(this->db), get_sqlite_error_category());
+                        std::string message = sqlite3_errmsg(this->db);
+                        sqlite3_close(this->db);
+                        this->db = nullptr;
+                        throw std::system_error(errorCode, message);
+                    }
+                    ++this->opensCount;
+                    try {
+                        if(this->on_after_open) {
+                            this->on_after_open(this->db);
+                        }
+                        if(this->busyHandler.has_policy()) {
+                            this->busyHandler.install(this->db);
+                        }
+                    } catch(...) {
+                        //  close the handle so the next retain opens it again and calls `on_after_open`
+                        --this->_retain_count;
+                        this->cache.clear();
+                        this->control.clear();
+                        sqlite3_close(this->db);
+                        this->db = nullptr;
+                        throw;
+                    }
+                }
+            }
+
+            void release() {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                --this->_retain_count;
+                if(0 == this->_retain_count) {
+                    switch(this->lifetime) {
+                        case connection_lifetime::per_call:
+                            this->close();
+                            break;
+                        case connection_lifetime::idle_timeout:
+                            this->lastReleaseTime = std::chrono::steady_clock::now();
+                            if(this->idleThreadWaitsForRelease) {
+                                this->condition.notify_all();
+                            }
+                            break;
+                        case connection_lifetime::always_open:
+                            break;
+                    }
+                }
+            }
+
+            /**
+             *  Changes the lifetime policy. If the connection is open and not used at the moment it is closed
+             *  according to the new policy. `idleTimeout` is used by `connection_lifetime::idle_timeout` only.
+             */
+            void set_lifetime(connection_lifetime lifetime_, std::chrono::milliseconds idleTimeout_) {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                this->lifetime = lifetime_;
+                this->idleTimeout = idleTimeout_;
+                if(0 == this->_retain_count) {
+                    this->lastReleaseTime = std::chrono::steady_clock::now();
+                    if(this->lifetime == connection_lifetime::per_call) {
+                        this->close();
+                    }
+                }
+                if(this->lifetime == connection_lifetime::idle_timeout && !this->idleThread.joinable()) {
+                    this->idleThread = std::thread([this] {
+                        this->close_idle();
+                    });
+                }
+                this->condition.notify_all();
+            }
+
+            connection_lifetime get_lifetime() const {
+                return this->lifetime;
+            }
+
+            std::chrono::milliseconds get_idle_timeout() const {
+                return this->idleTimeout;
+            }
+
+            sqlite3 *get() const {
+                return this->db;
+            }
+
+            int retain_count() const {
+                return this->_retain_count;
+            }
+
+            /**
+             *  @return true if the handle is open. It may be open while nobody retains it
+             *  if lifetime policy is not `connection_lifetime::per_call`.
+             */
+            bool is_open() {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                return this->db != nullptr;
+            }
+
+            /**
+             *  Sets a busy handler policy shared by connections of a storage. It is installed right now
+             *  if the handle is open and every time the handle is opened after `on_after_open` so it replaces
+             *  a busy timeout set there. Null policy removes the handler.
+             */
+            void set_busy_handler(std::shared_ptr<const busy_handler_policy> policy) {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                this->busyHandler.set_policy(std::move(policy));
+                if(this->db) {
+                    this->busyHandler.install(this->db);
+                }
+            }
+
+            /**
+             *  @return contention statistics collected by the busy handler of this connection.
+             */
+            busy_handler_stats busy_stats() {
+                return this->busyHandler.stats();
+            }
+
+            /**
+             *  @return amount of times the handle has been opened.
+             */
+            int64 opens_count() const {
+                return this->opensCount;
+            }
+
+            /**
+             *  @return amount of times the handle has been closed.
+             */
+            int64 closes_count() const {
+                return this->closesCount;
+            }
+
+            const std::string filename;
+
+            /**
+             *  Arguments of `sqlite3_open_v2`.
+             */
+            const open_options options;
+
+            /**
+             *  Statements cached for this connection. Cleared right before the connection is closed.
+             */
+            statement_cache cache;
+
+            /**
+             *  `BEGIN`, `COMMIT` and `ROLLBACK` statements of this connection. Cleared right before the connection
+             *  is closed.
+             */
+            control_statements control;
+
+          protected:
+            on_after_open_t on_after_open;
+            sqlite3 *db = nullptr;
+            std::atomic_int _retain_count{0};
+            std::recursive_mutex mutex;
+            connection_lifetime lifetime = connection_lifetime::per_call;
+            std::chrono::milliseconds idleTimeout{0};
+            std::chrono::steady_clock::time_point lastReleaseTime;
+            std::condition_variable_any condition;
+            std::thread idleThread;
+            bool idleThreadWaitsForRelease = false;
+            bool stopped = false;
+            std::atomic<int64> opensCount{0};
+            std::atomic<int64> closesCount{0};
+            busy_handler_state busyHandler;
+
+            void close() {
+                if(!this->db) {
+                    return;
+                }
+                this->cache.clear();
+                this->control.clear();
+                auto rc = sqlite3_close(this->db);
+                if(rc != SQLITE_OK) {
+                    throw std::system_error(std::error_code(sqlite3_errcode(this->db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(this->db));
+                }
+                this->db = nullptr;
+                ++this->closesCount;
+            }
+
+            /**
+             *  Body of the idle thread. Closes the handle once it is not retained for `idleTimeout`.
+             *  While it waits for a close time `release` doesn't wake it up: a newer release time is
+             *  noticed when the wait expires.
+             */
+            void close_idle() {
+                std::unique_lock<std::recursive_mutex> lock(this->mutex);
+                while(!this->stopped) {
+                    if(this->lifetime == connection_lifetime::idle_timeout && this->db && 0 == this->_retain_count) {
+                        auto closeTime = this->lastReleaseTime + this->idleTimeout;
+                        if(std::chrono::steady_clock::now() >= closeTime) {
+                            try {
+                                this->close();
+                            } catch(...) {
+                            }
+                        } else {
+                            this->condition.wait_until(lock, closeTime);
+                        }
+                    } else {
+                        this->idleThreadWaitsForRelease = true;
+                        this->condition.wait(lock);
+                        this->idleThreadWaitsForRelease = false;
+                    }
+                }
+            }
+        };
+
+        struct connection_ref {
+            connection_ref(connection_holder &holder_) : holder(holder_) {
+                this->holder.retain();
+            }
+
+            connection_ref(const connection_ref &other) : holder(other.holder) {
+                this->holder.retain();
+            }
+
+            connection_ref(connection_ref &&other) : holder(other.holder) {
+                this->holder.retain();
+            }
+
+            ~connection_ref() {
+                this->holder.release();
+            }
+
+            sqlite3 *get() const {
+                return this->holder.get();
+            }
+
+            statement_cache &cache() const {
+                return this->holder.cache;
+            }
+
+            control_statements &control() const {
+                return this->holder.control;
+            }
+
+          protected:
+            connection_holder &holder;
+        };
+    }
+}
+
+// #include "statement_cache.h"
+
+// #include "select_constraints.h"
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        struct prepared_statement_base {
+            sqlite3_stmt *stmt = nullptr;
+            connection_ref con;
+
+            /**
+             *  Not null if the statement belongs to a statement cache. Such a statement is put back
+             *  into the cache instead of being finalized.
+             */
+            statement_cache *cache = nullptr;
+            statement_cache_key cacheKey;
+            int cacheGeneration = 0;
+
+            prepared_statement_base(sqlite3_stmt *stmt_, connection_ref con_) : stmt(stmt_), con(std::move(con_)) {}
+
+            prepared_statement_base(prepared_statement_base &&other) :
+                stmt(other.stmt), con(other.con), cache(other.cache), cacheKey(std::move(other.cacheKey)),
+                cacheGeneration(other.cacheGeneration) {
+                other.stmt = nullptr;
+            }
+
+            ~prepared_statement_base() {
+                if(this->stmt) {
+                    if(this->cache) {
+                        this->cache->put(std::move(this->cacheKey), this->stmt, this->cacheGeneration);
+                    } else {
+                        sqlite3_finalize(this->stmt);
+                    }
+                    this->stmt = nullptr;
+                }
+            }
+
+            std::string sql() const {
+                if(this->stmt) {
+                    if(auto res = sqlite3_sql(this->stmt)) {
+                        return res;
+                    } else {
+                        return {};
+                    }
+                } else {
+                    return {};
+                }
+            }
+
+#if SQLITE_VERSION_NUMBER >= 3014000
+            std::string expanded_sql() const {
+                if(this->stmt) {
+                    if(auto res = sqlite3_expanded_sql(this->stmt)) {
+                        std::string result = res;
+                        sqlite3_free(res);
+                        return result;
+                    } else {
+                        return {};
+                    }
+                } else {
+                    return {};
+                }
+            }
+#endif
+#if SQLITE_VERSION_NUMBER >= 3026000 and defined(SQLITE_ENABLE_NORMALIZE)
+            std::string normalized_sql() const {
+                if(this->stmt) {
+                    if(auto res = sqlite3_normalized_sql(this->stmt)) {
+                        return res;
+                    } else {
+                        return {};
+                    }
+                } else {
+                    return {};
+                }
+            }
+#endif
+        };
+
+        template<class T>
+        struct prepared_statement_t : prepared_statement_base {
+            using expression_type = T;
+
+            expression_type t;
+
+            prepared_statement_t(T t_, sqlite3_stmt *stmt, connection_ref con_) :
+                prepared_statement_base{stmt, std::move(con_)}, t(std::move(t_)) {}
+
+            prepared_statement_t(prepared_statement_t &&) = default;
+        };
+
+        template<class T, class... Args>
+        struct get_all_t {
+            using type = T;
+
+            using conditions_type = std::tuple<Args...>;
+
+            conditions_type conditions;
+        };
+
+        template<class T, class... Args>
+        struct get_all_pointer_t {
+            using type = T;
+
+            using conditions_type = std::tuple<Args...>;
+
+            conditions_type conditions;
+        };
+
+#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
+        template<class T, class... Args>
+        struct get_all_optional_t {
+            using type = T;
+
+            using conditions_type = std::tuple<Args...>;
+
+            conditions_type conditions;
+        };
+#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+
+        template<class T, class... Wargs>
+        struct update_all_t;
+
+        template<class... Args, class... Wargs>
+        struct update_all_t<set_t<Args...>, Wargs...> {
+            using set_type = set_t<Args...>;
+            using conditions_type = std::tuple<Wargs...>;
+
+            set_type set;
+            conditions_type conditions;
+        };
+
+        template<class T, class... Args>
+        struct remove_all_t {
+            using type = T;
+            using conditions_type = std::tuple<Args...>;
+
+            conditions_type conditions;
+        };
+
+        template<class T, class... Ids>
+        struct get_t {
+            using type = T;
+            using ids_type = std::tuple<Ids...>;
+
+            ids_type ids;
+        };
+
+        template<class T, class... Ids>
+        struct get_pointer_t {
+            using type = T;
+            using ids_type = std::tuple<Ids...>;
+
+            ids_type ids;
+        };
+
+#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
+        template<class T, class... Ids>
+        struct get_optional_t {
+            using type = T;
+            using ids_type = std::tuple<Ids...>;
+
+            ids_type ids;
+        };
+#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+
+        template<class T>
+        struct update_t {
+            using type = T;
+
+            type obj;
+        };
+
+        template<class T, class... Ids>
+        struct remove_t {
+            using type = T;
+            using ids_type = std::tuple<Ids...>;
+
+            ids_type ids;
+        };
+
+        template<class T>
+        struct insert_t {
+            using type = T;
+
+            type obj;
+        };
+
+        template<class T, class... Cols>
+        struct insert_explicit {
+            using type = T;
+            using columns_type = columns_t<Cols...>;
+
+            type obj;
+            columns_type columns;
+        };
+
+        template<class T>
+        struct replace_t {
+            using type = T;
+
+            type obj;
+        };
+
+        template<class It>
+        struct insert_range_t {
+            using iterator_type = It;
+            using object_type = typename std::iterator_traits<iterator_type>::value_type;
+
+            std::pair<iterator_type, iterator_type> range;
+        };
+
+        template<class It>
+        struct replace_range_t {
+            using iterator_type = It;
+            using object_type = typename std::iterator_traits<iterator_type>::value_type;
+
+            std::pair<iterator_type, iterator_type> range;
+        };
+
+        /**
+         *  Trait for expressions which SQL text depends only on the expression type (and the storage).
+         *  Cached statements of such expressions are found by the type without serializing the expression.
+         */
+        template<class T>
+        struct has_static_sql : std::false_type {};
 
         template<class T, class... Ids>
-        struct get_pointer_t {
-            using type = T;
-            using ids_type = std::tuple<Ids...>;
+        struct has_static_sql<get_t<T, Ids...>> : std::true_type {};
+
+        template<class T, class... Ids>
+        struct has_static_sql<get_pointer_t<T, Ids...>> : std::true_type {};
+
+#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
+        template<class T, class... Ids>
+        struct has_static_sql<get_optional_t<T, Ids...>> : std::true_type {};
+#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+
+        template<class T>
+        struct has_static_sql<update_t<T>> : std::true_type {};
+
+        template<class T, class... Ids>
+        struct has_static_sql<remove_t<T, Ids...>> : std::true_type {};
+
+        template<class T>
+        struct has_static_sql<insert_t<T>> : std::true_type {};
+
+        template<class T>
+        struct has_static_sql<replace_t<T>> : std::true_type {};
+    }
+
+    /**
+     *  Create a replace range statement
+     */
+    template<class It>
+    internal::replace_range_t<It> replace_range(It from, It to) {
+        return {{std::move(from), std::move(to)}};
+    }
+
+    /**
+     *  Create an insert range statement
+     */
+    template<class It>
+    internal::insert_range_t<It> insert_range(It from, It to) {
+        return {{std::move(from), std::move(to)}};
+    }
+
+    /**
+     *  Create a replace statement.
+     *  T is an object type mapped to a storage.
+     *  Usage: storage.replace(myUserInstance);
+     *  Parameter obj is accepted by value. Is you want to accept it by ref
+     *  the use std::ref function: storage.replace(std::ref(myUserInstance));
+     */
+    template<class T>
+    internal::replace_t<T> replace(T obj) {
+        return {std::move(obj)};
+    }
+
+    /**
+     *  Create an insert statement.
+     *  T is an object type mapped to a storage.
+     *  Usage: storage.insert(myUserInstance);
+     *  Parameter obj is accepted by value. Is you want to accept it by ref
+     *  the use std::ref function: storage.insert(std::ref(myUserInstance));
+     */
+    template<class T>
+    internal::insert_t<T> insert(T obj) {
+        return {std::move(obj)};
+    }
+
+    /**
+     *  Create an explicit insert statement.
+     *  T is an object type mapped to a storage.
+     *  Cols is columns types aparameter pack. Must contain member pointers
+     *  Usage: storage.insert(myUserInstance, columns(&User::id, &User::name));
+     *  Parameter obj is accepted by value. Is you want to accept it by ref
+     *  the use std::ref function: storage.insert(std::ref(myUserInstance), columns(&User::id, &User::name));
+     */
+    template<class T, class... Cols>
+    internal::insert_explicit<T, Cols...> insert(T obj, internal::columns_t<Cols...> cols) {
+        return {std::move(obj), std::move(cols)};
+    }
+
+    /**
+     *  Create a remove statement
+     *  T is an object type mapped to a storage.
+     *  Usage: remove<User>(5);
+     */
+    template<class T, class... Ids>
+    internal::remove_t<T, Ids...> remove(Ids... ids) {
+        std::tuple<Ids...> idsTuple{std::forward<Ids>(ids)...};
+        return {move(idsTuple)};
+    }
+
+    /**
+     *  Create an update statement.
+     *  T is an object type mapped to a storage.
+     *  Usage: storage.update(myUserInstance);
+     *  Parameter obj is accepted by value. Is you want to accept it by ref
+     *  the use std::ref function: storage.update(std::ref(myUserInstance));
+     */
+    template<class T>
+    internal::update_t<T> update(T obj) {
+        return {std::move(obj)};
+    }
+
+    /**
+     *  Create a get statement.
+     *  T is an object type mapped to a storage.
+     *  Usage: get<User>(5);
+     */
+    template<class T, class... Ids>
+    internal::get_t<T, Ids...> get(Ids... ids) {
+        std::tuple<Ids...> idsTuple{std::forward<Ids>(ids)...};
+        return {move(idsTuple)};
+    }
+
+    /**
+     *  Create a get pointer statement.
+     *  T is an object type mapped to a storage.
+     *  Usage: get_pointer<User>(5);
+     */
+    template<class T, class... Ids>
+    internal::get_pointer_t<T, Ids...> get_pointer(Ids... ids) {
+        std::tuple<Ids...> idsTuple{std::forward<Ids>(ids)...};
+        return {move(idsTuple)};
+    }
+
+#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
+    /**
+     *  Create a get optional statement.
+     *  T is an object type mapped to a storage.
+     *  Usage: get_optional<User>(5);
+     */
+    template<class T, class... Ids>
+    internal::get_optional_t<T, Ids...> get_optional(Ids... ids) {
+        std::tuple<Ids...> idsTuple{std::forward<Ids>(ids)...};
+        return {move(idsTuple)};
+    }
+#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+
+    /**
+     *  Create a remove all statement.
+     *  T is an object type mapped to a storage.
+     *  Usage: storage.remove_all<User>(...);
+     */
+    template<class T, class... Args>
+    internal::remove_all_t<T, Args...> remove_all(Args... args) {
+        using args_tuple = std::tuple<Args...>;
+        internal::validate_conditions<args_tuple>();
+        args_tuple conditions{std::forward<Args>(args)...};
+        return {move(conditions)};
+    }
+
+    /**
+     *  Create a get all statement.
+     *  T is an object type mapped to a storage.
+     *  Usage: storage.get_all<User>(...);
+     */
+    template<class T, class... Args>
+    internal::get_all_t<T, Args...> get_all(Args... args) {
+        using args_tuple = std::tuple<Args...>;
+        internal::validate_conditions<args_tuple>();
+        args_tuple conditions{std::forward<Args>(args)...};
+        return {move(conditions)};
+    }
+
+    /**
+     *  Create an update all statement.
+     *  Usage: storage.update_all(set(...), ...);
+     */
+    template<class... Args, class... Wargs>
+    internal::update_all_t<internal::set_t<Args...>, Wargs...> update_all(internal::set_t<Args...> set, Wargs... wh) {
+        using args_tuple = std::tuple<Wargs...>;
+        internal::validate_conditions<args_tuple>();
+        args_tuple conditions{std::forward<Wargs>(wh)...};
+        return {std::move(set), move(conditions)};
+    }
+
+    /**
+     *  Create a get all pointer statement.
+     *  T is an object type mapped to a storage.
+     *  Usage: storage.get_all_pointer<User>(...);
+     */
+    template<class T, class... Args>
+    internal::get_all_pointer_t<T, Args...> get_all_pointer(Args... args) {
+        std::tuple<Args...> conditions{std::forward<Args>(args)...};
+        return {move(conditions)};
+    }
+
+#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
+    /**
+     *  Create a get all optional statement.
+     *  T is an object type mapped to a storage.
+     *  Usage: storage.get_all_optional<User>(...);
+     */
+    template<class T, class... Args>
+    internal::get_all_optional_t<T, Args...> get_all_optional(Args... args) {
+        std::tuple<Args...> conditions{std::forward<Args>(args)...};
+        return {move(conditions)};
+    }
+#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+}
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  ast_iterator accepts any expression and a callable object
+         *  which will be called for any node of provided expression.
+         *  E.g. if we pass `where(is_equal(5, max(&User::id, 10))` then
+         *  callable object will be called with 5, &User::id and 10.
+         *  ast_iterator is used mostly in finding literals to be bound to
+         *  a statement. To use it just call `iterate_ast(object, callable);`
+         *  T is an ast element. E.g. where_t
+         */
+        template<class T, class SFINAE = void>
+        struct ast_iterator {
+            using node_type = T;
+
+            /**
+             *  L is a callable type. Mostly is a templated lambda
+             */
+            template<class L>
+            void operator()(const T &t, const L &l) const {
+                l(t);
+            }
+        };
+
+        /**
+         *  Simplified API
+         */
+        template<class T, class L>
+        void iterate_ast(const T &t, const L &l) {
+            ast_iterator<T> iterator;
+            iterator(t, l);
+        }
+
+        template<class T>
+        struct ast_iterator<std::reference_wrapper<T>, void> {
+            using node_type = std::reference_wrapper<T>;
+
+            template<class L>
+            void operator()(const node_type &r, const L &l) const {
+                iterate_ast(r.get(), l);
+            }
+        };
+
+        template<class C>
+        struct ast_iterator<conditions::where_t<C>, void> {
+            using node_type = conditions::where_t<C>;
+
+            template<class L>
+            void operator()(const node_type &where, const L &l) const {
+                iterate_ast(where.c, l);
+            }
+        };
+
+        template<class T>
+        struct ast_iterator<
+            T,
+            typename std::enable_if<is_base_of_template<T, conditions::binary_condition>::value>::type> {
+            using node_type = T;
+
+            template<class L>
+            void operator()(const node_type &binaryCondition, const L &l) const {
+                iterate_ast(binaryCondition.l, l);
+                iterate_ast(binaryCondition.r, l);
+            }
+        };
+
+        template<class L, class R, class... Ds>
+        struct ast_iterator<binary_operator<L, R, Ds...>, void> {
+            using node_type = binary_operator<L, R, Ds...>;
+
+            template<class C>
+            void operator()(const node_type &binaryOperator, const C &l) const {
+                iterate_ast(binaryOperator.lhs, l);
+                iterate_ast(binaryOperator.rhs, l);
+            }
+        };
+
+        template<class... Args>
+        struct ast_iterator<columns_t<Args...>, void> {
+            using node_type = columns_t<Args...>;
+
+            template<class L>
+            void operator()(const node_type &cols, const L &l) const {
+                iterate_ast(cols.columns, l);
+            }
+        };
+
+        template<class L, class A>
+        struct ast_iterator<conditions::in_t<L, A>, void> {
+            using node_type = conditions::in_t<L, A>;
+
+            template<class C>
+            void operator()(const node_type &in, const C &l) const {
+                iterate_ast(in.l, l);
+                iterate_ast(in.arg, l);
+            }
+        };
+
+        /**
+         *  Every value of `in` vector is a node even if the vector itself is a BLOB (e.g. std::vector<uint8_t>).
+         */
+        template<class L, class E>
+        struct ast_iterator<conditions::in_t<L, std::vector<E>>, void> {
+            using node_type = conditions::in_t<L, std::vector<E>>;
+
+            template<class C>
+            void operator()(const node_type &in, const C &l) const {
+                iterate_ast(in.l, l);
+                for(auto &i: in.arg) {
+                    iterate_ast(i, l);
+                }
+            }
+        };
+
+        template<class T>
+        struct ast_iterator<std::vector<T>, void> {
+            using node_type = std::vector<T>;
+
+            template<class L>
+            void operator()(const node_type &vec, const L &l) const {
+                for(auto &i: vec) {
+                    iterate_ast(i, l);
+                }
+            }
+        };
+
+        template<>
+        struct ast_iterator<std::vector<char>, void> {
+            using node_type = std::vector<char>;
+
+            template<class L>
+            void operator()(const node_type &vec, const L &l) const {
+                l(vec);
+            }
+        };
+
+        template<>
+        struct ast_iterator<std::vector<unsigned char>, void> {
+            using node_type = std::vector<unsigned char>;
+
+            template<class L>
+            void operator()(const node_type &vec, const L &l) const {
+                l(vec);
+            }
+        };
+
+#ifdef SQLITE_ORM_BYTE_SUPPORTED
+        template<>
+        struct ast_iterator<std::vector<std::byte>, void> {
+            using node_type = std::vector<std::byte>;
+
+            template<class L>
+            void operator()(const node_type &vec, const L &l) const {
+                l(vec);
+            }
+        };
+#endif  //  SQLITE_ORM_BYTE_SUPPORTED
+
+        template<class T>
+        struct ast_iterator<T, typename std::enable_if<is_base_of_template<T, compound_operator>::value>::type> {
+            using node_type = T;
+
+            template<class L>
+            void operator()(const node_type &c, const L &l) const {
+                iterate_ast(c.left, l);
+                iterate_ast(c.right, l);
+            }
+        };
+
+        template<class T, class... Args>
+        struct ast_iterator<select_t<T, Args...>, void> {
+            using node_type = select_t<T, Args...>;
+
+            template<class L>
+            void operator()(const node_type &sel, const L &l) const {
+                iterate_ast(sel.col, l);
+                iterate_ast(sel.conditions, l);
+            }
+        };
+
+        template<class T, class... Args>
+        struct ast_iterator<get_all_t<T, Args...>, void> {
+            using node_type = get_all_t<T, Args...>;
+
+            template<class L>
+            void operator()(const node_type &get, const L &l) const {
+                iterate_ast(get.conditions, l);
+            }
+        };
+
+        template<class T, class... Args>
+        struct ast_iterator<get_all_pointer_t<T, Args...>, void> {
+            using node_type = get_all_pointer_t<T, Args...>;
+
+            template<class L>
+            void operator()(const node_type &get, const L &l) const {
+                iterate_ast(get.conditions, l);
+            }
+        };
+
+#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
+        template<class T, class... Args>
+        struct ast_iterator<get_all_optional_t<T, Args...>, void> {
+            using node_type = get_all_optional_t<T, Args...>;
+
+            template<class L>
+            void operator()(const node_type &get, const L &l) const {
+                iterate_ast(get.conditions, l);
+            }
+        };
+#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+
+        template<class... Args, class... Wargs>
+        struct ast_iterator<update_all_t<set_t<Args...>, Wargs...>, void> {
+            using node_type = update_all_t<set_t<Args...>, Wargs...>;
+
+            template<class L>
+            void operator()(const node_type &u, const L &l) const {
+                iterate_ast(u.set, l);
+                iterate_ast(u.conditions, l);
+            }
+        };
+
+        template<class T, class... Args>
+        struct ast_iterator<remove_all_t<T, Args...>, void> {
+            using node_type = remove_all_t<T, Args...>;
+
+            template<class L>
+            void operator()(const node_type &r, const L &l) const {
+                iterate_ast(r.conditions, l);
+            }
+        };
+
+        template<class... Args>
+        struct ast_iterator<set_t<Args...>, void> {
+            using node_type = set_t<Args...>;
+
+            template<class L>
+            void operator()(const node_type &s, const L &l) const {
+                iterate_ast(s.assigns, l);
+            }
+        };
+
+        template<class... Args>
+        struct ast_iterator<std::tuple<Args...>, void> {
+            using node_type = std::tuple<Args...>;
+
+            template<class L>
+            void operator()(const node_type &tuple, const L &l) const {
+                iterate_tuple(tuple, [&l](auto &v) {
+                    iterate_ast(v, l);
+                });
+            }
+        };
+
+        template<class T>
+        struct ast_iterator<conditions::having_t<T>, void> {
+            using node_type = conditions::having_t<T>;
+
+            template<class L>
+            void operator()(const node_type &hav, const L &l) const {
+                iterate_ast(hav.t, l);
+            }
+        };
+
+        template<class T, class E>
+        struct ast_iterator<conditions::cast_t<T, E>, void> {
+            using node_type = conditions::cast_t<T, E>;
+
+            template<class L>
+            void operator()(const node_type &c, const L &l) const {
+                iterate_ast(c.expression, l);
+            }
+        };
+
+        template<class T>
+        struct ast_iterator<conditions::exists_t<T>, void> {
+            using node_type = conditions::exists_t<T>;
+
+            template<class L>
+            void operator()(const node_type &e, const L &l) const {
+                iterate_ast(e.t, l);
+            }
+        };
+
+        template<class A, class T, class E>
+        struct ast_iterator<conditions::like_t<A, T, E>, void> {
+            using node_type = conditions::like_t<A, T, E>;
+
+            template<class L>
+            void operator()(const node_type &lk, const L &l) const {
+                iterate_ast(lk.arg, l);
+                iterate_ast(lk.pattern, l);
+                lk.arg3.apply([&l](auto &value) {
+                    iterate_ast(value, l);
+                });
+            }
+        };
+
+        template<class A, class T>
+        struct ast_iterator<conditions::glob_t<A, T>, void> {
+            using node_type = conditions::glob_t<A, T>;
+
+            template<class L>
+            void operator()(const node_type &lk, const L &l) const {
+                iterate_ast(lk.arg, l);
+                iterate_ast(lk.pattern, l);
+            }
+        };
+
+        template<class A, class T>
+        struct ast_iterator<conditions::between_t<A, T>, void> {
+            using node_type = conditions::between_t<A, T>;
+
+            template<class L>
+            void operator()(const node_type &b, const L &l) const {
+                iterate_ast(b.expr, l);
+                iterate_ast(b.b1, l);
+                iterate_ast(b.b2, l);
+            }
+        };
+
+        template<class T>
+        struct ast_iterator<conditions::named_collate<T>, void> {
+            using node_type = conditions::named_collate<T>;
+
+            template<class L>
+            void operator()(const node_type &col, const L &l) const {
+                iterate_ast(col.expr, l);
+            }
+        };
+
+        template<class C>
+        struct ast_iterator<conditions::negated_condition_t<C>, void> {
+            using node_type = conditions::negated_condition_t<C>;
+
+            template<class L>
+            void operator()(const node_type &neg, const L &l) const {
+                iterate_ast(neg.c, l);
+            }
+        };
+
+        template<class T>
+        struct ast_iterator<conditions::is_null_t<T>, void> {
+            using node_type = conditions::is_null_t<T>;
+
+            template<class L>
+            void operator()(const node_type &i, const L &l) const {
+                iterate_ast(i.t, l);
+            }
+        };
+
+        template<class T>
+        struct ast_iterator<conditions::is_not_null_t<T>, void> {
+            using node_type = conditions::is_not_null_t<T>;
+
+            template<class L>
+            void operator()(const node_type &i, const L &l) const {
+                iterate_ast(i.t, l);
+            }
+        };
+
+        template<class R, class S, class... Args>
+        struct ast_iterator<core_functions::core_function_t<R, S, Args...>, void> {
+            using node_type = core_functions::core_function_t<R, S, Args...>;
+
+            template<class L>
+            void operator()(const node_type &f, const L &l) const {
+                iterate_ast(f.args, l);
+            }
+        };
+
+        template<class T, class O>
+        struct ast_iterator<conditions::left_join_t<T, O>, void> {
+            using node_type = conditions::left_join_t<T, O>;
+
+            template<class L>
+            void operator()(const node_type &j, const L &l) const {
+                iterate_ast(j.constraint, l);
+            }
+        };
+
+        template<class T>
+        struct ast_iterator<conditions::on_t<T>, void> {
+            using node_type = conditions::on_t<T>;
+
+            template<class L>
+            void operator()(const node_type &o, const L &l) const {
+                iterate_ast(o.arg, l);
+            }
+        };
+
+        template<class T, class O>
+        struct ast_iterator<conditions::join_t<T, O>, void> {
+            using node_type = conditions::join_t<T, O>;
+
+            template<class L>
+            void operator()(const node_type &j, const L &l) const {
+                iterate_ast(j.constraint, l);
+            }
+        };
+
+        template<class T, class O>
+        struct ast_iterator<conditions::left_outer_join_t<T, O>, void> {
+            using node_type = conditions::left_outer_join_t<T, O>;
+
+            template<class L>
+            void operator()(const node_type &j, const L &l) const {
+                iterate_ast(j.constraint, l);
+            }
+        };
+
+        template<class T, class O>
+        struct ast_iterator<conditions::inner_join_t<T, O>, void> {
+            using node_type = conditions::inner_join_t<T, O>;
+
+            template<class L>
+            void operator()(const node_type &j, const L &l) const {
+                iterate_ast(j.constraint, l);
+            }
+        };
+
+        template<class R, class T, class E, class... Args>
+        struct ast_iterator<simple_case_t<R, T, E, Args...>, void> {
+            using node_type = simple_case_t<R, T, E, Args...>;
+
+            template<class L>
+            void operator()(const node_type &c, const L &l) const {
+                c.case_expression.apply([&l](auto &c) {
+                    iterate_ast(c, l);
+                });
+                iterate_tuple(c.args, [&l](auto &pair) {
+                    iterate_ast(pair.first, l);
+                    iterate_ast(pair.second, l);
+                });
+                c.else_expression.apply([&l](auto &el) {
+                    iterate_ast(el, l);
+                });
+            }
+        };
+
+        template<class T, class E>
+        struct ast_iterator<as_t<T, E>, void> {
+            using node_type = as_t<T, E>;
+
+            template<class L>
+            void operator()(const node_type &a, const L &l) const {
+                iterate_ast(a.expression, l);
+            }
+        };
+
+        template<class T, bool OI>
+        struct ast_iterator<conditions::limit_t<T, false, OI, void>, void> {
+            using node_type = conditions::limit_t<T, false, OI, void>;
+
+            template<class L>
+            void operator()(const node_type &a, const L &l) const {
+                iterate_ast(a.lim, l);
+            }
+        };
+
+        template<class T, class O>
+        struct ast_iterator<conditions::limit_t<T, true, false, O>, void> {
+            using node_type = conditions::limit_t<T, true, false, O>;
+
+            template<class L>
+            void operator()(const node_type &a, const L &l) const {
+                iterate_ast(a.lim, l);
+                a.off.apply([&l](auto &value) {
+                    iterate_ast(value, l);
+                });
+            }
+        };
+
+        template<class T, class O>
+        struct ast_iterator<conditions::limit_t<T, true, true, O>, void> {
+            using node_type = conditions::limit_t<T, true, true, O>;
+
+            template<class L>
+            void operator()(const node_type &a, const L &l) const {
+                a.off.apply([&l](auto &value) {
+                    iterate_ast(value, l);
+                });
+                iterate_ast(a.lim, l);
+            }
+        };
+    }
+}
+
+// #include "prepared_statement.h"
+
+// #include "connection_holder.h"
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        template<class T, class S, class... Args>
+        struct view_t {
+            using mapped_type = T;
+            using storage_type = S;
+            using self = view_t<T, S, Args...>;
+
+            storage_type &storage;
+            connection_ref connection;
+            get_all_t<T, Args...> args;
+
+            view_t(storage_type &stor, decltype(connection) conn, Args &&... args_) :
+                storage(stor), connection(std::move(conn)), args{std::make_tuple(std::forward<Args>(args_)...)} {}
+
+            size_t size() {
+                return this->storage.template count<T>();
+            }
+
+            bool empty() {
+                return !this->size();
+            }
+
+            iterator_t<self> end() {
+                return {nullptr, *this};
+            }
+
+            iterator_t<self> begin() {
+                sqlite3_stmt *stmt = nullptr;
+                auto db = this->connection.get();
+                auto query = this->storage.string_from_expression(this->args, false);
+                auto ret = sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr);
+                if(ret == SQLITE_OK) {
+                    auto index = 1;
+                    iterate_ast(this->args.conditions, [&index, stmt, db](auto &node) {
+                        using node_type = typename std::decay<decltype(node)>::type;
+                        conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
+                        if(SQLITE_OK != binder(node)) {
+                            throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                    sqlite3_errmsg(db));
+                        }
+                    });
+                    return {stmt, *this};
+                } else {
+                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(db));
+                }
+            }
+        };
+    }
+}
+
+// #include "ast_iterator.h"
+
+// #include "storage_base.h"
+
+#include <functional>  //  std::function, std::bind
+#include <sqlite3.h>
+#include <string>  //  std::string
+#include <sstream>  //  std::stringstream
+#include <utility>  //  std::move
+#include <system_error>  //  std::system_error, std::error_code, std::make_error_code
+#include <vector>  //  std::vector
+#include <memory>  //  std::make_shared, std::shared_ptr
+#include <map>  //  std::map
+#include <type_traits>  //  std::decay, std::is_same
+#include <algorithm>  //  std::iter_swap
+#include <thread>  //  std::this_thread::get_id, std::this_thread::sleep_for, std::thread::id
+#include <atomic>  //  std::atomic
+#include <chrono>  //  std::chrono::milliseconds
+#include <mutex>  //  std::mutex, std::lock_guard
+
+// #include "pragma.h"
+
+#include <string>  //  std::string
+#include <sqlite3.h>
+#include <functional>  //  std::function
+#include <memory>  // std::shared_ptr
+#include <map>  //  std::map
+#include <mutex>  //  std::mutex, std::lock_guard
+#include <sstream>  //  std::stringstream
+#include <system_error>  //  std::system_error
+
+// #include "error_code.h"
+
+// #include "row_extractor.h"
+
+// #include "journal_mode.h"
+
+// #include "locking_mode.h"
+
+#include <string>  //  std::string
+#include <memory>  //  std::unique_ptr, std::make_unique
+#include <algorithm>  //  std::transform
+#include <iterator>  //  std::back_inserter
+#include <cctype>  //  ::toupper
+
+namespace sqlite_orm {
+
+    /**
+     *  Caps case like in https://www.sqlite.org/pragma.html#pragma_locking_mode
+     */
+    enum class locking_mode : signed char {
+        NORMAL = 0,
+        EXCLUSIVE = 1,
+    };
+
+    namespace internal {
+
+        inline const std::string &to_string(locking_mode l) {
+            static std::string res[] = {
+                "NORMAL",
+                "EXCLUSIVE",
+            };
+            return res[static_cast<int>(l)];
+        }
+
+        inline std::unique_ptr<locking_mode> locking_mode_from_string(const std::string &str) {
+            std::string upper_str;
+            std::transform(str.begin(), str.end(), std::back_inserter(upper_str), ::toupper);
+            for(auto l: {locking_mode::NORMAL, locking_mode::EXCLUSIVE}) {
+                if(to_string(l) == upper_str) {
+                    return std::make_unique<locking_mode>(l);
+                }
+            }
+            return {};
+        }
+    }
+}
+
+// #include "temp_store.h"
+
+#include <string>  //  std::string
+
+namespace sqlite_orm {
+
+    /**
+     *  Values of https://www.sqlite.org/pragma.html#pragma_temp_store. Numeric values are the ones
+     *  sqlite returns for `PRAGMA temp_store`.
+     */
+    enum class temp_store : signed char {
+        DEFAULT = 0,
+        FILE = 1,
+        MEMORY = 2,
+    };
+
+    namespace internal {
+
+        inline const std::string &to_string(temp_store t) {
+            static std::string res[] = {
+                "DEFAULT",
+                "FILE",
+                "MEMORY",
+            };
+            return res[static_cast<int>(t)];
+        }
+    }
+}
+
+// #include "sqlite_type.h"
+
+// #include "connection_holder.h"
+
+namespace sqlite_orm {
+
+    namespace internal {
+        struct storage_base;
+    }
+
+    struct pragma_t {
+        using get_connection_t = std::function<internal::connection_ref()>;
+
+        pragma_t(get_connection_t get_connection_) : get_connection(std::move(get_connection_)) {}
+
+        sqlite_orm::journal_mode journal_mode() {
+            return this->get_pragma<sqlite_orm::journal_mode>("journal_mode");
+        }
+
+        void journal_mode(sqlite_orm::journal_mode value) {
+            this->_journal_mode = -1;
+            this->set_pragma("journal_mode", value);
+            this->_journal_mode = static_cast<decltype(this->_journal_mode)>(value);
+        }
+
+        int synchronous() {
+            return this->get_pragma<int>("synchronous");
+        }
+
+        void synchronous(int value) {
+            this->_synchronous = -1;
+            this->set_pragma("synchronous", value);
+            this->_synchronous = value;
+        }
+
+        int user_version() {
+            return this->get_pragma<int>("user_version");
+        }
+
+        void user_version(int value) {
+            this->set_pragma("user_version", value);
+        }
+
+        int auto_vacuum() {
+            return this->get_pragma<int>("auto_vacuum");
+        }
+
+        void auto_vacuum(int value) {
+            this->set_pragma("auto_vacuum", value);
+        }
+
+        /**
+         *  Performance pragmas below are per connection. Values set with setters are remembered and
+         *  applied to every connection opened later (including pooled readers) so they survive reconnects.
+         *  Pooled readers which are open already keep their old values until they are closed.
+         */
+        int cache_size() {
+            return this->get_pragma<int>("cache_size");
+        }
+
+        void cache_size(int value) {
+            this->set_persistent_pragma("cache_size", value);
+        }
+
+        int64 mmap_size() {
+            return this->get_pragma<int64>("mmap_size");
+        }
+
+        void mmap_size(int64 value) {
+            this->set_persistent_pragma("mmap_size", value);
+        }
+
+        int page_size() {
+            return this->get_pragma<int>("page_size");
+        }
+
+        void page_size(int value) {
+            this->set_persistent_pragma("page_size", value);
+        }
+
+        sqlite_orm::temp_store temp_store() {
+            return static_cast<sqlite_orm::temp_store>(this->get_pragma<int>("temp_store"));
+        }
+
+        void temp_store(sqlite_orm::temp_store value) {
+            this->set_persistent_pragma("temp_store", internal::to_string(value));
+        }
+
+        sqlite_orm::locking_mode locking_mode() {
+            auto value = this->get_pragma<std::string>("locking_mode");
+            if(auto res = internal::locking_mode_from_string(value)) {
+                return *res;
+            } else {
+                throw std::system_error(std::make_error_code(orm_error_code::incorrect_locking_mode_string));
+            }
+        }
+
+        void locking_mode(sqlite_orm::locking_mode value) {
+            this->set_persistent_pragma("locking_mode", internal::to_string(value));
+        }
+
+        int wal_autocheckpoint() {
+            return this->get_pragma<int>("wal_autocheckpoint");
+        }
+
+        void wal_autocheckpoint(int value) {
+            this->set_persistent_pragma("wal_autocheckpoint", value);
+        }
+
+        int busy_timeout() {
+            return this->get_pragma<int>("busy_timeout");
+        }
+
+        void busy_timeout(int value) {
+            this->set_persistent_pragma("busy_timeout", value);
+        }
+
+      protected:
+        friend struct storage_base;
+
+      public:
+        int _synchronous = -1;
+        signed char _journal_mode = -1;  //  if != -1 stores static_cast<sqlite_orm::journal_mode>(journal_mode)
+
+        /**
+         *  Values of pragmas set by performance setters. Key is a pragma name, value is a serialized value.
+         *  Guarded by `_persistent_pragmas_mutex` cause connections are opened from any thread (pooled
+         *  readers, reopening after an idle close).
+         */
+        std::map<std::string, std::string> _persistent_pragmas;
+        mutable std::mutex _persistent_pragmas_mutex;
+        get_connection_t get_connection;
+
+        template<class T>
+        void set_persistent_pragma(const std::string &name, const T &value) {
+            std::stringstream ss;
+            ss << value;
+            this->erase_persistent_pragma(name);
+            this->set_pragma(name, value);
+            this->set_persistent_pragma_value(name, ss.str());
+        }
+
+        /**
+         *  @return a copy of remembered pragmas.
+         */
+        std::map<std::string, std::string> persistent_pragmas() const {
+            std::lock_guard<std::mutex> lock(this->_persistent_pragmas_mutex);
+            return this->_persistent_pragmas;
+        }
+
+        void set_persistent_pragma_value(const std::string &name, std::string value) {
+            std::lock_guard<std::mutex> lock(this->_persistent_pragmas_mutex);
+            this->_persistent_pragmas[name] = std::move(value);
+        }
+
+        void erase_persistent_pragma(const std::string &name) {
+            std::lock_guard<std::mutex> lock(this->_persistent_pragmas_mutex);
+            this->_persistent_pragmas.erase(name);
+        }
+
+        /**
+         *  Applies remembered pragmas to a just opened handle.
+         */
+        void apply_persistent_pragmas(sqlite3 *db) {
+            for(auto &p: this->persistent_pragmas()) {
+                this->set_pragma_impl("PRAGMA " + p.first + " = " + p.second, db);
+            }
+        }
+
+        template<class T>
+        T get_pragma(const std::string &name) {
+            auto connection = this->get_connection();
+            auto query = "PRAGMA " + name;
+            T res;
+            auto db = connection.get();
+            auto rc = sqlite3_exec(
+                db,
+                query.c_str(),
+                [](void *data, int argc, char **argv, char **) -> int {
+                    auto &res = *(T *)data;
+                    if(argc) {
+                        res = row_extractor<T>().extract(argv[0]);
+                    }
+                    return 0;
+                },
+                &res,
+                nullptr);
+            if(rc == SQLITE_OK) {
+                return res;
+            } else {
+                throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                        sqlite3_errmsg(db));
+            }
+        }
+
+        /**
+         *  Yevgeniy Zakharov: I wanted to refactore this function with statements and value bindings
+         *  but it turns out that bindings in pragma statements are not supported.
+         */
+        template<class T>
+        void set_pragma(const std::string &name, const T &value, sqlite3 *db = nullptr) {
+            std::stringstream ss;
+            ss << "PRAGMA " << name << " = " << value;
+            this->set_pragma_impl(ss.str(), db);
+        }
+
+        void set_pragma(const std::string &name, const sqlite_orm::journal_mode &value, sqlite3 *db = nullptr) {
+            std::stringstream ss;
+            ss << "PRAGMA " << name << " = " << internal::to_string(value);
+            this->set_pragma_impl(ss.str(), db);
+        }
+
+        /**
+         *  Executes a pragma query with `db` if it is passed. Otherwise obtains a connection from the storage
+         *  so applying pragmas to a just opened handle doesn't open another one.
+         */
+        void set_pragma_impl(const std::string &query, sqlite3 *db) {
+            if(db) {
+                auto rc = sqlite3_exec(db, query.c_str(), nullptr, nullptr, nullptr);
+                if(rc != SQLITE_OK) {
+                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(db));
+                }
+            } else {
+                auto con = this->get_connection();
+                this->set_pragma_impl(query, con.get());
+            }
+        }
+    };
+}
+
+// #include "limit_accesor.h"
+
+#include <sqlite3.h>
+#include <map>  //  std::map
+#include <functional>  //  std::function
+#include <memory>  //  std::shared_ptr
+
+// #include "connection_holder.h"
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        struct limit_accesor {
+            using get_connection_t = std::function<connection_ref()>;
+
+            limit_accesor(get_connection_t get_connection_) : get_connection(std::move(get_connection_)) {}
+
+            int length() {
+                return this->get(SQLITE_LIMIT_LENGTH);
+            }
+
+            void length(int newValue) {
+                this->set(SQLITE_LIMIT_LENGTH, newValue);
+            }
+
+            int sql_length() {
+                return this->get(SQLITE_LIMIT_SQL_LENGTH);
+            }
+
+            void sql_length(int newValue) {
+                this->set(SQLITE_LIMIT_SQL_LENGTH, newValue);
+            }
+
+            int column() {
+                return this->get(SQLITE_LIMIT_COLUMN);
+            }
+
+            void column(int newValue) {
+                this->set(SQLITE_LIMIT_COLUMN, newValue);
+            }
+
+            int expr_depth() {
+                return this->get(SQLITE_LIMIT_EXPR_DEPTH);
+            }
+
+            void expr_depth(int newValue) {
+                this->set(SQLITE_LIMIT_EXPR_DEPTH, newValue);
+            }
+
+            int compound_select() {
+                return this->get(SQLITE_LIMIT_COMPOUND_SELECT);
+            }
+
+            void compound_select(int newValue) {
+                this->set(SQLITE_LIMIT_COMPOUND_SELECT, newValue);
+            }
+
+            int vdbe_op() {
+                return this->get(SQLITE_LIMIT_VDBE_OP);
+            }
+
+            void vdbe_op(int newValue) {
+                this->set(SQLITE_LIMIT_VDBE_OP, newValue);
+            }
+
+            int function_arg() {
+                return this->get(SQLITE_LIMIT_FUNCTION_ARG);
+            }
+
+            void function_arg(int newValue) {
+                this->set(SQLITE_LIMIT_FUNCTION_ARG, newValue);
+            }
+
+            int attached() {
+                return this->get(SQLITE_LIMIT_ATTACHED);
+            }
+
+            void attached(int newValue) {
+                this->set(SQLITE_LIMIT_ATTACHED, newValue);
+            }
+
+            int like_pattern_length() {
+                return this->get(SQLITE_LIMIT_LIKE_PATTERN_LENGTH);
+            }
+
+            void like_pattern_length(int newValue) {
+                this->set(SQLITE_LIMIT_LIKE_PATTERN_LENGTH, newValue);
+            }
+
+            int variable_number() {
+                return this->get(SQLITE_LIMIT_VARIABLE_NUMBER);
+            }
+
+            void variable_number(int newValue) {
+                this->set(SQLITE_LIMIT_VARIABLE_NUMBER, newValue);
+            }
+
+            int trigger_depth() {
+                return this->get(SQLITE_LIMIT_TRIGGER_DEPTH);
+            }
+
+            void trigger_depth(int newValue) {
+                this->set(SQLITE_LIMIT_TRIGGER_DEPTH, newValue);
+            }
+
+#if SQLITE_VERSION_NUMBER >= 3008007
+            int worker_threads() {
+                return this->get(SQLITE_LIMIT_WORKER_THREADS);
+            }
+
+            void worker_threads(int newValue) {
+                this->set(SQLITE_LIMIT_WORKER_THREADS, newValue);
+            }
+#endif
+
+          protected:
+            get_connection_t get_connection;
+
+            friend struct storage_base;
+
+            /**
+             *  Stores limit set between connections.
+             */
+            std::map<int, int> limits;
+
+            int get(int id) {
+                auto connection = this->get_connection();
+                return sqlite3_limit(connection.get(), id, -1);
+            }
+
+            void set(int id, int newValue) {
+                this->limits[id] = newValue;
+                auto connection = this->get_connection();
+                sqlite3_limit(connection.get(), id, newValue);
+            }
+        };
+    }
+}
+
+// #include "transaction_guard.h"
+
+#include <functional>  //  std::function
+
+// #include "connection_holder.h"
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  Class used as a guard for a transaction. Calls `ROLLBACK` in destructor.
+         *  Has explicit `commit()` and `rollback()` functions. After explicit function is fired
+         *  guard won't do anything in d-tor. Also you can set `commit_on_destroy` to true to
+         *  make it call `COMMIT` on destroy.
+         */
+        struct transaction_guard_t {
+            /**
+             *  This is a public lever to tell a guard what it must do in its destructor
+             *  if `gotta_fire` is true
+             */
+            bool commit_on_destroy = false;
+
+            transaction_guard_t(connection_ref connection_,
+                                std::function<void()> commit_func_,
+                                std::function<void()> rollback_func_) :
+                connection(std::move(connection_)),
+                commit_func(std::move(commit_func_)), rollback_func(std::move(rollback_func_)) {}
+
+            ~transaction_guard_t() {
+                if(this->gotta_fire) {
+                    if(!this->commit_on_destroy) {
+                        this->rollback_func();
+                    } else {
+                        this->commit_func();
+                    }
+                }
+            }
+
+            /**
+             *  Call `COMMIT` explicitly. After this call
+             *  guard will not call `COMMIT` or `ROLLBACK`
+             *  in its destructor.
+             */
+            void commit() {
+                this->commit_func();
+                this->gotta_fire = false;
+            }
+
+            /**
+             *  Call `ROLLBACK` explicitly. After this call
+             *  guard will not call `COMMIT` or `ROLLBACK`
+             *  in its destructor.
+             */
+            void rollback() {
+                this->rollback_func();
+                this->gotta_fire = false;
+            }
+
+          protected:
+            connection_ref connection;
+            std::function<void()> commit_func;
+            std::function<void()> rollback_func;
+            bool gotta_fire = true;
+        };
+
+        /**
+         *  Guard of a savepoint returned by `storage.savepoint_guard(name)`. `commit()` releases the savepoint,
+         *  `rollback()` and destructor roll back to it and release it.
+         */
+        using savepoint_guard_t = transaction_guard_t;
+    }
+}
+
+// #include "transaction_options.h"
+
+#include <sqlite3.h>
+#include <chrono>  //  std::chrono::microseconds
+#include <system_error>  //  std::error_code
+
+// #include "error_code.h"
+
+namespace sqlite_orm {
+
+    /**
+     *  Kind of `BEGIN` statement. See https://www.sqlite.org/lang_transaction.html
+     */
+    enum class transaction_mode {
+
+        /**
+         *  Locks are taken by the first read and the first write. A transaction which reads and then writes
+         *  fails with SQLITE_BUSY if another connection writes in between.
+         */
+        deferred,
+
+        /**
+         *  The write lock is taken by `BEGIN` so the transaction can't fail on a lock upgrade later.
+         */
+        immediate,
+
+        /**
+         *  Like `immediate` but also prevents reads of other connections in rollback journal modes.
+         */
+        exclusive,
+    };
+
+    /**
+     *  Options of `storage.transaction(f, options)` and `storage.transaction_guard(options)`.
+     */
+    struct transaction_options {
+        transaction_mode mode = transaction_mode::immediate;
+
+        /**
+         *  Amount of times a transaction is started again after it failed with SQLITE_BUSY or SQLITE_LOCKED.
+         */
+        int max_retries = 10;
+
+        /**
+         *  Delay before the first retry. It is doubled for every next retry up to `max_backoff` and a random
+         *  jitter is applied.
+         */
+        std::chrono::microseconds backoff{1000};
+        std::chrono::microseconds max_backoff{100000};
+    };
+
+    namespace internal {
+
+        inline const char *begin_transaction_query(transaction_mode mode) {
+            switch(mode) {
+                case transaction_mode::deferred:
+                    return "BEGIN TRANSACTION";
+                case transaction_mode::immediate:
+                    return "BEGIN IMMEDIATE TRANSACTION";
+                case transaction_mode::exclusive:
+                    return "BEGIN EXCLUSIVE TRANSACTION";
+            }
+            return "BEGIN TRANSACTION";
+        }
+
+        /**
+         *  @return true if `errorCode` is SQLITE_BUSY or SQLITE_LOCKED (extended codes included) so the failed
+         *  transaction may succeed if it is started again.
+         */
+        inline bool is_busy_error(const std::error_code &errorCode) {
+            if(errorCode.category() != get_sqlite_error_category()) {
+                return false;
+            }
+            auto primaryCode = errorCode.value() & 0xff;
+            return primaryCode == SQLITE_BUSY || primaryCode == SQLITE_LOCKED;
+        }
+    }
+}
+
+// #include "busy_handler.h"
+
+// #include "statement_finalizer.h"
+
+// #include "type_printer.h"
+
+// #include "tuple_helper.h"
+
+// #include "row_extractor.h"
+
+// #include "connection_holder.h"
+
+// #include "connection_pool.h"
+
+#include <sqlite3.h>
+#include <string>  //  std::string
+#include <vector>  //  std::vector
+#include <memory>  //  std::unique_ptr, std::make_unique, std::shared_ptr
+#include <mutex>  //  std::recursive_mutex, std::lock_guard
+
+// #include "connection_holder.h"
+
+namespace sqlite_orm {
+
+    /**
+     *  Options of a pooled storage. Pass it to `make_storage` right after the filename.
+     *  `readers` is an amount of additional read-only connections used by SELECT-like queries
+     *  (`get`, `get_all`, `select`, `iterate`, `count` etc) so they can run in parallel from different threads
+     *  while one connection is used for writes. Makes sense only with `journal_mode::WAL`.
+     *  Ignored for in-memory databases cause every connection to `:memory:` is a separate database.
+     */
+    struct pool_options {
+        int readers = 0;
+    };
+
+    namespace internal {
+
+        /**
+         *  Set of reader connections to the same database file. Reader is opened lazily on its first
+         *  acquire and kept open until the pool is destroyed. `acquire_reader` returns a reader that is not used
+         *  by anybody at the moment if there is one. Otherwise the least busy reader is shared
+         *  (sqlite serializes access to a shared handle itself).
+         */
+        struct connection_pool {
+
+            connection_pool(const std::string &filename,
+                            pool_options options_,
+                            connection_holder::on_after_open_t f,
+                            const open_options &openOptions = {}) :
+                options(options_) {
+                this->readers.reserve(size_t(this->options.readers));
+                for(auto i = 0; i < this->options.readers; ++i) {
+                    this->readers.push_back(std::make_unique<connection_holder>(filename, f, openOptions));
+                }
+                this->opened.resize(this->readers.size(), false);
+            }
+
+            connection_pool(const connection_pool &) = delete;
+
+            ~connection_pool() {
+                for(size_t i = 0; i < this->readers.size(); ++i) {
+                    if(this->opened[i]) {
+                        this->readers[i]->release();
+                    }
+                }
+            }
+
+            connection_ref acquire_reader() {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                size_t bestIndex = 0;
+                auto bestUsers = -1;
+                for(size_t i = 0; i < this->readers.size(); ++i) {
+                    auto users = this->users(i);
+                    if(bestUsers == -1 || users < bestUsers ||
+                       (users == bestUsers && this->opened[i] && !this->opened[bestIndex])) {
+                        bestIndex = i;
+                        bestUsers = users;
+                    }
+                }
+                auto &reader = *this->readers[bestIndex];
+                if(!this->opened[bestIndex]) {
+                    reader.retain();
+                    this->opened[bestIndex] = true;
+                }
+                return {reader};
+            }
 
-            ids_type ids;
-        };
+            /**
+             *  @return amount of readers opened at the moment.
+             */
+            int opened_readers_count() {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                auto res = 0;
+                for(auto value: this->opened) {
+                    if(value) {
+                        ++res;
+                    }
+                }
+                return res;
+            }
 
-#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
-        template<class T, class... Ids>
-        struct get_optional_t {
-            using type = T;
-            using ids_type = std::tuple<Ids...>;
+            /**
+             *  Calls `f(db)` for every opened reader.
+             */
+            template<class F>
+            void for_each_opened_reader(const F &f) {
+                std::lock_guard<std::recursive_mutex> lock(this->mutex);
+                for(size_t i = 0; i < this->readers.size(); ++i) {
+                    if(this->opened[i]) {
+                        f(this->readers[i]->get());
+                    }
+                }
+            }
 
-            ids_type ids;
-        };
-#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+            int64 opens_count() const {
+                int64 res = 0;
+                for(auto &reader: this->readers) {
+                    res += reader->opens_count();
+                }
+                return res;
+            }
 
-        template<class T>
-        struct update_t {
-            using type = T;
+            int64 closes_count() const {
+                int64 res = 0;
+                for(auto &reader: this->readers) {
+                    res += reader->closes_count();
+                }
+                return res;
+            }
 
-            type obj;
-        };
+            void set_busy_handler(const std::shared_ptr<const busy_handler_policy> &policy) {
+                for(auto &reader: this->readers) {
+                    reader->set_busy_handler(policy);
+                }
+            }
 
-        template<class T, class... Ids>
-        struct remove_t {
-            using type = T;
-            using ids_type = std::tuple<Ids...>;
+            /**
+             *  @return sum of busy handler statistics of all readers. `max_wait` is the max of all readers.
+             */
+            busy_handler_stats busy_stats() {
+                busy_handler_stats res;
+                for(auto &reader: this->readers) {
+                    auto stats = reader->busy_stats();
+                    res.busy_count += stats.busy_count;
+                    res.attempts_count += stats.attempts_count;
+                    res.timeouts_count += stats.timeouts_count;
+                    res.total_wait += stats.total_wait;
+                    if(stats.max_wait > res.max_wait) {
+                        res.max_wait = stats.max_wait;
+                    }
+                }
+                return res;
+            }
 
-            ids_type ids;
-        };
+            void clear_caches() {
+                for(auto &reader: this->readers) {
+                    reader->cache.clear();
+                }
+            }
 
-        template<class T>
-        struct insert_t {
-            using type = T;
+            const pool_options options;
 
-            type obj;
+          protected:
+            std::vector<std::unique_ptr<connection_holder>> readers;
+            std::vector<bool> opened;
+            std::recursive_mutex mutex;
+
+            int users(size_t index) const {
+                auto res = this->readers[index]->retain_count();
+                if(this->opened[index]) {
+                    --res;
+                }
+                return res;
+            }
         };
+    }
+}
 
-        template<class T, class... Cols>
-        struct insert_explicit {
-            using type = T;
-            using columns_type = columns_t<Cols...>;
+// #include "write_queue.h"
 
-            type obj;
-            columns_type columns;
-        };
+#include <atomic>  //  std::atomic, std::atomic_bool
+#include <functional>  //  std::function
+#include <future>  //  std::promise, std::future
+#include <memory>  //  std::unique_ptr
+#include <mutex>  //  std::mutex, std::unique_lock, std::lock_guard
+#include <condition_variable>  //  std::condition_variable
+#include <thread>  //  std::thread
+#include <exception>  //  std::exception_ptr, std::current_exception
+#include <vector>  //  std::vector
+#include <utility>  //  std::move
+#include <cstddef>  //  std::ptrdiff_t
+#include <system_error>  //  std::system_error, std::error_code
+#include <sqlite3.h>
+
+// #include "sqlite_type.h"
+
+// #include "connection_holder.h"
+
+// #include "statement_cache.h"
+
+// #include "error_code.h"
+
+namespace sqlite_orm {
+
+    /**
+     *  Options of a write queue started by `storage.start_write_queue(options)`.
+     */
+    struct write_queue_options {
+
+        /**
+         *  Max amount of writes executed inside a single transaction.
+         */
+        size_t max_batch_size = 1000;
+    };
+
+    namespace internal {
 
+        /**
+         *  Unbounded multiple producers single consumer queue. `push` is lock-free and may be called
+         *  from any thread. `pop` and `empty` must be called by a single consumer thread.
+         */
         template<class T>
-        struct replace_t {
-            using type = T;
+        struct mpsc_queue {
 
-            type obj;
-        };
+            mpsc_queue() : head(new node), tail(head.load()) {}
 
-        template<class It>
-        struct insert_range_t {
-            using iterator_type = It;
-            using object_type = typename std::iterator_traits<iterator_type>::value_type;
+            mpsc_queue(const mpsc_queue &) = delete;
 
-            std::pair<iterator_type, iterator_type> range;
-        };
+            ~mpsc_queue() {
+                T value;
+                while(this->pop(value)) {
+                }
+                delete this->tail;
+            }
 
-        template<class It>
-        struct replace_range_t {
-            using iterator_type = It;
-            using object_type = typename std::iterator_traits<iterator_type>::value_type;
+            void push(T value) {
+                auto newNode = new node(std::move(value));
+                auto previous = this->head.exchange(newNode);
+                previous->next.store(newNode);
+            }
 
-            std::pair<iterator_type, iterator_type> range;
+            bool pop(T &value) {
+                auto next = this->tail->next.load();
+                if(next) {
+                    value = std::move(next->value);
+                    delete this->tail;
+                    this->tail = next;
+                    return true;
+                } else {
+                    return false;
+                }
+            }
+
+            bool empty() const {
+                return !this->tail->next.load();
+            }
+
+          protected:
+            struct node {
+                node() = default;
+
+                node(T value_) : value(std::move(value_)) {}
+
+                T value;
+                std::atomic<node *> next{nullptr};
+            };
+
+            std::atomic<node *> head;
+            node *tail;
         };
-    }
 
-    /**
-     *  Create a replace range statement
-     */
-    template<class It>
-    internal::replace_range_t<It> replace_range(It from, It to) {
-        return {{std::move(from), std::move(to)}};
-    }
+        /**
+         *  Group commit queue. Writes are pushed from any thread and executed by a single writer thread.
+         *  Writes pushed while the previous batch is committed are executed in a single transaction
+         *  so many writers share one commit (and one fsync). A future is fulfilled after the transaction
+         *  with a write is committed. Every write is executed inside its own savepoint so if a write throws
+         *  changes made by it are rolled back and only its future gets the exception. If the error has rolled
+         *  back the whole transaction futures of writes executed in that transaction get the exception too.
+         *  If the commit fails all futures of the batch get the exception.
+         */
+        struct write_queue {
+            using write_t = std::function<int64()>;
+            using transaction_function_t = std::function<void()>;
+
+            write_queue(write_queue_options options_,
+                        connection_ref con_,
+                        transaction_function_t begin_,
+                        transaction_function_t commit_,
+                        transaction_function_t rollback_) :
+                options(options_),
+                con(std::move(con_)), begin(std::move(begin_)), commit(std::move(commit_)),
+                rollback(std::move(rollback_)) {
+                if(!this->options.max_batch_size) {
+                    this->options.max_batch_size = 1;
+                }
+                this->thread = std::thread([this] {
+                    this->run();
+                });
+            }
 
-    /**
-     *  Create an insert range statement
-     */
-    template<class It>
-    internal::insert_range_t<It> insert_range(It from, It to) {
-        return {{std::move(from), std::move(to)}};
-    }
+            /**
+             *  Executes all pushed writes and stops the writer thread.
+             */
+            ~write_queue() {
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex);
+                    this->stopped = true;
+                }
+                this->condition.notify_one();
+                this->thread.join();
+            }
 
-    /**
-     *  Create a replace statement.
-     *  T is an object type mapped to a storage.
-     *  Usage: storage.replace(myUserInstance);
-     *  Parameter obj is accepted by value. Is you want to accept it by ref
-     *  the use std::ref function: storage.replace(std::ref(myUserInstance));
-     */
-    template<class T>
-    internal::replace_t<T> replace(T obj) {
-        return {std::move(obj)};
-    }
+            std::future<int64> push(write_t write) {
+                std::unique_ptr<task> newTask(new task{std::move(write), {}});
+                auto res = newTask->promise.get_future();
+                this->tasks.push(std::move(newTask));
+                if(this->writerIsWaiting) {
+                    {
+                        std::lock_guard<std::mutex> lock(this->mutex);
+                    }
+                    this->condition.notify_one();
+                }
+                return res;
+            }
 
-    /**
-     *  Create an insert statement.
-     *  T is an object type mapped to a storage.
-     *  Usage: storage.insert(myUserInstance);
-     *  Parameter obj is accepted by value. Is you want to accept it by ref
-     *  the use std::ref function: storage.insert(std::ref(myUserInstance));
-     */
-    template<class T>
-    internal::insert_t<T> insert(T obj) {
-        return {std::move(obj)};
-    }
+            /**
+             *  @return amount of committed transactions.
+             */
+            int64 commits_count() const {
+                return this->commitsCount;
+            }
 
-    /**
-     *  Create an explicit insert statement.
-     *  T is an object type mapped to a storage.
-     *  Cols is columns types aparameter pack. Must contain member pointers
-     *  Usage: storage.insert(myUserInstance, columns(&User::id, &User::name));
-     *  Parameter obj is accepted by value. Is you want to accept it by ref
-     *  the use std::ref function: storage.insert(std::ref(myUserInstance), columns(&User::id, &User::name));
-     */
-    template<class T, class... Cols>
-    internal::insert_explicit<T, Cols...> insert(T obj, internal::columns_t<Cols...> cols) {
-        return {std::move(obj), std::move(cols)};
-    }
+            /**
+             *  @return amount of executed writes.
+             */
+            int64 writes_count() const {
+                return this->writesCount;
+            }
 
-    /**
-     *  Create a remove statement
-     *  T is an object type mapped to a storage.
-     *  Usage: remove<User>(5);
-     */
-    template<class T, class... Ids>
-    internal::remove_t<T, Ids...> remove(Ids... ids) {
-        std::tuple<Ids...> idsTuple{std::forward<Ids>(ids)...};
-        return {move(idsTuple)};
-    }
+          protected:
+            struct task {
+                write_t write;
+                std::promise<int64> promise;
+            };
 
-    /**
-     *  Create an update statement.
-     *  T is an object type mapped to a storage.
-     *  Usage: storage.update(myUserInstance);
-     *  Parameter obj is accepted by value. Is you want to accept it by ref
-     *  the use std::ref function: storage.update(std::ref(myUserInstance));
-     */
-    template<class T>
-    internal::update_t<T> update(T obj) {
-        return {std::move(obj)};
-    }
+            struct task_result {
+                std::unique_ptr<task> t;
+                int64 value;
+                std::exception_ptr exception;
+            };
 
-    /**
-     *  Create a get statement.
-     *  T is an object type mapped to a storage.
-     *  Usage: get<User>(5);
-     */
-    template<class T, class... Ids>
-    internal::get_t<T, Ids...> get(Ids... ids) {
-        std::tuple<Ids...> idsTuple{std::forward<Ids>(ids)...};
-        return {move(idsTuple)};
+            write_queue_options options;
+            connection_ref con;
+            transaction_function_t begin;
+            transaction_function_t commit;
+            transaction_function_t rollback;
+            mpsc_queue<std::unique_ptr<task>> tasks;
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::atomic_bool writerIsWaiting{false};
+            bool stopped = false;
+            std::atomic<int64> commitsCount{0};
+            std::atomic<int64> writesCount{0};
+            std::thread thread;
+
+            void run() {
+                std::vector<task_result> batch;
+                batch.reserve(this->options.max_batch_size);
+                for(;;) {
+                    this->writerIsWaiting = true;
+                    auto stop = false;
+                    {
+                        std::unique_lock<std::mutex> lock(this->mutex);
+                        this->condition.wait(lock, [this] {
+                            return this->stopped || !this->tasks.empty();
+                        });
+                        stop = this->stopped;
+                    }
+                    this->writerIsWaiting = false;
+                    while(!this->tasks.empty() || !batch.empty()) {
+                        this->execute_batch(batch);
+                    }
+                    if(stop) {
+                        break;
+                    }
+                }
+            }
+
+            /**
+             *  Executes a cached savepoint statement of the queue connection.
+             */
+            void perform(control_statements::kind kind, const char *query) {
+                auto db = this->con.get();
+                if(this->con.control().perform(db, kind, query) != SQLITE_DONE) {
+                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(db));
+                }
+            }
+
+            /**
+             *  Executes writes of `batch` (topped up from the queue) in a single transaction and fulfills their
+             *  promises. Every write is wrapped in a savepoint which is rolled back if the write throws so a write
+             *  of several statements is never committed partially. If a failed write has rolled back the whole
+             *  transaction (e.g. `RAISE(ROLLBACK)` in a trigger, SQLITE_FULL, SQLITE_IOERR or SQLITE_NOMEM) writes
+             *  executed so far fail with its error and writes after it are left in `batch` for the next transaction.
+             */
+            void execute_batch(std::vector<task_result> &batch) {
+                std::unique_ptr<task> nextTask;
+                while(batch.size() < this->options.max_batch_size && this->tasks.pop(nextTask)) {
+                    batch.push_back({std::move(nextTask), 0, nullptr});
+                }
+                std::exception_ptr transactionException;
+                auto transactionIsActive = false;
+                auto resultsCount = batch.size();
+                try {
+                    this->begin();
+                    transactionIsActive = true;
+                    for(size_t i = 0; i < batch.size(); ++i) {
+                        auto &result = batch[i];
+                        this->perform(control_statements::write_savepoint, "SAVEPOINT write_queue_write");
+                        try {
+                            result.value = result.t->write();
+                            this->perform(control_statements::write_release, "RELEASE write_queue_write");
+                        } catch(...) {
+                            result.exception = std::current_exception();
+                            if(sqlite3_get_autocommit(this->con.get())) {
+                                resultsCount = i + 1;
+                                throw;
+                            }
+                            this->perform(control_statements::write_rollback_to, "ROLLBACK TO write_queue_write");
+                            this->perform(control_statements::write_release, "RELEASE write_queue_write");
+                        }
+                    }
+                    this->commit();
+                    transactionIsActive = false;
+                    ++this->commitsCount;
+                } catch(...) {
+                    transactionException = std::current_exception();
+                    if(transactionIsActive) {
+                        try {
+                            this->rollback();
+                        } catch(...) {
+                        }
+                    }
+                }
+                this->writesCount += static_cast<int64>(resultsCount);
+                for(size_t i = 0; i < resultsCount; ++i) {
+                    auto &result = batch[i];
+                    if(transactionException) {
+                        result.t->promise.set_exception(transactionException);
+                    } else if(result.exception) {
+                        result.t->promise.set_exception(result.exception);
+                    } else {
+                        result.t->promise.set_value(result.value);
+                    }
+                }
+                batch.erase(batch.begin(), batch.begin() + static_cast<std::ptrdiff_t>(resultsCount));
+            }
+        };
     }
+}
 
-    /**
-     *  Create a get pointer statement.
-     *  T is an object type mapped to a storage.
-     *  Usage: get_pointer<User>(5);
-     */
-    template<class T, class... Ids>
-    internal::get_pointer_t<T, Ids...> get_pointer(Ids... ids) {
-        std::tuple<Ids...> idsTuple{std::forward<Ids>(ids)...};
-        return {move(idsTuple)};
-    }
+// #include "wal_checkpointer.h"
 
-#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
-    /**
-     *  Create a get optional statement.
-     *  T is an object type mapped to a storage.
-     *  Usage: get_optional<User>(5);
-     */
-    template<class T, class... Ids>
-    internal::get_optional_t<T, Ids...> get_optional(Ids... ids) {
-        std::tuple<Ids...> idsTuple{std::forward<Ids>(ids)...};
-        return {move(idsTuple)};
-    }
-#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+#include <sqlite3.h>
+#include <atomic>  //  std::atomic, std::atomic_int
+#include <chrono>  //  std::chrono::steady_clock, std::chrono::milliseconds, std::chrono::microseconds
+#include <mutex>  //  std::mutex, std::unique_lock, std::lock_guard
+#include <condition_variable>  //  std::condition_variable
+#include <thread>  //  std::thread
+#include <memory>  //  std::unique_ptr
+#include <utility>  //  std::move
 
-    /**
-     *  Create a remove all statement.
-     *  T is an object type mapped to a storage.
-     *  Usage: storage.remove_all<User>(...);
-     */
-    template<class T, class... Args>
-    internal::remove_all_t<T, Args...> remove_all(Args... args) {
-        using args_tuple = std::tuple<Args...>;
-        internal::validate_conditions<args_tuple>();
-        args_tuple conditions{std::forward<Args>(args)...};
-        return {move(conditions)};
-    }
+// #include "sqlite_type.h"
 
-    /**
-     *  Create a get all statement.
-     *  T is an object type mapped to a storage.
-     *  Usage: storage.get_all<User>(...);
-     */
-    template<class T, class... Args>
-    internal::get_all_t<T, Args...> get_all(Args... args) {
-        using args_tuple = std::tuple<Args...>;
-        internal::validate_conditions<args_tuple>();
-        args_tuple conditions{std::forward<Args>(args)...};
-        return {move(conditions)};
-    }
+// #include "connection_holder.h"
 
-    /**
-     *  Create an update all statement.
-     *  Usage: storage.update_all(set(...), ...);
-     */
-    template<class... Args, class... Wargs>
-    internal::update_all_t<internal::set_t<Args...>, Wargs...> update_all(internal::set_t<Args...> set, Wargs... wh) {
-        using args_tuple = std::tuple<Wargs...>;
-        internal::validate_conditions<args_tuple>();
-        args_tuple conditions{std::forward<Wargs>(wh)...};
-        return {std::move(set), move(conditions)};
-    }
+namespace sqlite_orm {
 
     /**
-     *  Create a get all pointer statement.
-     *  T is an object type mapped to a storage.
-     *  Usage: storage.get_all_pointer<User>(...);
+     *  Modes of `sqlite3_wal_checkpoint_v2`. See https://www.sqlite.org/c3ref/wal_checkpoint_v2.html
      */
-    template<class T, class... Args>
-    internal::get_all_pointer_t<T, Args...> get_all_pointer(Args... args) {
-        std::tuple<Args...> conditions{std::forward<Args>(args)...};
-        return {move(conditions)};
-    }
+    enum class checkpoint_mode : signed char {
+        PASSIVE = SQLITE_CHECKPOINT_PASSIVE,
+        FULL = SQLITE_CHECKPOINT_FULL,
+        RESTART = SQLITE_CHECKPOINT_RESTART,
+        TRUNCATE = SQLITE_CHECKPOINT_TRUNCATE,
+    };
 
-#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
     /**
-     *  Create a get all optional statement.
-     *  T is an object type mapped to a storage.
-     *  Usage: storage.get_all_optional<User>(...);
+     *  Options of a checkpointer started by `storage.start_wal_checkpointer(options)`.
      */
-    template<class T, class... Args>
-    internal::get_all_optional_t<T, Args...> get_all_optional(Args... args) {
-        std::tuple<Args...> conditions{std::forward<Args>(args)...};
-        return {move(conditions)};
-    }
-#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
-}
+    struct wal_checkpointer_options {
 
-namespace sqlite_orm {
+        checkpoint_mode mode = checkpoint_mode::PASSIVE;
 
-    namespace internal {
+        /**
+         *  Checkpoint is run once the storage connection commits and WAL has at least this amount of frames
+         *  which are not checkpointed yet. 0 disables the trigger.
+         */
+        int wal_frames = 1000;
 
         /**
-         *  ast_iterator accepts any expression and a callable object
-         *  which will be called for any node of provided expression.
-         *  E.g. if we pass `where(is_equal(5, max(&User::id, 10))` then
-         *  callable object will be called with 5, &User::id and 10.
-         *  ast_iterator is used mostly in finding literals to be bound to
-         *  a statement. To use it just call `iterate_ast(object, callable);`
-         *  T is an ast element. E.g. where_t
+         *  Checkpoint is run if the previous one was run this time ago. It catches writes made by other
+         *  connections and processes. 0 disables the trigger.
          */
-        template<class T, class SFINAE = void>
-        struct ast_iterator {
-            using node_type = T;
+        std::chrono::milliseconds interval{1000};
 
-            /**
-             *  L is a callable type. Mostly is a templated lambda
-             */
-            template<class L>
-            void operator()(const T &t, const L &l) const {
-                l(t);
-            }
-        };
+        /**
+         *  Under a steady write load a `PASSIVE` checkpoint never catches up with writers so WAL is never
+         *  restarted and keeps growing. If WAL still has at least this amount of frames after a checkpoint
+         *  the next one is run in `checkpoint_mode::RESTART` mode. 0 disables escalation.
+         *  `FULL`, `RESTART` and `TRUNCATE` checkpoints block writers while they run so writers must have
+         *  a busy timeout (`storage.busy_timeout(ms)`) to use them.
+         */
+        int restart_wal_frames = 0;
 
         /**
-         *  Simplified API
+         *  Busy timeout of the checkpointer connection. `FULL`, `RESTART` and `TRUNCATE` checkpoints wait
+         *  for readers and writers up to this time.
          */
-        template<class T, class L>
-        void iterate_ast(const T &t, const L &l) {
-            ast_iterator<T> iterator;
-            iterator(t, l);
-        }
+        std::chrono::milliseconds busy_timeout{1000};
+    };
 
-        template<class T>
-        struct ast_iterator<std::reference_wrapper<T>, void> {
-            using node_type = std::reference_wrapper<T>;
+    /**
+     *  Statistics of a WAL checkpointer.
+     */
+    struct wal_checkpoint_stats {
 
-            template<class L>
-            void operator()(const node_type &r, const L &l) const {
-                iterate_ast(r.get(), l);
-            }
-        };
+        /**
+         *  Amount of `sqlite3_wal_checkpoint_v2` calls.
+         */
+        int64 checkpoints_count = 0;
 
-        template<class C>
-        struct ast_iterator<conditions::where_t<C>, void> {
-            using node_type = conditions::where_t<C>;
+        /**
+         *  Amount of checkpoints which returned SQLITE_BUSY. Such checkpoints may be partial.
+         */
+        int64 busy_count = 0;
 
-            template<class L>
-            void operator()(const node_type &where, const L &l) const {
-                iterate_ast(where.c, l);
-            }
-        };
+        /**
+         *  Amount of checkpoints escalated to `checkpoint_mode::RESTART` (see `restart_wal_frames`).
+         */
+        int64 restarts_count = 0;
 
-        template<class T>
-        struct ast_iterator<
-            T,
-            typename std::enable_if<is_base_of_template<T, conditions::binary_condition>::value>::type> {
-            using node_type = T;
+        /**
+         *  Amount of checkpoints which failed with an error other than SQLITE_BUSY.
+         */
+        int64 errors_count = 0;
 
-            template<class L>
-            void operator()(const node_type &binaryCondition, const L &l) const {
-                iterate_ast(binaryCondition.l, l);
-                iterate_ast(binaryCondition.r, l);
-            }
-        };
+        /**
+         *  Size of WAL in frames and amount of checkpointed frames reported by the last checkpoint.
+         */
+        int last_log_frames = 0;
+        int last_checkpointed_frames = 0;
 
-        template<class L, class R, class... Ds>
-        struct ast_iterator<binary_operator<L, R, Ds...>, void> {
-            using node_type = binary_operator<L, R, Ds...>;
+        /**
+         *  Sum of frames checkpointed by all checkpoints. A frame checkpointed by two checkpoints is counted twice.
+         */
+        int64 total_checkpointed_frames = 0;
 
-            template<class C>
-            void operator()(const node_type &binaryOperator, const C &l) const {
-                iterate_ast(binaryOperator.lhs, l);
-                iterate_ast(binaryOperator.rhs, l);
-            }
-        };
+        std::chrono::microseconds last_duration{0};
+        std::chrono::microseconds max_duration{0};
+        std::chrono::microseconds total_duration{0};
+    };
 
-        template<class... Args>
-        struct ast_iterator<columns_t<Args...>, void> {
-            using node_type = columns_t<Args...>;
+    namespace internal {
 
-            template<class L>
-            void operator()(const node_type &cols, const L &l) const {
-                iterate_ast(cols.columns, l);
+        /**
+         *  Runs WAL checkpoints on a background thread with its own connection so writers never run
+         *  them inline on commit. `install_hook` must be called for every writer connection of the storage:
+         *  it replaces the automatic checkpoint with a `sqlite3_wal_hook` which only wakes the checkpointer
+         *  up once WAL grows enough.
+         */
+        struct wal_checkpointer {
+
+            wal_checkpointer(wal_checkpointer_options options_, connection_ref con_) :
+                options(options_), con(std::move(con_)) {
+                sqlite3_busy_timeout(this->con.get(), static_cast<int>(this->options.busy_timeout.count()));
+                this->lastCheckpointTime = std::chrono::steady_clock::now();
+                this->thread = std::thread([this] {
+                    this->run();
+                });
             }
-        };
 
-        template<class L, class A>
-        struct ast_iterator<conditions::in_t<L, A>, void> {
-            using node_type = conditions::in_t<L, A>;
+            wal_checkpointer(const wal_checkpointer &) = delete;
 
-            template<class C>
-            void operator()(const node_type &in, const C &l) const {
-                iterate_ast(in.l, l);
-                iterate_ast(in.arg, l);
+            ~wal_checkpointer() {
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex);
+                    this->stopped = true;
+                }
+                this->condition.notify_one();
+                this->thread.join();
             }
-        };
 
-        template<class T>
-        struct ast_iterator<std::vector<T>, void> {
-            using node_type = std::vector<T>;
+            void install_hook(sqlite3 *db) {
+                sqlite3_wal_hook(db, wal_hook_callback, this);
+            }
 
-            template<class L>
-            void operator()(const node_type &vec, const L &l) const {
-                for(auto &i: vec) {
-                    iterate_ast(i, l);
+            /**
+             *  Runs a checkpoint right now on the calling thread.
+             */
+            void checkpoint() {
+                std::lock_guard<std::mutex> checkpointLock(this->checkpointMutex);
+                auto db = this->con.get();
+                auto mode = this->options.mode;
+                auto escalate = this->options.restart_wal_frames > 0 && mode == checkpoint_mode::PASSIVE &&
+                                this->lastLogFrames >= this->options.restart_wal_frames;
+                if(escalate) {
+                    mode = checkpoint_mode::RESTART;
+                }
+                auto logFrames = 0;
+                auto checkpointedFrames = 0;
+                auto start = std::chrono::steady_clock::now();
+                auto rc =
+                    sqlite3_wal_checkpoint_v2(db, nullptr, static_cast<int>(mode), &logFrames, &checkpointedFrames);
+                auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start);
+                if(rc == SQLITE_OK || rc == SQLITE_BUSY) {
+                    this->checkpointedFrames = checkpointedFrames;
+                    this->lastLogFrames = logFrames;
+                }
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->lastCheckpointTime = std::chrono::steady_clock::now();
+                ++this->statistics.checkpoints_count;
+                if(escalate) {
+                    ++this->statistics.restarts_count;
+                }
+                if(rc == SQLITE_BUSY) {
+                    ++this->statistics.busy_count;
+                } else if(rc != SQLITE_OK) {
+                    ++this->statistics.errors_count;
+                }
+                if(rc == SQLITE_OK || rc == SQLITE_BUSY) {
+                    this->statistics.last_log_frames = logFrames;
+                    this->statistics.last_checkpointed_frames = checkpointedFrames;
+                    if(checkpointedFrames > 0) {
+                        this->statistics.total_checkpointed_frames += checkpointedFrames;
+                    }
+                }
+                this->statistics.last_duration = duration;
+                if(duration > this->statistics.max_duration) {
+                    this->statistics.max_duration = duration;
                 }
+                this->statistics.total_duration += duration;
             }
-        };
-
-        template<>
-        struct ast_iterator<std::vector<char>, void> {
-            using node_type = std::vector<char>;
 
-            template<class L>
-            void operator()(const node_type &vec, const L &l) const {
-                l(vec);
+            wal_checkpoint_stats stats() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                return this->statistics;
             }
-        };
-
-        template<class T>
-        struct ast_iterator<T, typename std::enable_if<is_base_of_template<T, compound_operator>::value>::type> {
-            using node_type = T;
 
-            template<class L>
-            void operator()(const node_type &c, const L &l) const {
-                iterate_ast(c.left, l);
-                iterate_ast(c.right, l);
-            }
-        };
+            const wal_checkpointer_options options;
 
-        template<class T, class... Args>
-        struct ast_iterator<select_t<T, Args...>, void> {
-            using node_type = select_t<T, Args...>;
+          protected:
+            connection_ref con;
+            std::mutex mutex;
+            std::mutex checkpointMutex;
+            std::condition_variable condition;
+            bool stopped = false;
+            bool checkpointRequested = false;
+            std::chrono::steady_clock::time_point lastCheckpointTime;
+            std::atomic_int checkpointedFrames{0};
+            int lastLogFrames = 0;
+            wal_checkpoint_stats statistics;
+            std::thread thread;
 
-            template<class L>
-            void operator()(const node_type &sel, const L &l) const {
-                iterate_ast(sel.col, l);
-                iterate_ast(sel.conditions, l);
+            /**
+             *  Called by sqlite on the committing thread after every commit with the WAL size in frames.
+             *  Frames checkpointed by the previous checkpoint stay in WAL until a writer restarts it
+             *  so only frames above them are counted.
+             */
+            static int wal_hook_callback(void *data, sqlite3 *, const char *, int frames) {
+                auto &checkpointer = *static_cast<wal_checkpointer *>(data);
+                auto threshold = checkpointer.options.wal_frames;
+                if(threshold > 0) {
+                    auto checkpointed = checkpointer.checkpointedFrames.load();
+                    auto pendingFrames = frames >= checkpointed ? frames - checkpointed : frames;
+                    if(pendingFrames >= threshold) {
+                        {
+                            std::lock_guard<std::mutex> lock(checkpointer.mutex);
+                            checkpointer.checkpointRequested = true;
+                        }
+                        checkpointer.condition.notify_one();
+                    }
+                }
+                return SQLITE_OK;
             }
-        };
-
-        template<class T, class... Args>
-        struct ast_iterator<get_all_t<T, Args...>, void> {
-            using node_type = get_all_t<T, Args...>;
 
-            template<class L>
-            void operator()(const node_type &get, const L &l) const {
-                iterate_ast(get.conditions, l);
+            void run() {
+                std::unique_lock<std::mutex> lock(this->mutex);
+                while(!this->stopped) {
+                    auto hasInterval = this->options.interval.count() > 0;
+                    auto nextCheckpointTime = this->lastCheckpointTime + this->options.interval;
+                    auto checkpointIsDue = [this, hasInterval, nextCheckpointTime] {
+                        return this->checkpointRequested ||
+                               (hasInterval && std::chrono::steady_clock::now() >= nextCheckpointTime);
+                    };
+                    if(!checkpointIsDue()) {
+                        if(hasInterval) {
+                            this->condition.wait_until(lock, nextCheckpointTime);
+                        } else {
+                            this->condition.wait(lock);
+                        }
+                    }
+                    if(this->stopped) {
+                        break;
+                    }
+                    if(checkpointIsDue()) {
+                        this->checkpointRequested = false;
+                        lock.unlock();
+                        this->checkpoint();
+                        lock.lock();
+                    }
+                }
             }
         };
+    }
+}
 
-        template<class T, class... Args>
-        struct ast_iterator<get_all_pointer_t<T, Args...>, void> {
-            using node_type = get_all_pointer_t<T, Args...>;
-
-            template<class L>
-            void operator()(const node_type &get, const L &l) const {
-                iterate_ast(get.conditions, l);
-            }
-        };
+// #include "backup.h"
 
-#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
-        template<class T, class... Args>
-        struct ast_iterator<get_all_optional_t<T, Args...>, void> {
-            using node_type = get_all_optional_t<T, Args...>;
+#include <sqlite3.h>
+#include <string>  //  std::string
+#include <memory>
 
-            template<class L>
-            void operator()(const node_type &get, const L &l) const {
-                iterate_ast(get.conditions, l);
-            }
-        };
-#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+// #include "error_code.h"
 
-        template<class... Args, class... Wargs>
-        struct ast_iterator<update_all_t<set_t<Args...>, Wargs...>, void> {
-            using node_type = update_all_t<set_t<Args...>, Wargs...>;
+// #include "connection_holder.h"
 
-            template<class L>
-            void operator()(const node_type &u, const L &l) const {
-                iterate_ast(u.set, l);
-                iterate_ast(u.conditions, l);
-            }
-        };
+namespace sqlite_orm {
 
-        template<class T, class... Args>
-        struct ast_iterator<remove_all_t<T, Args...>, void> {
-            using node_type = remove_all_t<T, Args...>;
+    namespace internal {
 
-            template<class L>
-            void operator()(const node_type &r, const L &l) const {
-                iterate_ast(r.conditions, l);
+        /**
+         *  A backup class. Don't construct it as is, call storage.make_backup_from or storage.make_backup_to instead.
+         *  An instance of this class represents a wrapper around sqlite3_backup pointer. Use this class
+         *  to have maximum control on a backup operation. In case you need a single backup in one line you
+         *  can skip creating a backup_t instance and just call storage.backup_from or storage.backup_to function.
+         */
+        struct backup_t {
+            backup_t(connection_ref to_,
+                     const std::string &zDestName,
+                     connection_ref from_,
+                     const std::string &zSourceName,
+                     std::unique_ptr<connection_holder> holder_) :
+                handle(sqlite3_backup_init(to_.get(), zDestName.c_str(), from_.get(), zSourceName.c_str())),
+                holder(move(holder_)), to(to_), from(from_) {
+                if(!this->handle) {
+                    throw std::system_error(std::make_error_code(orm_error_code::failed_to_init_a_backup));
+                }
             }
-        };
 
-        template<class... Args>
-        struct ast_iterator<set_t<Args...>, void> {
-            using node_type = set_t<Args...>;
-
-            template<class L>
-            void operator()(const node_type &s, const L &l) const {
-                iterate_ast(s.assigns, l);
+            backup_t(backup_t &&other) :
+                handle(other.handle), holder(move(other.holder)), to(other.to), from(other.from) {
+                other.handle = nullptr;
             }
-        };
 
-        template<class... Args>
-        struct ast_iterator<std::tuple<Args...>, void> {
-            using node_type = std::tuple<Args...>;
+            ~backup_t() {
+                if(this->handle) {
+                    (void)sqlite3_backup_finish(this->handle);
+                    this->handle = nullptr;
+                }
+            }
 
-            template<class L>
-            void operator()(const node_type &tuple, const L &l) const {
-                iterate_tuple(tuple, [&l](auto &v) {
-                    iterate_ast(v, l);
-                });
+            /**
+             *  Calls sqlite3_backup_step with pages argument
+             */
+            int step(int pages) {
+                return sqlite3_backup_step(this->handle, pages);
             }
-        };
 
-        template<class T>
-        struct ast_iterator<conditions::having_t<T>, void> {
-            using node_type = conditions::having_t<T>;
+            /**
+             *  Returns sqlite3_backup_remaining result
+             */
+            int remaining() const {
+                return sqlite3_backup_remaining(this->handle);
+            }
 
-            template<class L>
-            void operator()(const node_type &hav, const L &l) const {
-                iterate_ast(hav.t, l);
+            /**
+             *  Returns sqlite3_backup_pagecount result
+             */
+            int pagecount() const {
+                return sqlite3_backup_pagecount(this->handle);
             }
+
+          protected:
+            sqlite3_backup *handle = nullptr;
+            std::unique_ptr<connection_holder> holder;
+            connection_ref to;
+            connection_ref from;
         };
+    }
+}
 
-        template<class T, class E>
-        struct ast_iterator<conditions::cast_t<T, E>, void> {
-            using node_type = conditions::cast_t<T, E>;
+namespace sqlite_orm {
 
-            template<class L>
-            void operator()(const node_type &c, const L &l) const {
-                iterate_ast(c.expression, l);
+    namespace internal {
+
+        /**
+         *  Returns `identifier` enclosed in double quotes. Embedded double quotes are doubled so any string
+         *  may be used as an identifier.
+         */
+        inline std::string quote_identifier(const std::string &identifier) {
+            std::string res;
+            res.reserve(identifier.size() + 2);
+            res += '"';
+            for(auto c: identifier) {
+                if(c == '"') {
+                    res += '"';
+                }
+                res += c;
             }
-        };
+            res += '"';
+            return res;
+        }
 
-        template<class T>
-        struct ast_iterator<conditions::exists_t<T>, void> {
-            using node_type = conditions::exists_t<T>;
+        struct storage_base {
+            using collating_function = std::function<int(int, const void *, int, const void *)>;
 
-            template<class L>
-            void operator()(const node_type &e, const L &l) const {
-                iterate_ast(e.t, l);
-            }
-        };
+            std::function<void(sqlite3 *)> on_open;
+            pragma_t pragma;
+            limit_accesor limit;
 
-        template<class A, class T, class E>
-        struct ast_iterator<conditions::like_t<A, T, E>, void> {
-            using node_type = conditions::like_t<A, T, E>;
+            /**
+             *  Begins a transaction and returns its guard. If the calling thread is inside a transaction already
+             *  the guard controls a savepoint instead (see `savepoint_guard`).
+             */
+            transaction_guard_t transaction_guard() {
+                if(this->in_transaction()) {
+                    return this->savepoint_guard(nested_savepoint_name());
+                }
+                this->begin_transaction();
+                return this->make_transaction_guard();
+            }
 
-            template<class L>
-            void operator()(const node_type &lk, const L &l) const {
-                iterate_ast(lk.arg, l);
-                iterate_ast(lk.pattern, l);
-                lk.arg3.apply([&l](auto &value) {
-                    iterate_ast(value, l);
+            /**
+             *  Begins a transaction in `options.mode`. `BEGIN` failed with SQLITE_BUSY or SQLITE_LOCKED is retried
+             *  up to `options.max_retries` times. Statements executed via the guard are not retried so use
+             *  `transaction_mode::immediate` or `transaction_mode::exclusive` to take the write lock right away.
+             */
+            transaction_guard_t transaction_guard(transaction_options options) {
+                if(this->in_transaction()) {
+                    return this->savepoint_guard(nested_savepoint_name());
+                }
+                this->retry_busy(options, [this, &options] {
+                    this->begin_transaction(options.mode);
                 });
+                return this->make_transaction_guard();
             }
-        };
-
-        template<class A, class T>
-        struct ast_iterator<conditions::glob_t<A, T>, void> {
-            using node_type = conditions::glob_t<A, T>;
 
-            template<class L>
-            void operator()(const node_type &lk, const L &l) const {
-                iterate_ast(lk.arg, l);
-                iterate_ast(lk.pattern, l);
+            /**
+             *  Executes `SAVEPOINT name` and returns a guard which releases the savepoint on `commit()` and
+             *  rolls back to it and releases it on `rollback()` or in destructor. Works both inside and outside
+             *  of a transaction.
+             */
+            savepoint_guard_t savepoint_guard(const std::string &name) {
+                this->savepoint(name);
+                auto releaseFunc = std::bind(&storage_base::release_savepoint, this, name);
+                auto rollbackFunc = [this, name] {
+                    this->rollback_to_savepoint(name);
+                    this->release_savepoint(name);
+                };
+                return {this->get_connection(), std::move(releaseFunc), std::move(rollbackFunc)};
             }
-        };
 
-        template<class A, class T>
-        struct ast_iterator<conditions::between_t<A, T>, void> {
-            using node_type = conditions::between_t<A, T>;
+            /**
+             *  Executes `SAVEPOINT name`. Outside of a transaction it begins a deferred transaction which is
+             *  committed by `release_savepoint(name)`. Inside a transaction it marks a point the transaction
+             *  may be rolled back to. Releasing a nested savepoint doesn't write anything to disk so it is
+             *  cheap to wrap a batch of writes inside a large transaction. Every `savepoint` call must be paired
+             *  with a `release_savepoint` call.
+             */
+            void savepoint(const std::string &name) {
+                this->connection->retain();
+                auto db = this->connection->get();
+                try {
+                    this->perform_savepoint_statement(db, "SAVEPOINT ", name);
+                } catch(...) {
+                    this->connection->release();
+                    throw;
+                }
+                this->transactionThreadId = std::this_thread::get_id();
+            }
 
-            template<class L>
-            void operator()(const node_type &b, const L &l) const {
-                iterate_ast(b.expr, l);
-                iterate_ast(b.b1, l);
-                iterate_ast(b.b2, l);
+            /**
+             *  Executes `RELEASE SAVEPOINT name`. Releasing the outermost savepoint commits the transaction.
+             */
+            void release_savepoint(const std::string &name) {
+                auto db = this->connection->get();
+                this->perform_savepoint_statement(db, "RELEASE SAVEPOINT ", name);
+                if(sqlite3_get_autocommit(db)) {
+                    this->transactionThreadId = std::thread::id();
+                }
+                this->connection->release();
+                if(this->connection->retain_count() < 0) {
+                    throw std::system_error(std::make_error_code(orm_error_code::no_active_transaction));
+                }
             }
-        };
 
-        template<class T>
-        struct ast_iterator<conditions::named_collate<T>, void> {
-            using node_type = conditions::named_collate<T>;
+            /**
+             *  Executes `ROLLBACK TO SAVEPOINT name`. Changes made after the savepoint are discarded but
+             *  the savepoint stays active so it must be released still.
+             */
+            void rollback_to_savepoint(const std::string &name) {
+                auto db = this->connection->get();
+                this->perform_savepoint_statement(db, "ROLLBACK TO SAVEPOINT ", name);
+            }
 
-            template<class L>
-            void operator()(const node_type &col, const L &l) const {
-                iterate_ast(col.expr, l);
+            /**
+             *  @return true if the calling thread has begun a transaction or a savepoint which is not finished yet.
+             */
+            bool in_transaction() const {
+                return this->transactionThreadId == std::this_thread::get_id();
             }
-        };
 
-        template<class C>
-        struct ast_iterator<conditions::negated_condition_t<C>, void> {
-            using node_type = conditions::negated_condition_t<C>;
+            void drop_index(const std::string &indexName) {
+                auto con = this->get_connection();
+                auto db = con.get();
+                std::stringstream ss;
+                ss << "DROP INDEX '" << indexName + "'";
+                auto query = ss.str();
+                sqlite3_stmt *stmt;
+                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+                    statement_finalizer finalizer{stmt};
+                    if(sqlite3_step(stmt) == SQLITE_DONE) {
+                        //  done..
+                    } else {
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
+                    }
+                } else {
+                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(db));
+                }
+            }
 
-            template<class L>
-            void operator()(const node_type &neg, const L &l) const {
-                iterate_ast(neg.c, l);
+            void vacuum() {
+                auto con = this->get_connection();
+                auto db = con.get();
+                std::string query = "VACUUM";
+                sqlite3_stmt *stmt;
+                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+                    statement_finalizer finalizer{stmt};
+                    if(sqlite3_step(stmt) == SQLITE_DONE) {
+                        //  done..
+                    } else {
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
+                    }
+                } else {
+                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(db));
+                }
             }
-        };
-
-        template<class T>
-        struct ast_iterator<conditions::is_null_t<T>, void> {
-            using node_type = conditions::is_null_t<T>;
 
-            template<class L>
-            void operator()(const node_type &i, const L &l) const {
-                iterate_ast(i.t, l);
+            /**
+             *  Drops table with given name.
+             */
+            void drop_table(const std::string &tableName) {
+                auto con = this->get_connection();
+                this->drop_table_internal(tableName, con.get());
+                this->clear_statement_cache();
             }
-        };
-
-        template<class T>
-        struct ast_iterator<conditions::is_not_null_t<T>, void> {
-            using node_type = conditions::is_not_null_t<T>;
 
-            template<class L>
-            void operator()(const node_type &i, const L &l) const {
-                iterate_ast(i.t, l);
+            /**
+             *  Enables or disables the statement cache. When it is enabled statements prepared by the storage
+             *  (e.g. inside `get`, `insert`, `update`, `replace`, `remove` and explicit `prepare` calls) are not
+             *  finalized after use but are reset and kept by their connection to be reused next time.
+             *  Cache is cleared by `sync_schema`, `drop_table` and when a connection is closed.
+             */
+            void enable_statement_cache(bool value = true) {
+                this->statementCacheEnabled = value;
+                if(!value) {
+                    this->clear_statement_cache();
+                }
             }
-        };
-
-        template<class R, class S, class... Args>
-        struct ast_iterator<core_functions::core_function_t<R, S, Args...>, void> {
-            using node_type = core_functions::core_function_t<R, S, Args...>;
 
-            template<class L>
-            void operator()(const node_type &f, const L &l) const {
-                iterate_ast(f.args, l);
+            bool statement_cache_enabled() const {
+                return this->statementCacheEnabled;
             }
-        };
-
-        template<class T, class O>
-        struct ast_iterator<conditions::left_join_t<T, O>, void> {
-            using node_type = conditions::left_join_t<T, O>;
 
-            template<class L>
-            void operator()(const node_type &j, const L &l) const {
-                iterate_ast(j.constraint, l);
+            /**
+             *  Finalizes all cached statements that are not used at the moment. Statements used at the moment
+             *  are finalized once they are released.
+             */
+            void clear_statement_cache() {
+                this->connection->cache.clear();
+                if(this->pool) {
+                    this->pool->clear_caches();
+                }
             }
-        };
 
-        template<class T>
-        struct ast_iterator<conditions::on_t<T>, void> {
-            using node_type = conditions::on_t<T>;
-
-            template<class L>
-            void operator()(const node_type &o, const L &l) const {
-                iterate_ast(o.arg, l);
+            /**
+             *  @return amount of statements taken from the statement cache.
+             */
+            int64 statement_cache_hits() const {
+                return this->statementCacheHits;
             }
-        };
-
-        template<class T, class O>
-        struct ast_iterator<conditions::join_t<T, O>, void> {
-            using node_type = conditions::join_t<T, O>;
 
-            template<class L>
-            void operator()(const node_type &j, const L &l) const {
-                iterate_ast(j.constraint, l);
+            /**
+             *  @return amount of statements prepared cause they were not found in the statement cache.
+             */
+            int64 statement_cache_misses() const {
+                return this->statementCacheMisses;
             }
-        };
 
-        template<class T, class O>
-        struct ast_iterator<conditions::left_outer_join_t<T, O>, void> {
-            using node_type = conditions::left_outer_join_t<T, O>;
+            /**
+             *  @return amount of SQL texts of primary key CRUD statements serialized by this storage. Every text
+             *  is serialized once per mapped type and reused afterwards. A copy of a storage serializes its own texts.
+             */
+            int64 static_sql_serializations_count() const {
+                return this->staticSqlSerializationsCount;
+            }
 
-            template<class L>
-            void operator()(const node_type &j, const L &l) const {
-                iterate_ast(j.constraint, l);
+            /**
+             *  Enables or disables reserving result vectors of `get_all`, `get_all_pointer` and `get_all_optional`
+             *  by an estimate of the table rows count. The first estimate of a table is read from `sqlite_stat1`
+             *  (filled by `ANALYZE`), later ones are the size of the previous result. Only queries without
+             *  conditions other than `order_by` are reserved cause filtered results may be much smaller than
+             *  the table. Pass a reserved container with `into` to reserve filtered results.
+             */
+            void enable_result_size_estimate(bool value = true) {
+                this->resultSizeEstimateEnabled = value;
             }
-        };
 
-        template<class T, class O>
-        struct ast_iterator<conditions::inner_join_t<T, O>, void> {
-            using node_type = conditions::inner_join_t<T, O>;
+            bool result_size_estimate_enabled() const {
+                return this->resultSizeEstimateEnabled;
+            }
 
-            template<class L>
-            void operator()(const node_type &j, const L &l) const {
-                iterate_ast(j.constraint, l);
+            /**
+             *  Starts a group commit queue. Writes passed to `enqueue_write` from any thread are executed by
+             *  a single writer thread, and all writes collected while the previous batch was committed are
+             *  executed in one transaction. Enables the statement cache so statements are not prepared
+             *  for every write. Does nothing if the queue is started already.
+             *  While the queue is running other writes must not be done via the main connection
+             *  cause they would be executed inside a transaction of the writer thread.
+             */
+            void start_write_queue(write_queue_options options = {}) {
+                if(!this->writeQueue) {
+                    this->enable_statement_cache();
+                    this->writeQueue = std::make_unique<write_queue>(
+                        options,
+                        this->get_connection(),
+                        [this] {
+                            this->begin_transaction();
+                        },
+                        [this] {
+                            this->commit();
+                        },
+                        [this] {
+                            this->abort_transaction();
+                        });
+                }
             }
-        };
 
-        template<class R, class T, class E, class... Args>
-        struct ast_iterator<simple_case_t<R, T, E, Args...>, void> {
-            using node_type = simple_case_t<R, T, E, Args...>;
+            /**
+             *  Executes all enqueued writes and stops the writer thread. Must not be called while
+             *  other threads enqueue writes.
+             */
+            void stop_write_queue() {
+                this->writeQueue.reset();
+            }
 
-            template<class L>
-            void operator()(const node_type &c, const L &l) const {
-                c.case_expression.apply([&l](auto &c) {
-                    iterate_ast(c, l);
-                });
-                iterate_tuple(c.args, [&l](auto &pair) {
-                    iterate_ast(pair.first, l);
-                    iterate_ast(pair.second, l);
-                });
-                c.else_expression.apply([&l](auto &el) {
-                    iterate_ast(el, l);
-                });
+            /**
+             *  Enqueues a write into the group commit queue started with `start_write_queue`. `write` may execute
+             *  several statements: it is executed inside its own savepoint so if it throws none of its changes
+             *  are committed.
+             *  @return future which gets a result of `write` after it is committed or an exception thrown by
+             *  `write` or by the commit.
+             */
+            std::future<int64> enqueue_write(std::function<int64()> write) {
+                if(this->writeQueue) {
+                    return this->writeQueue->push(std::move(write));
+                } else {
+                    throw std::system_error(std::make_error_code(orm_error_code::write_queue_is_not_started));
+                }
             }
-        };
 
-        template<class T, class E>
-        struct ast_iterator<as_t<T, E>, void> {
-            using node_type = as_t<T, E>;
+            /**
+             *  @return amount of transactions committed by the write queue.
+             */
+            int64 write_queue_commits_count() const {
+                return this->writeQueue ? this->writeQueue->commits_count() : 0;
+            }
 
-            template<class L>
-            void operator()(const node_type &a, const L &l) const {
-                iterate_ast(a.expression, l);
+            /**
+             *  @return amount of writes executed by the write queue.
+             */
+            int64 write_queue_writes_count() const {
+                return this->writeQueue ? this->writeQueue->writes_count() : 0;
             }
-        };
 
-        template<class T, bool OI>
-        struct ast_iterator<conditions::limit_t<T, false, OI, void>, void> {
-            using node_type = conditions::limit_t<T, false, OI, void>;
+            /**
+             *  Starts a background thread which runs WAL checkpoints with its own connection. Switches
+             *  the database to `journal_mode::WAL` if it is not in WAL mode yet. Automatic checkpoints
+             *  are disabled for connections of this storage so commits never run checkpoints inline:
+             *  a checkpoint is triggered once WAL grows by `options.wal_frames` frames or every
+             *  `options.interval`. Does nothing if the checkpointer is started already or the database
+             *  is in-memory.
+             */
+            void start_wal_checkpointer(wal_checkpointer_options options = {}) {
+                if(this->walCheckpointer || this->inMemory) {
+                    return;
+                }
+                if(this->pragma.journal_mode() != journal_mode::WAL) {
+                    this->pragma.journal_mode(journal_mode::WAL);
+                }
+                auto holder = std::make_unique<connection_holder>(
+                    this->connection->filename,
+                    std::bind(&storage_base::on_open_internal, this, std::placeholders::_1),
+                    this->connection->options);
+                auto checkpointer = std::make_unique<wal_checkpointer>(options, connection_ref{*holder});
+                auto con = this->get_connection();
+                checkpointer->install_hook(con.get());
+                this->walCheckpointerConnection = std::move(holder);
+                this->walCheckpointer = std::move(checkpointer);
+            }
 
-            template<class L>
-            void operator()(const node_type &a, const L &l) const {
-                iterate_ast(a.lim, l);
+            /**
+             *  Stops the checkpointer thread and restores automatic checkpoints.
+             */
+            void stop_wal_checkpointer() {
+                if(!this->walCheckpointer) {
+                    return;
+                }
+                auto checkpointer = std::move(this->walCheckpointer);
+                if(this->connection->is_open()) {
+                    auto con = this->get_connection();
+                    this->restore_autocheckpoint(con.get());
+                }
+                if(this->pool) {
+                    this->pool->for_each_opened_reader([this](sqlite3 *db) {
+                        this->restore_autocheckpoint(db);
+                    });
+                }
+                checkpointer.reset();
+                this->walCheckpointerConnection.reset();
             }
-        };
 
-        template<class T, class O>
-        struct ast_iterator<conditions::limit_t<T, true, false, O>, void> {
-            using node_type = conditions::limit_t<T, true, false, O>;
+            /**
+             *  Runs a checkpoint right now with the checkpointer connection and mode. Does nothing
+             *  if the checkpointer is not started.
+             */
+            void wal_checkpoint() {
+                if(this->walCheckpointer) {
+                    this->walCheckpointer->checkpoint();
+                }
+            }
 
-            template<class L>
-            void operator()(const node_type &a, const L &l) const {
-                iterate_ast(a.lim, l);
-                a.off.apply([&l](auto &value) {
-                    iterate_ast(value, l);
-                });
+            /**
+             *  @return statistics of the checkpointer. All values are zero if it was not started.
+             */
+            wal_checkpoint_stats wal_checkpointer_stats() {
+                if(this->walCheckpointer) {
+                    return this->walCheckpointer->stats();
+                } else {
+                    return {};
+                }
             }
-        };
 
-        template<class T, class O>
-        struct ast_iterator<conditions::limit_t<T, true, true, O>, void> {
-            using node_type = conditions::limit_t<T, true, true, O>;
+            /**
+             *  sqlite3_changes function.
+             */
+            int changes() {
+                auto con = this->get_connection();
+                return sqlite3_changes(con.get());
+            }
 
-            template<class L>
-            void operator()(const node_type &a, const L &l) const {
-                a.off.apply([&l](auto &value) {
-                    iterate_ast(value, l);
-                });
-                iterate_ast(a.lim, l);
+            /**
+             *  sqlite3_total_changes function.
+             */
+            int total_changes() {
+                auto con = this->get_connection();
+                return sqlite3_total_changes(con.get());
             }
-        };
-    }
-}
 
-// #include "prepared_statement.h"
+            int64 last_insert_rowid() {
+                auto con = this->get_connection();
+                return sqlite3_last_insert_rowid(con.get());
+            }
 
-// #include "connection_holder.h"
+            /**
+             *  Sets busy timeout of the current connection. The value is remembered and applied
+             *  to every connection opened later just like `pragma.busy_timeout(ms)` does.
+             *  Removes a busy handler set with `busy_handler`.
+             */
+            int busy_timeout(int ms) {
+                if(this->busyHandlerPolicy) {
+                    this->set_busy_handler_policy(nullptr);
+                    if(this->pool) {
+                        this->pool->for_each_opened_reader([ms](sqlite3 *db) {
+                            sqlite3_busy_timeout(db, ms);
+                        });
+                    }
+                }
+                auto con = this->get_connection();
+                auto rc = sqlite3_busy_timeout(con.get(), ms);
+                if(rc == SQLITE_OK) {
+                    this->pragma.set_persistent_pragma_value("busy_timeout", std::to_string(ms));
+                }
+                return rc;
+            }
 
-namespace sqlite_orm {
+            /**
+             *  Sets a busy handler of the storage connection and reader connections. It replaces a busy timeout
+             *  and is installed again every time a connection is opened. Every connection collects its own
+             *  contention statistics.
+             *  Usage: `storage.busy_handler(exponential_backoff_policy(std::chrono::milliseconds(5000)));`
+             */
+            void busy_handler(busy_handler_policy policy) {
+                this->pragma.erase_persistent_pragma("busy_timeout");
+                this->set_busy_handler_policy(std::make_shared<const busy_handler_policy>(std::move(policy)));
+            }
 
-    namespace internal {
+            /**
+             *  @return contention statistics of the storage (writer) connection. All values are zero
+             *  if no busy handler was set.
+             */
+            busy_handler_stats busy_stats() {
+                return this->connection->busy_stats();
+            }
 
-        template<class T, class S, class... Args>
-        struct view_t {
-            using mapped_type = T;
-            using storage_type = S;
-            using self = view_t<T, S, Args...>;
+            /**
+             *  @return contention statistics summed over reader connections.
+             */
+            busy_handler_stats readers_busy_stats() {
+                if(this->pool) {
+                    return this->pool->busy_stats();
+                } else {
+                    return {};
+                }
+            }
 
-            storage_type &storage;
-            connection_ref connection;
-            get_all_t<T, Args...> args;
+            /**
+             *  Returns libsqltie3 lib version, not sqlite_orm
+             */
+            std::string libversion() {
+                return sqlite3_libversion();
+            }
 
-            view_t(storage_type &stor, decltype(connection) conn, Args &&... args_) :
-                storage(stor), connection(std::move(conn)), args{std::make_tuple(std::forward<Args>(args_)...)} {}
+            /**
+             *  Runs `f` inside a transaction which is committed if `f` returns true and rolled back otherwise.
+             *  If the calling thread is inside a transaction already `f` is run inside a savepoint so only
+             *  changes made by `f` are rolled back and nothing is committed until the outer transaction is.
+             */
+            bool transaction(std::function<bool()> f) {
+                if(this->in_transaction()) {
+                    return this->nested_transaction(f);
+                }
+                this->begin_transaction();
+                auto shouldCommit = f();
+                if(shouldCommit) {
+                    this->commit();
+                } else {
+                    this->rollback();
+                }
+                return shouldCommit;
+            }
 
-            size_t size() {
-                return this->storage.template count<T>();
+            /**
+             *  Runs `f` inside a transaction begun in `options.mode`. If `f`, `BEGIN` or `COMMIT` fails with
+             *  SQLITE_BUSY or SQLITE_LOCKED the transaction is rolled back and `f` is called again in a new
+             *  transaction after a backoff delay, up to `options.max_retries` times. So `f` must not have side
+             *  effects outside of the database. Other exceptions are rethrown after the rollback.
+             *  Called inside a transaction it runs `f` inside a savepoint once: a retry must restart
+             *  the outer transaction.
+             *  @return true if the transaction is committed, false if `f` asked to roll it back.
+             */
+            bool transaction(const std::function<bool()> &f, transaction_options options) {
+                if(this->in_transaction()) {
+                    return this->nested_transaction(f);
+                }
+                return this->retry_busy(options, [this, &f, &options] {
+                    this->begin_transaction(options.mode);
+                    auto shouldCommit = false;
+                    try {
+                        shouldCommit = f();
+                        if(shouldCommit) {
+                            this->commit();
+                        } else {
+                            this->rollback();
+                        }
+                    } catch(...) {
+                        this->abort_transaction();
+                        throw;
+                    }
+                    return shouldCommit;
+                });
             }
 
-            bool empty() {
-                return !this->size();
+            std::string current_timestamp() {
+                auto con = this->get_connection();
+                return this->current_timestamp(con.get());
             }
 
-            iterator_t<self> end() {
-                return {nullptr, *this};
+#if SQLITE_VERSION_NUMBER >= 3007010
+            /**
+             * \fn db_release_memory
+             * \brief Releases freeable memory of database. It is function can/should be called periodically by
+             * application, if application has less memory usage constraint. \note sqlite3_db_release_memory added
+             * in 3.7.10 https://sqlite.org/changes.html
+             */
+            int db_release_memory() {
+                auto con = this->get_connection();
+                return sqlite3_db_release_memory(con.get());
             }
+#endif
 
-            iterator_t<self> begin() {
-                sqlite3_stmt *stmt = nullptr;
-                auto db = this->connection.get();
-                auto query = this->storage.string_from_expression(this->args, false);
-                auto ret = sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr);
-                if(ret == SQLITE_OK) {
-                    auto index = 1;
-                    iterate_ast(this->args.conditions, [&index, stmt, db](auto &node) {
-                        using node_type = typename std::decay<decltype(node)>::type;
-                        conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
-                        if(SQLITE_OK != binder(node)) {
-                            throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                                    sqlite3_errmsg(db));
+            /**
+             *  Returns existing permanent table names in database. Doesn't check storage itself - works only with
+             * actual database.
+             *  @return Returns list of tables in database.
+             */
+            std::vector<std::string> table_names() {
+                auto con = this->get_connection();
+                std::vector<std::string> tableNames;
+                std::string sql = "SELECT name FROM sqlite_master WHERE type='table'";
+                using data_t = std::vector<std::string>;
+                auto db = con.get();
+                int res = sqlite3_exec(
+                    db,
+                    sql.c_str(),
+                    [](void *data, int argc, char **argv, char * * /*columnName*/) -> int {
+                        auto &tableNames = *(data_t *)data;
+                        for(int i = 0; i < argc; i++) {
+                            if(argv[i]) {
+                                tableNames.push_back(argv[i]);
+                            }
                         }
-                    });
-                    return {stmt, *this};
-                } else {
+                        return 0;
+                    },
+                    &tableNames,
+                    nullptr);
+
+                if(res != SQLITE_OK) {
                     throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                             sqlite3_errmsg(db));
                 }
+                return tableNames;
             }
-        };
-    }
-}
 
-// #include "ast_iterator.h"
-
-// #include "storage_base.h"
-
-#include <functional>  //  std::function, std::bind
-#include <sqlite3.h>
-#include <string>  //  std::string
-#include <sstream>  //  std::stringstream
-#include <utility>  //  std::move
-#include <system_error>  //  std::system_error, std::error_code, std::make_error_code
-#include <vector>  //  std::vector
-#include <memory>  //  std::make_shared, std::shared_ptr
-#include <map>  //  std::map
-#include <type_traits>  //  std::decay, std::is_same
-#include <algorithm>  //  std::iter_swap
-
-// #include "pragma.h"
-
-#include <string>  //  std::string
-#include <sqlite3.h>
-#include <functional>  //  std::function
-#include <memory>  // std::shared_ptr
-
-// #include "error_code.h"
-
-// #include "row_extractor.h"
-
-// #include "journal_mode.h"
-
-// #include "connection_holder.h"
-
-namespace sqlite_orm {
-
-    namespace internal {
-        struct storage_base;
-    }
-
-    struct pragma_t {
-        using get_connection_t = std::function<internal::connection_ref()>;
-
-        pragma_t(get_connection_t get_connection_) : get_connection(std::move(get_connection_)) {}
-
-        sqlite_orm::journal_mode journal_mode() {
-            return this->get_pragma<sqlite_orm::journal_mode>("journal_mode");
-        }
+            void open_forever() {
+                this->isOpenedForever = true;
+                this->connection->retain();
+            }
 
-        void journal_mode(sqlite_orm::journal_mode value) {
-            this->_journal_mode = -1;
-            this->set_pragma("journal_mode", value);
-            this->_journal_mode = static_cast<decltype(this->_journal_mode)>(value);
-        }
+            /**
+             *  Sets when the database connection is closed after the last call that used it. By default
+             *  it is closed right away (`connection_lifetime::per_call`) so every call made outside of
+             *  a transaction reopens the database file and loses sqlite's page cache and cached statements.
+             *  `idleTimeout` is used by `connection_lifetime::idle_timeout` only. Has no effect on in-memory
+             *  databases which are always open.
+             */
+            void set_connection_lifetime(connection_lifetime lifetime,
+                                         std::chrono::milliseconds idleTimeout = std::chrono::milliseconds(1000)) {
+                this->connection->set_lifetime(lifetime, idleTimeout);
+            }
 
-        int synchronous() {
-            return this->get_pragma<int>("synchronous");
-        }
+            connection_lifetime get_connection_lifetime() const {
+                return this->connection->get_lifetime();
+            }
 
-        void synchronous(int value) {
-            this->_synchronous = -1;
-            this->set_pragma("synchronous", value);
-            this->_synchronous = value;
-        }
+            /**
+             *  @return amount of times database connections of this storage (including pooled readers)
+             *  have been opened.
+             */
+            int64 connection_opens_count() const {
+                auto res = this->connection->opens_count();
+                if(this->pool) {
+                    res += this->pool->opens_count();
+                }
+                return res;
+            }
 
-        int user_version() {
-            return this->get_pragma<int>("user_version");
-        }
+            /**
+             *  @return amount of times database connections of this storage (including pooled readers)
+             *  have been closed.
+             */
+            int64 connection_closes_count() const {
+                auto res = this->connection->closes_count();
+                if(this->pool) {
+                    res += this->pool->closes_count();
+                }
+                return res;
+            }
 
-        void user_version(int value) {
-            this->set_pragma("user_version", value);
-        }
+            /**
+             *  @return amount of pooled reader connections opened at the moment. Always 0 for a storage
+             *  created without `pool_options`.
+             */
+            int opened_readers_count() {
+                if(this->pool) {
+                    return this->pool->opened_readers_count();
+                } else {
+                    return 0;
+                }
+            }
 
-        int auto_vacuum() {
-            return this->get_pragma<int>("auto_vacuum");
-        }
+            void create_collation(const std::string &name, collating_function f) {
+                collating_function *functionPointer = nullptr;
+                if(f) {
+                    functionPointer = &(collatingFunctions[name] = std::move(f));
+                } else {
+                    collatingFunctions.erase(name);
+                }
 
-        void auto_vacuum(int value) {
-            this->set_pragma("auto_vacuum", value);
-        }
+                //  create collations if db is open
+                if(this->connection->is_open()) {
+                    auto con = this->get_connection();
+                    auto db = con.get();
+                    if(sqlite3_create_collation(db,
+                                                name.c_str(),
+                                                SQLITE_UTF8,
+                                                functionPointer,
+                                                functionPointer ? collate_callback : nullptr) != SQLITE_OK) {
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
+                    }
+                }
+            }
 
-      protected:
-        friend struct storage_base;
+            void begin_transaction() {
+                this->begin_transaction(transaction_mode::deferred);
+            }
 
-      public:
-        int _synchronous = -1;
-        signed char _journal_mode = -1;  //  if != -1 stores static_cast<sqlite_orm::journal_mode>(journal_mode)
-        get_connection_t get_connection;
+            void begin_transaction(transaction_mode mode) {
+                this->connection->retain();
+                auto db = this->connection->get();
+                try {
+                    this->begin_transaction(db, mode);
+                } catch(...) {
+                    this->connection->release();
+                    throw;
+                }
+                this->transactionThreadId = std::this_thread::get_id();
+            }
 
-        template<class T>
-        T get_pragma(const std::string &name) {
-            auto connection = this->get_connection();
-            auto query = "PRAGMA " + name;
-            T res;
-            auto db = connection.get();
-            auto rc = sqlite3_exec(
-                db,
-                query.c_str(),
-                [](void *data, int argc, char **argv, char **) -> int {
-                    auto &res = *(T *)data;
-                    if(argc) {
-                        res = row_extractor<T>().extract(argv[0]);
-                    }
-                    return 0;
-                },
-                &res,
-                nullptr);
-            if(rc == SQLITE_OK) {
-                return res;
-            } else {
-                throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                        sqlite3_errmsg(db));
+            void commit() {
+                auto db = this->connection->get();
+                this->commit(db);
+                this->transactionThreadId = std::thread::id();
+                this->connection->release();
+                if(this->connection->retain_count() < 0) {
+                    throw std::system_error(std::make_error_code(orm_error_code::no_active_transaction));
+                }
             }
-        }
 
-        /**
-         *  Yevgeniy Zakharov: I wanted to refactore this function with statements and value bindings
-         *  but it turns out that bindings in pragma statements are not supported.
-         */
-        template<class T>
-        void set_pragma(const std::string &name, const T &value, sqlite3 *db = nullptr) {
-            auto con = this->get_connection();
-            if(!db) {
-                db = con.get();
+            void rollback() {
+                auto db = this->connection->get();
+                this->rollback(db);
+                this->transactionThreadId = std::thread::id();
+                this->connection->release();
+                if(this->connection->retain_count() < 0) {
+                    throw std::system_error(std::make_error_code(orm_error_code::no_active_transaction));
+                }
             }
-            std::stringstream ss;
-            ss << "PRAGMA " << name << " = " << value;
-            auto query = ss.str();
-            auto rc = sqlite3_exec(db, query.c_str(), nullptr, nullptr, nullptr);
-            if(rc != SQLITE_OK) {
-                throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                        sqlite3_errmsg(db));
+
+            void backup_to(const std::string &filename, open_options openOptions = {}) {
+                auto backup = this->make_backup_to(filename, std::move(openOptions));
+                backup.step(-1);
             }
-        }
 
-        void set_pragma(const std::string &name, const sqlite_orm::journal_mode &value, sqlite3 *db = nullptr) {
-            auto con = this->get_connection();
-            if(!db) {
-                db = con.get();
+            void backup_to(storage_base &other) {
+                auto backup = this->make_backup_to(other);
+                backup.step(-1);
             }
-            std::stringstream ss;
-            ss << "PRAGMA " << name << " = " << internal::to_string(value);
-            auto query = ss.str();
-            auto rc = sqlite3_exec(db, query.c_str(), nullptr, nullptr, nullptr);
-            if(rc != SQLITE_OK) {
-                throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                        sqlite3_errmsg(db));
+
+            void backup_from(const std::string &filename, open_options openOptions = {}) {
+                auto backup = this->make_backup_from(filename, std::move(openOptions));
+                backup.step(-1);
             }
-        }
-    };
-}
 
-// #include "limit_accesor.h"
+            void backup_from(storage_base &other) {
+                auto backup = this->make_backup_from(other);
+                backup.step(-1);
+            }
 
-#include <sqlite3.h>
-#include <map>  //  std::map
-#include <functional>  //  std::function
-#include <memory>  //  std::shared_ptr
+            /**
+             *  Creates a backup into the database `filename`. `openOptions` are used to open it.
+             */
+            backup_t make_backup_to(const std::string &filename, open_options openOptions = {}) {
+                auto holder = std::make_unique<connection_holder>(filename, nullptr, std::move(openOptions));
+                return {connection_ref{*holder}, "main", this->get_connection(), "main", move(holder)};
+            }
 
-// #include "connection_holder.h"
+            backup_t make_backup_to(storage_base &other) {
+                return {other.get_connection(), "main", this->get_connection(), "main", {}};
+            }
 
-namespace sqlite_orm {
+            /**
+             *  Creates a backup from the database `filename`. `openOptions` are used to open it.
+             */
+            backup_t make_backup_from(const std::string &filename, open_options openOptions = {}) {
+                auto holder = std::make_unique<connection_holder>(filename, nullptr, std::move(openOptions));
+                return {this->get_connection(), "main", connection_ref{*holder}, "main", move(holder)};
+            }
 
-    namespace internal {
+            backup_t make_backup_from(storage_base &other) {
+                return {this->get_connection(), "main", other.get_connection(), "main", {}};
+            }
 
-        struct limit_accesor {
-            using get_connection_t = std::function<connection_ref()>;
+            const std::string &filename() const {
+                return this->connection->filename;
+            }
 
-            limit_accesor(get_connection_t get_connection_) : get_connection(std::move(get_connection_)) {}
+            const open_options &get_open_options() const {
+                return this->connection->options;
+            }
 
-            int length() {
-                return this->get(SQLITE_LIMIT_LENGTH);
+          protected:
+            storage_base(const std::string &filename_,
+                         int foreignKeysCount,
+                         pool_options poolOptions = {},
+                         open_options openOptions = {}) :
+                pragma(std::bind(&storage_base::get_connection, this)),
+                limit(std::bind(&storage_base::get_connection, this)),
+                inMemory(filename_.empty() || filename_ == ":memory:"),
+                connection(std::make_unique<connection_holder>(
+                    filename_,
+                    std::bind(&storage_base::on_open_internal, this, std::placeholders::_1),
+                    std::move(openOptions))),
+                cachedForeignKeysCount(foreignKeysCount) {
+                this->init_pool(poolOptions);
+                if(this->inMemory) {
+                    this->connection->retain();
+                }
             }
 
-            void length(int newValue) {
-                this->set(SQLITE_LIMIT_LENGTH, newValue);
+            storage_base(const storage_base &other) :
+                on_open(other.on_open), pragma(std::bind(&storage_base::get_connection, this)),
+                limit(std::bind(&storage_base::get_connection, this)), inMemory(other.inMemory),
+                connection(std::make_unique<connection_holder>(
+                    other.connection->filename,
+                    std::bind(&storage_base::on_open_internal, this, std::placeholders::_1),
+                    other.connection->options)),
+                cachedForeignKeysCount(other.cachedForeignKeysCount),
+                statementCacheEnabled(other.statementCacheEnabled.load()),
+                resultSizeEstimateEnabled(other.resultSizeEstimateEnabled.load()) {
+                this->pragma._persistent_pragmas = other.pragma.persistent_pragmas();
+                if(other.busyHandlerPolicy) {
+                    this->set_busy_handler_policy(other.busyHandlerPolicy);
+                }
+                if(other.pool) {
+                    this->init_pool(other.pool->options);
+                }
+                auto lifetime = other.connection->get_lifetime();
+                if(lifetime != connection_lifetime::per_call) {
+                    this->connection->set_lifetime(lifetime, other.connection->get_idle_timeout());
+                }
+                if(this->inMemory) {
+                    this->connection->retain();
+                }
             }
 
-            int sql_length() {
-                return this->get(SQLITE_LIMIT_SQL_LENGTH);
+            ~storage_base() {
+                if(this->isOpenedForever) {
+                    this->connection->release();
+                }
+                if(this->inMemory) {
+                    this->connection->release();
+                }
             }
 
-            void sql_length(int newValue) {
-                this->set(SQLITE_LIMIT_SQL_LENGTH, newValue);
+            const bool inMemory;
+            bool isOpenedForever = false;
+            std::unique_ptr<connection_holder> connection;
+            std::unique_ptr<connection_pool> pool;
+            std::atomic<std::thread::id> transactionThreadId{std::thread::id()};
+            std::map<std::string, collating_function> collatingFunctions;
+            const int cachedForeignKeysCount;
+            std::atomic<bool> statementCacheEnabled{false};
+            std::atomic<int64> statementCacheHits{0};
+            std::atomic<int64> statementCacheMisses{0};
+            mutable std::atomic<int64> staticSqlSerializationsCount{0};
+            std::atomic<bool> resultSizeEstimateEnabled{false};
+            std::mutex rowsCountEstimatesMutex;
+            std::map<std::string, size_t> rowsCountEstimates;
+            std::unique_ptr<write_queue> writeQueue;
+            std::unique_ptr<connection_holder> walCheckpointerConnection;
+            std::unique_ptr<wal_checkpointer> walCheckpointer;
+            std::shared_ptr<const busy_handler_policy> busyHandlerPolicy;
+
+            connection_ref get_connection() {
+                return {*this->connection};
             }
 
-            int column() {
-                return this->get(SQLITE_LIMIT_COLUMN);
+            /**
+             *  Returns a connection for a read-only query. It is a pooled reader connection if the storage has
+             *  readers and the calling thread has no active transaction. Otherwise it is the same connection
+             *  `get_connection` returns.
+             */
+            connection_ref get_read_connection() {
+                if(this->pool && this->transactionThreadId != std::this_thread::get_id()) {
+                    return this->pool->acquire_reader();
+                } else {
+                    return this->get_connection();
+                }
             }
 
-            void column(int newValue) {
-                this->set(SQLITE_LIMIT_COLUMN, newValue);
+            void init_pool(pool_options poolOptions) {
+                if(!this->inMemory && poolOptions.readers > 0) {
+                    this->pool = std::make_unique<connection_pool>(
+                        this->connection->filename,
+                        poolOptions,
+                        [this](sqlite3 *db) {
+                            this->on_open_internal(db);
+                            this->on_open_reader_internal(db);
+                        },
+                        this->connection->options);
+                    if(this->busyHandlerPolicy) {
+                        this->pool->set_busy_handler(this->busyHandlerPolicy);
+                    }
+                }
             }
 
-            int expr_depth() {
-                return this->get(SQLITE_LIMIT_EXPR_DEPTH);
+            /**
+             *  Passes `policy` to the storage connection and readers. The checkpointer connection keeps
+             *  its own busy timeout.
+             */
+            void set_busy_handler_policy(std::shared_ptr<const busy_handler_policy> policy) {
+                this->busyHandlerPolicy = policy;
+                this->connection->set_busy_handler(policy);
+                if(this->pool) {
+                    this->pool->set_busy_handler(policy);
+                }
             }
 
-            void expr_depth(int newValue) {
-                this->set(SQLITE_LIMIT_EXPR_DEPTH, newValue);
+#if SQLITE_VERSION_NUMBER >= 3006019
+
+            void foreign_keys(sqlite3 *db, bool value) {
+                std::stringstream ss;
+                ss << "PRAGMA foreign_keys = " << value;
+                auto query = ss.str();
+                auto rc = sqlite3_exec(db, query.c_str(), nullptr, nullptr, nullptr);
+                if(rc != SQLITE_OK) {
+                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(db));
+                }
             }
 
-            int compound_select() {
-                return this->get(SQLITE_LIMIT_COMPOUND_SELECT);
+            bool foreign_keys(sqlite3 *db) {
+                std::string query = "PRAGMA foreign_keys";
+                auto res = false;
+                auto rc = sqlite3_exec(
+                    db,
+                    query.c_str(),
+                    [](void *data, int argc, char **argv, char **) -> int {
+                        auto &res = *(bool *)data;
+                        if(argc) {
+                            res = row_extractor<bool>().extract(argv[0]);
+                        }
+                        return 0;
+                    },
+                    &res,
+                    nullptr);
+                if(rc != SQLITE_OK) {
+                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(db));
+                }
+                return res;
             }
 
-            void compound_select(int newValue) {
-                this->set(SQLITE_LIMIT_COMPOUND_SELECT, newValue);
+#endif
+            void on_open_internal(sqlite3 *db) {
+
+#if SQLITE_VERSION_NUMBER >= 3006019
+                if(this->cachedForeignKeysCount) {
+                    this->foreign_keys(db, true);
+                }
+#endif
+                this->pragma.apply_persistent_pragmas(db);
+
+                if(this->pragma._synchronous != -1) {
+                    this->pragma.set_pragma("synchronous", this->pragma._synchronous, db);
+                }
+
+                if(this->pragma._journal_mode != -1) {
+                    this->pragma.set_pragma("journal_mode", static_cast<journal_mode>(this->pragma._journal_mode), db);
+                }
+
+                for(auto &p: this->collatingFunctions) {
+                    if(sqlite3_create_collation(db, p.first.c_str(), SQLITE_UTF8, &p.second, collate_callback) !=
+                       SQLITE_OK) {
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
+                    }
+                }
+
+                for(auto &p: this->limit.limits) {
+                    sqlite3_limit(db, p.first, p.second);
+                }
+
+                if(this->walCheckpointer) {
+                    this->walCheckpointer->install_hook(db);
+                }
+
+                if(this->on_open) {
+                    this->on_open(db);
+                }
             }
 
-            int vdbe_op() {
-                return this->get(SQLITE_LIMIT_VDBE_OP);
+            /**
+             *  Replaces the checkpointer WAL hook with the automatic checkpoint. Uses `wal_autocheckpoint`
+             *  set with `pragma` if there is one or sqlite default otherwise.
+             */
+            void restore_autocheckpoint(sqlite3 *db) {
+                auto pragmas = this->pragma.persistent_pragmas();
+                auto it = pragmas.find("wal_autocheckpoint");
+                auto frames = it != pragmas.end() ? std::stoi(it->second) : 1000;
+                sqlite3_wal_autocheckpoint(db, frames);
             }
 
-            void vdbe_op(int newValue) {
-                this->set(SQLITE_LIMIT_VDBE_OP, newValue);
+            void on_open_reader_internal(sqlite3 *db) {
+                auto rc = sqlite3_exec(db, "PRAGMA query_only = 1", nullptr, nullptr, nullptr);
+                if(rc != SQLITE_OK) {
+                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(db));
+                }
             }
 
-            int function_arg() {
-                return this->get(SQLITE_LIMIT_FUNCTION_ARG);
+            void begin_transaction(sqlite3 *db, transaction_mode mode = transaction_mode::deferred) {
+                auto kind = control_statements::begin_deferred;
+                switch(mode) {
+                    case transaction_mode::deferred:
+                        break;
+                    case transaction_mode::immediate:
+                        kind = control_statements::begin_immediate;
+                        break;
+                    case transaction_mode::exclusive:
+                        kind = control_statements::begin_exclusive;
+                        break;
+                }
+                this->perform_control_statement(db, kind, begin_transaction_query(mode));
             }
 
-            void function_arg(int newValue) {
-                this->set(SQLITE_LIMIT_FUNCTION_ARG, newValue);
+            void commit(sqlite3 *db) {
+                this->perform_control_statement(db, control_statements::commit, "COMMIT");
             }
 
-            int attached() {
-                return this->get(SQLITE_LIMIT_ATTACHED);
+            void rollback(sqlite3 *db) {
+                this->perform_control_statement(db, control_statements::rollback, "ROLLBACK");
             }
 
-            void attached(int newValue) {
-                this->set(SQLITE_LIMIT_ATTACHED, newValue);
+            /**
+             *  Executes a cached transaction control statement of the storage connection. `db` must be
+             *  the storage connection handle.
+             */
+            void perform_control_statement(sqlite3 *db, control_statements::kind kind, const char *query) {
+                if(this->connection->control.perform(db, kind, query) != SQLITE_DONE) {
+                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(db));
+                }
             }
 
-            int like_pattern_length() {
-                return this->get(SQLITE_LIMIT_LIKE_PATTERN_LENGTH);
+            /**
+             *  Guard of a transaction begun already. Lambdas capture only `this` so `std::function` stores them
+             *  without a heap allocation.
+             */
+            transaction_guard_t make_transaction_guard() {
+                return {this->get_connection(),
+                        [this] {
+                            this->commit();
+                        },
+                        [this] {
+                            this->rollback();
+                        }};
             }
 
-            void like_pattern_length(int newValue) {
-                this->set(SQLITE_LIMIT_LIKE_PATTERN_LENGTH, newValue);
+            static const char *nested_savepoint_name() {
+                return "sqlite_orm_nested_transaction";
             }
 
-            int variable_number() {
-                return this->get(SQLITE_LIMIT_VARIABLE_NUMBER);
+            /**
+             *  Runs `f` inside a savepoint. Savepoints of nested calls have the same name which is fine
+             *  cause `RELEASE` and `ROLLBACK TO` find the innermost savepoint with the name.
+             */
+            bool nested_transaction(const std::function<bool()> &f) {
+                this->savepoint(nested_savepoint_name());
+                auto shouldCommit = false;
+                try {
+                    shouldCommit = f();
+                    if(!shouldCommit) {
+                        this->rollback_to_savepoint(nested_savepoint_name());
+                    }
+                } catch(...) {
+                    auto db = this->connection->get();
+                    if(!sqlite3_get_autocommit(db)) {
+                        try {
+                            this->rollback_to_savepoint(nested_savepoint_name());
+                            this->perform_savepoint_statement(db, "RELEASE SAVEPOINT ", nested_savepoint_name());
+                        } catch(...) {
+                        }
+                    }
+                    if(sqlite3_get_autocommit(db)) {
+                        this->transactionThreadId = std::thread::id();
+                    }
+                    this->connection->release();
+                    throw;
+                }
+                this->release_savepoint(nested_savepoint_name());
+                return shouldCommit;
             }
 
-            void variable_number(int newValue) {
-                this->set(SQLITE_LIMIT_VARIABLE_NUMBER, newValue);
+            void perform_savepoint_statement(sqlite3 *db, const char *statement, const std::string &name) {
+                auto query = statement + quote_identifier(name);
+                auto rc = sqlite3_exec(db, query.c_str(), nullptr, nullptr, nullptr);
+                if(rc != SQLITE_OK) {
+                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(db));
+                }
             }
 
-            int trigger_depth() {
-                return this->get(SQLITE_LIMIT_TRIGGER_DEPTH);
+            /**
+             *  Ends a transaction begun by `begin_transaction` after a failure. `COMMIT` failed with SQLITE_BUSY
+             *  leaves the transaction active and some errors roll it back automatically so `ROLLBACK` is
+             *  executed only if the transaction is still active. Errors of `ROLLBACK` are ignored.
+             */
+            void abort_transaction() {
+                auto db = this->connection->get();
+                if(db && !sqlite3_get_autocommit(db)) {
+                    sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr);
+                }
+                if(this->transactionThreadId == std::this_thread::get_id()) {
+                    this->transactionThreadId = std::thread::id();
+                    this->connection->release();
+                }
             }
 
-            void trigger_depth(int newValue) {
-                this->set(SQLITE_LIMIT_TRIGGER_DEPTH, newValue);
+            /**
+             *  Calls `f` until it doesn't throw an error for which `is_busy_error` is true or
+             *  `options.max_retries` retries are done. Sleeps for a backoff delay before every retry.
+             */
+            template<class F>
+            auto retry_busy(const transaction_options &options, const F &f) -> decltype(f()) {
+                for(auto attempt = 0;; ++attempt) {
+                    try {
+                        return f();
+                    } catch(const std::system_error &e) {
+                        if(attempt >= options.max_retries || !is_busy_error(e.code())) {
+                            throw;
+                        }
+                    }
+                    std::this_thread::sleep_for(backoff_delay(options.backoff, options.max_backoff, attempt));
+                }
             }
 
-#if SQLITE_VERSION_NUMBER >= 3008007
-            int worker_threads() {
-                return this->get(SQLITE_LIMIT_WORKER_THREADS);
+            std::string current_timestamp(sqlite3 *db) {
+                std::string res;
+                std::stringstream ss;
+                ss << "SELECT CURRENT_TIMESTAMP";
+                auto query = ss.str();
+                auto rc = sqlite3_exec(
+                    db,
+                    query.c_str(),
+                    [](void *data, int argc, char **argv, char **) -> int {
+                        auto &res = *(std::string *)data;
+                        if(argc) {
+                            if(argv[0]) {
+                                res = row_extractor<std::string>().extract(argv[0]);
+                            }
+                        }
+                        return 0;
+                    },
+                    &res,
+                    nullptr);
+                if(rc != SQLITE_OK) {
+                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(db));
+                }
+                return res;
             }
 
-            void worker_threads(int newValue) {
-                this->set(SQLITE_LIMIT_WORKER_THREADS, newValue);
+            void drop_table_internal(const std::string &tableName, sqlite3 *db) {
+                std::stringstream ss;
+                ss << "DROP TABLE '" << tableName + "'";
+                auto query = ss.str();
+                sqlite3_stmt *stmt;
+                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+                    statement_finalizer finalizer{stmt};
+                    if(sqlite3_step(stmt) == SQLITE_DONE) {
+                        //  done..
+                    } else {
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
+                    }
+                } else {
+                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                            sqlite3_errmsg(db));
+                }
             }
-#endif
-
-          protected:
-            get_connection_t get_connection;
-
-            friend struct storage_base;
 
             /**
-             *  Stores limit set between connections.
+             *  Returns the cached rows count estimate of `tableName` or reads it from `sqlite_stat1` once.
+             *  Returns 0 if nothing is known.
              */
-            std::map<int, int> limits;
-
-            int get(int id) {
-                auto connection = this->get_connection();
-                return sqlite3_limit(connection.get(), id, -1);
+            size_t rows_count_estimate(const std::string &tableName, sqlite3 *db) {
+                {
+                    std::lock_guard<std::mutex> lock(this->rowsCountEstimatesMutex);
+                    auto it = this->rowsCountEstimates.find(tableName);
+                    if(it != this->rowsCountEstimates.end()) {
+                        return it->second;
+                    }
+                }
+                auto res = this->stat1_rows_count(tableName, db);
+                std::lock_guard<std::mutex> lock(this->rowsCountEstimatesMutex);
+                return this->rowsCountEstimates.insert({tableName, res}).first->second;
             }
 
-            void set(int id, int newValue) {
-                this->limits[id] = newValue;
-                auto connection = this->get_connection();
-                sqlite3_limit(connection.get(), id, newValue);
+            void remember_rows_count(const std::string &tableName, size_t rowsCount) {
+                std::lock_guard<std::mutex> lock(this->rowsCountEstimatesMutex);
+                this->rowsCountEstimates[tableName] = rowsCount;
             }
-        };
-    }
-}
-
-// #include "transaction_guard.h"
-
-#include <functional>  //  std::function
-
-// #include "connection_holder.h"
-
-namespace sqlite_orm {
-
-    namespace internal {
 
-        /**
-         *  Class used as a guard for a transaction. Calls `ROLLBACK` in destructor.
-         *  Has explicit `commit()` and `rollback()` functions. After explicit function is fired
-         *  guard won't do anything in d-tor. Also you can set `commit_on_destroy` to true to
-         *  make it call `COMMIT` on destroy.
-         */
-        struct transaction_guard_t {
             /**
-             *  This is a public lever to tell a guard what it must do in its destructor
-             *  if `gotta_fire` is true
+             *  Every `sqlite_stat1` row of a table starts with the rows count of the table or of its index.
+             *  Partial indexes have fewer rows so the maximum is taken. Returns 0 if `ANALYZE` was never run.
              */
-            bool commit_on_destroy = false;
-
-            transaction_guard_t(connection_ref connection_,
-                                std::function<void()> commit_func_,
-                                std::function<void()> rollback_func_) :
-                connection(std::move(connection_)),
-                commit_func(std::move(commit_func_)), rollback_func(std::move(rollback_func_)) {}
-
-            ~transaction_guard_t() {
-                if(this->gotta_fire) {
-                    if(!this->commit_on_destroy) {
-                        this->rollback_func();
-                    } else {
-                        this->commit_func();
+            size_t stat1_rows_count(const std::string &tableName, sqlite3 *db) {
+                auto query = "SELECT MAX(CAST(stat AS INTEGER)) FROM sqlite_stat1 WHERE tbl = ?";
+                sqlite3_stmt *stmt;
+                if(sqlite3_prepare_v2(db, query, -1, &stmt, nullptr) != SQLITE_OK) {
+                    return 0;  //  no sqlite_stat1 table
+                }
+                statement_finalizer finalizer{stmt};
+                size_t res = 0;
+                if(sqlite3_bind_text(stmt, 1, tableName.c_str(), int(tableName.size()), SQLITE_STATIC) == SQLITE_OK &&
+                   sqlite3_step(stmt) == SQLITE_ROW) {
+                    auto rowsCount = sqlite3_column_int64(stmt, 0);
+                    if(rowsCount > 0) {
+                        res = size_t(rowsCount);
                     }
                 }
+                return res;
             }
 
-            /**
-             *  Call `COMMIT` explicitly. After this call
-             *  guard will not call `COMMIT` or `ROLLBACK`
-             *  in its destructor.
-             */
-            void commit() {
-                this->commit_func();
-                this->gotta_fire = false;
+            template<class S>
+            std::string process_order_by(const conditions::dynamic_order_by_t<S> &orderBy) const {
+                std::vector<std::string> expressions;
+                for(auto &entry: orderBy) {
+                    std::string entryString;
+                    {
+                        std::stringstream ss;
+                        ss << entry.name << " ";
+                        if(!entry._collate_argument.empty()) {
+                            ss << "COLLATE " << entry._collate_argument << " ";
+                        }
+                        switch(entry.asc_desc) {
+                            case 1:
+                                ss << "ASC";
+                                break;
+                            case -1:
+                                ss << "DESC";
+                                break;
+                        }
+                        entryString = ss.str();
+                    }
+                    expressions.push_back(move(entryString));
+                };
+                std::stringstream ss;
+                ss << static_cast<std::string>(orderBy) << " ";
+                for(size_t i = 0; i < expressions.size(); ++i) {
+                    ss << expressions[i];
+                    if(i < expressions.size() - 1) {
+                        ss << ", ";
+                    }
+                }
+                ss << " ";
+                return ss.str();
             }
 
-            /**
-             *  Call `ROLLBACK` explicitly. After this call
-             *  guard will not call `COMMIT` or `ROLLBACK`
-             *  in its destructor.
-             */
-            void rollback() {
-                this->rollback_func();
-                this->gotta_fire = false;
+            static int collate_callback(void *arg, int leftLen, const void *lhs, int rightLen, const void *rhs) {
+                auto &f = *(collating_function *)arg;
+                return f(leftLen, lhs, rightLen, rhs);
             }
 
-          protected:
-            connection_ref connection;
-            std::function<void()> commit_func;
-            std::function<void()> rollback_func;
-            bool gotta_fire = true;
+            //  returns foreign keys count in storage definition
+            template<class T>
+            static int foreign_keys_count(T &storageImpl) {
+                auto res = 0;
+                storageImpl.for_each([&res](auto impl) {
+                    res += impl->foreign_keys_count();
+                });
+                return res;
+            }
         };
     }
 }
 
-// #include "statement_finalizer.h"
+// #include "prepared_statement.h"
 
-// #include "type_printer.h"
+// #include "expression_object_type.h"
 
-// #include "tuple_helper.h"
+#include <type_traits>  //  std::decay
+#include <functional>  //  std::reference_wrapper
 
-// #include "row_extractor.h"
+// #include "prepared_statement.h"
 
-// #include "connection_holder.h"
+namespace sqlite_orm {
 
-// #include "backup.h"
+    namespace internal {
 
-#include <sqlite3.h>
-#include <string>  //  std::string
-#include <memory>
+        template<class T, class SFINAE = void>
+        struct expression_object_type;
 
-// #include "error_code.h"
+        template<class T>
+        struct expression_object_type<update_t<T>> {
+            using type = typename std::decay<T>::type;
+        };
 
-// #include "connection_holder.h"
+        template<class T>
+        struct expression_object_type<update_t<std::reference_wrapper<T>>> {
+            using type = typename std::decay<T>::type;
+        };
 
-namespace sqlite_orm {
+        template<class T>
+        struct expression_object_type<replace_t<T>> {
+            using type = typename std::decay<T>::type;
+        };
 
-    namespace internal {
+        template<class T>
+        struct expression_object_type<replace_t<std::reference_wrapper<T>>> {
+            using type = typename std::decay<T>::type;
+        };
 
-        /**
-         *  A backup class. Don't construct it as is, call storage.make_backup_from or storage.make_backup_to instead.
-         *  An instance of this class represents a wrapper around sqlite3_backup pointer. Use this class
-         *  to have maximum control on a backup operation. In case you need a single backup in one line you
-         *  can skip creating a backup_t instance and just call storage.backup_from or storage.backup_to function.
-         */
-        struct backup_t {
-            backup_t(connection_ref to_,
-                     const std::string &zDestName,
-                     connection_ref from_,
-                     const std::string &zSourceName,
-                     std::unique_ptr<connection_holder> holder_) :
-                handle(sqlite3_backup_init(to_.get(), zDestName.c_str(), from_.get(), zSourceName.c_str())),
-                holder(move(holder_)), to(to_), from(from_) {
-                if(!this->handle) {
-                    throw std::system_error(std::make_error_code(orm_error_code::failed_to_init_a_backup));
-                }
-            }
+        template<class T>
+        struct expression_object_type<insert_t<T>> {
+            using type = typename std::decay<T>::type;
+        };
 
-            backup_t(backup_t &&other) :
-                handle(other.handle), holder(move(other.holder)), to(other.to), from(other.from) {
-                other.handle = nullptr;
-            }
+        template<class T>
+        struct expression_object_type<insert_t<std::reference_wrapper<T>>> {
+            using type = typename std::decay<T>::type;
+        };
 
-            ~backup_t() {
-                if(this->handle) {
-                    (void)sqlite3_backup_finish(this->handle);
-                    this->handle = nullptr;
-                }
-            }
+        template<class T, class... Cols>
+        struct expression_object_type<insert_explicit<T, Cols...>> {
+            using type = typename std::decay<T>::type;
+        };
 
-            /**
-             *  Calls sqlite3_backup_step with pages argument
-             */
-            int step(int pages) {
-                return sqlite3_backup_step(this->handle, pages);
-            }
+        template<class T, class... Cols>
+        struct expression_object_type<insert_explicit<std::reference_wrapper<T>, Cols...>> {
+            using type = typename std::decay<T>::type;
+        };
 
-            /**
-             *  Returns sqlite3_backup_remaining result
-             */
-            int remaining() const {
-                return sqlite3_backup_remaining(this->handle);
-            }
+        template<class T>
+        struct get_ref_t {
 
-            /**
-             *  Returns sqlite3_backup_pagecount result
-             */
-            int pagecount() const {
-                return sqlite3_backup_pagecount(this->handle);
+            template<class O>
+            auto &operator()(O &t) const {
+                return t;
             }
+        };
 
-          protected:
-            sqlite3_backup *handle = nullptr;
-            std::unique_ptr<connection_holder> holder;
-            connection_ref to;
-            connection_ref from;
+        template<class T>
+        struct get_ref_t<std::reference_wrapper<T>> {
+
+            template<class O>
+            auto &operator()(O &t) const {
+                return t.get();
+            }
         };
-    }
-}
 
-namespace sqlite_orm {
+        template<class T>
+        auto &get_ref(T &t) {
+            using arg_type = typename std::decay<T>::type;
+            get_ref_t<arg_type> g;
+            return g(t);
+        }
+
+        template<class T>
+        struct get_object_t;
 
-    namespace internal {
+        template<class T>
+        struct get_object_t<const T> : get_object_t<T> {};
 
-        struct storage_base {
-            using collating_function = std::function<int(int, const void *, int, const void *)>;
+        template<class T>
+        auto &get_object(T &t) {
+            using expression_type = typename std::decay<T>::type;
+            get_object_t<expression_type> obj;
+            return obj(t);
+        }
 
-            std::function<void(sqlite3 *)> on_open;
-            pragma_t pragma;
-            limit_accesor limit;
+        template<class T>
+        struct get_object_t<replace_t<T>> {
+            using expression_type = replace_t<T>;
 
-            transaction_guard_t transaction_guard() {
-                this->begin_transaction();
-                auto commitFunc = std::bind(static_cast<void (storage_base::*)()>(&storage_base::commit), this);
-                auto rollbackFunc = std::bind(static_cast<void (storage_base::*)()>(&storage_base::rollback), this);
-                return {this->get_connection(), move(commitFunc), move(rollbackFunc)};
+            template<class O>
+            auto &operator()(O &e) const {
+                return get_ref(e.obj);
             }
+        };
 
-            void drop_index(const std::string &indexName) {
-                auto con = this->get_connection();
-                auto db = con.get();
-                std::stringstream ss;
-                ss << "DROP INDEX '" << indexName + "'";
-                auto query = ss.str();
-                sqlite3_stmt *stmt;
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    statement_finalizer finalizer{stmt};
-                    if(sqlite3_step(stmt) == SQLITE_DONE) {
-                        //  done..
-                    } else {
-                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(db));
-                    }
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
-            }
+        template<class T>
+        struct get_object_t<insert_t<T>> {
+            using expression_type = insert_t<T>;
 
-            void vacuum() {
-                auto con = this->get_connection();
-                auto db = con.get();
-                std::string query = "VACUUM";
-                sqlite3_stmt *stmt;
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    statement_finalizer finalizer{stmt};
-                    if(sqlite3_step(stmt) == SQLITE_DONE) {
-                        //  done..
-                    } else {
-                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(db));
-                    }
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            template<class O>
+            auto &operator()(O &e) const {
+                return get_ref(e.obj);
             }
+        };
 
-            /**
-             *  Drops table with given name.
-             */
-            void drop_table(const std::string &tableName) {
-                auto con = this->get_connection();
-                this->drop_table_internal(tableName, con.get());
-            }
+        template<class T>
+        struct get_object_t<update_t<T>> {
+            using expression_type = update_t<T>;
 
-            /**
-             *  sqlite3_changes function.
-             */
-            int changes() {
-                auto con = this->get_connection();
-                return sqlite3_changes(con.get());
+            template<class O>
+            auto &operator()(O &e) const {
+                return get_ref(e.obj);
             }
+        };
+    }
+}
 
-            /**
-             *  sqlite3_total_changes function.
-             */
-            int total_changes() {
-                auto con = this->get_connection();
-                return sqlite3_total_changes(con.get());
-            }
+// #include "bulk_loader.h"
 
-            int64 last_insert_rowid() {
-                auto con = this->get_connection();
-                return sqlite3_last_insert_rowid(con.get());
-            }
+#include <sqlite3.h>
+#include <vector>  //  std::vector
+#include <memory>  //  std::unique_ptr, std::make_unique
+#include <chrono>  //  std::chrono::steady_clock, std::chrono::milliseconds
+#include <utility>  //  std::move
 
-            int busy_timeout(int ms) {
-                auto con = this->get_connection();
-                return sqlite3_busy_timeout(con.get(), ms);
-            }
+// #include "journal_mode.h"
 
-            /**
-             *  Returns libsqltie3 lib version, not sqlite_orm
-             */
-            std::string libversion() {
-                return sqlite3_libversion();
-            }
+// #include "connection_holder.h"
 
-            bool transaction(std::function<bool()> f) {
-                this->begin_transaction();
-                auto con = this->get_connection();
-                auto db = con.get();
-                auto shouldCommit = f();
-                if(shouldCommit) {
-                    this->commit(db);
-                } else {
-                    this->rollback(db);
-                }
-                return shouldCommit;
-            }
+// #include "prepared_statement.h"
 
-            std::string current_timestamp() {
-                auto con = this->get_connection();
-                return this->current_timestamp(con.get());
-            }
+namespace sqlite_orm {
 
-#if SQLITE_VERSION_NUMBER >= 3007010
-            /**
-             * \fn db_release_memory
-             * \brief Releases freeable memory of database. It is function can/should be called periodically by
-             * application, if application has less memory usage constraint. \note sqlite3_db_release_memory added
-             * in 3.7.10 https://sqlite.org/changes.html
-             */
-            int db_release_memory() {
-                auto con = this->get_connection();
-                return sqlite3_db_release_memory(con.get());
-            }
-#endif
+    /**
+     *  Options of a loader created by `storage.bulk_loader<T>(options)`.
+     */
+    struct bulk_loader_options {
 
-            /**
-             *  Returns existing permanent table names in database. Doesn't check storage itself - works only with
-             * actual database.
-             *  @return Returns list of tables in database.
-             */
-            std::vector<std::string> table_names() {
-                auto con = this->get_connection();
-                std::vector<std::string> tableNames;
-                std::string sql = "SELECT name FROM sqlite_master WHERE type='table'";
-                using data_t = std::vector<std::string>;
-                auto db = con.get();
-                int res = sqlite3_exec(
-                    db,
-                    sql.c_str(),
-                    [](void *data, int argc, char **argv, char * * /*columnName*/) -> int {
-                        auto &tableNames = *(data_t *)data;
-                        for(int i = 0; i < argc; i++) {
-                            if(argv[i]) {
-                                tableNames.push_back(argv[i]);
-                            }
-                        }
-                        return 0;
-                    },
-                    &tableNames,
-                    nullptr);
+        /**
+         *  Max amount of rows inserted by a single INSERT statement. It is decreased if needed
+         *  to fit into SQLITE_LIMIT_VARIABLE_NUMBER.
+         */
+        size_t batch_size = 100;
 
-                if(res != SQLITE_OK) {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
-                return tableNames;
-            }
+        /**
+         *  Transaction is committed once this amount of rows is inserted in it. 0 means no limit.
+         */
+        size_t commit_rows = 100000;
 
-            void open_forever() {
-                this->isOpenedForever = true;
-                this->connection->retain();
-                if(1 == this->connection->retain_count()) {
-                    this->on_open_internal(this->connection->get());
-                }
-            }
+        /**
+         *  Transaction is committed once it is opened for this time. It is checked every time a batch
+         *  is inserted. 0 means no limit.
+         */
+        std::chrono::milliseconds commit_interval{0};
 
-            void create_collation(const std::string &name, collating_function f) {
-                collating_function *functionPointer = nullptr;
-                if(f) {
-                    functionPointer = &(collatingFunctions[name] = std::move(f));
-                } else {
-                    collatingFunctions.erase(name);
-                }
+        /**
+         *  `PRAGMA synchronous` value used while the loader exists. -1 means the current value is kept.
+         */
+        int synchronous = -1;
 
-                //  create collations if db is open
-                if(this->connection->retain_count() > 0) {
-                    auto db = this->connection->get();
-                    if(sqlite3_create_collation(db,
-                                                name.c_str(),
-                                                SQLITE_UTF8,
-                                                functionPointer,
-                                                f ? collate_callback : nullptr) != SQLITE_OK) {
-                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(db));
-                    }
-                }
-            }
+        /**
+         *  `PRAGMA journal_mode` value used while the loader exists. Null means the current value is kept.
+         */
+        std::unique_ptr<sqlite_orm::journal_mode> journal_mode;
+    };
 
-            void begin_transaction() {
-                this->connection->retain();
-                if(1 == this->connection->retain_count()) {
-                    this->on_open_internal(this->connection->get());
-                }
-                auto db = this->connection->get();
-                this->begin_transaction(db);
-            }
+    namespace internal {
 
-            void commit() {
-                auto db = this->connection->get();
-                this->commit(db);
-                this->connection->release();
-                if(this->connection->retain_count() < 0) {
-                    throw std::system_error(std::make_error_code(orm_error_code::no_active_transaction));
+        /**
+         *  Inserts objects pushed one by one with constant memory usage. Objects are buffered into
+         *  a batch which is inserted with a single `insert_range` statement once it is full. The statement
+         *  for a full batch is prepared once and reused. Rows are inserted inside a transaction which is
+         *  committed according to `bulk_loader_options`. Call `finish` to insert and commit the rest rows.
+         *  Otherwise uncommitted rows are rolled back in destructor just like `transaction_guard_t` does.
+         *  Loader cannot be created inside a transaction cause it commits its own transactions: storage throws
+         *  `orm_error_code::cannot_start_a_transaction_within_a_transaction` then. Loader must be used by
+         *  a single thread.
+         */
+        template<class S, class T>
+        struct bulk_loader_t {
+            using storage_type = S;
+            using object_type = T;
+            using buffer_type = std::vector<object_type>;
+            using statement_type = prepared_statement_t<insert_range_t<typename buffer_type::iterator>>;
+
+            bulk_loader_t(storage_type &storage_,
+                          connection_ref con_,
+                          bulk_loader_options options_,
+                          size_t batchSize_) :
+                storage(storage_), con(std::move(con_)), options(std::move(options_)), batchSize(batchSize_) {
+                auto db = this->con.get();
+                if(this->options.synchronous != -1) {
+                    this->previousSynchronous = this->storage.pragma.synchronous();
+                    this->storage.pragma.set_pragma("synchronous", this->options.synchronous, db);
                 }
-            }
-
-            void rollback() {
-                auto db = this->connection->get();
-                this->rollback(db);
-                this->connection->release();
-                if(this->connection->retain_count() < 0) {
-                    throw std::system_error(std::make_error_code(orm_error_code::no_active_transaction));
+                if(this->options.journal_mode) {
+                    auto previousJournalMode = this->storage.pragma.journal_mode();
+                    this->previousJournalMode = std::make_unique<sqlite_orm::journal_mode>(previousJournalMode);
+                    this->storage.pragma.set_pragma("journal_mode", *this->options.journal_mode, db);
                 }
+                this->buffer.reserve(this->batchSize);
+                this->begin();
             }
 
-            void backup_to(const std::string &filename) {
-                auto backup = this->make_backup_to(filename);
-                backup.step(-1);
-            }
-
-            void backup_to(storage_base &other) {
-                auto backup = this->make_backup_to(other);
-                backup.step(-1);
+            bulk_loader_t(bulk_loader_t &&other) :
+                storage(other.storage), con(other.con), options(std::move(other.options)),
+                batchSize(other.batchSize), buffer(std::move(other.buffer)), statement(std::move(other.statement)),
+                previousSynchronous(other.previousSynchronous),
+                previousJournalMode(std::move(other.previousJournalMode)), transactionStart(other.transactionStart),
+                rowsInTransaction(other.rowsInTransaction), rowsCount(other.rowsCount),
+                committedRowsCount(other.committedRowsCount), finished(other.finished) {
+                other.finished = true;
             }
 
-            void backup_from(const std::string &filename) {
-                auto backup = this->make_backup_from(filename);
-                backup.step(-1);
+            /**
+             *  Rolls back uncommitted rows and restores pragmas. Errors are ignored: the transaction may be
+             *  rolled back by sqlite already (e.g. SQLITE_FULL or `RAISE(ROLLBACK)` in a trigger).
+             */
+            ~bulk_loader_t() {
+                if(!this->finished) {
+                    this->statement.reset();
+                    try {
+                        this->storage.abort_transaction();
+                    } catch(...) {
+                    }
+                    try {
+                        this->restore_pragmas();
+                    } catch(...) {
+                    }
+                }
             }
 
-            void backup_from(storage_base &other) {
-                auto backup = this->make_backup_from(other);
-                backup.step(-1);
+            void push(const object_type &o) {
+                this->buffer.push_back(o);
+                this->on_pushed();
             }
 
-            backup_t make_backup_to(const std::string &filename) {
-                auto holder = std::make_unique<connection_holder>(filename);
-                return {connection_ref{*holder}, "main", this->get_connection(), "main", move(holder)};
+            void push(object_type &&o) {
+                this->buffer.push_back(std::move(o));
+                this->on_pushed();
             }
 
-            backup_t make_backup_to(storage_base &other) {
-                return {other.get_connection(), "main", this->get_connection(), "main", {}};
+            /**
+             *  Inserts buffered rows without waiting for the batch to be full.
+             */
+            void flush() {
+                this->insert_buffer();
+                auto commitByRows = this->options.commit_rows && this->rowsInTransaction >= this->options.commit_rows;
+                auto elapsed = std::chrono::steady_clock::now() - this->transactionStart;
+                auto commitByTime = this->options.commit_interval.count() && elapsed >= this->options.commit_interval;
+                if(commitByRows || commitByTime) {
+                    this->commit();
+                }
             }
 
-            backup_t make_backup_from(const std::string &filename) {
-                auto holder = std::make_unique<connection_holder>(filename);
-                return {this->get_connection(), "main", connection_ref{*holder}, "main", move(holder)};
+            /**
+             *  Inserts buffered rows, commits the current transaction and opens a new one.
+             */
+            void commit() {
+                this->insert_buffer();
+                this->storage.commit();
+                this->committedRowsCount += this->rowsInTransaction;
+                this->begin();
             }
 
-            backup_t make_backup_from(storage_base &other) {
-                return {this->get_connection(), "main", other.get_connection(), "main", {}};
+            /**
+             *  Inserts buffered rows, commits them and restores pragmas. Loader cannot be used after this call.
+             */
+            void finish() {
+                this->insert_buffer();
+                this->statement.reset();
+                this->storage.commit();
+                this->committedRowsCount += this->rowsInTransaction;
+                this->rowsInTransaction = 0;
+                this->finished = true;
+                this->restore_pragmas();
             }
 
-            const std::string &filename() const {
-                return this->connection->filename;
+            /**
+             *  @return amount of pushed rows.
+             */
+            size_t rows_count() const {
+                return this->rowsCount;
             }
 
-          protected:
-            storage_base(const std::string &filename_, int foreignKeysCount) :
-                pragma(std::bind(&storage_base::get_connection, this)),
-                limit(std::bind(&storage_base::get_connection, this)),
-                inMemory(filename_.empty() || filename_ == ":memory:"),
-                connection(std::make_unique<connection_holder>(filename_)), cachedForeignKeysCount(foreignKeysCount) {
-                if(this->inMemory) {
-                    this->connection->retain();
-                    this->on_open_internal(this->connection->get());
-                }
+            /**
+             *  @return amount of committed rows.
+             */
+            size_t committed_rows_count() const {
+                return this->committedRowsCount;
             }
 
-            storage_base(const storage_base &other) :
-                on_open(other.on_open), pragma(std::bind(&storage_base::get_connection, this)),
-                limit(std::bind(&storage_base::get_connection, this)), inMemory(other.inMemory),
-                connection(std::make_unique<connection_holder>(other.connection->filename)),
-                cachedForeignKeysCount(other.cachedForeignKeysCount) {
-                if(this->inMemory) {
-                    this->connection->retain();
-                    this->on_open_internal(this->connection->get());
-                }
+            /**
+             *  @return amount of rows inserted by a single statement.
+             */
+            size_t batch_size() const {
+                return this->batchSize;
             }
 
-            ~storage_base() {
-                if(this->isOpenedForever) {
-                    this->connection->release();
+          protected:
+            storage_type &storage;
+            connection_ref con;
+            bulk_loader_options options;
+            size_t batchSize = 0;
+            buffer_type buffer;
+            std::unique_ptr<statement_type> statement;
+            int previousSynchronous = -1;
+            std::unique_ptr<sqlite_orm::journal_mode> previousJournalMode;
+            std::chrono::steady_clock::time_point transactionStart;
+            size_t rowsInTransaction = 0;
+            size_t rowsCount = 0;
+            size_t committedRowsCount = 0;
+            bool finished = false;
+
+            void insert_buffer() {
+                if(this->buffer.empty()) {
+                    return;
                 }
-                if(this->inMemory) {
-                    this->connection->release();
+                if(this->buffer.size() == this->batchSize) {
+                    if(!this->statement) {
+                        this->statement = std::make_unique<statement_type>(
+                            this->storage.prepare(insert_range(this->buffer.begin(), this->buffer.end())));
+                    } else {
+                        this->statement->t.range = {this->buffer.begin(), this->buffer.end()};
+                    }
+                    this->storage.execute(*this->statement);
+                } else {
+                    auto partialStatement =
+                        this->storage.prepare(insert_range(this->buffer.begin(), this->buffer.end()));
+                    this->storage.execute(partialStatement);
                 }
+                this->rowsInTransaction += this->buffer.size();
+                this->buffer.clear();
             }
 
-            const bool inMemory;
-            bool isOpenedForever = false;
-            std::unique_ptr<connection_holder> connection;
-            std::map<std::string, collating_function> collatingFunctions;
-            const int cachedForeignKeysCount;
-
-            connection_ref get_connection() {
-                connection_ref res{*this->connection};
-                if(1 == this->connection->retain_count()) {
-                    this->on_open_internal(this->connection->get());
+            void on_pushed() {
+                ++this->rowsCount;
+                if(this->buffer.size() >= this->batchSize) {
+                    this->flush();
                 }
-                return res;
             }
 
-#if SQLITE_VERSION_NUMBER >= 3006019
-
-            void foreign_keys(sqlite3 *db, bool value) {
-                std::stringstream ss;
-                ss << "PRAGMA foreign_keys = " << value;
-                auto query = ss.str();
-                auto rc = sqlite3_exec(db, query.c_str(), nullptr, nullptr, nullptr);
-                if(rc != SQLITE_OK) {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            void begin() {
+                this->storage.begin_transaction();
+                this->transactionStart = std::chrono::steady_clock::now();
+                this->rowsInTransaction = 0;
             }
 
-            bool foreign_keys(sqlite3 *db) {
-                std::string query = "PRAGMA foreign_keys";
-                auto res = false;
-                auto rc = sqlite3_exec(
-                    db,
-                    query.c_str(),
-                    [](void *data, int argc, char **argv, char **) -> int {
-                        auto &res = *(bool *)data;
-                        if(argc) {
-                            res = row_extractor<bool>().extract(argv[0]);
-                        }
-                        return 0;
-                    },
-                    &res,
-                    nullptr);
-                if(rc != SQLITE_OK) {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
+            void restore_pragmas() {
+                auto db = this->con.get();
+                if(this->previousSynchronous != -1) {
+                    this->storage.pragma.set_pragma("synchronous", this->previousSynchronous, db);
+                }
+                if(this->previousJournalMode) {
+                    this->storage.pragma.set_pragma("journal_mode", *this->previousJournalMode, db);
                 }
-                return res;
             }
+        };
+    }
+}
 
-#endif
-            void on_open_internal(sqlite3 *db) {
+// #include "cursor.h"
 
-#if SQLITE_VERSION_NUMBER >= 3006019
-                if(this->cachedForeignKeysCount) {
-                    this->foreign_keys(db, true);
-                }
-#endif
-                if(this->pragma._synchronous != -1) {
-                    this->pragma.synchronous(this->pragma._synchronous);
-                }
+#include <sqlite3.h>
+#include <type_traits>  //  std::decay
+#include <system_error>  //  std::system_error
+#include <vector>  //  std::vector
+#include <utility>  //  std::move
 
-                if(this->pragma._journal_mode != -1) {
-                    this->pragma.set_pragma("journal_mode", static_cast<journal_mode>(this->pragma._journal_mode), db);
-                }
+// #include "row_extractor.h"
 
-                for(auto &p: this->collatingFunctions) {
-                    if(sqlite3_create_collation(db, p.first.c_str(), SQLITE_UTF8, &p.second, collate_callback) !=
-                       SQLITE_OK) {
-                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(db));
-                    }
-                }
+// #include "field_value_holder.h"
 
-                for(auto &p: this->limit.limits) {
-                    sqlite3_limit(db, p.first, p.second);
-                }
+// #include "error_code.h"
 
-                if(this->on_open) {
-                    this->on_open(db);
-                }
-            }
+// #include "prepared_statement.h"
 
-            void begin_transaction(sqlite3 *db) {
-                std::stringstream ss;
-                ss << "BEGIN TRANSACTION";
-                auto query = ss.str();
-                sqlite3_stmt *stmt;
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    statement_finalizer finalizer{stmt};
-                    if(sqlite3_step(stmt) == SQLITE_DONE) {
-                        //  done..
-                    } else {
-                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(db));
-                    }
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
-            }
+// #include "ast_iterator.h"
 
-            void commit(sqlite3 *db) {
-                std::stringstream ss;
-                ss << "COMMIT";
-                auto query = ss.str();
-                sqlite3_stmt *stmt;
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    statement_finalizer finalizer{stmt};
-                    if(sqlite3_step(stmt) == SQLITE_DONE) {
-                        //  done..
-                    } else {
-                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(db));
-                    }
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
-            }
+// #include "statement_binder.h"
 
-            void rollback(sqlite3 *db) {
-                std::stringstream ss;
-                ss << "ROLLBACK";
-                auto query = ss.str();
-                sqlite3_stmt *stmt;
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    statement_finalizer finalizer{stmt};
-                    if(sqlite3_step(stmt) == SQLITE_DONE) {
-                        //  done..
-                    } else {
-                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(db));
-                    }
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
-            }
+namespace sqlite_orm {
 
-            std::string current_timestamp(sqlite3 *db) {
-                std::string res;
-                std::stringstream ss;
-                ss << "SELECT CURRENT_TIMESTAMP";
-                auto query = ss.str();
-                auto rc = sqlite3_exec(
-                    db,
-                    query.c_str(),
-                    [](void *data, int argc, char **argv, char **) -> int {
-                        auto &res = *(std::string *)data;
-                        if(argc) {
-                            if(argv[0]) {
-                                res = row_extractor<std::string>().extract(argv[0]);
-                            }
-                        }
-                        return 0;
-                    },
-                    &res,
-                    nullptr);
-                if(rc != SQLITE_OK) {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
-                return res;
-            }
+    namespace internal {
 
-            void drop_table_internal(const std::string &tableName, sqlite3 *db) {
-                std::stringstream ss;
-                ss << "DROP TABLE '" << tableName + "'";
-                auto query = ss.str();
-                sqlite3_stmt *stmt;
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    statement_finalizer finalizer{stmt};
-                    if(sqlite3_step(stmt) == SQLITE_DONE) {
-                        //  done..
-                    } else {
-                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                                sqlite3_errmsg(db));
-                    }
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
-            }
+        /**
+         *  Forward only cursor created by `storage.stream<T>(conditions...)`. Unlike `iterate` it doesn't
+         *  allocate an object per row: every row is extracted into a single object owned by the cursor
+         *  or into elements of a caller provided vector. Strings and blobs are assigned in place so scanning
+         *  a table doesn't allocate once buffers have grown enough. Cursor owns its prepared statement so
+         *  it must be used by a single thread and must not outlive the storage.
+         */
+        template<class S, class T, class... Args>
+        struct cursor_t {
+            using storage_type = S;
+            using object_type = T;
+            using statement_type = prepared_statement_t<get_all_t<T, Args...>>;
 
-            template<class S>
-            std::string process_order_by(const conditions::dynamic_order_by_t<S> &orderBy) const {
-                std::vector<std::string> expressions;
-                for(auto &entry: orderBy) {
-                    std::string entryString;
-                    {
-                        std::stringstream ss;
-                        ss << entry.name << " ";
-                        if(!entry._collate_argument.empty()) {
-                            ss << "COLLATE " << entry._collate_argument << " ";
-                        }
-                        switch(entry.asc_desc) {
-                            case 1:
-                                ss << "ASC";
-                                break;
-                            case -1:
-                                ss << "DESC";
-                                break;
-                        }
-                        entryString = ss.str();
-                    }
-                    expressions.push_back(move(entryString));
-                };
-                std::stringstream ss;
-                ss << static_cast<std::string>(orderBy) << " ";
-                for(size_t i = 0; i < expressions.size(); ++i) {
-                    ss << expressions[i];
-                    if(i < expressions.size() - 1) {
-                        ss << ", ";
+            cursor_t(storage_type &storage_, statement_type statement_) :
+                storage(storage_), statement(std::move(statement_)) {
+                auto db = this->statement.con.get();
+                auto stmt = this->statement.stmt;
+                auto index = 1;
+                sqlite3_reset(stmt);
+                iterate_ast(this->statement.t, [stmt, &index, db](auto &node) {
+                    using node_type = typename std::decay<decltype(node)>::type;
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                    if(SQLITE_OK != binder(node)) {
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
                     }
+                });
+            }
+
+            cursor_t(cursor_t &&) = default;
+
+            /**
+             *  Steps to the next row and extracts it into `current()`.
+             *  @return false if there are no more rows.
+             */
+            bool next() {
+                if(!this->step()) {
+                    return false;
                 }
-                ss << " ";
-                return ss.str();
+                this->extract(this->object);
+                return true;
             }
 
-            static int collate_callback(void *arg, int leftLen, const void *lhs, int rightLen, const void *rhs) {
-                auto &f = *(collating_function *)arg;
-                return f(leftLen, lhs, rightLen, rhs);
+            /**
+             *  Extracts up to `n` next rows into `rows`. Existing elements of `rows` are overwritten so
+             *  their buffers are reused, new elements are appended only if `rows` is shorter than the amount
+             *  of extracted rows. `rows` is resized to the amount of extracted rows.
+             *  @return amount of extracted rows. 0 means there are no more rows.
+             */
+            size_t next(std::vector<object_type> &rows, size_t n) {
+                size_t count = 0;
+                while(count < n && this->step()) {
+                    if(count == rows.size()) {
+                        rows.emplace_back();
+                    }
+                    this->extract(rows[count]);
+                    ++count;
+                }
+                rows.resize(count);
+                return count;
             }
 
-            //  returns foreign keys count in storage definition
-            template<class T>
-            static int foreign_keys_count(T &storageImpl) {
-                auto res = 0;
-                storageImpl.for_each([&res](auto impl) {
-                    res += impl->foreign_keys_count();
+            /**
+             *  @return object extracted by the last successful `next()` call.
+             */
+            object_type &current() {
+                return this->object;
+            }
+
+            /**
+             *  @return true if all rows have been stepped.
+             */
+            bool done() const {
+                return this->isDone;
+            }
+
+          protected:
+            storage_type &storage;
+            statement_type statement;
+            object_type object;
+            bool isDone = false;
+
+            bool step() {
+                if(this->isDone) {
+                    return false;
+                }
+                auto stmt = this->statement.stmt;
+                auto stepRes = sqlite3_step(stmt);
+                switch(stepRes) {
+                    case SQLITE_ROW:
+                        return true;
+                    case SQLITE_DONE:
+                        this->isDone = true;
+                        return false;
+                    default: {
+                        auto db = this->statement.con.get();
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
+                    }
+                }
+            }
+
+            void extract(object_type &o) {
+                auto &impl = this->storage.template get_impl<object_type>();
+                auto stmt = this->statement.stmt;
+                auto index = 0;
+                impl.table.for_each_column([&index, &o, stmt](auto &c) {
+                    extract_column_value(c, o, stmt, index++);
                 });
-                return res;
             }
         };
     }
 }
 
-// #include "prepared_statement.h"
+// #include "columnar_result.h"
 
-// #include "expression_object_type.h"
+#include <sqlite3.h>
+#include <vector>  //  std::vector
+#include <tuple>  //  std::tuple, std::get, std::tuple_size, std::tuple_element
+#include <memory>  //  std::shared_ptr, std::unique_ptr
+#include <cstdint>  //  std::uint64_t
+#include <utility>  //  std::index_sequence, std::make_index_sequence
+#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
+#include <optional>  // std::optional
+#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
 
-#include <type_traits>  //  std::decay
-#include <functional>  //  std::reference_wrapper
+// #include "row_extractor.h"
 
-// #include "prepared_statement.h"
+// #include "column_result.h"
 
 namespace sqlite_orm {
 
     namespace internal {
 
-        template<class T, class SFINAE = void>
-        struct expression_object_type;
-
+        /**
+         *  Tells how a column of type `T` is stored in a `columnar_column`. Nullable types (`std::shared_ptr`,
+         *  `std::unique_ptr` and `std::optional`) are stored as plain values plus a null bitmap.
+         */
         template<class T>
-        struct expression_object_type<update_t<T>> {
-            using type = typename std::decay<T>::type;
+        struct columnar_traits {
+            using value_type = T;
+            static constexpr bool is_nullable = false;
         };
 
         template<class T>
-        struct expression_object_type<update_t<std::reference_wrapper<T>>> {
-            using type = typename std::decay<T>::type;
+        struct columnar_traits<std::shared_ptr<T>> {
+            using value_type = T;
+            static constexpr bool is_nullable = true;
         };
 
         template<class T>
-        struct expression_object_type<replace_t<T>> {
-            using type = typename std::decay<T>::type;
+        struct columnar_traits<std::unique_ptr<T>> {
+            using value_type = T;
+            static constexpr bool is_nullable = true;
         };
 
+#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
         template<class T>
-        struct expression_object_type<replace_t<std::reference_wrapper<T>>> {
-            using type = typename std::decay<T>::type;
+        struct columnar_traits<std::optional<T>> {
+            using value_type = T;
+            static constexpr bool is_nullable = true;
         };
+#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
 
+        /**
+         *  Values of a single result column stored contiguously. If the column type is nullable `null_bitmap`
+         *  has a bit for every row (bit `i % 64` of word `i / 64`) which is set if the row value is NULL.
+         *  Value of a NULL row is default constructed. For not nullable columns `null_bitmap` is empty.
+         */
         template<class T>
-        struct expression_object_type<insert_t<T>> {
-            using type = typename std::decay<T>::type;
-        };
+        struct columnar_column {
+            using traits = columnar_traits<T>;
+            using value_type = typename traits::value_type;
 
-        template<class T>
-        struct expression_object_type<insert_t<std::reference_wrapper<T>>> {
-            using type = typename std::decay<T>::type;
-        };
+            std::vector<value_type> values;
+            std::vector<std::uint64_t> null_bitmap;
 
-        template<class T, class... Cols>
-        struct expression_object_type<insert_explicit<T, Cols...>> {
-            using type = typename std::decay<T>::type;
-        };
+            size_t size() const {
+                return this->values.size();
+            }
 
-        template<class T, class... Cols>
-        struct expression_object_type<insert_explicit<std::reference_wrapper<T>, Cols...>> {
-            using type = typename std::decay<T>::type;
-        };
+            bool is_null(size_t index) const {
+                if(traits::is_nullable) {
+                    return (this->null_bitmap[index / 64] >> (index % 64)) & 1;
+                } else {
+                    return false;
+                }
+            }
 
-        template<class T>
-        struct get_ref_t {
+            void reserve(size_t n) {
+                this->values.reserve(n);
+                if(traits::is_nullable) {
+                    this->null_bitmap.reserve((n + 63) / 64);
+                }
+            }
 
-            template<class O>
-            auto &operator()(O &t) const {
-                return t;
+            void clear() {
+                this->values.clear();
+                this->null_bitmap.clear();
+            }
+
+            void push_back(sqlite3_stmt *stmt, int columnIndex) {
+                auto index = this->values.size();
+                if(traits::is_nullable) {
+                    if(index % 64 == 0) {
+                        this->null_bitmap.push_back(0);
+                    }
+                    if(sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
+                        this->null_bitmap.back() |= std::uint64_t(1) << (index % 64);
+                        this->values.emplace_back();
+                        return;
+                    }
+                }
+                this->values.push_back(row_extractor<value_type>().extract(stmt, columnIndex));
             }
         };
 
-        template<class T>
-        struct get_ref_t<std::reference_wrapper<T>> {
+        /**
+         *  Struct-of-arrays result of `storage.select_columns(columns(...), ...)`. Every selected column
+         *  is stored in its own `columnar_column` so its values are contiguous in memory.
+         *  Usage: `auto res = storage.select_columns(columns(&User::id, &User::age));
+         *          const std::vector<int> &ages = res.values<1>();`
+         */
+        template<class... Ts>
+        struct columnar_result {
+            using columns_type = std::tuple<columnar_column<Ts>...>;
 
-            template<class O>
-            auto &operator()(O &t) const {
-                return t.get();
+            static constexpr const int count = std::tuple_size<columns_type>::value;
+
+            columns_type columns;
+
+            template<size_t I>
+            typename std::tuple_element<I, columns_type>::type &column() {
+                return std::get<I>(this->columns);
             }
-        };
 
-        template<class T>
-        auto &get_ref(T &t) {
-            using arg_type = typename std::decay<T>::type;
-            get_ref_t<arg_type> g;
-            return g(t);
-        }
+            template<size_t I>
+            const typename std::tuple_element<I, columns_type>::type &column() const {
+                return std::get<I>(this->columns);
+            }
 
-        template<class T>
-        struct get_object_t;
+            template<size_t I>
+            const auto &values() const {
+                return std::get<I>(this->columns).values;
+            }
 
-        template<class T>
-        struct get_object_t<const T> : get_object_t<T> {};
+            /**
+             *  @return amount of rows.
+             */
+            size_t size() const {
+                return std::get<0>(this->columns).size();
+            }
 
-        template<class T>
-        auto &get_object(T &t) {
-            using expression_type = typename std::decay<T>::type;
-            get_object_t<expression_type> obj;
-            return obj(t);
-        }
+            bool empty() const {
+                return !this->size();
+            }
 
-        template<class T>
-        struct get_object_t<replace_t<T>> {
-            using expression_type = replace_t<T>;
+            void reserve(size_t n) {
+                this->for_each_column([n](auto &column) {
+                    column.reserve(n);
+                });
+            }
 
-            template<class O>
-            auto &operator()(O &e) const {
-                return get_ref(e.obj);
+            void clear() {
+                this->for_each_column([](auto &column) {
+                    column.clear();
+                });
             }
-        };
 
-        template<class T>
-        struct get_object_t<insert_t<T>> {
-            using expression_type = insert_t<T>;
+            /**
+             *  Appends the current row of `stmt`. Column `i` of the statement is appended to column `i`.
+             */
+            void push_back(sqlite3_stmt *stmt) {
+                auto index = 0;
+                this->for_each_column([stmt, &index](auto &column) {
+                    column.push_back(stmt, index++);
+                });
+            }
 
-            template<class O>
-            auto &operator()(O &e) const {
-                return get_ref(e.obj);
+          protected:
+            template<class L>
+            void for_each_column(const L &l) {
+                this->for_each_column(l, std::make_index_sequence<count>{});
+            }
+
+            template<class L, size_t... Is>
+            void for_each_column(const L &l, std::index_sequence<Is...>) {
+                using expander = int[];
+                (void)expander{0, (l(std::get<Is>(this->columns)), 0)...};
             }
         };
 
         template<class T>
-        struct get_object_t<update_t<T>> {
-            using expression_type = update_t<T>;
+        struct columnar_result_type;
 
-            template<class O>
-            auto &operator()(O &e) const {
-                return get_ref(e.obj);
+        template<class... Ts>
+        struct columnar_result_type<std::tuple<Ts...>> {
+            using type = columnar_result<Ts...>;
+        };
+
+        /**
+         *  `columnar_result` type of columns `C` selected from storage `St`.
+         */
+        template<class St, class C>
+        using columnar_result_t = typename columnar_result_type<typename column_result_t<St, C>::type>::type;
+    }
+}
+
+// #include "row_view.h"
+
+#include <sqlite3.h>
+
+// #include "row_extractor.h"
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  Current row of a statement passed to `storage.visit` callback. Values are extracted lazily
+         *  with `get<V>(columnIndex)`. `V` may be a view type (`std::string_view` or `blob_view`) which
+         *  points into sqlite's column buffer without copying. Views are valid only inside the callback.
+         */
+        struct row_view {
+
+            row_view(sqlite3_stmt *stmt_) : stmt(stmt_) {}
+
+            template<class V>
+            V get(int columnIndex) const {
+                return row_extractor<V>().extract(this->stmt, columnIndex);
+            }
+
+            bool is_null(int columnIndex) const {
+                return sqlite3_column_type(this->stmt, columnIndex) == SQLITE_NULL;
+            }
+
+            int columns_count() const {
+                return sqlite3_column_count(this->stmt);
             }
+
+          protected:
+            sqlite3_stmt *stmt = nullptr;
         };
     }
 }
@@ -8861,8 +12907,38 @@ namespace sqlite_orm {
             storage_t(const std::string &filename, impl_type impl_) :
                 storage_base{filename, foreign_keys_count(impl_)}, impl(std::move(impl_)) {}
 
+            /**
+             *  @param filename database filename.
+             *  @param poolOptions reader connections options.
+             *  @param impl_ storage_impl head
+             */
+            storage_t(const std::string &filename, pool_options poolOptions, impl_type impl_) :
+                storage_base{filename, foreign_keys_count(impl_), poolOptions}, impl(std::move(impl_)) {}
+
+            /**
+             *  @param filename database filename.
+             *  @param openOptions `sqlite3_open_v2` arguments.
+             *  @param poolOptions reader connections options.
+             *  @param impl_ storage_impl head
+             */
+            storage_t(const std::string &filename,
+                      open_options openOptions,
+                      pool_options poolOptions,
+                      impl_type impl_) :
+                storage_base{filename, foreign_keys_count(impl_), poolOptions, std::move(openOptions)},
+                impl(std::move(impl_)) {}
+
             storage_t(const storage_t &other) : storage_base(other), impl(other.impl) {}
 
+            /**
+             *  Write queue executes functions which use this storage so it must be stopped
+             *  before storage members are destroyed. The same is true for WAL checkpointer thread.
+             */
+            ~storage_t() {
+                this->stop_write_queue();
+                this->stop_wal_checkpointer();
+            }
+
           protected:
             impl_type impl;
 
@@ -8875,8 +12951,14 @@ namespace sqlite_orm {
             template<class V>
             friend struct iterator_t;
 
-            template<class O, class T, class G, class S, class... Op>
-            std::string serialize_column_schema(const internal::column_t<O, T, G, S, Op...> &c) {
+            template<class S, class T, class... Args>
+            friend struct cursor_t;
+
+            template<class S, class T>
+            friend struct bulk_loader_t;
+
+            template<class O, class T, class G, class S, class A, class... Op>
+            std::string serialize_column_schema(const internal::column_t<O, T, G, S, A, Op...> &c) {
                 std::stringstream ss;
                 ss << "'" << c.name << "' ";
                 using column_type = typename std::decay<decltype(c)>::type;
@@ -9483,35 +13565,49 @@ namespace sqlite_orm {
                 return ss.str();
             }
 
+            /**
+             *  @return `kind` SQL text of a table cached in `impl`. `serialize` is called only once to create it.
+             */
+            template<class I, class F>
+            const std::string &static_sql(I &impl, static_sql_cache::statement_kind kind, const F &serialize) const {
+                return impl.staticSql.get(kind, [this, &serialize] {
+                    auto sql = serialize();
+                    ++this->staticSqlSerializationsCount;
+                    return sql;
+                });
+            }
+
             // Common code for statements with conditions: get_t, get_pointer_t, get_optional_t.
             template<class T>
             std::string string_from_expression_impl_get(bool /*noTableName*/) const {
                 auto &impl = this->get_impl<T>();
-                std::stringstream ss;
-                ss << "SELECT ";
-                auto columnNames = impl.table.column_names();
-                for(size_t i = 0; i < columnNames.size(); ++i) {
-                    ss << "\"" << columnNames[i] << "\"";
-                    if(i < columnNames.size() - 1) {
-                        ss << ",";
-                    }
-                    ss << " ";
-                }
-                ss << "FROM '" << impl.table.name << "' WHERE ";
-                auto primaryKeyColumnNames = impl.table.primary_key_column_names();
-                if(!primaryKeyColumnNames.empty()) {
-                    for(size_t i = 0; i < primaryKeyColumnNames.size(); ++i) {
-                        ss << "\"" << primaryKeyColumnNames[i] << "\""
-                           << " = ? ";
-                        if(i < primaryKeyColumnNames.size() - 1) {
-                            ss << "AND ";
+                return this->static_sql(impl, static_sql_cache::get_statement, [&impl] {
+                    std::stringstream ss;
+                    ss << "SELECT ";
+                    auto columnNames = impl.table.column_names();
+                    for(size_t i = 0; i < columnNames.size(); ++i) {
+                        ss << "\"" << columnNames[i] << "\"";
+                        if(i < columnNames.size() - 1) {
+                            ss << ",";
+                        }
+                        ss << " ";
+                    }
+                    ss << "FROM '" << impl.table.name << "' WHERE ";
+                    auto primaryKeyColumnNames = impl.table.primary_key_column_names();
+                    if(!primaryKeyColumnNames.empty()) {
+                        for(size_t i = 0; i < primaryKeyColumnNames.size(); ++i) {
+                            ss << "\"" << primaryKeyColumnNames[i] << "\""
+                               << " = ? ";
+                            if(i < primaryKeyColumnNames.size() - 1) {
+                                ss << "AND ";
+                            }
+                            ss << ' ';
                         }
-                        ss << ' ';
+                        return ss.str();
+                    } else {
+                        throw std::system_error(std::make_error_code(orm_error_code::table_has_no_primary_key_column));
                     }
-                    return ss.str();
-                } else {
-                    throw std::system_error(std::make_error_code(orm_error_code::table_has_no_primary_key_column));
-                }
+                });
             }
 
             template<class T, class... Ids>
@@ -9537,50 +13633,54 @@ namespace sqlite_orm {
                 using object_type = typename expression_object_type<expression_type>::type;
                 auto &impl = this->get_impl<object_type>();
 
-                std::stringstream ss;
-                ss << "UPDATE '" << impl.table.name << "' SET ";
-                std::vector<std::string> setColumnNames;
-                impl.table.for_each_column([&setColumnNames](auto &c) {
-                    if(!c.template has<constraints::primary_key_t<>>()) {
-                        setColumnNames.emplace_back(c.name);
-                    }
-                });
-                for(size_t i = 0; i < setColumnNames.size(); ++i) {
-                    ss << "\"" << setColumnNames[i] << "\""
-                       << " = ?";
-                    if(i < setColumnNames.size() - 1) {
-                        ss << ",";
+                return this->static_sql(impl, static_sql_cache::update_statement, [&impl] {
+                    std::stringstream ss;
+                    ss << "UPDATE '" << impl.table.name << "' SET ";
+                    std::vector<std::string> setColumnNames;
+                    impl.table.for_each_column([&setColumnNames](auto &c) {
+                        if(!c.template has<constraints::primary_key_t<>>()) {
+                            setColumnNames.emplace_back(c.name);
+                        }
+                    });
+                    for(size_t i = 0; i < setColumnNames.size(); ++i) {
+                        ss << "\"" << setColumnNames[i] << "\""
+                           << " = ?";
+                        if(i < setColumnNames.size() - 1) {
+                            ss << ",";
+                        }
+                        ss << " ";
                     }
-                    ss << " ";
-                }
-                ss << "WHERE ";
-                auto primaryKeyColumnNames = impl.table.primary_key_column_names();
-                for(size_t i = 0; i < primaryKeyColumnNames.size(); ++i) {
-                    ss << "\"" << primaryKeyColumnNames[i] << "\""
-                       << " = ?";
-                    if(i < primaryKeyColumnNames.size() - 1) {
-                        ss << " AND";
+                    ss << "WHERE ";
+                    auto primaryKeyColumnNames = impl.table.primary_key_column_names();
+                    for(size_t i = 0; i < primaryKeyColumnNames.size(); ++i) {
+                        ss << "\"" << primaryKeyColumnNames[i] << "\""
+                           << " = ?";
+                        if(i < primaryKeyColumnNames.size() - 1) {
+                            ss << " AND";
+                        }
+                        ss << " ";
                     }
-                    ss << " ";
-                }
-                return ss.str();
+                    return ss.str();
+                });
             }
 
             template<class T, class... Ids>
             std::string string_from_expression(const remove_t<T, Ids...> &, bool /*noTableName*/) const {
                 auto &impl = this->get_impl<T>();
-                std::stringstream ss;
-                ss << "DELETE FROM '" << impl.table.name << "' ";
-                ss << "WHERE ";
-                auto primaryKeyColumnNames = impl.table.primary_key_column_names();
-                for(size_t i = 0; i < primaryKeyColumnNames.size(); ++i) {
-                    ss << "\"" << primaryKeyColumnNames[i] << "\""
-                       << " = ? ";
-                    if(i < primaryKeyColumnNames.size() - 1) {
-                        ss << "AND ";
+                return this->static_sql(impl, static_sql_cache::remove_statement, [&impl] {
+                    std::stringstream ss;
+                    ss << "DELETE FROM '" << impl.table.name << "' ";
+                    ss << "WHERE ";
+                    auto primaryKeyColumnNames = impl.table.primary_key_column_names();
+                    for(size_t i = 0; i < primaryKeyColumnNames.size(); ++i) {
+                        ss << "\"" << primaryKeyColumnNames[i] << "\""
+                           << " = ? ";
+                        if(i < primaryKeyColumnNames.size() - 1) {
+                            ss << "AND ";
+                        }
                     }
-                }
-                return ss.str();
+                    return ss.str();
+                });
             }
 
             template<class T, class... Cols>
@@ -9632,23 +13732,63 @@ namespace sqlite_orm {
                 using object_type = typename expression_object_type<expression_type>::type;
                 this->assert_mapped_type<object_type>();
                 auto &impl = this->get_impl<object_type>();
-                std::stringstream ss;
-                ss << "INSERT INTO '" << impl.table.name << "' ";
-                std::vector<std::string> columnNames;
-                auto compositeKeyColumnNames = impl.table.composite_key_columns_names();
+                return this->static_sql(impl, static_sql_cache::insert_statement, [&impl] {
+                    std::stringstream ss;
+                    ss << "INSERT INTO '" << impl.table.name << "' ";
+                    std::vector<std::string> columnNames;
+                    auto compositeKeyColumnNames = impl.table.composite_key_columns_names();
+
+                    impl.table.for_each_column([&impl, &columnNames, &compositeKeyColumnNames](auto &c) {
+                        if(impl.table._without_rowid || !c.template has<constraints::primary_key_t<>>()) {
+                            auto it = std::find(compositeKeyColumnNames.begin(), compositeKeyColumnNames.end(), c.name);
+                            if(it == compositeKeyColumnNames.end()) {
+                                columnNames.emplace_back(c.name);
+                            }
+                        }
+                    });
 
-                impl.table.for_each_column([&impl, &columnNames, &compositeKeyColumnNames](auto &c) {
-                    if(impl.table._without_rowid || !c.template has<constraints::primary_key_t<>>()) {
-                        auto it = std::find(compositeKeyColumnNames.begin(), compositeKeyColumnNames.end(), c.name);
-                        if(it == compositeKeyColumnNames.end()) {
-                            columnNames.emplace_back(c.name);
+                    auto columnNamesCount = columnNames.size();
+                    if(columnNamesCount) {
+                        ss << "(";
+                        for(size_t i = 0; i < columnNamesCount; ++i) {
+                            ss << "\"" << columnNames[i] << "\"";
+                            if(i < columnNamesCount - 1) {
+                                ss << ",";
+                            } else {
+                                ss << ")";
+                            }
+                            ss << " ";
+                        }
+                    } else {
+                        ss << "DEFAULT ";
+                    }
+                    ss << "VALUES ";
+                    if(columnNamesCount) {
+                        ss << "(";
+                        for(size_t i = 0; i < columnNamesCount; ++i) {
+                            ss << "?";
+                            if(i < columnNamesCount - 1) {
+                                ss << ", ";
+                            } else {
+                                ss << ")";
+                            }
                         }
                     }
+                    return ss.str();
                 });
+            }
 
-                auto columnNamesCount = columnNames.size();
-                if(columnNamesCount) {
-                    ss << "(";
+            template<class T>
+            std::string string_from_expression(const replace_t<T> &rep, bool /*noTableName*/) const {
+                using expression_type = typename std::decay<decltype(rep)>::type;
+                using object_type = typename expression_object_type<expression_type>::type;
+                this->assert_mapped_type<object_type>();
+                auto &impl = this->get_impl<object_type>();
+                return this->static_sql(impl, static_sql_cache::replace_statement, [&impl] {
+                    std::stringstream ss;
+                    ss << "REPLACE INTO '" << impl.table.name << "' (";
+                    auto columnNames = impl.table.column_names();
+                    auto columnNamesCount = columnNames.size();
                     for(size_t i = 0; i < columnNamesCount; ++i) {
                         ss << "\"" << columnNames[i] << "\"";
                         if(i < columnNamesCount - 1) {
@@ -9658,12 +13798,7 @@ namespace sqlite_orm {
                         }
                         ss << " ";
                     }
-                } else {
-                    ss << "DEFAULT ";
-                }
-                ss << "VALUES ";
-                if(columnNamesCount) {
-                    ss << "(";
+                    ss << "VALUES(";
                     for(size_t i = 0; i < columnNamesCount; ++i) {
                         ss << "?";
                         if(i < columnNamesCount - 1) {
@@ -9672,39 +13807,8 @@ namespace sqlite_orm {
                             ss << ")";
                         }
                     }
-                }
-                return ss.str();
-            }
-
-            template<class T>
-            std::string string_from_expression(const replace_t<T> &rep, bool /*noTableName*/) const {
-                using expression_type = typename std::decay<decltype(rep)>::type;
-                using object_type = typename expression_object_type<expression_type>::type;
-                this->assert_mapped_type<object_type>();
-                auto &impl = this->get_impl<object_type>();
-                std::stringstream ss;
-                ss << "REPLACE INTO '" << impl.table.name << "' (";
-                auto columnNames = impl.table.column_names();
-                auto columnNamesCount = columnNames.size();
-                for(size_t i = 0; i < columnNamesCount; ++i) {
-                    ss << "\"" << columnNames[i] << "\"";
-                    if(i < columnNamesCount - 1) {
-                        ss << ",";
-                    } else {
-                        ss << ")";
-                    }
-                    ss << " ";
-                }
-                ss << "VALUES(";
-                for(size_t i = 0; i < columnNamesCount; ++i) {
-                    ss << "?";
-                    if(i < columnNamesCount - 1) {
-                        ss << ", ";
-                    } else {
-                        ss << ")";
-                    }
-                }
-                return ss.str();
+                    return ss.str();
+                });
             }
 
             template<class It>
@@ -10128,10 +14232,24 @@ namespace sqlite_orm {
             view_t<T, self, Args...> iterate(Args &&... args) {
                 this->assert_mapped_type<T>();
 
-                auto con = this->get_connection();
+                auto con = this->get_read_connection();
                 return {*this, std::move(con), std::forward<Args>(args)...};
             }
 
+            /**
+             *  Creates a forward only cursor over `T` rows filtered by `args` (conditions like in `get_all`).
+             *  Cursor reuses a single object (`next()`/`current()`) or a caller provided vector
+             *  (`next(rows, n)`) instead of allocating an object per row.
+             *  Usage: `auto cursor = storage.stream<User>(where(c(&User::id) > 10));
+             *          while(cursor.next()) { auto &user = cursor.current(); }`
+             */
+            template<class T, class... Args>
+            cursor_t<self, T, Args...> stream(Args... args) {
+                this->assert_mapped_type<T>();
+                auto statement = this->prepare(sqlite_orm::get_all<T>(std::move(args)...));
+                return {*this, std::move(statement)};
+            }
+
             template<class O, class... Args>
             void remove_all(Args &&... args) {
                 this->assert_mapped_type<O>();
@@ -10474,6 +14592,29 @@ namespace sqlite_orm {
                 }
             }
 
+            /**
+             *  Result of a query without conditions other than `order_by` contains all rows of the table.
+             */
+            template<class Conditions>
+            struct selects_whole_table {
+                static constexpr const bool value =
+                    count_tuple<Conditions, conditions::is_order_by>::value == int(std::tuple_size<Conditions>::value);
+            };
+
+            template<class Conditions, class C>
+            void reserve_result(const std::string &tableName, sqlite3 *db, C &res) {
+                if(this->resultSizeEstimateEnabled && selects_whole_table<Conditions>::value) {
+                    reserve_container(res, this->rows_count_estimate(tableName, db));
+                }
+            }
+
+            template<class Conditions>
+            void remember_result_size(const std::string &tableName, size_t size) {
+                if(this->resultSizeEstimateEnabled && selects_whole_table<Conditions>::value) {
+                    this->remember_rows_count(tableName, size);
+                }
+            }
+
           public:
             /**
              *  Select * with no conditions routine.
@@ -10487,6 +14628,19 @@ namespace sqlite_orm {
                 return this->execute(statement);
             }
 
+            /**
+             *  The same as `get_all` but puts objects into a caller provided container. The container is cleared
+             *  first and keeps its capacity so reusing it across calls avoids reallocations.
+             *  Usage: `storage.get_all<User>(into(users), where(...));`
+             *  @return `target.container`
+             */
+            template<class O, class C, class... Args>
+            C &get_all(into_t<C> target, Args &&... args) {
+                this->assert_mapped_type<O>();
+                auto statement = this->prepare(sqlite_orm::get_all<O>(std::forward<Args>(args)...));
+                return this->execute(statement, target);
+            }
+
             /**
              *  Select * with no conditions routine.
              *  O is an object type to be extracted. Must be specified explicitly.
@@ -10499,6 +14653,18 @@ namespace sqlite_orm {
                 return this->execute(statement);
             }
 
+            /**
+             *  The same as `get_all_pointer` but puts pointers into a caller provided container which is cleared
+             *  first.
+             *  @return `target.container`
+             */
+            template<class O, class C, class... Args>
+            C &get_all_pointer(into_t<C> target, Args &&... args) {
+                this->assert_mapped_type<O>();
+                auto statement = this->prepare(sqlite_orm::get_all_pointer<O>(std::forward<Args>(args)...));
+                return this->execute(statement, target);
+            }
+
             /**
              *  Select * by id routine.
              *  throws std::system_error(orm_error_code::not_found, orm_error_category) if object not found with given
@@ -10728,6 +14894,81 @@ namespace sqlite_orm {
                 return this->execute(statement);
             }
 
+            /**
+             *  The same as `select` but puts rows into a caller provided container. The container is cleared
+             *  first and keeps its capacity.
+             *  Usage: `storage.select(into(ids), &User::id, where(...));`
+             *  @return `target.container`
+             */
+            template<class C, class T, class... Args>
+            C &select(into_t<C> target, T m, Args... args) {
+                static_assert(!is_base_of_template<T, compound_operator>::value ||
+                                  std::tuple_size<std::tuple<Args...>>::value == 0,
+                              "Cannot use args with a compound operator");
+                auto statement = this->prepare(sqlite_orm::select(std::move(m), std::forward<Args>(args)...));
+                return this->execute(statement, target);
+            }
+
+            /**
+             *  Select multiple columns into a struct-of-arrays `columnar_result` instead of
+             *  std::vector<std::tuple<...>>. Every column is extracted into its own contiguous vector.
+             *  Nullable columns have a null bitmap.
+             *  Usage: `auto res = storage.select_columns(columns(&User::id, &User::age), where(...));
+             *          for(auto age: res.values<1>()) {...}`
+             */
+            template<class... Cs, class... Args, class R = columnar_result_t<self, columns_t<Cs...>>>
+            R select_columns(columns_t<Cs...> cols, Args... args) {
+                auto statement = this->prepare(sqlite_orm::select(std::move(cols), std::forward<Args>(args)...));
+                return this->execute_columnar(statement);
+            }
+
+            /**
+             *  Select columns and call `f(row)` for every row without allocating row objects. `row` is
+             *  `row_view` so values are extracted with `row.get<V>(index)`. Use `std::string_view` and
+             *  `blob_view` to read TEXT and BLOB values without copying. Views must not outlive the callback.
+             *  Usage: `storage.visit(columns(&User::id, &User::name), [](auto &row) {
+             *              auto name = row.get<std::string_view>(1);
+             *          }, where(...));`
+             */
+            template<class T, class F, class... Args>
+            void visit(T m, const F &f, Args... args) {
+                auto statement = this->prepare(sqlite_orm::select(std::move(m), std::forward<Args>(args)...));
+                this->visit(statement, f);
+            }
+
+            template<class T, class... Args, class F>
+            void visit(const prepared_statement_t<select_t<T, Args...>> &statement, const F &f) {
+                auto db = statement.con.get();
+                auto stmt = statement.stmt;
+                auto index = 1;
+                sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
+                iterate_ast(statement.t, [stmt, &index, db](auto &node) {
+                    using node_type = typename std::decay<decltype(node)>::type;
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
+                    if(SQLITE_OK != binder(node)) {
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
+                    }
+                });
+                row_view row{stmt};
+                int stepRes;
+                do {
+                    stepRes = sqlite3_step(stmt);
+                    switch(stepRes) {
+                        case SQLITE_ROW: {
+                            f(row);
+                        } break;
+                        case SQLITE_DONE:
+                            break;
+                        default: {
+                            throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                    sqlite3_errmsg(db));
+                        }
+                    }
+                } while(stepRes != SQLITE_DONE);
+            }
+
             /**
              *  Returns a string representation of object of a class mapped to the storage.
              *  Type of string has json-like style.
@@ -10759,8 +15000,12 @@ namespace sqlite_orm {
                     return;
                 }
 
-                auto statement = this->prepare(sqlite_orm::replace_range(from, to));
-                this->execute(statement);
+                auto &impl = this->get_impl<O>();
+                size_t columnsCount = 0;
+                impl.table.for_each_column([&columnsCount](auto &) {
+                    ++columnsCount;
+                });
+                this->execute_range_by_chunks<replace_range_t<It>>(from, to, columnsCount);
             }
 
             template<class O, class... Cols>
@@ -10792,11 +15037,162 @@ namespace sqlite_orm {
                     return;
                 }
 
-                auto statement = this->prepare(sqlite_orm::insert_range(from, to));
-                this->execute(statement);
+                this->execute_range_by_chunks<insert_range_t<It>>(from, to, this->insert_range_columns_count<O>());
+            }
+
+            /**
+             *  Creates a loader which inserts objects of type `O` pushed one by one. Pushed objects are inserted
+             *  by batches and committed every `options.commit_rows` rows or `options.commit_interval` time so
+             *  memory usage doesn't depend on amount of rows. Primary key columns are not inserted just like
+             *  in `insert_range`. Call `finish` on the loader to commit the rest rows. Loader commits its own
+             *  transactions so it cannot be created inside a transaction: `std::system_error` with
+             *  `orm_error_code::cannot_start_a_transaction_within_a_transaction` is thrown then.
+             */
+            template<class O>
+            bulk_loader_t<self, O> bulk_loader(bulk_loader_options options = {}) {
+                this->assert_mapped_type<O>();
+                auto con = this->get_connection();
+                if(!sqlite3_get_autocommit(con.get())) {
+                    throw std::system_error(
+                        std::make_error_code(orm_error_code::cannot_start_a_transaction_within_a_transaction));
+                }
+                auto maxBatchSize = this->range_chunk_size(con.get(), this->insert_range_columns_count<O>());
+                auto batchSize = std::min(std::max(options.batch_size, size_t(1)), maxBatchSize);
+                return {*this, std::move(con), std::move(options), batchSize};
+            }
+
+            /**
+             *  Enqueues insertion of `o` into the write queue (see `start_write_queue`).
+             *  @return future with id of inserted object.
+             */
+            template<class O>
+            std::future<int64> enqueue_insert(O o) {
+                this->assert_mapped_type<O>();
+                auto expression = sqlite_orm::insert(std::move(o));
+                return this->enqueue_write([this, expression] {
+                    auto statement = this->prepare(expression);
+                    return this->execute(statement);
+                });
+            }
+
+            /**
+             *  Enqueues replacement of `o` into the write queue (see `start_write_queue`).
+             *  @return future with rowid of replaced object.
+             */
+            template<class O>
+            std::future<int64> enqueue_replace(O o) {
+                this->assert_mapped_type<O>();
+                auto expression = sqlite_orm::replace(std::move(o));
+                return this->enqueue_write([this, expression] {
+                    auto statement = this->prepare(expression);
+                    this->execute(statement);
+                    return sqlite3_last_insert_rowid(statement.con.get());
+                });
+            }
+
+            /**
+             *  Enqueues update of `o` into the write queue (see `start_write_queue`).
+             *  @return future with amount of changed rows.
+             */
+            template<class O>
+            std::future<int64> enqueue_update(O o) {
+                this->assert_mapped_type<O>();
+                auto expression = sqlite_orm::update(std::move(o));
+                return this->enqueue_write([this, expression] {
+                    auto statement = this->prepare(expression);
+                    this->execute(statement);
+                    return int64(sqlite3_changes(statement.con.get()));
+                });
+            }
+
+            /**
+             *  Enqueues removal of an object with given primary key into the write queue (see `start_write_queue`).
+             *  @return future with amount of changed rows.
+             */
+            template<class O, class... Ids>
+            std::future<int64> enqueue_remove(Ids... ids) {
+                this->assert_mapped_type<O>();
+                auto expression = sqlite_orm::remove<O>(std::forward<Ids>(ids)...);
+                return this->enqueue_write([this, expression] {
+                    auto statement = this->prepare(expression);
+                    this->execute(statement);
+                    return int64(sqlite3_changes(statement.con.get()));
+                });
             }
 
           protected:
+            /**
+             *  @return amount of columns bound for every object by `insert_range`.
+             */
+            template<class O>
+            size_t insert_range_columns_count() const {
+                auto &impl = this->get_impl<O>();
+                size_t res = 0;
+                impl.table.for_each_column([&res](auto &c) {
+                    if(!c.template has<constraints::primary_key_t<>>()) {
+                        ++res;
+                    }
+                });
+                return res;
+            }
+
+            /**
+             *  @return max amount of rows with `columnsCount` columns each which fit into
+             *  `SQLITE_LIMIT_VARIABLE_NUMBER` bound variables.
+             */
+            size_t range_chunk_size(sqlite3 *db, size_t columnsCount) const {
+                auto variablesLimit = static_cast<size_t>(sqlite3_limit(db, SQLITE_LIMIT_VARIABLE_NUMBER, -1));
+                return std::max(variablesLimit / std::max(columnsCount, size_t(1)), size_t(1));
+            }
+
+            /**
+             *  Executes `insert_range_t` or `replace_range_t` expression split into chunks. A chunk has as many rows
+             *  as fit into `SQLITE_LIMIT_VARIABLE_NUMBER` bound variables. All full chunks share one statement
+             *  and the last partial chunk has its own one. Chunks are executed inside a single transaction
+             *  unless there is an opened transaction already. The own transaction is aborted if a chunk or
+             *  `COMMIT` fails and the original error is rethrown.
+             */
+            template<class E>
+            void execute_range_by_chunks(typename E::iterator_type from,
+                                         typename E::iterator_type to,
+                                         size_t columnsCount) {
+                auto con = this->get_connection();
+                auto db = con.get();
+                auto rowsCount = static_cast<size_t>(std::distance(from, to));
+                auto chunkSize = this->range_chunk_size(db, columnsCount);
+                auto ownTransaction = rowsCount > chunkSize && sqlite3_get_autocommit(db);
+                if(ownTransaction) {
+                    this->begin_transaction();
+                }
+                try {
+                    auto fullChunksCount = rowsCount / chunkSize;
+                    if(fullChunksCount) {
+                        auto chunkEnd = std::next(from, chunkSize);
+                        auto statement = this->prepare_impl(E{{from, chunkEnd}}, con);
+                        for(size_t i = 0; i < fullChunksCount; ++i) {
+                            if(i) {
+                                chunkEnd = std::next(from, chunkSize);
+                                statement.t.range = {from, chunkEnd};
+                            }
+                            this->execute(statement);
+                            from = chunkEnd;
+                        }
+                    }
+                    if(from != to) {
+                        auto statement = this->prepare_impl(E{{from, to}}, con);
+                        this->execute(statement);
+                    }
+                    if(ownTransaction) {
+                        this->commit();
+                    }
+                } catch(...) {
+                    if(ownTransaction) {
+                        this->abort_transaction();
+                    }
+                    throw;
+                }
+            }
+
             template<class... Tss, class... Cols>
             sync_schema_result sync_table(storage_impl<internal::index_t<Cols...>, Tss...> *impl, sqlite3 *db, bool) {
                 auto res = sync_schema_result::already_in_sync;
@@ -10925,6 +15321,7 @@ namespace sqlite_orm {
                     auto res = this->sync_table(impl, db, preserve);
                     result.insert({impl->table.name, res});
                 });
+                this->clear_statement_cache();
                 return result;
             }
 
@@ -10953,234 +15350,152 @@ namespace sqlite_orm {
                 return this->impl.table_exists(tableName, con.get());
             }
 
+          protected:
+            /**
+             *  Common part of all `prepare` overloads. Takes a statement from the statement cache of `con`
+             *  if the cache is enabled. Otherwise or if there is no such statement in the cache prepares a new one.
+             *  Statements of expressions with static SQL are searched by expression type only so SQL
+             *  is not serialized for them at all in case of cache hit. Statements which go to the cache are
+             *  always prepared with `prepare_flags::persistent`.
+             */
+            template<class E>
+            prepared_statement_t<E>
+            prepare_impl(E expression, connection_ref con, prepare_flags flags = prepare_flags::none) {
+                auto db = con.get();
+                sqlite3_stmt *stmt = nullptr;
+                statement_cache *cache = nullptr;
+                statement_cache_key cacheKey;
+                auto cacheGeneration = 0;
+                std::string query;
+                if(this->statementCacheEnabled) {
+                    flags = prepare_flags::persistent;
+                    cache = &con.cache();
+                    cacheGeneration = cache->generation();
+                    cacheKey.type = &typeid(E);
+                    if(!has_static_sql<E>::value) {
+                        query = this->string_from_expression(expression, false);
+                        cacheKey.sql = query;
+                    }
+                    stmt = cache->take(cacheKey);
+                    if(stmt) {
+                        ++this->statementCacheHits;
+                    } else {
+                        ++this->statementCacheMisses;
+                    }
+                }
+                if(!stmt) {
+                    if(query.empty()) {
+                        query = this->string_from_expression(expression, false);
+                    }
+                    if(prepare_statement(db, query.c_str(), flags, &stmt) != SQLITE_OK) {
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
+                    }
+                }
+                prepared_statement_t<E> res{std::move(expression), stmt, std::move(con)};
+                res.cache = cache;
+                res.cacheKey = std::move(cacheKey);
+                res.cacheGeneration = cacheGeneration;
+                return res;
+            }
+
+          public:
             template<class T, class... Args>
-            prepared_statement_t<select_t<T, Args...>> prepare(select_t<T, Args...> sel) {
+            prepared_statement_t<select_t<T, Args...>>
+            prepare(select_t<T, Args...> sel, prepare_flags flags = prepare_flags::none) {
                 sel.highest_level = true;
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(sel, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(sel), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+                return this->prepare_impl(std::move(sel), this->get_read_connection(), flags);
             }
 
             template<class T, class... Args>
-            prepared_statement_t<get_all_t<T, Args...>> prepare(get_all_t<T, Args...> get) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(get, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(get), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<get_all_t<T, Args...>>
+            prepare(get_all_t<T, Args...> get, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(get), this->get_read_connection(), flags);
             }
 
             template<class T, class... Args>
-            prepared_statement_t<get_all_pointer_t<T, Args...>> prepare(get_all_pointer_t<T, Args...> get) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(get, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(get), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<get_all_pointer_t<T, Args...>>
+            prepare(get_all_pointer_t<T, Args...> get, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(get), this->get_read_connection(), flags);
             }
 
 #ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
             template<class T, class... Args>
-            prepared_statement_t<get_all_optional_t<T, Args...>> prepare(get_all_optional_t<T, Args...> get) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(get, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(get), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<get_all_optional_t<T, Args...>>
+            prepare(get_all_optional_t<T, Args...> get, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(get), this->get_read_connection(), flags);
             }
 #endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
 
             template<class... Args, class... Wargs>
             prepared_statement_t<update_all_t<set_t<Args...>, Wargs...>>
-            prepare(update_all_t<set_t<Args...>, Wargs...> upd) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(upd, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(upd), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepare(update_all_t<set_t<Args...>, Wargs...> upd, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(upd), this->get_connection(), flags);
             }
 
             template<class T, class... Args>
-            prepared_statement_t<remove_all_t<T, Args...>> prepare(remove_all_t<T, Args...> rem) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(rem, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(rem), stmt, std::move(con)};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<remove_all_t<T, Args...>>
+            prepare(remove_all_t<T, Args...> rem, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(rem), this->get_connection(), flags);
             }
 
             template<class T, class... Ids>
-            prepared_statement_t<get_t<T, Ids...>> prepare(get_t<T, Ids...> g) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(g, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(g), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<get_t<T, Ids...>>
+            prepare(get_t<T, Ids...> g, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(g), this->get_read_connection(), flags);
             }
 
             template<class T, class... Ids>
-            prepared_statement_t<get_pointer_t<T, Ids...>> prepare(get_pointer_t<T, Ids...> g) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(g, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(g), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<get_pointer_t<T, Ids...>>
+            prepare(get_pointer_t<T, Ids...> g, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(g), this->get_read_connection(), flags);
             }
 
 #ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
             template<class T, class... Ids>
-            prepared_statement_t<get_optional_t<T, Ids...>> prepare(get_optional_t<T, Ids...> g) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(g, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(g), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<get_optional_t<T, Ids...>>
+            prepare(get_optional_t<T, Ids...> g, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(g), this->get_read_connection(), flags);
             }
 #endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
 
             template<class T>
-            prepared_statement_t<update_t<T>> prepare(update_t<T> upd) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(upd, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(upd), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<update_t<T>> prepare(update_t<T> upd, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(upd), this->get_connection(), flags);
             }
 
             template<class T, class... Ids>
-            prepared_statement_t<remove_t<T, Ids...>> prepare(remove_t<T, Ids...> rem) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(rem, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(rem), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<remove_t<T, Ids...>>
+            prepare(remove_t<T, Ids...> rem, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(rem), this->get_connection(), flags);
             }
 
             template<class T>
-            prepared_statement_t<insert_t<T>> prepare(insert_t<T> ins) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(ins, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(ins), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<insert_t<T>> prepare(insert_t<T> ins, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(ins), this->get_connection(), flags);
             }
 
             template<class T>
-            prepared_statement_t<replace_t<T>> prepare(replace_t<T> rep) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(rep, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(rep), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<replace_t<T>> prepare(replace_t<T> rep, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(rep), this->get_connection(), flags);
             }
 
             template<class It>
-            prepared_statement_t<insert_range_t<It>> prepare(insert_range_t<It> ins) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(ins, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(ins), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<insert_range_t<It>>
+            prepare(insert_range_t<It> ins, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(ins), this->get_connection(), flags);
             }
 
             template<class It>
-            prepared_statement_t<replace_range_t<It>> prepare(replace_range_t<It> rep) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(rep, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(rep), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<replace_range_t<It>>
+            prepare(replace_range_t<It> rep, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(rep), this->get_connection(), flags);
             }
 
             template<class T, class... Cols>
-            prepared_statement_t<insert_explicit<T, Cols...>> prepare(insert_explicit<T, Cols...> ins) {
-                auto con = this->get_connection();
-                sqlite3_stmt *stmt;
-                auto db = con.get();
-                auto query = this->string_from_expression(ins, false);
-                if(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
-                    return {std::move(ins), stmt, con};
-                } else {
-                    throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                            sqlite3_errmsg(db));
-                }
+            prepared_statement_t<insert_explicit<T, Cols...>>
+            prepare(insert_explicit<T, Cols...> ins, prepare_flags flags = prepare_flags::none) {
+                return this->prepare_impl(std::move(ins), this->get_connection(), flags);
             }
 
             template<class T, class... Cols>
@@ -11189,17 +15504,17 @@ namespace sqlite_orm {
                 using expression_type = typename statement_type::expression_type;
                 using object_type = typename expression_object_type<expression_type>::type;
                 auto index = 1;
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto &impl = this->get_impl<object_type>();
                 auto &o = statement.t.obj;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_tuple(statement.t.columns.columns, [&o, &index, &stmt, &impl, db](auto &m) {
                     using column_type = typename std::decay<decltype(m)>::type;
                     using field_type = typename column_result_t<self, column_type>::type;
                     const field_type *value = impl.table.template get_object_field_pointer<field_type>(o, m);
-                    if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, *value)) {
+                    if(SQLITE_OK != bind_value<field_type>(stmt, index++, *value, SQLITE_STATIC)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
@@ -11219,30 +15534,22 @@ namespace sqlite_orm {
                 using object_type = typename expression_type::object_type;
                 auto &impl = this->get_impl<object_type>();
                 auto index = 1;
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 for(auto it = statement.t.range.first; it != statement.t.range.second; ++it) {
                     auto &o = *it;
                     impl.table.for_each_column([&o, &index, &stmt, db](auto &c) {
                         using column_type = typename std::decay<decltype(c)>::type;
                         using field_type = typename column_type::field_type;
-                        if(c.member_pointer) {
-                            if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, o.*c.member_pointer)) {
-                                throw std::system_error(
-                                    std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                    sqlite3_errmsg(db));
-                            }
-                        } else {
-                            using getter_type = typename column_type::getter_type;
-                            field_value_holder<getter_type> valueHolder{((o).*(c.getter))()};
-                            if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, valueHolder.value)) {
+                        call_with_column_value(c, o, [stmt, &index, db](auto &value, auto destructor) {
+                            if(SQLITE_OK != bind_value<field_type>(stmt, index++, value, destructor)) {
                                 throw std::system_error(
                                     std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                     sqlite3_errmsg(db));
                             }
-                        }
+                        });
                     });
                 }
                 if(sqlite3_step(stmt) == SQLITE_DONE) {
@@ -11259,33 +15566,24 @@ namespace sqlite_orm {
                 using expression_type = typename statement_type::expression_type;
                 using object_type = typename expression_type::object_type;
                 auto index = 1;
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto &impl = this->get_impl<object_type>();
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 for(auto it = statement.t.range.first; it != statement.t.range.second; ++it) {
                     auto &o = *it;
                     impl.table.for_each_column([&o, &index, &stmt, db](auto &c) {
                         if(!c.template has<constraints::primary_key_t<>>()) {
                             using column_type = typename std::decay<decltype(c)>::type;
                             using field_type = typename column_type::field_type;
-                            if(c.member_pointer) {
-                                if(SQLITE_OK !=
-                                   statement_binder<field_type>().bind(stmt, index++, o.*c.member_pointer)) {
-                                    throw std::system_error(
-                                        std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                        sqlite3_errmsg(db));
-                                }
-                            } else {
-                                using getter_type = typename column_type::getter_type;
-                                field_value_holder<getter_type> valueHolder{((o).*(c.getter))()};
-                                if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, valueHolder.value)) {
+                            call_with_column_value(c, o, [stmt, &index, db](auto &value, auto destructor) {
+                                if(SQLITE_OK != bind_value<field_type>(stmt, index++, value, destructor)) {
                                     throw std::system_error(
                                         std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                         sqlite3_errmsg(db));
                                 }
-                            }
+                            });
                         }
                     });
                 }
@@ -11302,29 +15600,22 @@ namespace sqlite_orm {
                 using statement_type = typename std::decay<decltype(statement)>::type;
                 using expression_type = typename statement_type::expression_type;
                 using object_type = typename expression_object_type<expression_type>::type;
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 auto &o = get_object(statement.t);
                 auto &impl = this->get_impl<object_type>();
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 impl.table.for_each_column([&o, &index, &stmt, db](auto &c) {
                     using column_type = typename std::decay<decltype(c)>::type;
                     using field_type = typename column_type::field_type;
-                    if(c.member_pointer) {
-                        if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, o.*c.member_pointer)) {
-                            throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                                    sqlite3_errmsg(db));
-                        }
-                    } else {
-                        using getter_type = typename column_type::getter_type;
-                        field_value_holder<getter_type> valueHolder{((o).*(c.getter))()};
-                        if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, valueHolder.value)) {
+                    call_with_column_value(c, o, [stmt, &index, db](auto &value, auto destructor) {
+                        if(SQLITE_OK != bind_value<field_type>(stmt, index++, value, destructor)) {
                             throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                     sqlite3_errmsg(db));
                         }
-                    }
+                    });
                 });
                 if(sqlite3_step(stmt) == SQLITE_DONE) {
                     //..
@@ -11340,36 +15631,27 @@ namespace sqlite_orm {
                 using expression_type = typename statement_type::expression_type;
                 using object_type = typename expression_object_type<expression_type>::type;
                 int64 res = 0;
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 auto &impl = this->get_impl<object_type>();
                 auto &o = get_object(statement.t);
                 auto compositeKeyColumnNames = impl.table.composite_key_columns_names();
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 impl.table.for_each_column([&o, &index, &stmt, &impl, &compositeKeyColumnNames, db](auto &c) {
                     if(impl.table._without_rowid || !c.template has<constraints::primary_key_t<>>()) {
                         auto it = std::find(compositeKeyColumnNames.begin(), compositeKeyColumnNames.end(), c.name);
                         if(it == compositeKeyColumnNames.end()) {
                             using column_type = typename std::decay<decltype(c)>::type;
                             using field_type = typename column_type::field_type;
-                            if(c.member_pointer) {
-                                if(SQLITE_OK !=
-                                   statement_binder<field_type>().bind(stmt, index++, o.*c.member_pointer)) {
-                                    throw std::system_error(
-                                        std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                        sqlite3_errmsg(db));
-                                }
-                            } else {
-                                using getter_type = typename column_type::getter_type;
-                                field_value_holder<getter_type> valueHolder{((o).*(c.getter))()};
-                                if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, valueHolder.value)) {
+                            call_with_column_value(c, o, [stmt, &index, db](auto &value, auto destructor) {
+                                if(SQLITE_OK != bind_value<field_type>(stmt, index++, value, destructor)) {
                                     throw std::system_error(
                                         std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                         sqlite3_errmsg(db));
                                 }
-                            }
+                            });
                         }
                     }
                 });
@@ -11384,14 +15666,14 @@ namespace sqlite_orm {
 
             template<class T, class... Ids>
             void execute(const prepared_statement_t<remove_t<T, Ids...>> &statement) {
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t.ids, [stmt, &index, db](auto &v) {
                     using field_type = typename std::decay<decltype(v)>::type;
-                    if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, v)) {
+                    if(SQLITE_OK != bind_value<field_type>(stmt, index++, v, SQLITE_STATIC)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
@@ -11409,54 +15691,37 @@ namespace sqlite_orm {
                 using statement_type = typename std::decay<decltype(statement)>::type;
                 using expression_type = typename statement_type::expression_type;
                 using object_type = typename expression_object_type<expression_type>::type;
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto &impl = this->get_impl<object_type>();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 auto &o = get_object(statement.t);
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 impl.table.for_each_column([&o, stmt, &index, db](auto &c) {
                     if(!c.template has<constraints::primary_key_t<>>()) {
                         using column_type = typename std::decay<decltype(c)>::type;
                         using field_type = typename column_type::field_type;
-                        if(c.member_pointer) {
-                            auto bind_res = statement_binder<field_type>().bind(stmt, index++, o.*c.member_pointer);
-                            if(SQLITE_OK != bind_res) {
+                        call_with_column_value(c, o, [stmt, &index, db](auto &value, auto destructor) {
+                            if(SQLITE_OK != bind_value<field_type>(stmt, index++, value, destructor)) {
                                 throw std::system_error(
                                     std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                     sqlite3_errmsg(db));
                             }
-                        } else {
-                            using getter_type = typename column_type::getter_type;
-                            field_value_holder<getter_type> valueHolder{((o).*(c.getter))()};
-                            if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, valueHolder.value)) {
-                                throw std::system_error(
-                                    std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                    sqlite3_errmsg(db));
-                            }
-                        }
+                        });
                     }
                 });
                 impl.table.for_each_column([&o, stmt, &index, db](auto &c) {
                     if(c.template has<constraints::primary_key_t<>>()) {
                         using column_type = typename std::decay<decltype(c)>::type;
                         using field_type = typename column_type::field_type;
-                        if(c.member_pointer) {
-                            if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, o.*c.member_pointer)) {
-                                throw std::system_error(
-                                    std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
-                                    sqlite3_errmsg(db));
-                            }
-                        } else {
-                            using getter_type = typename column_type::getter_type;
-                            field_value_holder<getter_type> valueHolder{((o).*(c.getter))()};
-                            if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, valueHolder.value)) {
+                        call_with_column_value(c, o, [stmt, &index, db](auto &value, auto destructor) {
+                            if(SQLITE_OK != bind_value<field_type>(stmt, index++, value, destructor)) {
                                 throw std::system_error(
                                     std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                     sqlite3_errmsg(db));
                             }
-                        }
+                        });
                     }
                 });
                 if(sqlite3_step(stmt) == SQLITE_DONE) {
@@ -11470,14 +15735,14 @@ namespace sqlite_orm {
             template<class T, class... Ids>
             std::unique_ptr<T> execute(const prepared_statement_t<get_pointer_t<T, Ids...>> &statement) {
                 auto &impl = this->get_impl<T>();
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t.ids, [stmt, &index, db](auto &v) {
                     using field_type = typename std::decay<decltype(v)>::type;
-                    if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, v)) {
+                    if(SQLITE_OK != bind_value<field_type>(stmt, index++, v, SQLITE_STATIC)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
@@ -11485,16 +15750,10 @@ namespace sqlite_orm {
                 auto stepRes = sqlite3_step(stmt);
                 switch(stepRes) {
                     case SQLITE_ROW: {
-                        auto res = std::make_unique<T>();
-                        index = 0;
-                        impl.table.for_each_column([&index, &res, stmt](auto &c) {
-                            using field_type = typename std::decay<decltype(c)>::type::field_type;
-                            auto value = row_extractor<field_type>().extract(stmt, index++);
-                            if(c.member_pointer) {
-                                (*res).*c.member_pointer = std::move(value);
-                            } else {
-                                ((*res).*(c.setter))(std::move(value));
-                            }
+                        std::unique_ptr<T> res;
+                        emplace_object(impl.table, stmt, [&res](auto &&... args) -> T & {
+                            res = std::make_unique<T>(std::forward<decltype(args)>(args)...);
+                            return *res;
                         });
                         return res;
                     } break;
@@ -11512,14 +15771,14 @@ namespace sqlite_orm {
             template<class T, class... Ids>
             std::optional<T> execute(const prepared_statement_t<get_optional_t<T, Ids...>> &statement) {
                 auto &impl = this->get_impl<T>();
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t.ids, [stmt, &index, db](auto &v) {
                     using field_type = typename std::decay<decltype(v)>::type;
-                    if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, v)) {
+                    if(SQLITE_OK != bind_value<field_type>(stmt, index++, v, SQLITE_STATIC)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
@@ -11527,16 +15786,9 @@ namespace sqlite_orm {
                 auto stepRes = sqlite3_step(stmt);
                 switch(stepRes) {
                     case SQLITE_ROW: {
-                        auto res = std::make_optional<T>();
-                        index = 0;
-                        impl.table.for_each_column([&index, &res, stmt](auto &c) {
-                            using field_type = typename std::decay<decltype(c)>::type::field_type;
-                            auto value = row_extractor<field_type>().extract(stmt, index++);
-                            if(c.member_pointer) {
-                                (*res).*c.member_pointer = std::move(value);
-                            } else {
-                                ((*res).*(c.setter))(std::move(value));
-                            }
+                        std::optional<T> res;
+                        emplace_object(impl.table, stmt, [&res](auto &&... args) -> T & {
+                            return res.emplace(std::forward<decltype(args)>(args)...);
                         });
                         return res;
                     } break;
@@ -11554,14 +15806,14 @@ namespace sqlite_orm {
             template<class T, class... Ids>
             T execute(const prepared_statement_t<get_t<T, Ids...>> &statement) {
                 auto &impl = this->get_impl<T>();
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t.ids, [stmt, &index, db](auto &v) {
                     using field_type = typename std::decay<decltype(v)>::type;
-                    if(SQLITE_OK != statement_binder<field_type>().bind(stmt, index++, v)) {
+                    if(SQLITE_OK != bind_value<field_type>(stmt, index++, v, SQLITE_STATIC)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
@@ -11569,19 +15821,7 @@ namespace sqlite_orm {
                 auto stepRes = sqlite3_step(stmt);
                 switch(stepRes) {
                     case SQLITE_ROW: {
-                        T res;
-                        index = 0;
-                        impl.table.for_each_column([&index, &res, stmt](auto &c) {
-                            using column_type = typename std::decay<decltype(c)>::type;
-                            using field_type = typename column_type::field_type;
-                            auto value = row_extractor<field_type>().extract(stmt, index++);
-                            if(c.member_pointer) {
-                                res.*c.member_pointer = std::move(value);
-                            } else {
-                                ((res).*(c.setter))(std::move(value));
-                            }
-                        });
-                        return res;
+                        return make_object(impl.table, stmt);
                     } break;
                     case SQLITE_DONE: {
                         throw std::system_error(std::make_error_code(sqlite_orm::orm_error_code::not_found));
@@ -11595,14 +15835,14 @@ namespace sqlite_orm {
 
             template<class T, class... Args>
             void execute(const prepared_statement_t<remove_all_t<T, Args...>> &statement) {
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t.conditions, [stmt, &index, db](auto &node) {
                     using node_type = typename std::decay<decltype(node)>::type;
-                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                     if(SQLITE_OK != binder(node)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
@@ -11618,15 +15858,15 @@ namespace sqlite_orm {
 
             template<class... Args, class... Wargs>
             void execute(const prepared_statement_t<update_all_t<set_t<Args...>, Wargs...>> &statement) {
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_tuple(statement.t.set.assigns, [&index, stmt, db](auto &setArg) {
                     iterate_ast(setArg, [&index, stmt, db](auto &node) {
                         using node_type = typename std::decay<decltype(node)>::type;
-                        conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                        conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                         if(SQLITE_OK != binder(node)) {
                             throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                     sqlite3_errmsg(db));
@@ -11635,7 +15875,7 @@ namespace sqlite_orm {
                 });
                 iterate_ast(statement.t.conditions, [stmt, &index, db](auto &node) {
                     using node_type = typename std::decay<decltype(node)>::type;
-                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                     if(SQLITE_OK != binder(node)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
@@ -11651,26 +15891,75 @@ namespace sqlite_orm {
 
             template<class T, class... Args, class R = typename column_result_t<self, T>::type>
             std::vector<R> execute(const prepared_statement_t<select_t<T, Args...>> &statement) {
-                auto con = this->get_connection();
-                auto db = con.get();
+                std::vector<R> res;
+                this->execute(statement, into(res));
+                return res;
+            }
+
+            /**
+             *  Clears `target.container` and appends the selected rows to it.
+             */
+            template<class T, class... Args, class C>
+            C &execute(const prepared_statement_t<select_t<T, Args...>> &statement, into_t<C> target) {
+                using R = typename column_result_t<self, T>::type;
+                auto db = statement.con.get();
+                auto stmt = statement.stmt;
+                auto index = 1;
+                sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
+                iterate_ast(statement.t, [stmt, &index, db](auto &node) {
+                    using node_type = typename std::decay<decltype(node)>::type;
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
+                    if(SQLITE_OK != binder(node)) {
+                        throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                sqlite3_errmsg(db));
+                    }
+                });
+                auto &res = target.container;
+                res.clear();
+                int stepRes;
+                do {
+                    stepRes = sqlite3_step(stmt);
+                    switch(stepRes) {
+                        case SQLITE_ROW: {
+                            res.push_back(row_extractor<R>().extract(stmt, 0));
+                        } break;
+                        case SQLITE_DONE:
+                            break;
+                        default: {
+                            throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
+                                                    sqlite3_errmsg(db));
+                        }
+                    }
+                } while(stepRes != SQLITE_DONE);
+                return res;
+            }
+
+            /**
+             *  Executes a prepared multicolumn select and extracts rows into `columnar_result`.
+             */
+            template<class... Cs, class... Args, class R = columnar_result_t<self, columns_t<Cs...>>>
+            R execute_columnar(const prepared_statement_t<select_t<columns_t<Cs...>, Args...>> &statement) {
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t, [stmt, &index, db](auto &node) {
                     using node_type = typename std::decay<decltype(node)>::type;
-                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                     if(SQLITE_OK != binder(node)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
                 });
-                std::vector<R> res;
+                R res;
                 int stepRes;
                 do {
                     stepRes = sqlite3_step(stmt);
                     switch(stepRes) {
                         case SQLITE_ROW: {
-                            res.push_back(row_extractor<R>().extract(stmt, 0));
+                            res.push_back(stmt);
                         } break;
                         case SQLITE_DONE:
                             break;
@@ -11685,38 +15974,43 @@ namespace sqlite_orm {
 
             template<class T, class... Args>
             std::vector<T> execute(const prepared_statement_t<get_all_t<T, Args...>> &statement) {
+                std::vector<T> res;
+                this->execute(statement, into(res));
+                return res;
+            }
+
+            /**
+             *  Clears `target.container` and appends all objects to it.
+             */
+            template<class T, class... Args, class C>
+            C &execute(const prepared_statement_t<get_all_t<T, Args...>> &statement, into_t<C> target) {
                 auto &impl = this->get_impl<T>();
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t, [stmt, &index, db](auto &node) {
                     using node_type = typename std::decay<decltype(node)>::type;
-                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                     if(SQLITE_OK != binder(node)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
                 });
-                std::vector<T> res;
+                auto &res = target.container;
+                res.clear();
+                using conditions_type = typename get_all_t<T, Args...>::conditions_type;
+                this->reserve_result<conditions_type>(impl.table.name, db, res);
                 int stepRes;
                 do {
                     stepRes = sqlite3_step(stmt);
                     switch(stepRes) {
                         case SQLITE_ROW: {
-                            T obj;
-                            auto index = 0;
-                            impl.table.for_each_column([&index, &obj, stmt](auto &c) {
-                                using field_type = typename std::decay<decltype(c)>::type::field_type;
-                                auto value = row_extractor<field_type>().extract(stmt, index++);
-                                if(c.member_pointer) {
-                                    obj.*c.member_pointer = std::move(value);
-                                } else {
-                                    ((obj).*(c.setter))(std::move(value));
-                                }
+                            emplace_object(impl.table, stmt, [&res](auto &&... args) -> T & {
+                                res.emplace_back(std::forward<decltype(args)>(args)...);
+                                return res.back();
                             });
-                            res.push_back(std::move(obj));
                         } break;
                         case SQLITE_DONE:
                             break;
@@ -11726,44 +16020,50 @@ namespace sqlite_orm {
                         }
                     }
                 } while(stepRes != SQLITE_DONE);
+                this->remember_result_size<conditions_type>(impl.table.name, res.size());
                 return res;
             }
 
             template<class T, class... Args>
             std::vector<std::unique_ptr<T>>
             execute(const prepared_statement_t<get_all_pointer_t<T, Args...>> &statement) {
+                std::vector<std::unique_ptr<T>> res;
+                this->execute(statement, into(res));
+                return res;
+            }
+
+            /**
+             *  Clears `target.container` and appends all objects to it.
+             */
+            template<class T, class... Args, class C>
+            C &execute(const prepared_statement_t<get_all_pointer_t<T, Args...>> &statement, into_t<C> target) {
                 auto &impl = this->get_impl<T>();
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t, [stmt, &index, db](auto &node) {
                     using node_type = typename std::decay<decltype(node)>::type;
-                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                     if(SQLITE_OK != binder(node)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
                 });
-                std::vector<std::unique_ptr<T>> res;
+                auto &res = target.container;
+                res.clear();
+                using conditions_type = typename get_all_pointer_t<T, Args...>::conditions_type;
+                this->reserve_result<conditions_type>(impl.table.name, db, res);
                 int stepRes;
                 do {
                     stepRes = sqlite3_step(stmt);
                     switch(stepRes) {
                         case SQLITE_ROW: {
-                            auto obj = std::make_unique<T>();
-                            auto index = 0;
-                            impl.table.for_each_column([&index, &obj, stmt](auto &c) {
-                                using field_type = typename std::decay<decltype(c)>::type::field_type;
-                                auto value = row_extractor<field_type>().extract(stmt, index++);
-                                if(c.member_pointer) {
-                                    (*obj).*c.member_pointer = std::move(value);
-                                } else {
-                                    ((*obj).*(c.setter))(std::move(value));
-                                }
+                            emplace_object(impl.table, stmt, [&res](auto &&... args) -> T & {
+                                res.push_back(std::make_unique<T>(std::forward<decltype(args)>(args)...));
+                                return *res.back();
                             });
-                            res.push_back(std::move(obj));
                         } break;
                         case SQLITE_DONE:
                             break;
@@ -11773,6 +16073,7 @@ namespace sqlite_orm {
                         }
                     }
                 } while(stepRes != SQLITE_DONE);
+                this->remember_result_size<conditions_type>(impl.table.name, res.size());
                 return res;
             }
 
@@ -11780,38 +16081,43 @@ namespace sqlite_orm {
             template<class T, class... Args>
             std::vector<std::optional<T>>
             execute(const prepared_statement_t<get_all_optional_t<T, Args...>> &statement) {
+                std::vector<std::optional<T>> res;
+                this->execute(statement, into(res));
+                return res;
+            }
+
+            /**
+             *  Clears `target.container` and appends all objects to it.
+             */
+            template<class T, class... Args, class C>
+            C &execute(const prepared_statement_t<get_all_optional_t<T, Args...>> &statement, into_t<C> target) {
                 auto &impl = this->get_impl<T>();
-                auto con = this->get_connection();
-                auto db = con.get();
+                auto db = statement.con.get();
                 auto stmt = statement.stmt;
                 auto index = 1;
                 sqlite3_reset(stmt);
+                statement_reset_guard resetGuard{stmt};
                 iterate_ast(statement.t, [stmt, &index, db](auto &node) {
                     using node_type = typename std::decay<decltype(node)>::type;
-                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index};
+                    conditional_binder<node_type, is_bindable<node_type>> binder{stmt, index, SQLITE_STATIC};
                     if(SQLITE_OK != binder(node)) {
                         throw std::system_error(std::error_code(sqlite3_errcode(db), get_sqlite_error_category()),
                                                 sqlite3_errmsg(db));
                     }
                 });
-                std::vector<std::optional<T>> res;
+                auto &res = target.container;
+                res.clear();
+                using conditions_type = typename get_all_optional_t<T, Args...>::conditions_type;
+                this->reserve_result<conditions_type>(impl.table.name, db, res);
                 int stepRes;
                 do {
                     stepRes = sqlite3_step(stmt);
                     switch(stepRes) {
                         case SQLITE_ROW: {
-                            auto obj = std::make_optional<T>();
-                            auto index = 0;
-                            impl.table.for_each_column([&index, &obj, stmt](auto &c) {
-                                using field_type = typename std::decay<decltype(c)>::type::field_type;
-                                auto value = row_extractor<field_type>().extract(stmt, index++);
-                                if(c.member_pointer) {
-                                    (*obj).*c.member_pointer = std::move(value);
-                                } else {
-                                    ((*obj).*(c.setter))(std::move(value));
-                                }
+                            emplace_object(impl.table, stmt, [&res](auto &&... args) -> T & {
+                                res.emplace_back(std::in_place, std::forward<decltype(args)>(args)...);
+                                return *res.back();
                             });
-                            res.push_back(std::move(obj));
                         } break;
                         case SQLITE_DONE:
                             break;
@@ -11821,6 +16127,7 @@ namespace sqlite_orm {
                         }
                     }
                 } while(stepRes != SQLITE_DONE);
+                this->remember_result_size<conditions_type>(impl.table.name, res.size());
                 return res;
             }
 #endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
@@ -11838,6 +16145,33 @@ namespace sqlite_orm {
         return {filename, internal::storage_impl<Ts...>(tables...)};
     }
 
+    /**
+     *  Creates a storage with a pool of reader connections. E.g.
+     *  `auto storage = make_storage("db.sqlite", pool_options{4}, make_table(...));`
+     */
+    template<class... Ts>
+    internal::storage_t<Ts...> make_storage(const std::string &filename, pool_options poolOptions, Ts... tables) {
+        return {filename, poolOptions, internal::storage_impl<Ts...>(tables...)};
+    }
+
+    /**
+     *  Creates a storage which opens connections with `sqlite3_open_v2` arguments. E.g.
+     *  `auto storage = make_storage("db.sqlite", open_options{SQLITE_OPEN_READONLY}, make_table(...));`
+     */
+    template<class... Ts>
+    internal::storage_t<Ts...> make_storage(const std::string &filename, open_options openOptions, Ts... tables) {
+        return {filename, std::move(openOptions), pool_options{}, internal::storage_impl<Ts...>(tables...)};
+    }
+
+    /**
+     *  Creates a storage with `sqlite3_open_v2` arguments and a pool of reader connections.
+     */
+    template<class... Ts>
+    internal::storage_t<Ts...>
+    make_storage(const std::string &filename, open_options openOptions, pool_options poolOptions, Ts... tables) {
+        return {filename, std::move(openOptions), poolOptions, internal::storage_impl<Ts...>(tables...)};
+    }
+
     /**
      *  sqlite3_threadsafe() interface.
      */
@@ -11847,6 +16181,316 @@ namespace sqlite_orm {
 }
 #pragma once
 
+#include <functional>  //  std::function
+#include <future>  //  std::future, std::packaged_task
+#include <memory>  //  std::shared_ptr, std::make_shared, std::unique_ptr
+#include <mutex>  //  std::mutex, std::unique_lock, std::lock_guard
+#include <condition_variable>  //  std::condition_variable
+#include <thread>  //  std::thread
+#include <queue>  //  std::queue
+#include <vector>  //  std::vector
+#include <utility>  //  std::move, std::forward, std::declval
+#include <exception>  //  std::exception_ptr, std::current_exception, std::rethrow_exception
+
+#ifdef SQLITE_ORM_COROUTINES_SUPPORTED
+#include <coroutine>  //  std::coroutine_handle
+#include <optional>  //  std::optional
+#endif  // SQLITE_ORM_COROUTINES_SUPPORTED
+
+// #include "prepared_statement.h"
+
+namespace sqlite_orm {
+
+    namespace internal {
+
+        /**
+         *  Fixed size thread pool. Jobs are executed in order of posting. Destructor executes all posted
+         *  jobs and joins threads.
+         */
+        struct executor {
+            using job_t = std::function<void()>;
+
+            executor(size_t threadsCount) {
+                if(!threadsCount) {
+                    threadsCount = 1;
+                }
+                this->threads.reserve(threadsCount);
+                for(size_t i = 0; i < threadsCount; ++i) {
+                    this->threads.emplace_back([this] {
+                        this->run();
+                    });
+                }
+            }
+
+            executor(const executor &) = delete;
+
+            ~executor() {
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex);
+                    this->stopped = true;
+                }
+                this->condition.notify_all();
+                for(auto &thread: this->threads) {
+                    thread.join();
+                }
+            }
+
+            void post(job_t job) {
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex);
+                    this->jobs.push(std::move(job));
+                }
+                this->condition.notify_one();
+            }
+
+            size_t threads_count() const {
+                return this->threads.size();
+            }
+
+          protected:
+            std::vector<std::thread> threads;
+            std::queue<job_t> jobs;
+            std::mutex mutex;
+            std::condition_variable condition;
+            bool stopped = false;
+
+            void run() {
+                for(;;) {
+                    job_t job;
+                    {
+                        std::unique_lock<std::mutex> lock(this->mutex);
+                        this->condition.wait(lock, [this] {
+                            return this->stopped || !this->jobs.empty();
+                        });
+                        if(this->jobs.empty()) {
+                            return;
+                        }
+                        job = std::move(this->jobs.front());
+                        this->jobs.pop();
+                    }
+                    job();
+                }
+            }
+        };
+
+#ifdef SQLITE_ORM_COROUTINES_SUPPORTED
+        /**
+         *  Awaitable returned by `async_storage::schedule`. Posts a job to the executor when a coroutine
+         *  is suspended and resumes the coroutine on the executor thread once the job is done.
+         */
+        template<class S, class F>
+        struct async_awaitable {
+            using storage_type = S;
+            using result_type = decltype(std::declval<F &>()(std::declval<storage_type &>()));
+
+            async_awaitable(executor &executor_, storage_type &storage_, F job_) :
+                executorRef(executor_), storage(storage_), job(std::move(job_)) {}
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) {
+                this->executorRef.post([this, handle] {
+                    try {
+                        if constexpr(std::is_void<result_type>::value) {
+                            this->job(this->storage);
+                        } else {
+                            this->result.emplace(this->job(this->storage));
+                        }
+                    } catch(...) {
+                        this->exception = std::current_exception();
+                    }
+                    handle.resume();
+                });
+            }
+
+            result_type await_resume() {
+                if(this->exception) {
+                    std::rethrow_exception(this->exception);
+                }
+                if constexpr(!std::is_void<result_type>::value) {
+                    return std::move(*this->result);
+                }
+            }
+
+          protected:
+            using value_type = typename std::conditional<std::is_void<result_type>::value, bool, result_type>::type;
+
+            executor &executorRef;
+            storage_type &storage;
+            F job;
+            std::optional<value_type> result;
+            std::exception_ptr exception;
+        };
+#endif  // SQLITE_ORM_COROUTINES_SUPPORTED
+
+        /**
+         *  Asynchronous facade of a storage. Every call is executed by a dedicated executor thread and
+         *  returns `std::future`. Executor has a single thread by default. More threads make sense only
+         *  if the storage has reader connections (see `pool_options`) so reads are executed in parallel.
+         *  If `SQLITE_ORM_COROUTINES_SUPPORTED` is defined `*_co` functions and `schedule` return awaitables
+         *  which resume a coroutine on the executor thread. Storage must outlive the facade.
+         */
+        template<class S>
+        struct async_storage {
+            using storage_type = S;
+
+            async_storage(storage_type &storage_, size_t threadsCount = 1) :
+                storage(storage_), executorPtr(std::make_unique<executor>(threadsCount)) {}
+
+            /**
+             *  Executes `f(storage)` on the executor.
+             */
+            template<class F>
+            std::future<decltype(std::declval<F &>()(std::declval<storage_type &>()))> submit(F f) {
+                using result_type = decltype(std::declval<F &>()(std::declval<storage_type &>()));
+                auto &storage = this->storage;
+                auto task = std::make_shared<std::packaged_task<result_type()>>([&storage, f]() mutable {
+                    return f(storage);
+                });
+                auto res = task->get_future();
+                this->executorPtr->post([task] {
+                    (*task)();
+                });
+                return res;
+            }
+
+            template<class T, class... Args>
+            std::future<std::vector<T>> get_all_async(Args &&... args) {
+                return this->submit(this->expression_job(sqlite_orm::get_all<T>(std::forward<Args>(args)...)));
+            }
+
+            template<class T, class... Ids>
+            std::future<T> get_async(Ids... ids) {
+                return this->submit(this->expression_job(sqlite_orm::get<T>(std::forward<Ids>(ids)...)));
+            }
+
+            template<class T, class... Ids>
+            std::future<std::unique_ptr<T>> get_pointer_async(Ids... ids) {
+                return this->submit(this->expression_job(sqlite_orm::get_pointer<T>(std::forward<Ids>(ids)...)));
+            }
+
+            template<class O>
+            std::future<int64> insert_async(O o) {
+                return this->submit(this->expression_job(sqlite_orm::insert(std::move(o))));
+            }
+
+            template<class O>
+            std::future<void> replace_async(O o) {
+                return this->submit(this->expression_job(sqlite_orm::replace(std::move(o))));
+            }
+
+            template<class O>
+            std::future<void> update_async(O o) {
+                return this->submit(this->expression_job(sqlite_orm::update(std::move(o))));
+            }
+
+            template<class T, class... Ids>
+            std::future<void> remove_async(Ids... ids) {
+                return this->submit(this->expression_job(sqlite_orm::remove<T>(std::forward<Ids>(ids)...)));
+            }
+
+            /**
+             *  Executes a prepared statement on the executor. Statement is moved into the job cause
+             *  it must not be used by two threads at once.
+             */
+            template<class T>
+            auto execute_async(prepared_statement_t<T> statement) {
+                return this->submit(this->statement_job(std::move(statement)));
+            }
+
+#ifdef SQLITE_ORM_COROUTINES_SUPPORTED
+            /**
+             *  @return awaitable which executes `f(storage)` on the executor.
+             */
+            template<class F>
+            async_awaitable<storage_type, F> schedule(F f) {
+                return {*this->executorPtr, this->storage, std::move(f)};
+            }
+
+            template<class T, class... Args>
+            auto get_all_co(Args &&... args) {
+                return this->schedule(this->expression_job(sqlite_orm::get_all<T>(std::forward<Args>(args)...)));
+            }
+
+            template<class T, class... Ids>
+            auto get_co(Ids... ids) {
+                return this->schedule(this->expression_job(sqlite_orm::get<T>(std::forward<Ids>(ids)...)));
+            }
+
+            template<class T, class... Ids>
+            auto get_pointer_co(Ids... ids) {
+                return this->schedule(this->expression_job(sqlite_orm::get_pointer<T>(std::forward<Ids>(ids)...)));
+            }
+
+            template<class O>
+            auto insert_co(O o) {
+                return this->schedule(this->expression_job(sqlite_orm::insert(std::move(o))));
+            }
+
+            template<class O>
+            auto replace_co(O o) {
+                return this->schedule(this->expression_job(sqlite_orm::replace(std::move(o))));
+            }
+
+            template<class O>
+            auto update_co(O o) {
+                return this->schedule(this->expression_job(sqlite_orm::update(std::move(o))));
+            }
+
+            template<class T, class... Ids>
+            auto remove_co(Ids... ids) {
+                return this->schedule(this->expression_job(sqlite_orm::remove<T>(std::forward<Ids>(ids)...)));
+            }
+
+            template<class T>
+            auto execute_co(prepared_statement_t<T> statement) {
+                return this->schedule(this->statement_job(std::move(statement)));
+            }
+#endif  // SQLITE_ORM_COROUTINES_SUPPORTED
+
+            size_t threads_count() const {
+                return this->executorPtr->threads_count();
+            }
+
+          protected:
+            storage_type &storage;
+            std::unique_ptr<executor> executorPtr;
+
+            /**
+             *  @return job which prepares and executes `expression`.
+             */
+            template<class E>
+            static auto expression_job(E expression) {
+                return [expression](storage_type &storage) {
+                    auto statement = storage.prepare(expression);
+                    return storage.execute(statement);
+                };
+            }
+
+            template<class T>
+            static auto statement_job(prepared_statement_t<T> statement) {
+                auto statementPointer = std::make_shared<prepared_statement_t<T>>(std::move(statement));
+                return [statementPointer](storage_type &storage) {
+                    return storage.execute(*statementPointer);
+                };
+            }
+        };
+    }
+
+    /**
+     *  Creates an asynchronous facade of `storage` with `threadsCount` executor threads.
+     *  Usage: `auto asyncStorage = make_async_storage(storage);
+     *          auto users = asyncStorage.get_all_async<User>().get();`
+     */
+    template<class S>
+    internal::async_storage<S> make_async_storage(S &storage, size_t threadsCount = 1) {
+        return {storage, threadsCount};
+    }
+}
+#pragma once
+
 #if defined(_MSC_VER)
 #if defined(__RESTORE_MIN__)
 __pragma(pop_macro("min"))
@@ -11863,19 +16507,19 @@ __pragma(pop_macro("min"))
 #include <utility>  //  std::pair
 #include <functional>  //  std::reference_wrapper
 
-    // #include "conditions.h"
+// #include "conditions.h"
 
-    // #include "operators.h"
+// #include "operators.h"
 
-    // #include "select_constraints.h"
+// #include "select_constraints.h"
 
-    // #include "prepared_statement.h"
+// #include "prepared_statement.h"
 
-    // #include "optional_container.h"
+// #include "optional_container.h"
 
-    // #include "core_functions.h"
+// #include "core_functions.h"
 
-    namespace sqlite_orm {
+namespace sqlite_orm {
 
     namespace internal {
 
@@ -12147,7 +16791,9 @@ __pragma(pop_macro("min"))
 }
 #pragma once
 
-#include <type_traits>  //  std::is_same, std::decay, std::remove_reference
+#include <type_traits>  //  std::is_same, std::decay, std::remove_reference, std::integral_constant
+#include <tuple>  //  std::tuple_size, std::forward_as_tuple, std::get
+#include <utility>  //  std::index_sequence, std::index_sequence_for, std::forward
 
 // #include "prepared_statement.h"
 
@@ -12314,6 +16960,67 @@ namespace sqlite_orm {
         });
         return internal::get_ref(*result);
     }
+
+    namespace internal {
+
+        /**
+         *  Amount of arguments of a statement accessible with `get<N>`.
+         */
+        template<class T>
+        struct statement_arguments_count
+            : std::tuple_size<typename bindable_filter<typename node_tuple<T>::type>::type> {};
+
+        template<class T, class... Ids>
+        struct statement_arguments_count<get_t<T, Ids...>> : std::integral_constant<size_t, sizeof...(Ids)> {};
+
+        template<class T, class... Ids>
+        struct statement_arguments_count<get_pointer_t<T, Ids...>> : std::integral_constant<size_t, sizeof...(Ids)> {};
+
+#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
+        template<class T, class... Ids>
+        struct statement_arguments_count<get_optional_t<T, Ids...>>
+            : std::integral_constant<size_t, sizeof...(Ids)> {};
+#endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
+
+        template<class T, class... Ids>
+        struct statement_arguments_count<remove_t<T, Ids...>> : std::integral_constant<size_t, sizeof...(Ids)> {};
+
+        template<class T>
+        struct statement_arguments_count<update_t<T>> : std::integral_constant<size_t, 1> {};
+
+        template<class T>
+        struct statement_arguments_count<insert_t<T>> : std::integral_constant<size_t, 1> {};
+
+        template<class T, class... Cols>
+        struct statement_arguments_count<insert_explicit<T, Cols...>> : std::integral_constant<size_t, 1> {};
+
+        template<class T>
+        struct statement_arguments_count<replace_t<T>> : std::integral_constant<size_t, 1> {};
+
+        template<class T, class Tuple, size_t... Is>
+        void rebind_values(prepared_statement_t<T> &statement, Tuple &&values, std::index_sequence<Is...>) {
+            using expander = int[];
+            (void)expander{0, (sqlite_orm::get<Is>(statement) = std::get<Is>(std::move(values)), 0)...};
+        }
+    }
+
+    /**
+     *  Assigns new values to all arguments of a prepared statement in the order `get<N>` uses. Values are
+     *  bound when the statement is executed next time so the statement is not prepared again.
+     *  Usage: `auto statement = storage.prepare(get_all<User>(where(c(&User::age) > 18 and c(&User::name) != "")));
+     *          for(auto age: ages) {
+     *              rebind(statement, age, "");
+     *              auto users = storage.execute(statement);
+     *          }`
+     */
+    template<class T, class... Args>
+    void rebind(internal::prepared_statement_t<T> &statement, Args &&... args) {
+        static_assert(internal::statement_arguments_count<T>::value == sizeof...(Args),
+                      "rebind must get a value for every argument of the statement");
+        internal::rebind_values(statement,
+                                std::forward_as_tuple(std::forward<Args>(args)...),
+                                std::index_sequence_for<Args...>{});
+    }
 }
 #pragma once
 
@@ -0,0 +1,140 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <thread>  //  std::thread
+#include <vector>  //  std::vector
+#include <future>  //  std::future
+
+#ifdef SQLITE_ORM_COROUTINES_SUPPORTED
+#include <coroutine>  //  std::suspend_never
+#include <exception>  //  std::terminate
+#include <stdexcept>  //  std::runtime_error
+#endif  // SQLITE_ORM_COROUTINES_SUPPORTED
+
+using namespace sqlite_orm;
+
+namespace AsyncStorageTests {
+    struct User {
+        int id = 0;
+        std::string name;
+    };
+
+    inline auto initStorage() {
+        return make_storage(
+            {},
+            make_table("users", make_column("id", &User::id, primary_key()), make_column("name", &User::name)));
+    }
+
+#ifdef SQLITE_ORM_COROUTINES_SUPPORTED
+    /**
+     *  Minimal fire and forget coroutine type.
+     */
+    struct task {
+        struct promise_type {
+            task get_return_object() {
+                return {};
+            }
+            std::suspend_never initial_suspend() noexcept {
+                return {};
+            }
+            std::suspend_never final_suspend() noexcept {
+                return {};
+            }
+            void return_void() {}
+            void unhandled_exception() {
+                std::terminate();
+            }
+        };
+    };
+#endif  // SQLITE_ORM_COROUTINES_SUPPORTED
+}
+
+TEST_CASE("Async storage") {
+    using namespace AsyncStorageTests;
+    auto storage = initStorage();
+    storage.sync_schema();
+    auto asyncStorage = make_async_storage(storage);
+    REQUIRE(asyncStorage.threads_count() == 1);
+
+    SECTION("crud") {
+        auto id = asyncStorage.insert_async(User{0, "first"}).get();
+        REQUIRE(id == 1);
+        asyncStorage.replace_async(User{2, "second"}).get();
+        REQUIRE(asyncStorage.get_async<User>(2).get().name == "second");
+        asyncStorage.update_async(User{2, "updated"}).get();
+        REQUIRE(asyncStorage.get_pointer_async<User>(2).get()->name == "updated");
+        REQUIRE(asyncStorage.get_all_async<User>().get().size() == 2);
+        REQUIRE(asyncStorage.get_all_async<User>(where(c(&User::name) == "first")).get().size() == 1);
+        asyncStorage.remove_async<User>(1).get();
+        REQUIRE_FALSE(asyncStorage.get_pointer_async<User>(1).get());
+        REQUIRE_THROWS_AS(asyncStorage.get_async<User>(1).get(), std::system_error);
+    }
+    SECTION("execute and submit") {
+        storage.replace(User{1, "first"});
+        auto statement = storage.prepare(get_all<User>(where(c(&User::id) == 1)));
+        auto rows = asyncStorage.execute_async(std::move(statement)).get();
+        REQUIRE(rows.size() == 1);
+        auto count = asyncStorage
+                         .submit([](decltype(storage) &s) {
+                             return s.count<User>();
+                         })
+                         .get();
+        REQUIRE(count == 1);
+    }
+    SECTION("many threads") {
+        std::vector<std::thread> threads;
+        for(auto t = 0; t < 4; ++t) {
+            threads.emplace_back([&asyncStorage, t] {
+                std::vector<std::future<int64>> futures;
+                for(auto i = 0; i < 25; ++i) {
+                    futures.push_back(asyncStorage.insert_async(User{0, std::to_string(t)}));
+                }
+                for(auto &future: futures) {
+                    future.get();
+                }
+            });
+        }
+        for(auto &thread: threads) {
+            thread.join();
+        }
+        REQUIRE(storage.count<User>() == 100);
+    }
+#ifdef SQLITE_ORM_COROUTINES_SUPPORTED
+    SECTION("coroutines") {
+        std::promise<std::string> done;
+        [](decltype(asyncStorage) &asyncStorage, std::promise<std::string> &done) -> task {
+            //  objects are not created inside `co_await` expressions: gcc 12 destroys such temporaries twice
+            User user{0, "coroutine"};
+            user.id = int(co_await asyncStorage.insert_co(user));
+            user = co_await asyncStorage.get_co<User>(user.id);
+            user.name += " updated";
+            co_await asyncStorage.update_co(user);
+            auto users = co_await asyncStorage.get_all_co<User>();
+            done.set_value(users.front().name);
+        }(asyncStorage, done);
+        REQUIRE(done.get_future().get() == "coroutine updated");
+    }
+    SECTION("coroutine exceptions") {
+        std::promise<int> done;
+        [](decltype(asyncStorage) &asyncStorage, std::promise<int> &done) -> task {
+            auto caughtCount = 0;
+            try {
+                co_await asyncStorage.get_co<User>(100);
+            } catch(const std::system_error &) {
+                ++caughtCount;
+            }
+            try {
+                co_await asyncStorage.schedule([](decltype(storage) &) -> int {
+                    throw std::runtime_error("job failed");
+                });
+            } catch(const std::runtime_error &) {
+                ++caughtCount;
+            }
+            User user{0, "after exceptions"};
+            co_await asyncStorage.insert_co(user);
+            auto users = co_await asyncStorage.get_all_co<User>();
+            done.set_value(caughtCount * 10 + int(users.size()));
+        }(asyncStorage, done);
+        REQUIRE(done.get_future().get() == 21);
+    }
+#endif  // SQLITE_ORM_COROUTINES_SUPPORTED
+}
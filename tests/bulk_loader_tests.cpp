@@ -0,0 +1,158 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <cstdio>  //  remove
+
+using namespace sqlite_orm;
+
+namespace BulkLoaderTests {
+    struct Item {
+        int id = 0;
+        std::string name;
+        int value = 0;
+    };
+
+    inline auto initStorage(const std::string &filename) {
+        return make_storage(filename,
+                            make_table("items",
+                                       make_column("id", &Item::id, primary_key()),
+                                       make_column("name", &Item::name),
+                                       make_column("value", &Item::value)));
+    }
+}
+
+TEST_CASE("Bulk loader") {
+    using namespace BulkLoaderTests;
+    auto storage = initStorage({});
+    storage.sync_schema();
+
+    SECTION("finish") {
+        bulk_loader_options options;
+        options.batch_size = 7;
+        options.commit_rows = 30;
+        auto loader = storage.bulk_loader<Item>(std::move(options));
+        REQUIRE(loader.batch_size() == 7);
+        for(auto i = 1; i <= 100; ++i) {
+            Item item{0, "item" + std::to_string(i), i};
+            if(i % 2) {
+                loader.push(item);
+            } else {
+                loader.push(std::move(item));
+            }
+        }
+        REQUIRE(loader.rows_count() == 100);
+        REQUIRE(loader.committed_rows_count() == 70);
+        loader.finish();
+        REQUIRE(loader.committed_rows_count() == 100);
+        REQUIRE(storage.count<Item>() == 100);
+        REQUIRE(storage.get<Item>(100).name == "item100");
+        REQUIRE(*storage.sum(&Item::value) == 5050);
+    }
+    SECTION("batch size fits variable limit") {
+        storage.limit.variable_number(10);
+        bulk_loader_options options;
+        options.batch_size = 1000;
+        auto loader = storage.bulk_loader<Item>(std::move(options));
+        REQUIRE(loader.batch_size() == 5);
+        for(auto i = 1; i <= 12; ++i) {
+            loader.push(Item{0, "item", i});
+        }
+        loader.finish();
+        REQUIRE(storage.count<Item>() == 12);
+    }
+    SECTION("uncommitted rows are rolled back") {
+        {
+            bulk_loader_options options;
+            options.batch_size = 10;
+            options.commit_rows = 20;
+            auto loader = storage.bulk_loader<Item>(std::move(options));
+            for(auto i = 1; i <= 35; ++i) {
+                loader.push(Item{0, "item", i});
+            }
+            REQUIRE(loader.committed_rows_count() == 20);
+        }
+        REQUIRE(storage.count<Item>() == 20);
+    }
+    SECTION("transaction rolled back by sqlite") {
+        auto filename = "bulk_loader_rollback.sqlite";
+        ::remove(filename);
+        auto fileStorage = initStorage(filename);
+        fileStorage.sync_schema();
+        {
+            sqlite3 *db = nullptr;
+            sqlite3_open(filename, &db);
+            REQUIRE(sqlite3_exec(db,
+                                 "CREATE TRIGGER items_rollback BEFORE INSERT ON items WHEN NEW.name = 'rollback' "
+                                 "BEGIN SELECT RAISE(ROLLBACK, 'rolled back'); END",
+                                 nullptr,
+                                 nullptr,
+                                 nullptr) == SQLITE_OK);
+            sqlite3_close(db);
+        }
+        {
+            bulk_loader_options options;
+            options.batch_size = 1;
+            options.synchronous = 0;
+            auto loader = fileStorage.bulk_loader<Item>(std::move(options));
+            loader.push(Item{0, "first", 1});
+            REQUIRE_THROWS_AS(loader.push(Item{0, "rollback", 2}), std::system_error);
+        }
+        REQUIRE_FALSE(fileStorage.in_transaction());
+        REQUIRE(fileStorage.pragma.synchronous() != 0);
+        REQUIRE(fileStorage.count<Item>() == 0);
+        fileStorage.insert(Item{0, "second", 3});
+        REQUIRE(fileStorage.count<Item>() == 1);
+    }
+    SECTION("explicit commit") {
+        auto loader = storage.bulk_loader<Item>();
+        loader.push(Item{0, "first", 1});
+        loader.commit();
+        REQUIRE(loader.committed_rows_count() == 1);
+        loader.push(Item{0, "second", 2});
+        loader.finish();
+        REQUIRE(storage.count<Item>() == 2);
+    }
+    SECTION("inside a transaction") {
+        storage.begin_transaction();
+        storage.insert(Item{0, "outer", 1});
+        try {
+            storage.bulk_loader<Item>();
+            REQUIRE(false);
+        } catch(const std::system_error &e) {
+            REQUIRE(e.code() == std::make_error_code(orm_error_code::cannot_start_a_transaction_within_a_transaction));
+        }
+        REQUIRE(storage.in_transaction());
+        storage.commit();
+        REQUIRE(storage.count<Item>() == 1);
+    }
+    SECTION("synchronous") {
+        auto synchronous = storage.pragma.synchronous();
+        REQUIRE(synchronous != 0);
+        bulk_loader_options options;
+        options.synchronous = 0;
+        {
+            auto loader = storage.bulk_loader<Item>(std::move(options));
+            loader.push(Item{0, "item", 1});
+            loader.finish();
+        }
+        REQUIRE(storage.pragma.synchronous() == synchronous);
+        REQUIRE(storage.count<Item>() == 1);
+    }
+}
+
+TEST_CASE("Bulk loader journal mode") {
+    using namespace BulkLoaderTests;
+    auto filename = "bulk_loader.sqlite";
+    ::remove(filename);
+    auto storage = initStorage(filename);
+    storage.sync_schema();
+    storage.open_forever();
+    REQUIRE(storage.pragma.journal_mode() == journal_mode::DELETE);
+    bulk_loader_options options;
+    options.journal_mode = std::make_unique<journal_mode>(journal_mode::OFF);
+    auto loader = storage.bulk_loader<Item>(std::move(options));
+    REQUIRE(storage.pragma.journal_mode() == journal_mode::OFF);
+    loader.push(Item{0, "item", 1});
+    loader.finish();
+    REQUIRE(storage.pragma.journal_mode() == journal_mode::DELETE);
+    REQUIRE(storage.count<Item>() == 1);
+}
@@ -0,0 +1,130 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <cstdio>  //  remove
+#include <thread>  //  std::thread, std::this_thread::sleep_for
+#include <chrono>  //  std::chrono::milliseconds, std::chrono::microseconds
+
+using namespace sqlite_orm;
+
+namespace BusyHandlerTests {
+    struct User {
+        int id = 0;
+        std::string name;
+    };
+
+    inline auto initStorage(const std::string &filename) {
+        return make_storage(filename,
+                            make_table("users",
+                                       make_column("id", &User::id, primary_key()),
+                                       make_column("name", &User::name)));
+    }
+
+    /**
+     *  Separate connection which holds the write lock of the database until `unlock` is called.
+     */
+    struct Locker {
+        Locker(const std::string &filename) {
+            sqlite3_open(filename.c_str(), &this->db);
+            REQUIRE(sqlite3_exec(this->db, "BEGIN IMMEDIATE", nullptr, nullptr, nullptr) == SQLITE_OK);
+        }
+
+        ~Locker() {
+            this->unlock();
+            sqlite3_close(this->db);
+        }
+
+        void unlock() {
+            if(sqlite3_get_autocommit(this->db) == 0) {
+                sqlite3_exec(this->db, "COMMIT", nullptr, nullptr, nullptr);
+            }
+        }
+
+        sqlite3 *db = nullptr;
+    };
+}
+
+TEST_CASE("Busy handler") {
+    using namespace BusyHandlerTests;
+    auto filename = "busy_handler.sqlite";
+    ::remove(filename);
+    auto storage = initStorage(filename);
+    storage.sync_schema();
+    REQUIRE(storage.busy_stats().busy_count == 0);
+
+    SECTION("exponential backoff") {
+        storage.busy_handler(exponential_backoff_policy(std::chrono::milliseconds(5000)));
+        {
+            Locker locker(filename);
+            std::thread unlocker([&locker] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                locker.unlock();
+            });
+            storage.insert(User{0, "Alice"});
+            unlocker.join();
+        }
+        REQUIRE(storage.count<User>() == 1);
+        auto stats = storage.busy_stats();
+        REQUIRE(stats.busy_count >= 1);
+        REQUIRE(stats.attempts_count >= stats.busy_count);
+        REQUIRE(stats.timeouts_count == 0);
+        REQUIRE(stats.total_wait >= std::chrono::milliseconds(20));
+        REQUIRE(stats.max_wait <= stats.total_wait);
+        REQUIRE(stats.max_wait > std::chrono::microseconds(0));
+    }
+    SECTION("spin then sleep") {
+        storage.busy_handler(spin_then_sleep_policy(std::chrono::milliseconds(5000), 10));
+        {
+            Locker locker(filename);
+            std::thread unlocker([&locker] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(30));
+                locker.unlock();
+            });
+            storage.insert(User{0, "Alice"});
+            unlocker.join();
+        }
+        auto stats = storage.busy_stats();
+        REQUIRE(stats.busy_count >= 1);
+        REQUIRE(stats.attempts_count > 10);
+        REQUIRE(stats.timeouts_count == 0);
+    }
+    SECTION("timeout") {
+        storage.busy_handler(exponential_backoff_policy(std::chrono::milliseconds(20)));
+        Locker locker(filename);
+        try {
+            storage.insert(User{0, "Alice"});
+            REQUIRE(false);
+        } catch(const std::system_error &e) {
+            REQUIRE(e.code().value() == SQLITE_BUSY);
+        }
+        auto stats = storage.busy_stats();
+        REQUIRE(stats.busy_count == 1);
+        REQUIRE(stats.timeouts_count == 1);
+        REQUIRE(stats.max_wait >= std::chrono::milliseconds(20));
+    }
+    SECTION("callback") {
+        std::vector<int> attempts;
+        storage.busy_handler({[&attempts](int attempt, std::chrono::microseconds) {
+            attempts.push_back(attempt);
+            return attempt < 2;
+        }});
+        Locker locker(filename);
+        REQUIRE_THROWS_AS(storage.insert(User{0, "Alice"}), std::system_error);
+        REQUIRE(attempts == std::vector<int>{0, 1, 2});
+        auto stats = storage.busy_stats();
+        REQUIRE(stats.busy_count == 1);
+        REQUIRE(stats.attempts_count == 3);
+        REQUIRE(stats.timeouts_count == 1);
+    }
+    SECTION("busy timeout removes handler") {
+        auto calls = 0;
+        storage.busy_handler({[&calls](int, std::chrono::microseconds) {
+            ++calls;
+            return false;
+        }});
+        storage.busy_timeout(10);
+        Locker locker(filename);
+        REQUIRE_THROWS_AS(storage.insert(User{0, "Alice"}), std::system_error);
+        REQUIRE(calls == 0);
+        REQUIRE(storage.busy_stats().busy_count == 0);
+    }
+}
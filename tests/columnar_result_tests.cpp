@@ -0,0 +1,97 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+
+using namespace sqlite_orm;
+
+namespace ColumnarResultTests {
+    struct Measurement {
+        int id = 0;
+        std::string sensor;
+        double value = 0;
+        std::unique_ptr<double> error;
+    };
+}
+
+TEST_CASE("Columnar result") {
+    using namespace ColumnarResultTests;
+    auto storage = make_storage({},
+                                make_table("measurements",
+                                           make_column("id", &Measurement::id, primary_key()),
+                                           make_column("sensor", &Measurement::sensor),
+                                           make_column("value", &Measurement::value),
+                                           make_column("error", &Measurement::error)));
+    storage.sync_schema();
+    const auto rowsCount = 150;
+    storage.transaction([&storage, rowsCount] {
+        for(auto i = 1; i <= rowsCount; ++i) {
+            Measurement measurement;
+            measurement.id = i;
+            measurement.sensor = "sensor" + std::to_string(i % 3);
+            measurement.value = i * 0.5;
+            if(i % 10) {
+                measurement.error = std::make_unique<double>(i * 0.01);
+            }
+            storage.replace(measurement);
+        }
+        return true;
+    });
+
+    SECTION("all rows") {
+        auto res = storage.select_columns(
+            columns(&Measurement::id, &Measurement::sensor, &Measurement::value, &Measurement::error),
+            order_by(&Measurement::id));
+        static_assert(decltype(res)::count == 4, "");
+        REQUIRE(res.size() == size_t(rowsCount));
+        auto &ids = res.values<0>();
+        auto &sensors = res.values<1>();
+        auto &values = res.values<2>();
+        auto &errors = res.column<3>();
+        static_assert(std::is_same<std::decay<decltype(ids)>::type, std::vector<int>>::value, "");
+        static_assert(std::is_same<std::decay<decltype(errors.values)>::type, std::vector<double>>::value, "");
+        for(auto i = 0; i < rowsCount; ++i) {
+            auto id = i + 1;
+            REQUIRE(ids[i] == id);
+            REQUIRE(sensors[i] == "sensor" + std::to_string(id % 3));
+            REQUIRE(values[i] == id * 0.5);
+            if(id % 10) {
+                REQUIRE_FALSE(errors.is_null(i));
+                REQUIRE(errors.values[i] == Approx(id * 0.01));
+            } else {
+                REQUIRE(errors.is_null(i));
+                REQUIRE(errors.values[i] == 0);
+            }
+        }
+        REQUIRE(res.column<0>().null_bitmap.empty());
+        REQUIRE_FALSE(res.column<0>().is_null(0));
+        REQUIRE(errors.null_bitmap.size() == 3);
+        REQUIRE(errors.null_bitmap[0] == ((1ull << 9) | (1ull << 19) | (1ull << 29) | (1ull << 39) | (1ull << 49) |
+                                          (1ull << 59)));
+    }
+    SECTION("conditions") {
+        auto res = storage.select_columns(columns(&Measurement::value),
+                                          where(c(&Measurement::sensor) == "sensor0" and c(&Measurement::id) <= 9),
+                                          order_by(&Measurement::id));
+        REQUIRE(res.values<0>() == std::vector<double>{1.5, 3, 4.5});
+    }
+    SECTION("empty") {
+        auto res = storage.select_columns(columns(&Measurement::id, &Measurement::error),
+                                          where(c(&Measurement::id) > rowsCount));
+        REQUIRE(res.empty());
+        REQUIRE(res.column<1>().null_bitmap.empty());
+    }
+    SECTION("prepared statement") {
+        auto statement = storage.prepare(select(columns(&Measurement::id, sum(&Measurement::value)),
+                                                group_by(&Measurement::sensor),
+                                                order_by(&Measurement::sensor)));
+        auto res = storage.execute_columnar(statement);
+        REQUIRE(res.size() == 3);
+        REQUIRE_FALSE(res.column<1>().is_null(0));
+    }
+    SECTION("null aggregate") {
+        auto res = storage.select_columns(columns(count(&Measurement::id), max(&Measurement::value)),
+                                          where(c(&Measurement::id) > rowsCount));
+        REQUIRE(res.size() == 1);
+        REQUIRE(res.values<0>().front() == 0);
+        REQUIRE(res.column<1>().is_null(0));
+    }
+}
@@ -0,0 +1,108 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <cstdio>  //  remove
+#include <thread>  //  std::this_thread::sleep_for
+#include <chrono>  //  std::chrono::milliseconds
+#include <cctype>  //  ::tolower
+#include <stdexcept>  //  std::runtime_error
+
+using namespace sqlite_orm;
+
+namespace ConnectionLifetimeTests {
+    struct User {
+        int id = 0;
+        std::string name;
+    };
+
+    inline auto initStorage(const std::string &filename) {
+        return make_storage(filename,
+                            make_table("users",
+                                       make_column("id", &User::id, primary_key()),
+                                       make_column("name", &User::name)));
+    }
+}
+
+TEST_CASE("Connection lifetime") {
+    using namespace ConnectionLifetimeTests;
+    auto filename = "connection_lifetime.sqlite";
+    ::remove(filename);
+    auto storage = initStorage(filename);
+    storage.sync_schema();
+    storage.replace(User{1, "Alice"});
+
+    SECTION("per call") {
+        REQUIRE(storage.get_connection_lifetime() == connection_lifetime::per_call);
+        auto opensCount = storage.connection_opens_count();
+        auto closesCount = storage.connection_closes_count();
+        for(auto i = 0; i < 5; ++i) {
+            REQUIRE(storage.get<User>(1).name == "Alice");
+        }
+        REQUIRE(storage.connection_opens_count() == opensCount + 5);
+        REQUIRE(storage.connection_closes_count() == closesCount + 5);
+    }
+    SECTION("on_open throws") {
+        auto throwOnOpen = true;
+        auto onOpenCalls = 0;
+        storage.on_open = [&throwOnOpen, &onOpenCalls](sqlite3 *) {
+            ++onOpenCalls;
+            if(throwOnOpen) {
+                throw std::runtime_error("on_open failed");
+            }
+        };
+        REQUIRE_THROWS_AS(storage.get<User>(1), std::runtime_error);
+        throwOnOpen = false;
+        REQUIRE(storage.get<User>(1).name == "Alice");
+        REQUIRE(onOpenCalls == 2);
+        auto opensCount = storage.connection_opens_count();
+        REQUIRE(storage.get<User>(1).name == "Alice");
+        REQUIRE(storage.connection_opens_count() == opensCount + 1);
+        REQUIRE(onOpenCalls == 3);
+    }
+    SECTION("always open") {
+        storage.set_connection_lifetime(connection_lifetime::always_open);
+        auto opensCount = storage.connection_opens_count();
+        for(auto i = 0; i < 5; ++i) {
+            REQUIRE(storage.get<User>(1).name == "Alice");
+            storage.replace(User{2, "Bob" + std::to_string(i)});
+        }
+        REQUIRE(storage.connection_opens_count() == opensCount + 1);
+        auto closesCount = storage.connection_closes_count();
+        storage.set_connection_lifetime(connection_lifetime::per_call);
+        REQUIRE(storage.connection_closes_count() == closesCount + 1);
+        REQUIRE(storage.get<User>(2).name == "Bob4");
+    }
+    SECTION("idle timeout") {
+        storage.set_connection_lifetime(connection_lifetime::idle_timeout, std::chrono::milliseconds(50));
+        auto opensCount = storage.connection_opens_count();
+        auto closesCount = storage.connection_closes_count();
+        for(auto i = 0; i < 5; ++i) {
+            REQUIRE(storage.count<User>() == 1);
+        }
+        REQUIRE(storage.connection_opens_count() == opensCount + 1);
+        auto waited = 0;
+        while(storage.connection_closes_count() == closesCount && waited < 5000) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            waited += 10;
+        }
+        REQUIRE(storage.connection_closes_count() == closesCount + 1);
+        REQUIRE(storage.count<User>() == 1);
+        REQUIRE(storage.connection_opens_count() == opensCount + 2);
+    }
+    SECTION("collation while idle") {
+        storage.set_connection_lifetime(connection_lifetime::always_open);
+        REQUIRE(storage.count<User>() == 1);
+        storage.create_collation("ignore_case", [](int leftLength, const void *lhs, int rightLength, const void *rhs) {
+            std::string left((const char *)lhs, size_t(leftLength));
+            std::string right((const char *)rhs, size_t(rightLength));
+            for(auto &c: left) {
+                c = char(::tolower(c));
+            }
+            for(auto &c: right) {
+                c = char(::tolower(c));
+            }
+            return left.compare(right);
+        });
+        auto ids = storage.select(&User::id, where(is_equal(&User::name, "ALICE").collate("ignore_case")));
+        REQUIRE(ids == std::vector<int>{1});
+    }
+}
@@ -0,0 +1,114 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <cstdio>  //  remove
+#include <thread>  //  std::thread
+#include <vector>  //  std::vector
+#include <atomic>  //  std::atomic_int
+
+using namespace sqlite_orm;
+
+namespace ConnectionPoolTests {
+    struct User {
+        int id = 0;
+        std::string name;
+    };
+
+    inline auto initStorage(const std::string &filename, pool_options options) {
+        return make_storage(filename,
+                            options,
+                            make_table("users",
+                                       make_column("id", &User::id, primary_key()),
+                                       make_column("name", &User::name)));
+    }
+}
+
+TEST_CASE("Connection pool") {
+    using namespace ConnectionPoolTests;
+    auto filename = "connection_pool.sqlite";
+    ::remove(filename);
+    auto storage = initStorage(filename, pool_options{3});
+    storage.sync_schema();
+    storage.pragma.journal_mode(journal_mode::WAL);
+    REQUIRE(storage.opened_readers_count() == 0);
+
+    storage.transaction([&storage] {
+        for(auto i = 1; i <= 100; ++i) {
+            storage.replace(User{i, "user" + std::to_string(i)});
+        }
+        return true;
+    });
+
+    SECTION("single thread") {
+        REQUIRE(storage.count<User>() == 100);
+        REQUIRE(storage.get<User>(5).name == "user5");
+        REQUIRE(storage.opened_readers_count() == 1);
+        {
+            auto statement = storage.prepare(get_all<User>());
+            REQUIRE(storage.count<User>() == 100);
+            REQUIRE(storage.opened_readers_count() == 2);
+            REQUIRE(storage.execute(statement).size() == 100);
+        }
+        REQUIRE(storage.get_all<User>().size() == 100);
+        REQUIRE(storage.opened_readers_count() == 2);
+    }
+    SECTION("readers see committed data") {
+        REQUIRE(storage.count<User>() == 100);
+        storage.remove<User>(1);
+        REQUIRE(storage.count<User>() == 99);
+        REQUIRE(storage.get_pointer<User>(1) == nullptr);
+    }
+    SECTION("transaction reads its own writes") {
+        storage.begin_transaction();
+        storage.replace(User{101, "new"});
+        REQUIRE(storage.count<User>() == 101);
+        REQUIRE(storage.get<User>(101).name == "new");
+        storage.rollback();
+        REQUIRE(storage.count<User>() == 100);
+    }
+    SECTION("iterate") {
+        auto count = 0;
+        for(auto &user: storage.iterate<User>()) {
+            REQUIRE(!user.name.empty());
+            ++count;
+        }
+        REQUIRE(count == 100);
+    }
+    SECTION("many threads") {
+        std::atomic_int errorsCount{0};
+        std::vector<std::thread> threads;
+        for(auto t = 0; t < 6; ++t) {
+            threads.emplace_back([&storage, &errorsCount, t] {
+                for(auto i = 0; i < 50; ++i) {
+                    auto id = (t * 50 + i) % 100 + 1;
+                    auto user = storage.get_pointer<User>(id);
+                    if(!user || user->name != "user" + std::to_string(id)) {
+                        ++errorsCount;
+                    }
+                    if(storage.count<User>() != 100) {
+                        ++errorsCount;
+                    }
+                }
+            });
+        }
+        for(auto &thread: threads) {
+            thread.join();
+        }
+        REQUIRE(errorsCount == 0);
+        REQUIRE(storage.opened_readers_count() >= 1);
+        REQUIRE(storage.opened_readers_count() <= 3);
+    }
+    SECTION("copy") {
+        auto storageCopy = storage;
+        REQUIRE(storageCopy.count<User>() == 100);
+        REQUIRE(storageCopy.opened_readers_count() == 1);
+    }
+}
+
+TEST_CASE("Connection pool in memory") {
+    using namespace ConnectionPoolTests;
+    auto storage = initStorage({}, pool_options{2});
+    storage.sync_schema();
+    storage.replace(User{1, "first"});
+    REQUIRE(storage.count<User>() == 1);
+    REQUIRE(storage.opened_readers_count() == 0);
+}
@@ -0,0 +1,82 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <string>  //  std::string
+#include <vector>  //  std::vector
+#include <utility>  //  std::move
+
+using namespace sqlite_orm;
+
+namespace ConstructorTests {
+    struct Point {
+        int id;
+        std::string name;
+        double x;
+
+        Point(int id_, std::string name_, double x_) : id(id_), name(std::move(name_)), x(x_) {}
+    };
+
+    struct Reading {
+        const int id;
+        const std::string sensor;
+        const double value;
+    };
+}
+
+TEST_CASE("Constructor") {
+    using namespace ConstructorTests;
+    auto storage = make_storage({},
+                                make_table("points",
+                                           make_column("id", &Point::id, primary_key()),
+                                           make_column("name", &Point::name),
+                                           make_column("x", &Point::x),
+                                           constructor()),
+                                make_table("readings",
+                                           make_column("id", &Reading::id, primary_key()),
+                                           make_column("sensor", &Reading::sensor),
+                                           make_column("value", &Reading::value),
+                                           factory([](int id, std::string sensor, double value) {
+                                               return Reading{id, std::move(sensor), value};
+                                           })));
+    static_assert(internal::storage_traits::storage_columns_count<decltype(storage), Point>::value == 3,
+                  "constructor is not a column");
+    storage.sync_schema();
+    REQUIRE(storage.sync_schema_simulate()["points"] == sync_schema_result::already_in_sync);
+
+    SECTION("constructor") {
+        storage.replace(Point{1, "first", 0.5});
+        storage.replace(Point{2, "second", 1.5});
+        auto point = storage.get<Point>(2);
+        REQUIRE(point.name == "second");
+        REQUIRE(point.x == 1.5);
+        REQUIRE(storage.get_pointer<Point>(1)->name == "first");
+        REQUIRE_FALSE(storage.get_pointer<Point>(3));
+#ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
+        REQUIRE(storage.get_optional<Point>(1)->x == 0.5);
+#endif
+        auto points = storage.get_all<Point>(order_by(&Point::id));
+        REQUIRE(points.size() == 2);
+        REQUIRE(points[0].name == "first");
+        REQUIRE(points[1].name == "second");
+        REQUIRE(storage.get_all_pointer<Point>(where(c(&Point::x) > 1)).size() == 1);
+        std::vector<std::string> names;
+        for(auto &p: storage.iterate<Point>()) {
+            names.push_back(p.name);
+        }
+        REQUIRE(names == std::vector<std::string>{"first", "second"});
+    }
+    SECTION("factory and const members") {
+        storage.replace(Reading{1, "temperature", 21.5});
+        storage.replace(Reading{2, "humidity", 40});
+        storage.update(Reading{2, "humidity", 45});
+        auto reading = storage.get<Reading>(2);
+        REQUIRE(reading.sensor == "humidity");
+        REQUIRE(reading.value == 45);
+        auto readings = storage.get_all<Reading>(where(c(&Reading::sensor) == "temperature"));
+        REQUIRE(readings.size() == 1);
+        REQUIRE(readings.front().value == 21.5);
+        auto sensors = storage.select(&Reading::sensor, order_by(&Reading::id));
+        REQUIRE(sensors == std::vector<std::string>{"temperature", "humidity"});
+        storage.remove<Reading>(1);
+        REQUIRE(storage.count<Reading>() == 1);
+    }
+}
@@ -0,0 +1,3 @@
+//  Catch main of `coroutine_tests`: async storage tests built as C++20 so coroutine awaitables are compiled
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
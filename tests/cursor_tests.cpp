@@ -0,0 +1,118 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+
+using namespace sqlite_orm;
+
+namespace CursorTests {
+    struct User {
+        int id = 0;
+        std::string name;
+        std::vector<char> blob;
+    };
+
+    struct Visit {
+        int id = 0;
+        std::string url;
+
+        int getId() const {
+            return this->id;
+        }
+
+        void setId(int value) {
+            this->id = value;
+        }
+
+        const std::string &getUrl() const {
+            return this->url;
+        }
+
+        void setUrl(std::string value) {
+            this->url = std::move(value);
+        }
+    };
+}
+
+TEST_CASE("Cursor") {
+    using namespace CursorTests;
+    auto storage = make_storage({},
+                                make_table("users",
+                                           make_column("id", &User::id, primary_key()),
+                                           make_column("name", &User::name),
+                                           make_column("blob", &User::blob)),
+                                make_table("visits",
+                                           make_column("id", &Visit::setId, &Visit::getId, primary_key()),
+                                           make_column("url", &Visit::getUrl, &Visit::setUrl)));
+    storage.sync_schema();
+    for(auto i = 1; i <= 10; ++i) {
+        storage.replace(User{i, "user" + std::to_string(i), std::vector<char>(size_t(i), char(i))});
+    }
+
+    SECTION("next") {
+        auto cursor = storage.stream<User>(order_by(&User::id));
+        auto id = 0;
+        while(cursor.next()) {
+            ++id;
+            auto &user = cursor.current();
+            REQUIRE(user.id == id);
+            REQUIRE(user.name == "user" + std::to_string(id));
+            REQUIRE(user.blob == std::vector<char>(size_t(id), char(id)));
+        }
+        REQUIRE(id == 10);
+        REQUIRE(cursor.done());
+        REQUIRE_FALSE(cursor.next());
+    }
+    SECTION("same object") {
+        auto cursor = storage.stream<User>();
+        REQUIRE(cursor.next());
+        auto pointer = &cursor.current();
+        REQUIRE(cursor.next());
+        REQUIRE(pointer == &cursor.current());
+    }
+    SECTION("conditions") {
+        auto cursor = storage.stream<User>(where(c(&User::id) > 3 and c(&User::id) <= 5), order_by(&User::id).desc());
+        std::vector<int> ids;
+        while(cursor.next()) {
+            ids.push_back(cursor.current().id);
+        }
+        REQUIRE(ids == std::vector<int>{5, 4});
+    }
+    SECTION("batch") {
+        auto cursor = storage.stream<User>(order_by(&User::id));
+        std::vector<User> rows;
+        REQUIRE(cursor.next(rows, 4) == 4);
+        REQUIRE(rows.size() == 4);
+        REQUIRE(rows.front().id == 1);
+        REQUIRE(rows.back().id == 4);
+        auto data = rows.data();
+        REQUIRE(cursor.next(rows, 4) == 4);
+        REQUIRE(rows.data() == data);
+        REQUIRE(rows.front().id == 5);
+        REQUIRE(rows.back().name == "user8");
+        REQUIRE(cursor.next(rows, 4) == 2);
+        REQUIRE(rows.size() == 2);
+        REQUIRE(rows.back().id == 10);
+        REQUIRE(cursor.next(rows, 4) == 0);
+        REQUIRE(rows.empty());
+        REQUIRE(cursor.done());
+    }
+    SECTION("shorter values") {
+        auto cursor = storage.stream<User>(order_by(&User::id).desc());
+        REQUIRE(cursor.next());
+        REQUIRE(cursor.current().name == "user10");
+        REQUIRE(cursor.current().blob.size() == 10);
+        REQUIRE(cursor.next());
+        REQUIRE(cursor.current().name == "user9");
+        REQUIRE(cursor.current().blob == std::vector<char>(9, char(9)));
+    }
+    SECTION("setters") {
+        storage.replace(Visit{1, "https://github.com"});
+        storage.replace(Visit{2, "https://sqlite.org"});
+        auto cursor = storage.stream<Visit>(order_by(&Visit::getId));
+        REQUIRE(cursor.next());
+        REQUIRE(cursor.current().id == 1);
+        REQUIRE(cursor.current().url == "https://github.com");
+        REQUIRE(cursor.next());
+        REQUIRE(cursor.current().url == "https://sqlite.org");
+        REQUIRE_FALSE(cursor.next());
+    }
+}
@@ -0,0 +1,111 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <cstdio>  //  remove
+
+using namespace sqlite_orm;
+
+namespace OpenOptionsTests {
+    struct User {
+        int id = 0;
+        std::string name;
+    };
+
+    template<class... Args>
+    auto initStorage(const std::string &filename, Args... args) {
+        return make_storage(filename,
+                            args...,
+                            make_table("users",
+                                       make_column("id", &User::id, primary_key()),
+                                       make_column("name", &User::name)));
+    }
+}
+
+TEST_CASE("Open options") {
+    using namespace OpenOptionsTests;
+    auto filename = "open_options.sqlite";
+    ::remove(filename);
+    {
+        auto storage = initStorage(filename);
+        storage.sync_schema();
+        storage.replace(User{1, "Alice"});
+        storage.replace(User{2, "Bob"});
+    }
+
+    SECTION("default") {
+        auto storage = initStorage(filename, open_options{});
+        REQUIRE(storage.count<User>() == 2);
+        storage.replace(User{3, "Carl"});
+        REQUIRE(storage.count<User>() == 3);
+    }
+    SECTION("read only") {
+        open_options options;
+        options.flags = SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX;
+        auto storage = initStorage(filename, options);
+        REQUIRE(storage.get_open_options().flags == options.flags);
+        REQUIRE(storage.get<User>(2).name == "Bob");
+        REQUIRE_THROWS_AS(storage.replace(User{3, "Carl"}), std::system_error);
+    }
+    SECTION("uri parameters") {
+        open_options options;
+        options.flags = SQLITE_OPEN_READWRITE;
+        options.uri_parameters = {{"mode", "ro"}};
+        auto storage = initStorage(filename, options);
+        REQUIRE(storage.count<User>() == 2);
+        REQUIRE_THROWS_AS(storage.remove<User>(1), std::system_error);
+
+        open_options immutableOptions;
+        immutableOptions.flags = SQLITE_OPEN_READONLY;
+        immutableOptions.uri_parameters = {{"immutable", "1"}};
+        auto immutableStorage = initStorage(filename, immutableOptions, pool_options{2});
+        REQUIRE(immutableStorage.get_all<User>().size() == 2);
+        REQUIRE(immutableStorage.opened_readers_count() == 1);
+    }
+    SECTION("not existing file") {
+        auto notExistingFilename = "open_options_not_existing.sqlite";
+        ::remove(notExistingFilename);
+        open_options options;
+        options.flags = SQLITE_OPEN_READWRITE;
+        auto storage = initStorage(notExistingFilename, options);
+        REQUIRE_THROWS_AS(storage.sync_schema(), std::system_error);
+    }
+    SECTION("vfs") {
+        open_options options;
+        options.vfs = sqlite3_vfs_find(nullptr)->zName;
+        auto storage = initStorage(filename, options);
+        REQUIRE(storage.count<User>() == 2);
+
+        open_options badOptions;
+        badOptions.vfs = "not_existing_vfs";
+        auto badStorage = initStorage(filename, badOptions);
+        REQUIRE_THROWS_AS(badStorage.count<User>(), std::system_error);
+    }
+    SECTION("backup") {
+        auto backupFilename = "open_options_backup.sqlite";
+        ::remove(backupFilename);
+        {
+            auto storage = initStorage(filename);
+            storage.backup_to(backupFilename);
+        }
+        auto storage = initStorage({});
+        storage.sync_schema();
+        open_options options;
+        options.flags = SQLITE_OPEN_READONLY;
+        options.uri_parameters = {{"immutable", "1"}};
+        storage.backup_from(backupFilename, options);
+        REQUIRE(storage.count<User>() == 2);
+
+        auto backup = storage.make_backup_to(backupFilename, options);
+        REQUIRE(backup.step(-1) == SQLITE_READONLY);
+    }
+}
+
+TEST_CASE("Open filename") {
+    open_options options;
+    REQUIRE(internal::open_filename("db.sqlite", options) == "db.sqlite");
+    REQUIRE(internal::open_flags(options) == (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE));
+
+    options.uri_parameters = {{"mode", "ro"}, {"a&b", "c=d"}};
+    REQUIRE(internal::open_filename("dir/a?b#c%.sqlite", options) ==
+            "file:dir/a%3Fb%23c%25.sqlite?mode=ro&a%26b=c%3Dd");
+    REQUIRE((internal::open_flags(options) & SQLITE_OPEN_URI) != 0);
+}
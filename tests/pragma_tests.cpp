@@ -1,5 +1,8 @@
 #include <sqlite_orm/sqlite_orm.h>
 #include <cstdio>  //  ::remove
+#include <atomic>  //  std::atomic_int
+#include <thread>  //  std::thread
+#include <vector>  //  std::vector
 #include <catch2/catch.hpp>
 
 using namespace sqlite_orm;
@@ -99,3 +102,68 @@ TEST_CASE("Auto vacuum") {
     storage.pragma.auto_vacuum(2);
     REQUIRE(storage.pragma.auto_vacuum() == 2);
 }
+
+TEST_CASE("Performance pragmas") {
+    auto filename = "performance_pragmas.sqlite";
+    ::remove(filename);
+    auto storage = make_storage(filename);
+
+    storage.pragma.page_size(8192);
+    storage.pragma.cache_size(-20000);
+    storage.pragma.mmap_size(1 << 20);
+    storage.pragma.temp_store(temp_store::MEMORY);
+    storage.pragma.wal_autocheckpoint(500);
+    storage.pragma.busy_timeout(1500);
+    storage.pragma.locking_mode(locking_mode::NORMAL);
+    storage.busy_timeout(2500);
+
+    //  every call opens a new connection so values are read from a reopened handle
+    REQUIRE(storage.pragma.page_size() == 8192);
+    REQUIRE(storage.pragma.cache_size() == -20000);
+    REQUIRE(storage.pragma.mmap_size() == 1 << 20);
+    REQUIRE(storage.pragma.temp_store() == temp_store::MEMORY);
+    REQUIRE(storage.pragma.wal_autocheckpoint() == 500);
+    REQUIRE(storage.pragma.busy_timeout() == 2500);
+    REQUIRE(storage.pragma.locking_mode() == locking_mode::NORMAL);
+
+    SECTION("copy") {
+        auto storageCopy = storage;
+        REQUIRE(storageCopy.pragma.cache_size() == -20000);
+        REQUIRE(storageCopy.pragma.temp_store() == temp_store::MEMORY);
+    }
+    SECTION("locking mode") {
+        storage.pragma.locking_mode(locking_mode::EXCLUSIVE);
+        REQUIRE(storage.pragma.locking_mode() == locking_mode::EXCLUSIVE);
+        storage.pragma.temp_store(temp_store::FILE);
+        REQUIRE(storage.pragma.temp_store() == temp_store::FILE);
+    }
+    SECTION("readers") {
+        auto pooledStorage = make_storage(filename, pool_options{1});
+        pooledStorage.pragma.cache_size(-1000);
+        auto statement = pooledStorage.prepare(select(1));
+        auto db = statement.con.get();
+        sqlite3_stmt *stmt = nullptr;
+        REQUIRE(sqlite3_prepare_v2(db, "PRAGMA cache_size", -1, &stmt, nullptr) == SQLITE_OK);
+        REQUIRE(sqlite3_step(stmt) == SQLITE_ROW);
+        REQUIRE(sqlite3_column_int(stmt, 0) == -1000);
+        sqlite3_finalize(stmt);
+    }
+    SECTION("readers opened while pragmas are set") {
+        auto pooledStorage = make_storage(filename, pool_options{4});
+        std::atomic_int rowsCount{0};
+        std::vector<std::thread> threads;
+        for(auto i = 0; i < 4; ++i) {
+            threads.emplace_back([&pooledStorage, &rowsCount] {
+                rowsCount += int(pooledStorage.select(1).size());
+            });
+        }
+        for(auto i = 0; i < 20; ++i) {
+            pooledStorage.pragma.cache_size(-1000 - i);
+        }
+        for(auto &thread: threads) {
+            thread.join();
+        }
+        REQUIRE(rowsCount == 4);
+        REQUIRE(pooledStorage.pragma.cache_size() == -1019);
+    }
+}
@@ -0,0 +1,81 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <string>  //  std::string
+
+#include "prepared_common.h"
+
+using namespace sqlite_orm;
+
+TEST_CASE("Prepared rebind") {
+    using namespace PreparedStatementTests;
+    using Catch::Matchers::UnorderedEquals;
+
+    auto filename = "prepared.sqlite";
+    remove(filename);
+    auto storage = make_storage(
+        filename,
+        make_table("users", make_column("id", &User::id, primary_key()), make_column("name", &User::name)));
+    storage.sync_schema();
+    storage.set_connection_lifetime(connection_lifetime::always_open);
+
+    storage.replace(User{1, "Team BS"});
+    storage.replace(User{2, "Shy'm"});
+    storage.replace(User{3, "Maître Gims"});
+
+    SECTION("get all") {
+        auto statement = storage.prepare(get_all<User>(where(c(&User::id) > 0 and c(&User::name) != "")));
+        auto stmt = statement.stmt;
+        REQUIRE(storage.execute(statement).size() == 3);
+
+        rebind(statement, 1, "Shy'm");
+        REQUIRE(get<0>(statement) == 1);
+        REQUIRE(std::string(get<1>(statement)) == "Shy'm");
+        std::vector<User> expected;
+        expected.push_back(User{3, "Maître Gims"});
+        REQUIRE_THAT(storage.execute(statement), UnorderedEquals(expected));
+
+        for(auto id = 0; id < 3; ++id) {
+            rebind(statement, id, "");
+            REQUIRE(storage.execute(statement).size() == size_t(3 - id));
+        }
+        REQUIRE(statement.stmt == stmt);
+    }
+    SECTION("bindings don't outlive execute") {
+        auto statement = storage.prepare(get_all<User>(where(c(&User::name) == std::string(64, 'a'))));
+        REQUIRE(storage.execute(statement).empty());
+        get<0>(statement) = std::string(128, 'b');
+#if SQLITE_VERSION_NUMBER >= 3014000
+        auto expanded = statement.expanded_sql();
+        REQUIRE(expanded.find("NULL") != std::string::npos);
+        REQUIRE(expanded.find(std::string(64, 'a')) == std::string::npos);
+#endif
+        REQUIRE(storage.execute(statement).empty());
+        REQUIRE(get<0>(statement) == std::string(128, 'b'));
+    }
+    SECTION("by reference") {
+        auto id = 2;
+        auto statement = storage.prepare(get_all<User>(where(c(&User::id) >= std::ref(id))));
+        rebind(statement, 3);
+        REQUIRE(id == 3);
+        REQUIRE(storage.execute(statement).size() == 1);
+    }
+    SECTION("get") {
+        auto statement = storage.prepare(get<User>(1));
+        REQUIRE(storage.execute(statement).name == "Team BS");
+        rebind(statement, 2);
+        REQUIRE(storage.execute(statement).name == "Shy'm");
+    }
+    SECTION("replace") {
+        auto statement = storage.prepare(replace(User{1, "Team BS"}));
+        rebind(statement, User{4, "Vald"});
+        storage.execute(statement);
+        REQUIRE(storage.get<User>(4).name == "Vald");
+    }
+    SECTION("select") {
+        auto statement = storage.prepare(select(&User::name, where(c(&User::id) == 0), limit(1)));
+        rebind(statement, 3, 1);
+        REQUIRE(storage.execute(statement) == std::vector<std::string>{"Maître Gims"});
+        rebind(statement, 1, 0);
+        REQUIRE(storage.execute(statement).empty());
+    }
+}
@@ -0,0 +1,101 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <vector>  //  std::vector
+#include <cstdio>  //  ::remove
+
+using namespace sqlite_orm;
+
+TEST_CASE("Range chunks") {
+    struct Point {
+        int id = 0;
+        int x = 0;
+        int y = 0;
+        std::string name;
+    };
+    auto storage = make_storage({},
+                                make_table("points",
+                                           make_column("id", &Point::id, primary_key()),
+                                           make_column("x", &Point::x),
+                                           make_column("y", &Point::y),
+                                           make_column("name", &Point::name, unique())));
+    storage.sync_schema();
+    storage.limit.variable_number(10);
+    REQUIRE(storage.limit.variable_number() == 10);
+
+    std::vector<Point> points;
+    for(auto i = 1; i <= 100; ++i) {
+        points.push_back(Point{i, i * 2, i * 3, "point" + std::to_string(i)});
+    }
+
+    SECTION("insert_range") {
+        storage.insert_range(points.begin(), points.end());
+        REQUIRE(storage.count<Point>() == 100);
+        for(auto &point: points) {
+            auto inserted = storage.get<Point>(point.id);
+            REQUIRE(inserted.x == point.x);
+            REQUIRE(inserted.y == point.y);
+            REQUIRE(inserted.name == point.name);
+        }
+    }
+    SECTION("replace_range") {
+        storage.replace_range(points.begin(), points.end());
+        REQUIRE(storage.count<Point>() == 100);
+        for(auto &point: points) {
+            point.x = -point.x;
+        }
+        storage.replace_range(points.begin() + 1, points.end());
+        REQUIRE(storage.count<Point>() == 100);
+        REQUIRE(storage.get<Point>(1).x == 2);
+        REQUIRE(storage.get<Point>(2).x == -4);
+        REQUIRE(storage.get<Point>(100).x == -200);
+    }
+    SECTION("failed chunk rolls back all chunks") {
+        points.back().name = points.front().name;
+        REQUIRE_THROWS_AS(storage.insert_range(points.begin(), points.end()), std::system_error);
+        REQUIRE(storage.count<Point>() == 0);
+    }
+    SECTION("chunk which rolls back the transaction") {
+        auto filename = "range_chunks_rollback.sqlite";
+        ::remove(filename);
+        auto fileStorage = make_storage(filename,
+                                        make_table("points",
+                                                   make_column("id", &Point::id, primary_key()),
+                                                   make_column("x", &Point::x),
+                                                   make_column("y", &Point::y),
+                                                   make_column("name", &Point::name, unique())));
+        fileStorage.sync_schema();
+        {
+            sqlite3 *db = nullptr;
+            sqlite3_open(filename, &db);
+            REQUIRE(sqlite3_exec(db,
+                                 "CREATE TRIGGER points_rollback BEFORE INSERT ON points WHEN NEW.name = 'rollback' "
+                                 "BEGIN SELECT RAISE(ROLLBACK, 'rolled back'); END",
+                                 nullptr,
+                                 nullptr,
+                                 nullptr) == SQLITE_OK);
+            sqlite3_close(db);
+        }
+        fileStorage.limit.variable_number(4);
+        points[50].name = "rollback";
+        try {
+            fileStorage.insert_range(points.begin(), points.end());
+            REQUIRE(false);
+        } catch(const std::system_error &e) {
+            REQUIRE(std::string(e.what()).find("rolled back") != std::string::npos);
+        }
+        REQUIRE_FALSE(fileStorage.in_transaction());
+        REQUIRE(fileStorage.count<Point>() == 0);
+        REQUIRE(fileStorage.transaction([&fileStorage] {
+            fileStorage.insert(Point{0, 1, 2, "after"});
+            return true;
+        }));
+        REQUIRE(fileStorage.count<Point>() == 1);
+    }
+    SECTION("explicit transaction") {
+        storage.begin_transaction();
+        storage.insert_range(points.begin(), points.end());
+        REQUIRE(storage.count<Point>() == 100);
+        storage.rollback();
+        REQUIRE(storage.count<Point>() == 0);
+    }
+}
@@ -0,0 +1,112 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <cstdio>  //  ::remove
+#include <deque>  //  std::deque
+#include <list>  //  std::list
+#include <memory>  //  std::unique_ptr
+#include <string>  //  std::string, std::to_string
+#include <tuple>  //  std::tuple, std::get
+#include <vector>  //  std::vector
+
+using namespace sqlite_orm;
+
+namespace ResultContainerTests {
+    struct User {
+        int id = 0;
+        std::string name;
+    };
+
+    inline auto initStorage(const std::string &filename) {
+        return make_storage(filename,
+                            make_table("users",
+                                       make_column("id", &User::id, primary_key()),
+                                       make_column("name", &User::name)));
+    }
+}
+
+TEST_CASE("into") {
+    using namespace ResultContainerTests;
+    auto storage = initStorage({});
+    storage.sync_schema();
+    storage.transaction([&storage] {
+        for(auto i = 1; i <= 10; ++i) {
+            storage.replace(User{i, "user" + std::to_string(i)});
+        }
+        return true;
+    });
+
+    SECTION("get_all keeps capacity") {
+        std::vector<User> users;
+        REQUIRE(&storage.get_all<User>(into(users)) == &users);
+        REQUIRE(users.size() == 10);
+        auto data = users.data();
+        storage.get_all<User>(into(users), where(c(&User::id) > 5), order_by(&User::id));
+        REQUIRE(users.size() == 5);
+        REQUIRE(users.front().id == 6);
+        REQUIRE(users.data() == data);
+        storage.get_all<User>(into(users), where(c(&User::id) > 10));
+        REQUIRE(users.empty());
+    }
+    SECTION("get_all_pointer") {
+        std::deque<std::unique_ptr<User>> users;
+        users.push_back(std::make_unique<User>());
+        storage.get_all_pointer<User>(into(users), where(c(&User::id) <= 3));
+        REQUIRE(users.size() == 3);
+        REQUIRE(users.back()->name == "user3");
+    }
+    SECTION("select") {
+        std::list<int> ids{100};
+        storage.select(into(ids), &User::id, where(c(&User::id) < 3), order_by(&User::id));
+        REQUIRE(ids == std::list<int>{1, 2});
+        std::vector<std::tuple<int, std::string>> rows;
+        storage.select(into(rows), columns(&User::id, &User::name), where(c(&User::id) == 4));
+        REQUIRE(rows.size() == 1);
+        REQUIRE(std::get<1>(rows.front()) == "user4");
+    }
+    SECTION("prepared statement") {
+        auto statement = storage.prepare(get_all<User>(where(c(&User::id) > 8)));
+        std::vector<User> users;
+        storage.execute(statement, into(users));
+        storage.execute(statement, into(users));
+        REQUIRE(users.size() == 2);
+    }
+}
+
+TEST_CASE("Result size estimate") {
+    using namespace ResultContainerTests;
+    auto filename = "result_size_estimate.sqlite";
+    ::remove(filename);
+    auto storage = initStorage(filename);
+    storage.sync_schema();
+    storage.transaction([&storage] {
+        for(auto i = 1; i <= 100; ++i) {
+            storage.replace(User{i, "user" + std::to_string(i)});
+        }
+        return true;
+    });
+    {
+        sqlite3 *db = nullptr;
+        sqlite3_open(filename, &db);
+        REQUIRE(sqlite3_exec(db, "ANALYZE", nullptr, nullptr, nullptr) == SQLITE_OK);
+        sqlite3_close(db);
+    }
+    storage.remove_all<User>(where(c(&User::id) > 80));
+
+    REQUIRE_FALSE(storage.result_size_estimate_enabled());
+    storage.enable_result_size_estimate();
+    REQUIRE(storage.result_size_estimate_enabled());
+
+    //  the first estimate is read from sqlite_stat1
+    auto users = storage.get_all<User>(order_by(&User::id));
+    REQUIRE(users.size() == 80);
+    REQUIRE(users.capacity() == 100);
+
+    //  then the size of the previous result is used
+    REQUIRE(storage.get_all_pointer<User>().capacity() == 80);
+
+    //  filtered results are not reserved
+    REQUIRE(storage.get_all<User>(where(c(&User::id) <= 5)).capacity() < 80);
+
+    storage.enable_result_size_estimate(false);
+    REQUIRE(storage.get_all<User>().capacity() != 80);
+}
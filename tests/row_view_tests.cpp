@@ -0,0 +1,105 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+
+using namespace sqlite_orm;
+
+namespace RowViewTests {
+    struct Document {
+        int id = 0;
+        std::string title;
+        std::vector<char> content;
+        std::unique_ptr<std::string> note;
+    };
+}
+
+TEST_CASE("Visit rows") {
+    using namespace RowViewTests;
+    auto storage = make_storage({},
+                                make_table("documents",
+                                           make_column("id", &Document::id, primary_key()),
+                                           make_column("title", &Document::title),
+                                           make_column("content", &Document::content),
+                                           make_column("note", &Document::note)));
+    storage.sync_schema();
+    for(auto i = 1; i <= 5; ++i) {
+        Document document;
+        document.id = i;
+        document.title = "title" + std::to_string(i);
+        document.content = std::vector<char>(size_t(i), 'a');
+        if(i % 2) {
+            document.note = std::make_unique<std::string>("note");
+        }
+        storage.replace(document);
+    }
+
+    SECTION("blob_view") {
+        std::vector<size_t> sizes;
+        storage.visit(
+            columns(&Document::id, &Document::content),
+            [&sizes](auto &row) {
+                auto content = row.template get<blob_view>(1);
+                REQUIRE(std::all_of(content.begin(), content.end(), [](char c) {
+                    return c == 'a';
+                }));
+                sizes.push_back(content.size());
+            },
+            order_by(&Document::id));
+        REQUIRE(sizes == std::vector<size_t>{1, 2, 3, 4, 5});
+    }
+    SECTION("conditions and nulls") {
+        std::vector<int> ids;
+        std::vector<bool> nulls;
+        storage.visit(
+            columns(&Document::id, &Document::note),
+            [&ids, &nulls](auto &row) {
+                REQUIRE(row.columns_count() == 2);
+                ids.push_back(row.template get<int>(0));
+                nulls.push_back(row.is_null(1));
+            },
+            where(c(&Document::id) >= 3),
+            order_by(&Document::id));
+        REQUIRE(ids == std::vector<int>{3, 4, 5});
+        REQUIRE(nulls == std::vector<bool>{false, true, false});
+    }
+    SECTION("prepared statement") {
+        auto statement = storage.prepare(select(&Document::title, where(c(&Document::id) == 2)));
+        std::string title;
+        storage.visit(statement, [&title](auto &row) {
+            title = row.template get<std::string>(0);
+        });
+        REQUIRE(title == "title2");
+        get<0>(statement) = 4;
+        storage.visit(statement, [&title](auto &row) {
+            title = row.template get<std::string>(0);
+        });
+        REQUIRE(title == "title4");
+    }
+    SECTION("empty blob") {
+        storage.update_all(set(c(&Document::content) = std::vector<char>{}), where(c(&Document::id) == 1));
+        storage.visit(
+            &Document::content,
+            [](auto &row) {
+                auto content = row.template get<blob_view>(0);
+                REQUIRE(content.empty());
+            },
+            where(c(&Document::id) == 1));
+    }
+#ifdef SQLITE_ORM_STRING_VIEW_SUPPORTED
+    SECTION("string_view") {
+        std::vector<std::string> titles;
+        storage.visit(
+            columns(&Document::title, &Document::note),
+            [&titles](auto &row) {
+                auto title = row.template get<std::string_view>(0);
+                if(title.substr(5) != "3") {
+                    titles.emplace_back(title);
+                }
+                if(row.is_null(1)) {
+                    REQUIRE(row.template get<std::string_view>(1).empty());
+                }
+            },
+            order_by(&Document::id));
+        REQUIRE(titles == std::vector<std::string>{"title1", "title2", "title4", "title5"});
+    }
+#endif  // SQLITE_ORM_STRING_VIEW_SUPPORTED
+}
@@ -0,0 +1,114 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <vector>  //  std::vector
+#include <array>  //  std::array
+#include <string>  //  std::string
+#include <cstdint>  //  uint8_t
+#ifdef SQLITE_ORM_STRING_VIEW_SUPPORTED
+#include <string_view>  //  std::string_view
+#endif  //  SQLITE_ORM_STRING_VIEW_SUPPORTED
+
+using namespace sqlite_orm;
+
+namespace StatementBinderTests {
+    struct Document {
+        int id = 0;
+        std::string json;
+        std::vector<uint8_t> payload;
+    };
+
+    class Record {
+        int id = 0;
+        std::string text;
+
+      public:
+        Record() = default;
+
+        Record(int id_, std::string text_) : id(id_), text(std::move(text_)) {}
+
+        int getId() const {
+            return this->id;
+        }
+
+        void setId(int value) {
+            this->id = value;
+        }
+
+        std::string getText() const {
+            return this->text;
+        }
+
+        void setText(std::string value) {
+            this->text = std::move(value);
+        }
+    };
+}
+
+TEST_CASE("Binding text and blobs") {
+    using namespace StatementBinderTests;
+    auto storage = make_storage({},
+                                make_table("documents",
+                                           make_column("id", &Document::id, primary_key()),
+                                           make_column("json", &Document::json),
+                                           make_column("payload", &Document::payload)),
+                                make_table("records",
+                                           make_column("id", &Record::getId, &Record::setId, primary_key()),
+                                           make_column("text", &Record::getText, &Record::setText)));
+    storage.sync_schema();
+    std::string json(10000, 'j');
+    std::vector<uint8_t> payload{0, 1, 2, 255};
+    storage.replace(Document{1, json, payload});
+    storage.replace(Document{2, "{}", {}});
+
+    SECTION("std::string and std::vector<uint8_t>") {
+        auto document = storage.get<Document>(1);
+        REQUIRE(document.json == json);
+        REQUIRE(document.payload == payload);
+        REQUIRE(storage.get<Document>(2).payload.empty());
+        REQUIRE(storage.count<Document>(where(c(&Document::payload) == payload)) == 1);
+        REQUIRE(storage.count<Document>(where(is_equal(&Document::json, std::string("{}")))) == 1);
+    }
+    SECTION("std::vector<uint8_t> inside in") {
+        std::vector<uint8_t> ids{1, 3};
+        REQUIRE(storage.count<Document>(where(in(&Document::id, ids))) == 1);
+    }
+    SECTION("blob_view") {
+        std::vector<char> bytes{char(0), char(1), char(2), char(255)};
+        blob_view view{bytes.data(), bytes.size()};
+        REQUIRE(storage.count<Document>(where(c(&Document::payload) == view)) == 1);
+    }
+    SECTION("getter returning by value") {
+        std::vector<Record> records;
+        for(auto i = 1; i <= 3; ++i) {
+            records.emplace_back(i, std::string(100, char('a' + i)));
+        }
+        storage.replace_range(records.begin(), records.end());
+        storage.replace(Record{4, std::string(100, 'e')});
+        auto statement = storage.prepare(replace(Record{5, std::string(100, 'f')}));
+        storage.execute(statement);
+        for(auto i = 1; i <= 5; ++i) {
+            REQUIRE(storage.get<Record>(i).getText() == std::string(100, char('a' + i)));
+        }
+    }
+    SECTION("cached statements") {
+        storage.enable_statement_cache();
+        for(auto i = 0; i < 3; ++i) {
+            storage.replace(Document{3, std::to_string(i), {uint8_t(i)}});
+            REQUIRE(storage.get<Document>(3).json == std::to_string(i));
+        }
+        REQUIRE(storage.statement_cache_hits() > 0);
+    }
+#ifdef SQLITE_ORM_STRING_VIEW_SUPPORTED
+    SECTION("std::string_view") {
+        std::string_view view = json;
+        REQUIRE(storage.count<Document>(where(c(&Document::json) == view)) == 1);
+        REQUIRE(storage.count<Document>(where(c(&Document::json) == std::string_view{})) == 0);
+    }
+#endif  //  SQLITE_ORM_STRING_VIEW_SUPPORTED
+#ifdef SQLITE_ORM_BYTE_SUPPORTED
+    SECTION("std::array<std::byte, N>") {
+        std::array<std::byte, 4> bytes{std::byte{0}, std::byte{1}, std::byte{2}, std::byte{255}};
+        REQUIRE(storage.count<Document>(where(c(&Document::payload) == bytes)) == 1);
+    }
+#endif  //  SQLITE_ORM_BYTE_SUPPORTED
+}
@@ -0,0 +1,152 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <vector>  //  std::vector
+#include <cstdio>  //  remove
+
+using namespace sqlite_orm;
+
+namespace StatementCacheTests {
+    struct User {
+        int id = 0;
+        std::string name;
+    };
+
+    inline bool operator==(const User &lhs, const User &rhs) {
+        return lhs.id == rhs.id && lhs.name == rhs.name;
+    }
+
+    inline auto initStorage() {
+        return make_storage(
+            {},
+            make_table("users", make_column("id", &User::id, primary_key()), make_column("name", &User::name)));
+    }
+}
+
+TEST_CASE("Statement cache") {
+    using namespace StatementCacheTests;
+    auto storage = initStorage();
+    storage.open_forever();
+    storage.sync_schema();
+    REQUIRE_FALSE(storage.statement_cache_enabled());
+
+    SECTION("disabled") {
+        storage.replace(User{1, "first"});
+        REQUIRE(storage.get<User>(1).name == "first");
+        REQUIRE(storage.statement_cache_hits() == 0);
+        REQUIRE(storage.statement_cache_misses() == 0);
+    }
+    SECTION("enabled") {
+        storage.enable_statement_cache();
+        REQUIRE(storage.statement_cache_enabled());
+
+        storage.replace(User{1, "first"});
+        storage.replace(User{2, "second"});
+        REQUIRE(storage.statement_cache_misses() == 1);
+        REQUIRE(storage.statement_cache_hits() == 1);
+
+        REQUIRE(storage.get<User>(1) == User{1, "first"});
+        REQUIRE(storage.get<User>(2) == User{2, "second"});
+        REQUIRE(storage.get_pointer<User>(3) == nullptr);
+        REQUIRE(storage.statement_cache_misses() == 3);
+        REQUIRE(storage.statement_cache_hits() == 2);
+
+        storage.update(User{1, "updated"});
+        REQUIRE(storage.get<User>(1).name == "updated");
+        storage.remove<User>(2);
+        REQUIRE(storage.get_pointer<User>(2) == nullptr);
+
+        auto id = storage.insert(User{0, "inserted"});
+        REQUIRE(storage.get<User>(id).name == "inserted");
+        id = storage.insert(User{0, "inserted again"});
+        REQUIRE(storage.get<User>(id).name == "inserted again");
+        REQUIRE(storage.count<User>() == 3);
+
+        SECTION("statements with different sql are cached separately") {
+            auto misses = storage.statement_cache_misses();
+            auto hits = storage.statement_cache_hits();
+            REQUIRE(storage.get_all<User>(where(c(&User::id) == 1)).size() == 1);
+            REQUIRE(storage.get_all<User>(where(c(&User::id) < 10)).size() == 3);
+            REQUIRE(storage.get_all<User>(where(c(&User::id) == 10)).size() == 0);
+            REQUIRE(storage.statement_cache_misses() == misses + 2);
+            REQUIRE(storage.statement_cache_hits() == hits + 1);
+        }
+        SECTION("statement in use is not shared") {
+            auto misses = storage.statement_cache_misses();
+            auto first = storage.prepare(get<User>(1));
+            auto second = storage.prepare(get<User>(1));
+            REQUIRE(first.stmt != second.stmt);
+            REQUIRE(storage.statement_cache_misses() == misses + 1);
+            REQUIRE(storage.execute(first) == storage.execute(second));
+        }
+        SECTION("sync_schema clears cache") {
+            auto misses = storage.statement_cache_misses();
+            storage.sync_schema();
+            REQUIRE(storage.get<User>(1).name == "updated");
+            REQUIRE(storage.statement_cache_misses() == misses + 1);
+        }
+        SECTION("drop_table clears cache") {
+            storage.drop_table("users");
+            REQUIRE_THROWS_AS(storage.get<User>(1), std::system_error);
+            storage.sync_schema();
+            REQUIRE(storage.count<User>() == 0);
+        }
+        SECTION("disable") {
+            storage.enable_statement_cache(false);
+            auto misses = storage.statement_cache_misses();
+            auto hits = storage.statement_cache_hits();
+            REQUIRE(storage.get<User>(1).name == "updated");
+            REQUIRE(storage.statement_cache_misses() == misses);
+            REQUIRE(storage.statement_cache_hits() == hits);
+        }
+    }
+}
+
+TEST_CASE("Prepare flags") {
+    using namespace StatementCacheTests;
+    auto filename = "prepare_flags.sqlite";
+    ::remove(filename);
+    auto storage = make_storage(
+        filename,
+        make_table("users", make_column("id", &User::id, primary_key()), make_column("name", &User::name)));
+    sqlite3 *db = nullptr;
+    storage.on_open = [&db](sqlite3 *db_) {
+        db = db_;
+    };
+    storage.open_forever();
+    storage.sync_schema();
+    storage.replace(User{1, "first"});
+    auto lookasideUsed = [&db] {
+        int current = 0;
+        int highwater = 0;
+        sqlite3_db_status(db, SQLITE_DBSTATUS_LOOKASIDE_USED, &current, &highwater, 0);
+        return current;
+    };
+    auto prepareStatements = [&storage](prepare_flags flags) {
+        std::vector<decltype(storage.prepare(get<User>(1)))> statements;
+        for(auto i = 0; i < 10; ++i) {
+            statements.push_back(storage.prepare(get<User>(1), flags));
+            REQUIRE(storage.execute(statements.back()).name == "first");
+        }
+        return statements;
+    };
+
+    auto before = lookasideUsed();
+    int transientUsed = 0;
+    {
+        auto statements = prepareStatements(prepare_flags::none);
+        transientUsed = lookasideUsed() - before;
+    }
+    int persistentUsed = 0;
+    {
+        auto statements = prepareStatements(prepare_flags::persistent);
+        persistentUsed = lookasideUsed() - before;
+    }
+    //  lookaside may be disabled (SQLITE_OMIT_LOOKASIDE) so both can be zero
+    REQUIRE(persistentUsed <= transientUsed);
+
+    SECTION("cached statements are persistent") {
+        storage.enable_statement_cache();
+        auto cached = prepareStatements(prepare_flags::none);
+        REQUIRE(lookasideUsed() - before == persistentUsed);
+    }
+}
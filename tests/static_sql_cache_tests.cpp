@@ -0,0 +1,55 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+
+using namespace sqlite_orm;
+
+TEST_CASE("Static sql cache") {
+    struct User {
+        int id = 0;
+        std::string name;
+    };
+    struct Visit {
+        int userId = 0;
+        std::string date;
+    };
+    auto storage = make_storage(
+        {},
+        make_table("users", make_column("id", &User::id, primary_key()), make_column("name", &User::name)),
+        make_table("visits", make_column("user_id", &Visit::userId), make_column("date", &Visit::date)));
+    storage.sync_schema();
+
+    SECTION("statements are serialized once and reused") {
+        for(auto i = 1; i <= 3; ++i) {
+            auto id = storage.insert(User{0, "user" + std::to_string(i)});
+            REQUIRE(id == i);
+            REQUIRE(storage.get<User>(id).name == "user" + std::to_string(i));
+            storage.update(User{id, "updated" + std::to_string(i)});
+            REQUIRE(storage.get_pointer<User>(id)->name == "updated" + std::to_string(i));
+            storage.replace(User{id, "replaced" + std::to_string(i)});
+            REQUIRE(storage.get<User>(id).name == "replaced" + std::to_string(i));
+        }
+        storage.remove<User>(2);
+        REQUIRE(storage.count<User>() == 2);
+        REQUIRE_FALSE(storage.get_pointer<User>(2));
+        REQUIRE(storage.static_sql_serializations_count() == 5);
+    }
+    SECTION("copy serializes its own statements") {
+        storage.replace(User{1, "first"});
+        REQUIRE(storage.get<User>(1).name == "first");
+        REQUIRE(storage.static_sql_serializations_count() == 2);
+        auto storageCopy = storage;
+        REQUIRE(storageCopy.static_sql_serializations_count() == 0);
+        storageCopy.sync_schema();
+        storageCopy.replace(User{1, "copy"});
+        REQUIRE(storageCopy.get<User>(1).name == "copy");
+        REQUIRE(storageCopy.static_sql_serializations_count() == 2);
+        REQUIRE(storage.static_sql_serializations_count() == 2);
+    }
+    SECTION("serialization error is not cached") {
+        REQUIRE_THROWS_AS(storage.get<Visit>(1), std::system_error);
+        REQUIRE_THROWS_AS(storage.get<Visit>(1), std::system_error);
+        REQUIRE(storage.static_sql_serializations_count() == 0);
+        storage.insert(Visit{1, "today"});
+        REQUIRE(storage.count<Visit>() == 1);
+    }
+}
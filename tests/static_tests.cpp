@@ -50,6 +50,7 @@ TEST_CASE("Column") {
         static_assert(std::is_same<column_type::getter_type, const int &(User::*)() const>::value,
                       "Incorrect getter_type");
         static_assert(std::is_same<column_type::setter_type, void (User::*)(int)>::value, "Incorrect setter_type");
+        static_assert(std::is_same<column_type::access_type, internal::field_access>::value, "Incorrect access_type");
     }
     {
         using column_type = decltype(make_column("id", &User::getIdByRefConst, &User::setIdByVal));
@@ -60,6 +61,8 @@ TEST_CASE("Column") {
         static_assert(std::is_same<column_type::getter_type, const int &(User::*)() const>::value,
                       "Incorrect getter_type");
         static_assert(std::is_same<column_type::setter_type, void (User::*)(int)>::value, "Incorrect setter_type");
+        static_assert(std::is_same<column_type::access_type, internal::getter_setter_access>::value,
+                      "Incorrect access_type");
     }
     {
         using column_type = decltype(make_column("id", &User::setIdByVal, &User::getIdByRefConst));
@@ -70,6 +73,8 @@ TEST_CASE("Column") {
         static_assert(std::is_same<column_type::getter_type, const int &(User::*)() const>::value,
                       "Incorrect getter_type");
         static_assert(std::is_same<column_type::setter_type, void (User::*)(int)>::value, "Incorrect setter_type");
+        static_assert(std::is_same<column_type::access_type, internal::getter_setter_access>::value,
+                      "Incorrect access_type");
     }
     {
         using column_type = decltype(make_column("id", &User::getIdByRef, &User::setIdByConstRef));
@@ -2,6 +2,9 @@
 #include <catch2/catch.hpp>
 #include <memory>  //  std::unique_ptr, std::shared_ptr
 #include <string>  //  std::string
+#include <vector>  //  std::vector
+#include <array>  //  std::array
+#include <cstdint>  //  uint8_t
 #ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
 #include <optional>  //  std::optional
 #endif  // SQLITE_ORM_OPTIONAL_SUPPORTED
@@ -21,6 +24,17 @@ TEST_CASE("is_bindable") {
     static_assert(internal::is_bindable<std::nullptr_t>::value, "null must be bindable");
     static_assert(internal::is_bindable<std::unique_ptr<int>>::value, "unique_ptr must be bindable");
     static_assert(internal::is_bindable<std::shared_ptr<int>>::value, "shared_ptr must be bindable");
+    static_assert(internal::is_bindable<std::vector<char>>::value, "vector<char> must be bindable");
+    static_assert(internal::is_bindable<std::vector<uint8_t>>::value, "vector<uint8_t> must be bindable");
+    static_assert(internal::is_bindable<std::array<unsigned char, 4>>::value, "array of bytes must be bindable");
+    static_assert(internal::is_bindable<blob_view>::value, "blob_view must be bindable");
+    static_assert(!internal::is_bindable<std::vector<int>>::value, "vector<int> cannot be bindable");
+#ifdef SQLITE_ORM_STRING_VIEW_SUPPORTED
+    static_assert(internal::is_bindable<std::string_view>::value, "string_view must be bindable");
+#endif  // SQLITE_ORM_STRING_VIEW_SUPPORTED
+#ifdef SQLITE_ORM_BYTE_SUPPORTED
+    static_assert(internal::is_bindable<std::array<std::byte, 4>>::value, "array<std::byte> must be bindable");
+#endif  // SQLITE_ORM_BYTE_SUPPORTED
 
 #ifdef SQLITE_ORM_OPTIONAL_SUPPORTED
     static_assert(internal::is_bindable<std::optional<int>>::value, "optional must be bindable");
@@ -0,0 +1,316 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <cstdio>  //  remove
+#include <thread>  //  std::thread, std::this_thread::sleep_for
+#include <chrono>  //  std::chrono::milliseconds
+#include <vector>  //  std::vector
+#include <atomic>  //  std::atomic_int
+#include <stdexcept>  //  std::runtime_error
+
+using namespace sqlite_orm;
+
+namespace TransactionTests {
+    struct Counter {
+        int id = 0;
+        int value = 0;
+    };
+
+    inline auto initStorage(const std::string &filename) {
+        return make_storage(filename,
+                            make_table("counters",
+                                       make_column("id", &Counter::id, primary_key()),
+                                       make_column("value", &Counter::value)));
+    }
+
+    /**
+     *  Increments the counter with a read and a write in `writersCount` threads. Every thread has its own
+     *  storage so every writer has its own connection just like a separate process would.
+     */
+    inline void runWriters(const std::string &filename, transaction_options options, std::atomic_int &callsCount) {
+        const auto writersCount = 4;
+        const auto incrementsCount = 25;
+        std::vector<std::thread> threads;
+        for(auto i = 0; i < writersCount; ++i) {
+            threads.emplace_back([&filename, options, &callsCount] {
+                auto storage = initStorage(filename);
+                for(auto j = 0; j < incrementsCount; ++j) {
+                    storage.transaction(
+                        [&storage, &callsCount] {
+                            ++callsCount;
+                            auto counter = storage.get<Counter>(1);
+                            ++counter.value;
+                            storage.update(counter);
+                            return true;
+                        },
+                        options);
+                }
+            });
+        }
+        for(auto &thread: threads) {
+            thread.join();
+        }
+        REQUIRE(initStorage(filename).get<Counter>(1).value == writersCount * incrementsCount);
+        REQUIRE(callsCount >= writersCount * incrementsCount);
+    }
+}
+
+TEST_CASE("Transaction retries") {
+    using namespace TransactionTests;
+    auto filename = "transaction_retries.sqlite";
+    ::remove(filename);
+    auto storage = initStorage(filename);
+    storage.sync_schema();
+    storage.replace(Counter{1, 0});
+
+    transaction_options options;
+    options.max_retries = 10000;
+    options.backoff = std::chrono::microseconds(100);
+    options.max_backoff = std::chrono::microseconds(2000);
+    std::atomic_int callsCount{0};
+
+    SECTION("concurrent immediate writers") {
+        runWriters(filename, options, callsCount);
+    }
+    SECTION("concurrent deferred writers") {
+        options.mode = transaction_mode::deferred;
+        runWriters(filename, options, callsCount);
+    }
+    SECTION("concurrent exclusive writers in WAL mode") {
+        storage.pragma.journal_mode(journal_mode::WAL);
+        options.mode = transaction_mode::exclusive;
+        runWriters(filename, options, callsCount);
+    }
+    SECTION("rollback") {
+        auto res = storage.transaction(
+            [&storage] {
+                storage.update_all(set(c(&Counter::value) = 5));
+                return false;
+            },
+            options);
+        REQUIRE_FALSE(res);
+        REQUIRE(storage.get<Counter>(1).value == 0);
+    }
+    SECTION("other errors are not retried") {
+        auto calls = 0;
+        REQUIRE_THROWS_AS(storage.transaction(
+                              [&storage, &calls]() -> bool {
+                                  ++calls;
+                                  storage.update_all(set(c(&Counter::value) = 5));
+                                  throw std::runtime_error("fail");
+                              },
+                              options),
+                          std::runtime_error);
+        REQUIRE(calls == 1);
+        REQUIRE(storage.get<Counter>(1).value == 0);
+
+        //  connection is released and no transaction is left active
+        storage.begin_transaction();
+        storage.rollback();
+    }
+    SECTION("retries are limited") {
+        sqlite3 *db = nullptr;
+        sqlite3_open(filename, &db);
+        REQUIRE(sqlite3_exec(db, "BEGIN EXCLUSIVE", nullptr, nullptr, nullptr) == SQLITE_OK);
+        options.max_retries = 2;
+        try {
+            storage.transaction(
+                [&callsCount] {
+                    ++callsCount;
+                    return true;
+                },
+                options);
+            REQUIRE(false);
+        } catch(const std::system_error &e) {
+            REQUIRE(e.code().value() == SQLITE_BUSY);
+        }
+        REQUIRE(callsCount == 0);
+        sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr);
+        sqlite3_close(db);
+        REQUIRE(storage.transaction(
+            [&callsCount] {
+                ++callsCount;
+                return true;
+            },
+            options));
+        REQUIRE(callsCount == 1);
+    }
+    SECTION("guard waits for a lock") {
+        sqlite3 *db = nullptr;
+        sqlite3_open(filename, &db);
+        REQUIRE(sqlite3_exec(db, "BEGIN IMMEDIATE", nullptr, nullptr, nullptr) == SQLITE_OK);
+        std::thread unlocker([db] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(30));
+            sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr);
+        });
+        {
+            auto guard = storage.transaction_guard(options);
+            auto counter = storage.get<Counter>(1);
+            counter.value = 10;
+            storage.update(counter);
+            guard.commit();
+        }
+        unlocker.join();
+        sqlite3_close(db);
+        REQUIRE(storage.get<Counter>(1).value == 10);
+    }
+}
+
+TEST_CASE("Savepoints") {
+    using namespace TransactionTests;
+    auto filename = "savepoints.sqlite";
+    ::remove(filename);
+    auto storage = initStorage(filename);
+    storage.sync_schema();
+    storage.replace(Counter{1, 0});
+    auto setValue = [&storage](int value) {
+        storage.update_all(set(c(&Counter::value) = value));
+    };
+    auto getValue = [&storage] {
+        return storage.get<Counter>(1).value;
+    };
+
+    SECTION("savepoint outside of transaction") {
+        REQUIRE_FALSE(storage.in_transaction());
+        storage.savepoint("outer");
+        REQUIRE(storage.in_transaction());
+        setValue(1);
+        storage.savepoint("inner");
+        setValue(2);
+        storage.rollback_to_savepoint("inner");
+        REQUIRE(getValue() == 1);
+        storage.release_savepoint("inner");
+        REQUIRE(storage.in_transaction());
+        storage.release_savepoint("outer");
+        REQUIRE_FALSE(storage.in_transaction());
+        REQUIRE(getValue() == 1);
+    }
+    SECTION("quoted savepoint name") {
+        const std::string name = "my \"savepoint\"; DROP TABLE counters; --";
+        storage.savepoint(name);
+        setValue(1);
+        {
+            auto guard = storage.savepoint_guard(name + "\"");
+            setValue(2);
+        }
+        REQUIRE(getValue() == 1);
+        storage.rollback_to_savepoint(name);
+        storage.release_savepoint(name);
+        REQUIRE_FALSE(storage.in_transaction());
+        REQUIRE(getValue() == 0);
+        REQUIRE(storage.table_exists("counters"));
+    }
+    SECTION("nested transaction rolled back") {
+        storage.transaction([&] {
+            setValue(1);
+            auto res = storage.transaction([&] {
+                setValue(2);
+                return false;
+            });
+            REQUIRE_FALSE(res);
+            REQUIRE(getValue() == 1);
+            return true;
+        });
+        REQUIRE_FALSE(storage.in_transaction());
+        REQUIRE(getValue() == 1);
+    }
+    SECTION("nested transaction is committed by the outer one") {
+        storage.transaction([&] {
+            storage.transaction([&] {
+                storage.transaction([&] {
+                    setValue(3);
+                    return true;
+                });
+                return true;
+            });
+            return false;
+        });
+        REQUIRE(getValue() == 0);
+    }
+    SECTION("nested transaction with options") {
+        transaction_options options;
+        storage.transaction(
+            [&] {
+                setValue(1);
+                storage.transaction(
+                    [&] {
+                        setValue(2);
+                        return true;
+                    },
+                    options);
+                return true;
+            },
+            options);
+        REQUIRE(getValue() == 2);
+    }
+    SECTION("exception inside nested transaction") {
+        storage.transaction([&] {
+            setValue(1);
+            try {
+                storage.transaction([&]() -> bool {
+                    setValue(2);
+                    throw std::runtime_error("fail");
+                });
+            } catch(const std::runtime_error &) {
+            }
+            REQUIRE(getValue() == 1);
+            return true;
+        });
+        REQUIRE(getValue() == 1);
+    }
+    SECTION("guards") {
+        auto guard = storage.transaction_guard();
+        setValue(1);
+        {
+            auto nestedGuard = storage.transaction_guard();
+            setValue(2);
+        }
+        REQUIRE(getValue() == 1);
+        {
+            auto savepointGuard = storage.savepoint_guard("batch");
+            setValue(3);
+            savepointGuard.commit();
+        }
+        guard.commit();
+        REQUIRE_FALSE(storage.in_transaction());
+        REQUIRE(getValue() == 3);
+    }
+}
+
+TEST_CASE("Transaction control statements are cached") {
+    using namespace TransactionTests;
+    auto filename = "control_statements.sqlite";
+    ::remove(filename);
+    auto storage = initStorage(filename);
+    sqlite3 *db = nullptr;
+    storage.on_open = [&db](sqlite3 *db_) {
+        db = db_;
+    };
+    storage.sync_schema();
+    auto statementsCount = [&db] {
+        auto res = 0;
+        for(auto stmt = sqlite3_next_stmt(db, nullptr); stmt; stmt = sqlite3_next_stmt(db, stmt)) {
+            ++res;
+        }
+        return res;
+    };
+    storage.set_connection_lifetime(connection_lifetime::always_open);
+    storage.transaction([] {
+        return true;
+    });
+    REQUIRE(statementsCount() == 2);
+    for(auto i = 0; i < 3; ++i) {
+        storage.transaction([] {
+            return false;
+        });
+        auto guard = storage.transaction_guard();
+        guard.commit();
+    }
+    REQUIRE(statementsCount() == 3);
+
+    //  statements are finalized before the connection is closed
+    storage.set_connection_lifetime(connection_lifetime::per_call);
+    REQUIRE(storage.connection_closes_count() > 0);
+    storage.transaction([] {
+        return true;
+    });
+}
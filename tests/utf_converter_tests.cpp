@@ -0,0 +1,72 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <string>  //  std::string, std::wstring, std::u16string
+
+using namespace sqlite_orm;
+using internal::utf_converter;
+
+namespace UtfConverterTests {
+    struct Message {
+        int id = 0;
+        std::wstring wide;
+        std::u16string utf16;
+    };
+
+    //  "aé€😀" in UTF-8
+    const std::string utf8Text = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+    const std::u16string utf16Text = u"aé€\U0001F600";
+    const std::wstring wideText = L"aé€\U0001F600";
+}
+
+TEST_CASE("utf_converter") {
+    using namespace UtfConverterTests;
+    SECTION("valid") {
+        REQUIRE(utf_converter::to_utf8(utf16Text.data(), utf16Text.size()) == utf8Text);
+        REQUIRE(utf_converter::to_utf8(wideText.data(), wideText.size()) == utf8Text);
+        REQUIRE(utf_converter::from_utf8<char16_t>(utf8Text.data(), utf8Text.size()) == utf16Text);
+        REQUIRE(utf_converter::from_utf8<wchar_t>(utf8Text.data(), utf8Text.size()) == wideText);
+        REQUIRE(utf_converter::from_utf8<char16_t>("", 0).empty());
+    }
+    SECTION("malformed") {
+        const std::string truncated = "a\xE2\x82";
+        REQUIRE(utf_converter::from_utf8<char16_t>(truncated.data(), truncated.size()) == u"a�");
+        const std::string overlong = "\xC0\xAF";
+        REQUIRE(utf_converter::from_utf8<char16_t>(overlong.data(), overlong.size()) == u"�");
+        const std::string surrogate = "\xED\xA0\x80";
+        REQUIRE(utf_converter::from_utf8<char16_t>(surrogate.data(), surrogate.size()) == u"�");
+        const std::string continuation = "\x80z";
+        REQUIRE(utf_converter::from_utf8<char16_t>(continuation.data(), continuation.size()) == u"�z");
+
+        const char16_t loneSurrogate[] = {u'a', char16_t(0xD800), u'b'};
+        REQUIRE(utf_converter::to_utf8(loneSurrogate, 3) == std::string("a\xEF\xBF\xBD") + "b");
+    }
+}
+
+TEST_CASE("Wide strings") {
+    using namespace UtfConverterTests;
+    auto storage = make_storage({},
+                                make_table("messages",
+                                           make_column("id", &Message::id, primary_key()),
+                                           make_column("wide", &Message::wide),
+                                           make_column("utf16", &Message::utf16)));
+    storage.sync_schema();
+    storage.replace(Message{1, wideText, utf16Text});
+    storage.replace(Message{2, L"", u""});
+
+    auto message = storage.get<Message>(1);
+    REQUIRE(message.wide == wideText);
+    REQUIRE(message.utf16 == utf16Text);
+    REQUIRE(storage.get<Message>(2).wide.empty());
+    REQUIRE(storage.get<Message>(2).utf16.empty());
+
+    //  stored as regular UTF-8 text
+    auto text = storage.select(cast<std::string>(&Message::wide), where(c(&Message::id) == 1));
+    REQUIRE(text == std::vector<std::string>{utf8Text});
+    text = storage.select(cast<std::string>(&Message::utf16), where(c(&Message::id) == 1));
+    REQUIRE(text == std::vector<std::string>{utf8Text});
+
+    REQUIRE(storage.count<Message>(where(c(&Message::wide) == wideText)) == 1);
+    REQUIRE(storage.count<Message>(where(c(&Message::utf16) == utf16Text)) == 1);
+    REQUIRE(storage.count<Message>(where(c(&Message::utf16) == wideText.c_str())) == 1);
+    REQUIRE(storage.count<Message>(where(c(&Message::wide) == utf16Text.c_str())) == 1);
+}
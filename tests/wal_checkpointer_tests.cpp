@@ -0,0 +1,123 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <cstdio>  //  remove
+#include <thread>  //  std::this_thread::sleep_for
+#include <chrono>  //  std::chrono::milliseconds
+
+using namespace sqlite_orm;
+
+namespace WalCheckpointerTests {
+    struct Item {
+        int id = 0;
+        std::string value;
+    };
+
+    inline auto initStorage(const std::string &filename) {
+        return make_storage(filename,
+                            make_table("items",
+                                       make_column("id", &Item::id, primary_key()),
+                                       make_column("value", &Item::value)));
+    }
+
+    template<class F>
+    bool waitFor(const F &f) {
+        for(auto i = 0; i < 500; ++i) {
+            if(f()) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return false;
+    }
+}
+
+TEST_CASE("WAL checkpointer") {
+    using namespace WalCheckpointerTests;
+    auto filename = "wal_checkpointer.sqlite";
+    ::remove(filename);
+    auto storage = initStorage(filename);
+    storage.set_connection_lifetime(connection_lifetime::always_open);
+    storage.sync_schema();
+
+    SECTION("frames trigger") {
+        wal_checkpointer_options options;
+        options.wal_frames = 10;
+        options.interval = std::chrono::milliseconds(0);
+        storage.start_wal_checkpointer(options);
+        REQUIRE(storage.pragma.journal_mode() == journal_mode::WAL);
+        REQUIRE(storage.wal_checkpointer_stats().checkpoints_count == 0);
+        for(auto i = 0; i < 50; ++i) {
+            storage.insert(Item{0, std::string(1000, 'a')});
+        }
+        REQUIRE(waitFor([&storage] {
+            return storage.wal_checkpointer_stats().checkpoints_count > 0;
+        }));
+        auto stats = storage.wal_checkpointer_stats();
+        REQUIRE(stats.errors_count == 0);
+        REQUIRE(stats.total_checkpointed_frames > 0);
+        REQUIRE(stats.last_log_frames >= stats.last_checkpointed_frames);
+        REQUIRE(stats.max_duration >= stats.last_duration);
+        REQUIRE(stats.total_duration >= stats.max_duration);
+        REQUIRE(storage.count<Item>() == 50);
+    }
+    SECTION("interval trigger") {
+        wal_checkpointer_options options;
+        options.wal_frames = 0;
+        options.interval = std::chrono::milliseconds(20);
+        options.mode = checkpoint_mode::TRUNCATE;
+        storage.start_wal_checkpointer(options);
+        storage.insert(Item{0, "value"});
+        REQUIRE(waitFor([&storage] {
+            auto stats = storage.wal_checkpointer_stats();
+            return stats.checkpoints_count >= 2 && stats.last_log_frames == 0;
+        }));
+    }
+    SECTION("manual checkpoint") {
+        wal_checkpointer_options options;
+        options.wal_frames = 0;
+        options.interval = std::chrono::milliseconds(0);
+        storage.start_wal_checkpointer(options);
+        for(auto i = 0; i < 5; ++i) {
+            storage.insert(Item{0, "value"});
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        REQUIRE(storage.wal_checkpointer_stats().checkpoints_count == 0);
+        storage.wal_checkpoint();
+        auto stats = storage.wal_checkpointer_stats();
+        REQUIRE(stats.checkpoints_count == 1);
+        REQUIRE(stats.last_checkpointed_frames == stats.last_log_frames);
+        REQUIRE(stats.last_log_frames > 0);
+    }
+    SECTION("restart escalation") {
+        wal_checkpointer_options options;
+        options.wal_frames = 0;
+        options.interval = std::chrono::milliseconds(0);
+        options.restart_wal_frames = 1;
+        storage.start_wal_checkpointer(options);
+        for(auto i = 0; i < 5; ++i) {
+            storage.insert(Item{0, std::string(1000, 'a')});
+        }
+        storage.wal_checkpoint();
+        auto stats = storage.wal_checkpointer_stats();
+        REQUIRE(stats.restarts_count == 0);
+        auto logFrames = stats.last_log_frames;
+        REQUIRE(logFrames > 1);
+        storage.wal_checkpoint();
+        stats = storage.wal_checkpointer_stats();
+        REQUIRE(stats.restarts_count == 1);
+        REQUIRE(stats.busy_count == 0);
+
+        //  the next writer starts WAL from the beginning
+        storage.insert(Item{0, "value"});
+        storage.wal_checkpoint();
+        stats = storage.wal_checkpointer_stats();
+        REQUIRE(stats.last_log_frames < logFrames);
+    }
+    SECTION("stop") {
+        storage.start_wal_checkpointer();
+        storage.stop_wal_checkpointer();
+        REQUIRE(storage.wal_checkpointer_stats().checkpoints_count == 0);
+        storage.insert(Item{0, "value"});
+        REQUIRE(storage.count<Item>() == 1);
+    }
+}
@@ -0,0 +1,157 @@
+#include <sqlite_orm/sqlite_orm.h>
+#include <catch2/catch.hpp>
+#include <thread>  //  std::thread
+#include <vector>  //  std::vector
+#include <future>  //  std::future, std::promise
+#include <cstdio>  //  ::remove
+#include <string>  //  std::string
+#include <algorithm>  //  std::sort, std::unique
+
+using namespace sqlite_orm;
+
+TEST_CASE("Write queue") {
+    struct User {
+        int id = 0;
+        std::string name;
+    };
+    auto storage = make_storage(
+        {},
+        make_table("users", make_column("id", &User::id, primary_key()), make_column("name", &User::name, unique())));
+    storage.sync_schema();
+
+    SECTION("not started") {
+        REQUIRE_THROWS_AS(storage.enqueue_insert(User{0, "user"}), std::system_error);
+        REQUIRE(storage.write_queue_commits_count() == 0);
+    }
+    SECTION("many threads") {
+        storage.start_write_queue();
+        REQUIRE(storage.statement_cache_enabled());
+        const auto threadsCount = 8;
+        const auto writesPerThread = 100;
+        std::vector<std::thread> threads;
+        std::vector<std::vector<std::future<int64>>> futures(threadsCount);
+        for(auto t = 0; t < threadsCount; ++t) {
+            threads.emplace_back([&storage, &futures, t] {
+                for(auto i = 0; i < writesPerThread; ++i) {
+                    auto name = "user" + std::to_string(t) + "_" + std::to_string(i);
+                    futures[t].push_back(storage.enqueue_insert(User{0, name}));
+                }
+            });
+        }
+        for(auto &thread: threads) {
+            thread.join();
+        }
+        std::vector<int64> ids;
+        for(auto &threadFutures: futures) {
+            for(auto &future: threadFutures) {
+                ids.push_back(future.get());
+            }
+        }
+        std::sort(ids.begin(), ids.end());
+        REQUIRE(std::unique(ids.begin(), ids.end()) == ids.end());
+        REQUIRE(storage.write_queue_writes_count() == threadsCount * writesPerThread);
+        REQUIRE(storage.write_queue_commits_count() >= 1);
+        REQUIRE(storage.write_queue_commits_count() <= threadsCount * writesPerThread);
+        storage.stop_write_queue();
+        REQUIRE(storage.count<User>() == threadsCount * writesPerThread);
+    }
+    SECTION("failed write doesn't affect others") {
+        storage.start_write_queue();
+        auto first = storage.enqueue_insert(User{0, "first"});
+        auto duplicate = storage.enqueue_insert(User{0, "first"});
+        auto second = storage.enqueue_insert(User{0, "second"});
+        REQUIRE(first.get() == 1);
+        REQUIRE_THROWS_AS(duplicate.get(), std::system_error);
+        REQUIRE(second.get() == 2);
+        storage.stop_write_queue();
+        REQUIRE(storage.count<User>() == 2);
+    }
+    SECTION("failed write of several statements is rolled back") {
+        storage.start_write_queue();
+        std::promise<void> unblock;
+        auto unblocked = unblock.get_future().share();
+        auto blocker = storage.enqueue_write([unblocked] {
+            unblocked.wait();
+            return int64(0);
+        });
+        auto first = storage.enqueue_insert(User{0, "first"});
+        auto pair = storage.enqueue_write([&storage] {
+            storage.insert(User{0, "pair"});
+            return storage.insert(User{0, "first"});
+        });
+        auto second = storage.enqueue_insert(User{0, "second"});
+        unblock.set_value();
+        REQUIRE(blocker.get() == 0);
+        REQUIRE(first.get() > 0);
+        REQUIRE_THROWS_AS(pair.get(), std::system_error);
+        REQUIRE(second.get() > 0);
+        storage.stop_write_queue();
+        auto names = storage.select(&User::name, order_by(&User::id));
+        REQUIRE(names == std::vector<std::string>{"first", "second"});
+    }
+    SECTION("write which rolls back the transaction") {
+        auto filename = "write_queue_rollback.sqlite";
+        ::remove(filename);
+        auto fileStorage = make_storage(filename,
+                                        make_table("users",
+                                                   make_column("id", &User::id, primary_key()),
+                                                   make_column("name", &User::name, unique())));
+        fileStorage.sync_schema();
+        {
+            sqlite3 *db = nullptr;
+            sqlite3_open(filename, &db);
+            REQUIRE(sqlite3_exec(db,
+                                 "CREATE TRIGGER users_rollback BEFORE INSERT ON users WHEN NEW.name = 'rollback' "
+                                 "BEGIN SELECT RAISE(ROLLBACK, 'rolled back'); END",
+                                 nullptr,
+                                 nullptr,
+                                 nullptr) == SQLITE_OK);
+            sqlite3_close(db);
+        }
+        fileStorage.start_write_queue();
+
+        //  keeps the writer busy so the next writes are executed in a single batch
+        std::promise<void> started;
+        std::promise<void> unblock;
+        auto unblocked = unblock.get_future().share();
+        auto blocker = fileStorage.enqueue_write([&started, unblocked] {
+            started.set_value();
+            unblocked.wait();
+            return int64(0);
+        });
+        started.get_future().wait();
+        auto first = fileStorage.enqueue_insert(User{0, "first"});
+        auto rollback = fileStorage.enqueue_insert(User{0, "rollback"});
+        auto second = fileStorage.enqueue_insert(User{0, "second"});
+        unblock.set_value();
+
+        REQUIRE(blocker.get() == 0);
+        REQUIRE_THROWS_AS(first.get(), std::system_error);
+        REQUIRE_THROWS_AS(rollback.get(), std::system_error);
+        REQUIRE(second.get() > 0);
+        fileStorage.stop_write_queue();
+        auto names = fileStorage.select(&User::name);
+        REQUIRE(names == std::vector<std::string>{"second"});
+        REQUIRE_FALSE(fileStorage.in_transaction());
+    }
+    SECTION("replace, update and remove") {
+        storage.start_write_queue();
+        REQUIRE(storage.enqueue_replace(User{5, "five"}).get() == 5);
+        REQUIRE(storage.enqueue_update(User{5, "updated"}).get() == 1);
+        REQUIRE(storage.get<User>(5).name == "updated");
+        REQUIRE(storage.enqueue_remove<User>(5).get() == 1);
+        REQUIRE(storage.enqueue_remove<User>(5).get() == 0);
+        REQUIRE(storage.enqueue_write([] {
+                    return int64(42);
+                }).get() == 42);
+    }
+    SECTION("stop executes enqueued writes") {
+        storage.start_write_queue(write_queue_options{10});
+        for(auto i = 0; i < 100; ++i) {
+            storage.enqueue_insert(User{0, "user" + std::to_string(i)});
+        }
+        storage.stop_write_queue();
+        REQUIRE(storage.count<User>() == 100);
+        REQUIRE_THROWS_AS(storage.enqueue_insert(User{0, "user"}), std::system_error);
+    }
+}